@@ -0,0 +1,65 @@
+use criterion::BenchmarkId;
+use criterion::Criterion;
+use criterion::Throughput;
+use criterion::{criterion_group, criterion_main};
+use russell_lab::{mat_inverse, mat_mat_mul, mat_vec_mul};
+use russell_lab::{Matrix, Vector};
+
+// The sizes include the crossover between the native code and BLAS/LAPACK
+// (MAX_DIM_FOR_NATIVE_MAT_MAT_MUL, MAX_DIM_FOR_NATIVE_MAT_VEC_MUL, and MAX_DIM_FOR_NATIVE_MAT_INVERSE)
+const SIZES: [usize; 12] = [2, 3, 4, 5, 6, 8, 9, 10, 12, 13, 16, 32];
+
+/// Returns a diagonally dominant matrix
+fn sample_matrix(n: usize) -> Matrix {
+    let mut a = Matrix::new(n, n);
+    for i in 0..n {
+        for j in 0..n {
+            a.set(i, j, if i == j { 5.0 } else { 1.0 / (1 + i + j) as f64 });
+        }
+    }
+    a
+}
+
+fn bench_mat_mat_mul(c: &mut Criterion) {
+    let mut group = c.benchmark_group("mat_mat_mul");
+    for size in &SIZES {
+        group.throughput(Throughput::Elements(*size as u64));
+        group.bench_with_input(BenchmarkId::from_parameter(size), size, |b, &size| {
+            let a = sample_matrix(size);
+            let bb = sample_matrix(size);
+            let mut cc = Matrix::new(size, size);
+            b.iter(|| mat_mat_mul(&mut cc, 1.0, &a, &bb, 0.0).unwrap());
+        });
+    }
+    group.finish();
+}
+
+fn bench_mat_vec_mul(c: &mut Criterion) {
+    let mut group = c.benchmark_group("mat_vec_mul");
+    for size in &SIZES {
+        group.throughput(Throughput::Elements(*size as u64));
+        group.bench_with_input(BenchmarkId::from_parameter(size), size, |b, &size| {
+            let a = sample_matrix(size);
+            let u = Vector::filled(size, 1.0);
+            let mut v = Vector::new(size);
+            b.iter(|| mat_vec_mul(&mut v, 1.0, &a, &u).unwrap());
+        });
+    }
+    group.finish();
+}
+
+fn bench_mat_inverse(c: &mut Criterion) {
+    let mut group = c.benchmark_group("mat_inverse");
+    for size in &SIZES {
+        group.throughput(Throughput::Elements(*size as u64));
+        group.bench_with_input(BenchmarkId::from_parameter(size), size, |b, &size| {
+            let a = sample_matrix(size);
+            let mut ai = Matrix::new(size, size);
+            b.iter(|| mat_inverse(&mut ai, &a).unwrap());
+        });
+    }
+    group.finish();
+}
+
+criterion_group!(benches, bench_mat_mat_mul, bench_mat_vec_mul, bench_mat_inverse);
+criterion_main!(benches);
@@ -0,0 +1,55 @@
+use criterion::BenchmarkId;
+use criterion::Criterion;
+use criterion::Throughput;
+use criterion::{criterion_group, criterion_main};
+use russell_lab::{math, StrError, Vector};
+
+// Run with:
+//
+//     cargo bench --bench special_functions_benchmark
+
+/// Defines the number of arguments
+const SIZES: [usize; 3] = [64, 4096, 262144];
+
+/// Defines a scalar function and its slice version
+type Pair = (
+    &'static str,
+    fn(f64) -> f64,
+    fn(&mut [f64], &[f64]) -> Result<(), StrError>,
+    f64,
+    f64,
+);
+
+/// Holds the functions and the range of arguments
+const FUNCTIONS: [Pair; 5] = [
+    ("erf", math::erf, math::erf_slice, -1.2, 1.2),
+    ("erf_inv", math::erf_inv, math::erf_inv_slice, -0.8, 0.8),
+    ("bessel_j0", math::bessel_j0, math::bessel_j0_slice, 0.01, 1.99),
+    ("bessel_j1", math::bessel_j1, math::bessel_j1_slice, 0.01, 1.99),
+    ("gamma", math::gamma, math::gamma_slice, 1.0, 7.9),
+];
+
+fn bench_special_functions(c: &mut Criterion) {
+    for (name, scalar, slice, start, stop) in FUNCTIONS {
+        let mut group = c.benchmark_group(name);
+        for size in SIZES {
+            let x = Vector::linspace(start, stop, size).unwrap();
+            let mut y = Vector::new(size);
+            group.throughput(Throughput::Elements(size as u64));
+            group.bench_function(BenchmarkId::new("scalar", size), |b| {
+                b.iter(|| {
+                    for i in 0..size {
+                        y[i] = scalar(x[i]);
+                    }
+                });
+            });
+            group.bench_function(BenchmarkId::new("slice", size), |b| {
+                b.iter(|| slice(y.as_mut_data(), x.as_data()).unwrap());
+            });
+        }
+        group.finish();
+    }
+}
+
+criterion_group!(benches, bench_special_functions);
+criterion_main!(benches);
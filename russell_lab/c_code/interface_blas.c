@@ -398,3 +398,82 @@ void c_zgetri(const int32_t *n,
               int32_t *info) {
     FN_ZGETRI(n, a, lda, ipiv, work, lwork, info);
 }
+
+// Solves a batch of linear systems a[i] ⋅ x[i] = b[i] with (n,n) matrices stored contiguously (strided)
+// Uses dgetrf_batch_strided and dgetrs_batch_strided with Intel MKL; otherwise, calls dgesv for each matrix
+// ipiv must have size n * batch_size and info must have size batch_size
+void c_dgesv_batch_strided(const int32_t *n,
+                           double *a,
+                           const int32_t *stride_a,
+                           int32_t *ipiv,
+                           double *b,
+                           const int32_t *stride_b,
+                           const int32_t *batch_size,
+                           int32_t *info) {
+    const int32_t nrhs = 1;
+    int32_t i;
+#ifdef USE_INTEL_MKL
+    dgetrf_batch_strided(n, n, a, n, stride_a, ipiv, n, batch_size, info);
+    for (i = 0; i < *batch_size; i++) {
+        if (info[i] != 0) {
+            return;
+        }
+    }
+    dgetrs_batch_strided("N", n, &nrhs, a, n, stride_a, ipiv, n, b, n, stride_b, batch_size, info);
+#else
+    for (i = 0; i < *batch_size; i++) {
+        FN_DGESV(n, &nrhs, &a[i * (*stride_a)], n, &ipiv[i * (*n)], &b[i * (*stride_b)], n, &info[i]);
+        if (info[i] != 0) {
+            return;
+        }
+    }
+#endif
+}
+
+// Performs a batch of matrix-matrix multiplications c[i] := α a[i] ⋅ b[i] + β c[i] (strided; col-major)
+// Uses cblas_dgemm_batch_strided with Intel MKL; otherwise, calls cblas_dgemm for each matrix
+void c_dgemm_batch_strided(int32_t m,
+                           int32_t n,
+                           int32_t k,
+                           double alpha,
+                           const double *a,
+                           int32_t stride_a,
+                           const double *b,
+                           int32_t stride_b,
+                           double beta,
+                           double *c,
+                           int32_t stride_c,
+                           int32_t batch_size) {
+#ifdef USE_INTEL_MKL
+    cblas_dgemm_batch_strided(CblasColMajor, CblasNoTrans, CblasNoTrans, m, n, k,
+                              alpha, a, m, stride_a, b, k, stride_b, beta, c, m, stride_c, batch_size);
+#else
+    int32_t i;
+    for (i = 0; i < batch_size; i++) {
+        cblas_dgemm(CblasColMajor, CblasNoTrans, CblasNoTrans, m, n, k,
+                    alpha, &a[i * stride_a], m, &b[i * stride_b], k, beta, &c[i * stride_c], m);
+    }
+#endif
+}
+
+// Computes the eigenvalues and eigenvectors of a batch of symmetric (n,n) matrices stored contiguously (strided)
+// Calls dsyev for each matrix, sharing the workspace (there is no batched dsyev in LAPACK or Intel MKL)
+// info must have size batch_size; the loop stops at the first failure
+void c_dsyev_batch_strided(C_BOOL upper,
+                           const int32_t *n,
+                           double *a,
+                           const int32_t *stride_a,
+                           double *w,
+                           double *work,
+                           const int32_t *lwork,
+                           const int32_t *batch_size,
+                           int32_t *info) {
+    const char *uplo = upper == C_TRUE ? "U" : "L";
+    int32_t i;
+    for (i = 0; i < *batch_size; i++) {
+        FN_DSYEV("V", uplo, n, &a[i * (*stride_a)], n, &w[i * (*n)], work, lwork, &info[i]);
+        if (info[i] != 0) {
+            return;
+        }
+    }
+}
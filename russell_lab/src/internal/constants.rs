@@ -1,6 +1,17 @@
 /// Defines the vector size to decide when to use the native Rust code or BLAS
 pub(crate) const MAX_DIM_FOR_NATIVE_BLAS: usize = 16;
 
+/// Defines the matrix dimension (m, n, and k) to decide when to use the native Rust code or BLAS in mat_mat_mul
+///
+/// The crossover values (here and below) have been obtained with `benches/small_matrix_benchmark.rs`.
+pub(crate) const MAX_DIM_FOR_NATIVE_MAT_MAT_MUL: usize = 4;
+
+/// Defines the matrix dimension (m and n) to decide when to use the native Rust code or BLAS in mat_vec_mul
+pub(crate) const MAX_DIM_FOR_NATIVE_MAT_VEC_MUL: usize = 9;
+
+/// Defines the matrix dimension to decide when to use the native Rust code or LAPACK in mat_inverse
+pub(crate) const MAX_DIM_FOR_NATIVE_MAT_INVERSE: usize = 12;
+
 // -------------------------------------------------------------------------------------------
 // IMPORTANT: The constants below must match the corresponding C-code constants in constants.h
 
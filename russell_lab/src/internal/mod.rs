@@ -3,8 +3,10 @@
 mod add_arrays;
 mod constants;
 mod dgeev_data;
+mod native_mat_kernels;
 mod to_i32;
 pub(crate) use crate::internal::add_arrays::*;
 pub(crate) use crate::internal::constants::*;
 pub(crate) use crate::internal::dgeev_data::*;
+pub(crate) use crate::internal::native_mat_kernels::*;
 pub(crate) use crate::internal::to_i32::*;
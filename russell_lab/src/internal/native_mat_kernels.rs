@@ -0,0 +1,313 @@
+use super::MAX_DIM_FOR_NATIVE_MAT_INVERSE;
+use crate::StrError;
+
+/// Performs the matrix-matrix multiplication of small (col-major) matrices natively
+///
+/// **Note:** This is an internal function used by `mat_mat_mul` (`m, n, k ≤ MAX_DIM_FOR_NATIVE_MAT_MAT_MUL`).
+///
+/// ```text
+///   c  :=  α  a   ⋅   b   +  β  c
+/// (m,n)     (m,k)   (k,n)     (m,n)
+/// ```
+///
+/// Each column of `c` is computed as a linear combination of the (contiguous) columns of `a`; thus, the
+/// innermost loop is vectorized. The square dimensions 2, 3, and 4 (common in tensor calculations)
+/// are compiled with constant sizes so that the loops are fully unrolled. As in BLAS, `c` is not read if `β = 0`.
+#[inline]
+pub(crate) fn native_mat_mat_mul(
+    c: &mut [f64],
+    alpha: f64,
+    a: &[f64],
+    b: &[f64],
+    beta: f64,
+    m: usize,
+    n: usize,
+    k: usize,
+) {
+    match (m, n, k) {
+        (2, 2, 2) => mat_mat_mul_kernel(c, alpha, a, b, beta, 2, 2, 2),
+        (3, 3, 3) => mat_mat_mul_kernel(c, alpha, a, b, beta, 3, 3, 3),
+        (4, 4, 4) => mat_mat_mul_kernel(c, alpha, a, b, beta, 4, 4, 4),
+        _ => mat_mat_mul_kernel(c, alpha, a, b, beta, m, n, k),
+    }
+}
+
+/// Performs the matrix-vector multiplication of a small (col-major) matrix natively
+///
+/// **Note:** This is an internal function used by `mat_vec_mul` (`m, n ≤ MAX_DIM_FOR_NATIVE_MAT_VEC_MUL`).
+///
+/// ```text
+///  v  :=  α ⋅  a   ⋅  u
+/// (m)        (m,n)   (n)
+/// ```
+///
+/// The result is computed as a linear combination of the (contiguous) columns of `a`; the square
+/// dimensions 2, 3, 4, and 6 are compiled with constant sizes (unrolled loops).
+#[inline]
+pub(crate) fn native_mat_vec_mul(v: &mut [f64], alpha: f64, a: &[f64], u: &[f64], m: usize, n: usize) {
+    match (m, n) {
+        (2, 2) => mat_vec_mul_kernel(v, alpha, a, u, 2, 2),
+        (3, 3) => mat_vec_mul_kernel(v, alpha, a, u, 3, 3),
+        (4, 4) => mat_vec_mul_kernel(v, alpha, a, u, 4, 4),
+        (6, 6) => mat_vec_mul_kernel(v, alpha, a, u, 6, 6),
+        _ => mat_vec_mul_kernel(v, alpha, a, u, m, n),
+    }
+}
+
+/// Computes the inverse of a small (col-major) square matrix natively and returns its determinant
+///
+/// **Note:** This is an internal function used by `mat_inverse` (`m ≤ MAX_DIM_FOR_NATIVE_MAT_INVERSE`).
+///
+/// The LU factorization with partial pivoting (as in dgetf2) is computed in a local (stack) array; then,
+/// the columns of the inverse are obtained by forward and backward substitutions. Each dimension is
+/// compiled with a constant size because the loops are too short to be efficient otherwise.
+pub(crate) fn native_mat_inverse(ai: &mut [f64], a: &[f64], m: usize) -> Result<f64, StrError> {
+    assert!(m <= MAX_DIM_FOR_NATIVE_MAT_INVERSE);
+    assert_eq!(a.len(), m * m);
+    assert_eq!(ai.len(), m * m);
+    match m {
+        4 => mat_inverse_kernel(ai, a, 4),
+        5 => mat_inverse_kernel(ai, a, 5),
+        6 => mat_inverse_kernel(ai, a, 6),
+        7 => mat_inverse_kernel(ai, a, 7),
+        8 => mat_inverse_kernel(ai, a, 8),
+        9 => mat_inverse_kernel(ai, a, 9),
+        10 => mat_inverse_kernel(ai, a, 10),
+        11 => mat_inverse_kernel(ai, a, 11),
+        12 => mat_inverse_kernel(ai, a, 12),
+        _ => mat_inverse_kernel(ai, a, m),
+    }
+}
+
+/// Implements the matrix inversion (inlined in each specialization with constant sizes)
+#[inline(always)]
+fn mat_inverse_kernel(ai: &mut [f64], a: &[f64], m: usize) -> Result<f64, StrError> {
+    // LU factorization: P ⋅ a = L ⋅ U (row i of P ⋅ a is the row perm[i] of a)
+    let mut lu = [0.0; MAX_DIM_FOR_NATIVE_MAT_INVERSE * MAX_DIM_FOR_NATIVE_MAT_INVERSE];
+    let mut perm = [0; MAX_DIM_FOR_NATIVE_MAT_INVERSE];
+    lu[..(m * m)].copy_from_slice(a);
+    for i in 0..m {
+        perm[i] = i;
+    }
+    let mut det = 1.0;
+    for p in 0..m {
+        let mut r = p;
+        let mut largest = f64::abs(lu[p + p * m]);
+        for i in (p + 1)..m {
+            let value = f64::abs(lu[i + p * m]);
+            if value > largest {
+                largest = value;
+                r = i;
+            }
+        }
+        if largest == 0.0 {
+            // same error as the LAPACK path (dgetrf) of mat_inverse
+            return Err(
+                "LAPACK ERROR (dgetrf): The factorization has been completed, but the factor U is exactly singular",
+            );
+        }
+        if r != p {
+            for j in 0..m {
+                lu.swap(p + j * m, r + j * m);
+            }
+            perm.swap(p, r);
+            det = -det;
+        }
+        let pivot = lu[p + p * m];
+        det *= pivot;
+        let inv_pivot = 1.0 / pivot;
+        for i in (p + 1)..m {
+            lu[i + p * m] *= inv_pivot;
+        }
+        for j in (p + 1)..m {
+            let s = lu[p + j * m];
+            if s != 0.0 {
+                for i in (p + 1)..m {
+                    lu[i + j * m] -= lu[i + p * m] * s;
+                }
+            }
+        }
+    }
+
+    // solve L ⋅ U ⋅ x = P ⋅ e_j for each column x of the inverse
+    for j in 0..m {
+        let x = &mut ai[(j * m)..((j + 1) * m)];
+        for i in 0..m {
+            x[i] = if perm[i] == j { 1.0 } else { 0.0 };
+        }
+        for p in 0..m {
+            let s = x[p];
+            if s != 0.0 {
+                for i in (p + 1)..m {
+                    x[i] -= lu[i + p * m] * s;
+                }
+            }
+        }
+        for p in (0..m).rev() {
+            x[p] /= lu[p + p * m];
+            let s = x[p];
+            if s != 0.0 {
+                for i in 0..p {
+                    x[i] -= lu[i + p * m] * s;
+                }
+            }
+        }
+    }
+    Ok(det)
+}
+
+/// Implements the matrix-matrix multiplication (inlined in each specialization with constant sizes)
+#[inline(always)]
+fn mat_mat_mul_kernel(c: &mut [f64], alpha: f64, a: &[f64], b: &[f64], beta: f64, m: usize, n: usize, k: usize) {
+    let (a, b, c) = (&a[..(m * k)], &b[..(k * n)], &mut c[..(m * n)]);
+    for j in 0..n {
+        let cj = &mut c[(j * m)..((j + 1) * m)];
+        if beta == 0.0 {
+            cj.fill(0.0);
+        } else if beta != 1.0 {
+            for i in 0..m {
+                cj[i] *= beta;
+            }
+        }
+        for l in 0..k {
+            let s = alpha * b[l + j * k];
+            let al = &a[(l * m)..((l + 1) * m)];
+            for i in 0..m {
+                cj[i] += s * al[i];
+            }
+        }
+    }
+}
+
+/// Implements the matrix-vector multiplication (inlined in each specialization with constant sizes)
+#[inline(always)]
+fn mat_vec_mul_kernel(v: &mut [f64], alpha: f64, a: &[f64], u: &[f64], m: usize, n: usize) {
+    let (v, a, u) = (&mut v[..m], &a[..(m * n)], &u[..n]);
+    v.fill(0.0);
+    for j in 0..n {
+        let s = alpha * u[j];
+        let aj = &a[(j * m)..((j + 1) * m)];
+        for i in 0..m {
+            v[i] += s * aj[i];
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#[cfg(test)]
+mod tests {
+    use super::{native_mat_inverse, native_mat_mat_mul, native_mat_vec_mul};
+    use crate::{array_approx_eq, MAX_DIM_FOR_NATIVE_MAT_INVERSE};
+
+    /// Returns a (col-major) m×n matrix with "arbitrary" entries
+    fn sample_matrix(m: usize, n: usize, shift: f64) -> Vec<f64> {
+        (0..(m * n))
+            .map(|p| f64::sin(1.0 + shift + p as f64) + if p % (m + 1) == 0 { 3.0 } else { 0.0 })
+            .collect()
+    }
+
+    #[test]
+    fn native_mat_mat_mul_works() {
+        for (m, n, k) in [
+            (1, 1, 1),
+            (2, 2, 2),
+            (3, 3, 3),
+            (4, 4, 4),
+            (6, 6, 6),
+            (2, 3, 4),
+            (5, 1, 7),
+            (7, 6, 5),
+        ] {
+            let a = sample_matrix(m, k, 0.0);
+            let b = sample_matrix(k, n, 1.0);
+            for (alpha, beta) in [(1.0, 0.0), (2.0, 1.0), (-0.5, 3.0)] {
+                let mut c = sample_matrix(m, n, 2.0);
+                let mut correct = vec![0.0; m * n];
+                for i in 0..m {
+                    for j in 0..n {
+                        let mut sum = 0.0;
+                        for l in 0..k {
+                            sum += a[i + l * m] * b[l + j * k];
+                        }
+                        correct[i + j * m] = alpha * sum + beta * c[i + j * m];
+                    }
+                }
+                native_mat_mat_mul(&mut c, alpha, &a, &b, beta, m, n, k);
+                array_approx_eq(&c, &correct, 1e-14);
+            }
+        }
+        // c is not read if β = 0
+        let mut c = vec![f64::NAN; 4];
+        native_mat_mat_mul(&mut c, 1.0, &[1.0, 0.0, 0.0, 1.0], &[1.0, 2.0, 3.0, 4.0], 0.0, 2, 2, 2);
+        assert_eq!(c, &[1.0, 2.0, 3.0, 4.0]);
+    }
+
+    #[test]
+    fn native_mat_vec_mul_works() {
+        for (m, n) in [(1, 1), (2, 2), (3, 3), (4, 4), (6, 6), (2, 5), (7, 3)] {
+            let a = sample_matrix(m, n, 0.0);
+            let u = sample_matrix(n, 1, 1.0);
+            let mut correct = vec![0.0; m];
+            for i in 0..m {
+                for j in 0..n {
+                    correct[i] += 0.5 * a[i + j * m] * u[j];
+                }
+            }
+            let mut v = vec![f64::NAN; m];
+            native_mat_vec_mul(&mut v, 0.5, &a, &u, m, n);
+            array_approx_eq(&v, &correct, 1e-15);
+        }
+    }
+
+    #[test]
+    fn native_mat_inverse_captures_errors() {
+        #[rustfmt::skip]
+        let a = [
+            1.0, 2.0, 0.0, 1.0,
+            2.0, 4.0, 0.0, 2.0,
+            0.0, 0.0, 1.0, 0.0,
+            3.0, 1.0, 0.0, 1.0,
+        ];
+        let mut ai = vec![0.0; 16];
+        assert_eq!(
+            native_mat_inverse(&mut ai, &a, 4).err(),
+            Some("LAPACK ERROR (dgetrf): The factorization has been completed, but the factor U is exactly singular")
+        );
+    }
+
+    #[test]
+    fn native_mat_inverse_works() {
+        for m in 1..(MAX_DIM_FOR_NATIVE_MAT_INVERSE + 1) {
+            let a = sample_matrix(m, m, 0.0);
+            let mut ai = vec![0.0; m * m];
+            native_mat_inverse(&mut ai, &a, m).unwrap();
+            let mut a_ai = vec![0.0; m * m];
+            native_mat_mat_mul(&mut a_ai, 1.0, &a, &ai, 0.0, m, m, m);
+            let mut identity = vec![0.0; m * m];
+            for i in 0..m {
+                identity[i + i * m] = 1.0;
+            }
+            array_approx_eq(&a_ai, &identity, 1e-13);
+        }
+        // requires pivoting (and the determinant changes sign)
+        #[rustfmt::skip]
+        let a = [
+            0.0, 1.0, 0.0, 0.0,
+            1.0, 0.0, 0.0, 0.0,
+            0.0, 0.0, 2.0, 0.0,
+            0.0, 0.0, 0.0, 4.0,
+        ];
+        let mut ai = vec![0.0; 16];
+        let det = native_mat_inverse(&mut ai, &a, 4).unwrap();
+        assert_eq!(det, -8.0);
+        #[rustfmt::skip]
+        let correct = [
+            0.0, 1.0, 0.0, 0.0,
+            1.0, 0.0, 0.0, 0.0,
+            0.0, 0.0, 0.5, 0.0,
+            0.0, 0.0, 0.0, 0.25,
+        ];
+        assert_eq!(ai, &correct);
+    }
+}
@@ -71,6 +71,8 @@
 //! * Matrix addition ([mat_add()]), multiplication ([mat_mat_mul()], [mat_t_mat_mul()]), copy ([mat_copy()]), singular-value decomposition ([mat_svd()]), eigenvalues ([mat_eigen()], [mat_eigen_sym()]), pseudo-inverse ([mat_pseudo_inverse()]), inverse ([mat_inverse()]), norms ([mat_norm()]), and more
 //! * Matrix-vector multiplication ([mat_vec_mul()])
 //! * Solution of dense linear systems with symmetric ([mat_cholesky()]) or non-symmetric ([solve_lin_sys()]) coefficient matrices
+//! * Workspace-reusing variants of LAPACK wrappers for repeated calls with matrices of the same dimension ([EigenSymWorkspace], [SvdWorkspace], [LuWorkspace])
+//! * Batched operations on many small matrices of the same dimension, packed contiguously ([solve_lin_sys_batch()], [mat_mat_mul_batch()], [mat_eigen_sym_batch()])
 //!
 //! The `russell_lab` functions are higher-level than the BLAS/LAPACK counterparts, thus losing some of the generality of BLAS/LAPACK. Each BLAS/LAPACK function wrapped by `russell_lab` is carefully documented and thoroughly tested.
 //!
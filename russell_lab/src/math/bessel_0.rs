@@ -1,4 +1,6 @@
+use super::lanes::{all_abs_in, map_slice, LANES};
 use super::{PI, SQRT_PI};
+use crate::StrError;
 
 // This implementation is based on j0.go file from Go (1.22.1),
 // which, in turn, is based on the FreeBSD code as explained below.
@@ -459,11 +461,53 @@ fn qzero(x: f64) -> f64 {
     (-0.125 + r / s) / x
 }
 
+/// Evaluates the Bessel function J0(x) over a slice
+///
+/// ```text
+/// y[i] := J0(x[i])
+/// ```
+///
+/// The arguments are evaluated in groups; if all arguments of a group fall in `2⁻¹³ ≤ |x| < 2`,
+/// a branch-free version of the rational approximation is used (suitable for SIMD).
+/// Otherwise, [bessel_j0()] is called. The results are identical to [bessel_j0()].
+///
+/// # Examples
+///
+/// ```
+/// use russell_lab::{approx_eq, math, StrError, Vector};
+///
+/// fn main() -> Result<(), StrError> {
+///     let x = Vector::linspace(0.0, 10.0, 11)?;
+///     let mut y = Vector::new(11);
+///     math::bessel_j0_slice(y.as_mut_data(), x.as_data())?;
+///     approx_eq(y[2], 0.22389077914123567, 1e-15);
+///     Ok(())
+/// }
+/// ```
+pub fn bessel_j0_slice(y: &mut [f64], x: &[f64]) -> Result<(), StrError> {
+    map_slice(y, x, bessel_j0, |x, y| {
+        if all_abs_in(x, TWO_M13, 2.0) {
+            for i in 0..LANES {
+                let z = x[i] * x[i];
+                let r = z * (R02 + z * (R03 + z * (R04 + z * R05)));
+                let s = 1.0 + z * (S01 + z * (S02 + z * (S03 + z * S04)));
+                let u = 0.5 * f64::abs(x[i]);
+                let small = 1.0 + z * (-0.25 + (r / s));
+                let large = (1.0 + u) * (1.0 - u) + z * (r / s);
+                y[i] = if f64::abs(x[i]) < 1.0 { small } else { large };
+            }
+            true
+        } else {
+            false
+        }
+    })
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #[cfg(test)]
 mod tests {
-    use super::{bessel_j0, bessel_y0, pzero, qzero, TWO_129};
+    use super::{bessel_j0, bessel_j0_slice, bessel_y0, pzero, qzero, TWO_129};
     use crate::{approx_eq, assert_alike};
 
     #[test]
@@ -698,4 +742,20 @@ mod tests {
             assert_alike(SC_SOLUTION_Y0[i], f);
         }
     }
+
+    #[test]
+    fn bessel_j0_slice_works() {
+        let mut y = [0.0; 2];
+        assert_eq!(bessel_j0_slice(&mut y, &[0.0]).err(), Some("arrays are incompatible"));
+        let mut x = Vec::new();
+        for i in 0..=400 {
+            x.push(-4.0 + 0.02 * (i as f64));
+        }
+        x.extend_from_slice(&[1e-5, 1e-10, 0.999, 1.0, -1.0, 2.0, 1e30, f64::NAN, f64::INFINITY]);
+        let mut y = vec![0.0; x.len()];
+        bessel_j0_slice(&mut y, &x).unwrap();
+        for i in 0..x.len() {
+            assert_alike(y[i], bessel_j0(x[i]));
+        }
+    }
 }
@@ -1,4 +1,6 @@
+use super::lanes::{all_abs_in, map_slice, LANES};
 use super::{PI, SQRT_PI, TWO_129, TWO_M27};
+use crate::StrError;
 
 // This implementation is based on j1.go file from Go (1.22.1),
 // which, in turn, is based on the FreeBSD code as explained below.
@@ -462,11 +464,36 @@ fn qone(x: f64) -> f64 {
     (0.375 + r / s) / x
 }
 
+/// Evaluates the Bessel function J1(x) over a slice
+///
+/// ```text
+/// y[i] := J1(x[i])
+/// ```
+///
+/// The arguments are evaluated in groups; if all arguments of a group fall in `2⁻²⁷ ≤ |x| < 2`,
+/// a branch-free version of the rational approximation is used (suitable for SIMD).
+/// Otherwise, [bessel_j1()] is called. The results are identical to [bessel_j1()].
+pub fn bessel_j1_slice(y: &mut [f64], x: &[f64]) -> Result<(), StrError> {
+    map_slice(y, x, bessel_j1, |x, y| {
+        if all_abs_in(x, TWO_M27, 2.0) {
+            for i in 0..LANES {
+                let z = x[i] * x[i];
+                let r = z * (R00 + z * (R01 + z * (R02 + z * R03))) * x[i];
+                let s = 1.0 + z * (S01 + z * (S02 + z * (S03 + z * (S04 + z * S05))));
+                y[i] = 0.5 * x[i] + r / s;
+            }
+            true
+        } else {
+            false
+        }
+    })
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #[cfg(test)]
 mod tests {
-    use super::{bessel_j1, bessel_y1, pone, qone, TWO_129, TWO_M54};
+    use super::{bessel_j1, bessel_j1_slice, bessel_y1, pone, qone, TWO_129, TWO_M54};
     use crate::{approx_eq, assert_alike};
 
     #[test]
@@ -709,4 +736,20 @@ mod tests {
             assert_alike(SC_SOLUTION_Y1[i], f);
         }
     }
+
+    #[test]
+    fn bessel_j1_slice_works() {
+        let mut y = [0.0; 2];
+        assert_eq!(bessel_j1_slice(&mut y, &[0.0]).err(), Some("arrays are incompatible"));
+        let mut x = Vec::new();
+        for i in 0..=400 {
+            x.push(-4.0 + 0.02 * (i as f64));
+        }
+        x.extend_from_slice(&[1e-5, 1e-10, -1e-10, 2.0, -2.0, 1e30, f64::NAN, f64::INFINITY]);
+        let mut y = vec![0.0; x.len()];
+        bessel_j1_slice(&mut y, &x).unwrap();
+        for i in 0..x.len() {
+            assert_alike(y[i], bessel_j1(x[i]));
+        }
+    }
 }
@@ -1,4 +1,6 @@
-use super::{bessel_j0, bessel_j1, bessel_y0, bessel_y1, SQRT_PI};
+use super::lanes::map_slice;
+use super::{bessel_j0, bessel_j0_slice, bessel_j1, bessel_j1_slice, bessel_y0, bessel_y1, SQRT_PI};
+use crate::StrError;
 
 // This implementation is based on j1.go file from Go (1.22.1),
 // which, in turn, is based on the FreeBSD code as explained below.
@@ -356,11 +358,35 @@ pub fn bessel_yn(n: i32, x: f64) -> f64 {
     }
 }
 
+/// Evaluates the Bessel function Jn(x) over a slice
+///
+/// ```text
+/// y[i] := Jn(n, x[i])
+/// ```
+///
+/// **Note:** The branch-free kernels of [bessel_j0_slice()] and [bessel_j1_slice()] are used with `n = 0` and `n = 1`.
+pub fn bessel_jn_slice(y: &mut [f64], n: i32, x: &[f64]) -> Result<(), StrError> {
+    match n {
+        0 => bessel_j0_slice(y, x),
+        1 => bessel_j1_slice(y, x),
+        _ => map_slice(y, x, |v| bessel_jn(n, v), |_, _| false),
+    }
+}
+
+/// Evaluates the Bessel function Yn(x) over a slice
+///
+/// ```text
+/// y[i] := Yn(n, x[i])
+/// ```
+pub fn bessel_yn_slice(y: &mut [f64], n: i32, x: &[f64]) -> Result<(), StrError> {
+    map_slice(y, x, |v| bessel_yn(n, v), |_, _| false)
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #[cfg(test)]
 mod tests {
-    use super::{bessel_jn, bessel_yn, TWO_302};
+    use super::{bessel_jn, bessel_jn_slice, bessel_yn, bessel_yn_slice, TWO_302};
     use crate::{approx_eq, assert_alike};
 
     #[test]
@@ -750,4 +776,33 @@ mod tests {
         // (0, 0)
         assert_alike(f64::NEG_INFINITY, bessel_yn(0, 0.0));
     }
+
+    #[test]
+    fn bessel_jn_slice_and_yn_slice_work() {
+        let mut y = [0.0; 2];
+        assert_eq!(
+            bessel_jn_slice(&mut y, 2, &[0.0]).err(),
+            Some("arrays are incompatible")
+        );
+        assert_eq!(
+            bessel_yn_slice(&mut y, 2, &[0.0]).err(),
+            Some("arrays are incompatible")
+        );
+        let mut x = Vec::new();
+        for i in 0..=100 {
+            x.push(-5.0 + 0.1 * (i as f64));
+        }
+        x.extend_from_slice(&[0.0, 1e-10, 30.0, f64::NAN, f64::INFINITY]);
+        let mut y = vec![0.0; x.len()];
+        for n in [-3, -1, 0, 1, 2, 5] {
+            bessel_jn_slice(&mut y, n, &x).unwrap();
+            for i in 0..x.len() {
+                assert_alike(y[i], bessel_jn(n, x[i]));
+            }
+            bessel_yn_slice(&mut y, n, &x).unwrap();
+            for i in 0..x.len() {
+                assert_alike(y[i], bessel_yn(n, x[i]));
+            }
+        }
+    }
 }
@@ -531,11 +531,45 @@ const RC_C2: f64 = 1.0 / 7.0;
 const RC_C3: f64 = 0.375;
 const RC_C4: f64 = 9.0 / 22.0;
 
+/// Computes the elliptic integral of the first kind F(φ, m) over a slice of φ values
+///
+/// ```text
+/// y[i] := F(phi[i], m)
+/// ```
+///
+/// See [elliptic_f()] for the requirements on φ and m. The first error found is returned.
+pub fn elliptic_f_slice(y: &mut [f64], phi: &[f64], m: f64) -> Result<(), StrError> {
+    if y.len() != phi.len() {
+        return Err("arrays are incompatible");
+    }
+    for (yi, p) in y.iter_mut().zip(phi) {
+        *yi = elliptic_f(*p, m)?;
+    }
+    Ok(())
+}
+
+/// Computes the elliptic integral of the second kind E(φ, m) over a slice of φ values
+///
+/// ```text
+/// y[i] := E(phi[i], m)
+/// ```
+///
+/// See [elliptic_e()] for the requirements on φ and m. The first error found is returned.
+pub fn elliptic_e_slice(y: &mut [f64], phi: &[f64], m: f64) -> Result<(), StrError> {
+    if y.len() != phi.len() {
+        return Err("arrays are incompatible");
+    }
+    for (yi, p) in y.iter_mut().zip(phi) {
+        *yi = elliptic_e(*p, m)?;
+    }
+    Ok(())
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #[cfg(test)]
 mod tests {
-    use super::{elliptic_e, elliptic_f, elliptic_pi, rc, rd, rf, rj};
+    use super::{elliptic_e, elliptic_e_slice, elliptic_f, elliptic_f_slice, elliptic_pi, rc, rd, rf, rj};
     use crate::approx_eq;
     use crate::math::PI;
 
@@ -899,4 +933,35 @@ mod tests {
             1e-50,
         ); // Mathematica: N[EllipticPi[1/2, 3/4], 50]
     }
+
+    #[test]
+    fn elliptic_f_slice_and_e_slice_work() {
+        let mut y = [0.0; 2];
+        assert_eq!(
+            elliptic_f_slice(&mut y, &[0.0], 0.5).err(),
+            Some("arrays are incompatible")
+        );
+        assert_eq!(
+            elliptic_e_slice(&mut y, &[0.0], 0.5).err(),
+            Some("arrays are incompatible")
+        );
+        assert_eq!(
+            elliptic_f_slice(&mut y, &[0.0, -1.0], 0.5).err(),
+            Some("phi and m must be non-negative")
+        );
+        assert_eq!(
+            elliptic_e_slice(&mut y, &[0.0, -1.0], 0.5).err(),
+            Some("phi and m must be non-negative")
+        );
+        let phi = [0.0, PI / 8.0, PI / 4.0, PI / 2.0];
+        let mut y = [0.0; 4];
+        elliptic_f_slice(&mut y, &phi, 0.5).unwrap();
+        for i in 0..phi.len() {
+            assert_eq!(y[i], elliptic_f(phi[i], 0.5).unwrap());
+        }
+        elliptic_e_slice(&mut y, &phi, 0.5).unwrap();
+        for i in 0..phi.len() {
+            assert_eq!(y[i], elliptic_e(phi[i], 0.5).unwrap());
+        }
+    }
 }
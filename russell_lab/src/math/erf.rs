@@ -112,6 +112,9 @@
 //              erfc(0) = 1, erfc(inf) = 0, erfc(-inf) = 2,
 //              erfc/erf(NaN) is NaN
 
+use super::lanes::{all_abs_in, map_slice, LANES};
+use crate::StrError;
+
 const ERX: f64 = 8.45062911510467529297e-01; // 0x3FEB0AC160000000
 
 // coefficients for approximation to  erf in [0, 0.84375]
@@ -396,11 +399,85 @@ pub fn erfc(x: f64) -> f64 {
     return 0.0;
 }
 
+/// Evaluates the error function over a slice
+///
+/// ```text
+/// y[i] := erf(x[i])
+/// ```
+///
+/// The arguments are evaluated in groups; if all arguments of a group fall in `2⁻²⁸ ≤ |x| < 0.84375`
+/// or `0.84375 ≤ |x| < 1.25`, a branch-free version of the corresponding rational approximation is used
+/// (suitable for SIMD). Otherwise, [erf()] is called. The results are identical to [erf()].
+///
+/// # Examples
+///
+/// ```
+/// use russell_lab::{approx_eq, math, StrError};
+///
+/// fn main() -> Result<(), StrError> {
+///     let x = [-0.5, 0.0, 0.5, 1.0, 2.0];
+///     let mut y = [0.0; 5];
+///     math::erf_slice(&mut y, &x)?;
+///     for i in 0..x.len() {
+///         approx_eq(y[i], math::erf(x[i]), 1e-15);
+///     }
+///     Ok(())
+/// }
+/// ```
+pub fn erf_slice(y: &mut [f64], x: &[f64]) -> Result<(), StrError> {
+    map_slice(y, x, erf, |x, y| {
+        if all_abs_in(x, SMALL, 0.84375) {
+            for i in 0..LANES {
+                let z = x[i] * x[i];
+                let r = PP0 + z * (PP1 + z * (PP2 + z * (PP3 + z * PP4)));
+                let s = 1.0 + z * (QQ1 + z * (QQ2 + z * (QQ3 + z * (QQ4 + z * QQ5))));
+                y[i] = x[i] + x[i] * (r / s);
+            }
+            true
+        } else if all_abs_in(x, 0.84375, 1.25) {
+            for i in 0..LANES {
+                let s = f64::abs(x[i]) - 1.0;
+                let pp = PA0 + s * (PA1 + s * (PA2 + s * (PA3 + s * (PA4 + s * (PA5 + s * PA6)))));
+                let qq = 1.0 + s * (QA1 + s * (QA2 + s * (QA3 + s * (QA4 + s * (QA5 + s * QA6)))));
+                y[i] = f64::copysign(ERX + pp / qq, x[i]);
+            }
+            true
+        } else {
+            false
+        }
+    })
+}
+
+/// Evaluates the complementary error function over a slice
+///
+/// ```text
+/// y[i] := erfc(x[i])
+/// ```
+///
+/// The arguments are evaluated in groups; if all arguments of a group fall in `2⁻⁵⁶ ≤ |x| < 0.25`,
+/// a branch-free version of the rational approximation is used (suitable for SIMD).
+/// Otherwise, [erfc()] is called. The results are identical to [erfc()].
+pub fn erfc_slice(y: &mut [f64], x: &[f64]) -> Result<(), StrError> {
+    map_slice(y, x, erfc, |x, y| {
+        if all_abs_in(x, TINY, 0.25) {
+            for i in 0..LANES {
+                let z = x[i] * x[i];
+                let r = PP0 + z * (PP1 + z * (PP2 + z * (PP3 + z * PP4)));
+                let s = 1.0 + z * (QQ1 + z * (QQ2 + z * (QQ3 + z * (QQ4 + z * QQ5))));
+                y[i] = 1.0 - (x[i] + x[i] * (r / s));
+            }
+            true
+        } else {
+            false
+        }
+    })
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #[cfg(test)]
 mod tests {
-    use super::{erf, erfc};
+    use super::{erf, erf_slice, erfc, erfc_slice};
     use crate::{approx_eq, assert_alike};
 
     #[test]
@@ -833,4 +910,31 @@ mod tests {
             assert_alike(SC_SOLUTION_ERFC[i], f);
         }
     }
+
+    #[test]
+    fn erf_slice_and_erfc_slice_capture_errors() {
+        let mut y = [0.0; 2];
+        assert_eq!(erf_slice(&mut y, &[0.0]).err(), Some("arrays are incompatible"));
+        assert_eq!(erfc_slice(&mut y, &[0.0]).err(), Some("arrays are incompatible"));
+    }
+
+    #[test]
+    fn erf_slice_and_erfc_slice_work() {
+        // uniform groups (fast kernels), mixed groups, special values, and remainder
+        let mut x = Vec::new();
+        for i in 0..400 {
+            x.push(-10.0 + 0.05 * (i as f64));
+        }
+        x.extend_from_slice(&[0.1, 0.2, -0.3, 0.24, 0.9, -1.0, 1.1, 1.2, 1e-10, 1e-20, 0.0, -0.0]);
+        x.extend_from_slice(&[f64::NAN, f64::INFINITY, f64::NEG_INFINITY]);
+        let mut y = vec![0.0; x.len()];
+        erf_slice(&mut y, &x).unwrap();
+        for i in 0..x.len() {
+            assert_alike(y[i], erf(x[i]));
+        }
+        erfc_slice(&mut y, &x).unwrap();
+        for i in 0..x.len() {
+            assert_alike(y[i], erfc(x[i]));
+        }
+    }
 }
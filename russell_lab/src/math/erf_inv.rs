@@ -1,4 +1,6 @@
+use super::lanes::{all_abs_in, map_slice, LANES};
 use super::LN2;
+use crate::StrError;
 
 // This implementation is based on erfinv.go file from Go (1.22.1),
 // which, in turn, is based on the code described below.
@@ -171,11 +173,36 @@ pub fn erfc_inv(x: f64) -> f64 {
     erf_inv(1.0 - x)
 }
 
+/// Evaluates the inverse error function over a slice
+///
+/// ```text
+/// y[i] := erf_inv(x[i])
+/// ```
+///
+/// The arguments are evaluated in groups; if all arguments of a group fall in `|x| < 0.85`,
+/// a branch-free version of the rational approximation is used (suitable for SIMD).
+/// Otherwise, [erf_inv()] is called. The results are identical to [erf_inv()].
+pub fn erf_inv_slice(y: &mut [f64], x: &[f64]) -> Result<(), StrError> {
+    map_slice(y, x, erf_inv, |x, y| {
+        if all_abs_in(x, 0.0, 0.85) {
+            for i in 0..LANES {
+                let r = 0.180625 - 0.25 * x[i] * x[i];
+                let z1 = ((((((A7 * r + A6) * r + A5) * r + A4) * r + A3) * r + A2) * r + A1) * r + A0;
+                let z2 = ((((((B7 * r + B6) * r + B5) * r + B4) * r + B3) * r + B2) * r + B1) * r + B0;
+                y[i] = (x[i] * z1) / z2;
+            }
+            true
+        } else {
+            false
+        }
+    })
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #[cfg(test)]
 mod tests {
-    use super::{erf_inv, erfc_inv};
+    use super::{erf_inv, erf_inv_slice, erfc_inv};
     use crate::math::{erf, erfc};
     use crate::{approx_eq, assert_alike};
 
@@ -399,4 +426,20 @@ mod tests {
             x += dx;
         }
     }
+
+    #[test]
+    fn erf_inv_slice_works() {
+        let mut y = [0.0; 2];
+        assert_eq!(erf_inv_slice(&mut y, &[0.0]).err(), Some("arrays are incompatible"));
+        let mut x = Vec::new();
+        for i in 0..=200 {
+            x.push(-1.0 + 0.01 * (i as f64));
+        }
+        x.extend_from_slice(&[0.0, -0.0, 0.85, -0.85, 1e-300, 2.0, f64::NAN]);
+        let mut y = vec![0.0; x.len()];
+        erf_inv_slice(&mut y, &x).unwrap();
+        for i in 0..x.len() {
+            assert_alike(y[i], erf_inv(x[i]));
+        }
+    }
 }
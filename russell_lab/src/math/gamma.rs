@@ -1,4 +1,6 @@
+use super::lanes::{all_in, map_slice, LANES};
 use super::{float_is_neg_integer, EULER, PI};
+use crate::StrError;
 
 // This implementation is based on gamma.go file from Go (1.22.1),
 // which, in turn, is based on the code described below.
@@ -209,11 +211,59 @@ pub fn gamma(x: f64) -> f64 {
     z * pp / qq
 }
 
+/// Evaluates the Gamma function Γ(x) over a slice
+///
+/// ```text
+/// y[i] := Γ(x[i])
+/// ```
+///
+/// The arguments are evaluated in groups; if all arguments of a group fall in `1 ≤ x < 8`,
+/// the argument reduction is performed in lockstep (with masks instead of branches) and followed
+/// by the rational approximation (suitable for SIMD). Otherwise, [gamma()] is called.
+/// The results are identical to [gamma()].
+pub fn gamma_slice(y: &mut [f64], x: &[f64]) -> Result<(), StrError> {
+    map_slice(y, x, gamma, |x, y| {
+        if !all_in(x, 1.0, 8.0) {
+            return false;
+        }
+        // reduce argument to [2, 3)
+        let mut xx = *x;
+        let mut z = [1.0; LANES];
+        loop {
+            let mut active = false;
+            for i in 0..LANES {
+                let mask = xx[i] >= 3.0;
+                active |= mask;
+                let t = xx[i] - 1.0;
+                xx[i] = if mask { t } else { xx[i] };
+                z[i] = if mask { z[i] * t } else { z[i] };
+            }
+            if !active {
+                break;
+            }
+        }
+        for i in 0..LANES {
+            let mask = xx[i] < 2.0;
+            z[i] = if mask { z[i] / xx[i] } else { z[i] };
+            xx[i] = if mask { xx[i] + 1.0 } else { xx[i] };
+        }
+        // results
+        for i in 0..LANES {
+            let t = xx[i] - 2.0;
+            let pp = (((((t * GP[0] + GP[1]) * t + GP[2]) * t + GP[3]) * t + GP[4]) * t + GP[5]) * t + GP[6];
+            let qq =
+                ((((((t * GQ[0] + GQ[1]) * t + GQ[2]) * t + GQ[3]) * t + GQ[4]) * t + GQ[5]) * t + GQ[6]) * t + GQ[7];
+            y[i] = if xx[i] == 2.0 { z[i] } else { z[i] * pp / qq };
+        }
+        true
+    })
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #[cfg(test)]
 mod tests {
-    use super::gamma;
+    use super::{gamma, gamma_slice};
     use crate::math::PI;
     use crate::{approx_eq, assert_alike};
 
@@ -389,4 +439,20 @@ mod tests {
             };
         }
     }
+
+    #[test]
+    fn gamma_slice_works() {
+        let mut y = [0.0; 2];
+        assert_eq!(gamma_slice(&mut y, &[0.0]).err(), Some("arrays are incompatible"));
+        let mut x = Vec::new();
+        for i in 0..=400 {
+            x.push(1.0 + 0.08 * (i as f64)); // up to 33
+        }
+        x.extend_from_slice(&[2.0, 3.0, 4.0, 5.0, -0.5, 0.5, 1e-10, 40.0, -2.0, 0.0, f64::NAN]);
+        let mut y = vec![0.0; x.len()];
+        gamma_slice(&mut y, &x).unwrap();
+        for i in 0..x.len() {
+            assert_alike(y[i], gamma(x[i]));
+        }
+    }
 }
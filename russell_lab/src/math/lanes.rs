@@ -0,0 +1,113 @@
+use crate::StrError;
+
+/// Defines the number of arguments evaluated together by the slice functions
+///
+/// Four f64 values fill a 256-bit register (e.g., AVX2).
+pub(crate) const LANES: usize = 4;
+
+/// Evaluates `y[i] = f(x[i])` over slices, trying a branch-free kernel on each group of LANES arguments
+///
+/// The `kernel` receives a group of arguments and must return `false` (without having to write anything)
+/// if the group is not entirely inside the region of the (branch-free) approximation. In this case,
+/// or for the remaining `len % LANES` arguments, the `scalar` function is called instead.
+///
+/// The kernels are written with fixed-size loops and no data-dependent branches so that the
+/// compiler can map them to SIMD instructions.
+#[inline(always)]
+pub(crate) fn map_slice<S, K>(y: &mut [f64], x: &[f64], scalar: S, kernel: K) -> Result<(), StrError>
+where
+    S: Fn(f64) -> f64,
+    K: Fn(&[f64; LANES], &mut [f64; LANES]) -> bool,
+{
+    if y.len() != x.len() {
+        return Err("arrays are incompatible");
+    }
+    let mut y_chunks = y.chunks_exact_mut(LANES);
+    let mut x_chunks = x.chunks_exact(LANES);
+    for (yy, xx) in (&mut y_chunks).zip(&mut x_chunks) {
+        let xx: &[f64; LANES] = xx.try_into().unwrap();
+        let yy: &mut [f64; LANES] = yy.try_into().unwrap();
+        if !kernel(xx, yy) {
+            for i in 0..LANES {
+                yy[i] = scalar(xx[i]);
+            }
+        }
+    }
+    for (yi, xi) in y_chunks.into_remainder().iter_mut().zip(x_chunks.remainder()) {
+        *yi = scalar(*xi);
+    }
+    Ok(())
+}
+
+/// Returns true if all arguments satisfy `lower ≤ |x| < upper` (NaN fails)
+#[inline(always)]
+pub(crate) fn all_abs_in(x: &[f64; LANES], lower: f64, upper: f64) -> bool {
+    let mut ok = true;
+    for i in 0..LANES {
+        let a = f64::abs(x[i]);
+        ok &= a >= lower && a < upper;
+    }
+    ok
+}
+
+/// Returns true if all arguments satisfy `lower ≤ x < upper` (NaN fails)
+#[inline(always)]
+pub(crate) fn all_in(x: &[f64; LANES], lower: f64, upper: f64) -> bool {
+    let mut ok = true;
+    for i in 0..LANES {
+        ok &= x[i] >= lower && x[i] < upper;
+    }
+    ok
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#[cfg(test)]
+mod tests {
+    use super::{all_abs_in, all_in, map_slice, LANES};
+
+    #[test]
+    fn map_slice_captures_errors() {
+        let mut y = vec![0.0; 2];
+        assert_eq!(
+            map_slice(&mut y, &[1.0], |x| x, |_, _| false).err(),
+            Some("arrays are incompatible")
+        );
+    }
+
+    #[test]
+    fn map_slice_works() {
+        // kernel accepting only the groups with positive values (and marking them with a negative sign)
+        let kernel = |x: &[f64; LANES], y: &mut [f64; LANES]| {
+            if !all_abs_in(x, 0.0, f64::MAX) || x.iter().any(|v| *v <= 0.0) {
+                return false;
+            }
+            for i in 0..LANES {
+                y[i] = -x[i];
+            }
+            true
+        };
+        let x = [1.0, 2.0, 3.0, 4.0, -5.0, 6.0, 7.0, 8.0, 9.0, 10.0];
+        let mut y = vec![0.0; x.len()];
+        map_slice(&mut y, &x, |v| 10.0 * v, kernel).unwrap();
+        assert_eq!(y, &[-1.0, -2.0, -3.0, -4.0, -50.0, 60.0, 70.0, 80.0, 90.0, 100.0]);
+        let mut empty: [f64; 0] = [];
+        map_slice(&mut empty, &[], |v| v, kernel).unwrap();
+    }
+
+    #[test]
+    fn all_abs_in_works() {
+        assert!(all_abs_in(&[-1.0, -0.5, 0.5, 1.0], 0.5, 1.5));
+        assert!(!all_abs_in(&[-1.0, -0.5, 0.4, 1.0], 0.5, 1.5));
+        assert!(!all_abs_in(&[-1.0, -0.5, 0.5, 1.5], 0.5, 1.5));
+        assert!(!all_abs_in(&[-1.0, f64::NAN, 0.5, 1.0], 0.5, 1.5));
+    }
+
+    #[test]
+    fn all_in_works() {
+        assert!(all_in(&[0.5, 0.6, 1.0, 1.4], 0.5, 1.5));
+        assert!(!all_in(&[-1.0, 0.6, 1.0, 1.4], 0.5, 1.5));
+        assert!(!all_in(&[0.5, 0.6, 1.0, 1.5], 0.5, 1.5));
+        assert!(!all_in(&[0.5, f64::NAN, 1.0, 1.4], 0.5, 1.5));
+    }
+}
@@ -1,4 +1,6 @@
+use super::lanes::map_slice;
 use super::{modulo, PI};
+use crate::StrError;
 
 // This implementation is based on gamma.go file from Go (1.22.1),
 // which, in turn, is based on the code described below.
@@ -398,11 +400,22 @@ fn sin_pi_times_neg_x_given_abs_x(abs_x: f64) -> f64 {
     }
 }
 
+/// Evaluates the natural logarithm of |Γ(x)| over a slice
+///
+/// ```text
+/// y[i] := ln(|Γ(x[i])|)
+/// ```
+///
+/// **Note:** The sign of Γ(x) returned by [ln_gamma()] is discarded (it is always positive for `x > 0`).
+pub fn ln_gamma_slice(y: &mut [f64], x: &[f64]) -> Result<(), StrError> {
+    map_slice(y, x, |v| ln_gamma(v).0, |_, _| false)
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #[cfg(test)]
 mod tests {
-    use super::{ln_gamma, sin_pi_times_neg_x_given_abs_x, TINY, TWO_52, TWO_53, TWO_58, Y_MIN};
+    use super::{ln_gamma, ln_gamma_slice, sin_pi_times_neg_x_given_abs_x, TINY, TWO_52, TWO_53, TWO_58, Y_MIN};
     use crate::math::{ONE_BY_3, PI};
     use crate::{approx_eq, assert_alike};
 
@@ -639,4 +652,16 @@ mod tests {
             assert_eq!(SC_SOLUTION[i].i, s);
         }
     }
+
+    #[test]
+    fn ln_gamma_slice_works() {
+        let mut y = [0.0; 2];
+        assert_eq!(ln_gamma_slice(&mut y, &[0.0]).err(), Some("arrays are incompatible"));
+        let x = [-2.5, -0.5, 0.0, 0.5, 1.0, 1.5, 2.0, 10.0, 1e20];
+        let mut y = vec![0.0; x.len()];
+        ln_gamma_slice(&mut y, &x).unwrap();
+        for i in 0..x.len() {
+            assert_alike(y[i], ln_gamma(x[i]).0);
+        }
+    }
 }
@@ -14,6 +14,7 @@ mod erf;
 mod erf_inv;
 mod functions;
 mod gamma;
+mod lanes;
 mod ln_gamma;
 mod modulo;
 pub use crate::math::bessel_0::*;
@@ -0,0 +1,191 @@
+use super::Matrix;
+use crate::{to_i32, CcBool, StrError, Vector, C_FALSE, C_TRUE};
+
+extern "C" {
+    // Computes the eigenvalues and eigenvectors of a symmetric matrix
+    // <https://netlib.org/lapack/explore-html/dd/d4c/dsyev_8f.html>
+    fn c_dsyev(
+        calc_v: CcBool,
+        upper: CcBool,
+        n: *const i32,
+        a: *mut f64,
+        lda: *const i32,
+        w: *mut f64,
+        work: *mut f64,
+        lwork: *const i32,
+        info: *mut i32,
+    );
+}
+
+/// Holds the workspace for the eigen-decomposition of symmetric matrices of the same dimension (dsyev)
+///
+/// The optimal size of the workspace is obtained once by a workspace query (lwork = -1) in [EigenSymWorkspace::new()].
+/// Afterwards, [EigenSymWorkspace::calc()] may be called many times without allocating memory.
+///
+/// See also: [crate::mat_eigen_sym()]
+///
+/// # Examples
+///
+/// ```
+/// use russell_lab::{vec_approx_eq, EigenSymWorkspace, Matrix, Vector, StrError};
+///
+/// fn main() -> Result<(), StrError> {
+///     let mut workspace = EigenSymWorkspace::new(2)?;
+///     let mut l = Vector::new(2);
+///     for d in [1.0, 2.0, 3.0] {
+///         let mut a = Matrix::from(&[[2.0 * d, d], [d, 2.0 * d]]);
+///         workspace.calc(&mut l, &mut a, false)?;
+///         vec_approx_eq(&l, &[d, 3.0 * d], 1e-14);
+///     }
+///     Ok(())
+/// }
+/// ```
+pub struct EigenSymWorkspace {
+    /// Holds the dimension of the matrices
+    m: usize,
+
+    /// Holds the workspace array
+    work: Vec<f64>,
+}
+
+impl EigenSymWorkspace {
+    /// Allocates a new instance (performs the workspace query)
+    ///
+    /// # Input
+    ///
+    /// * `m` -- dimension of the (square) matrices
+    pub fn new(m: usize) -> Result<Self, StrError> {
+        if m == 0 {
+            return Err("matrix dimension must be ≥ 1");
+        }
+        let n_i32 = to_i32(m);
+        let lda = n_i32;
+        let lwork = -1;
+        let mut a_dummy = [0.0];
+        let mut w_dummy = [0.0];
+        let mut work_query = [0.0];
+        let mut info = 0;
+        unsafe {
+            c_dsyev(
+                C_TRUE,
+                C_FALSE,
+                &n_i32,
+                a_dummy.as_mut_ptr(),
+                &lda,
+                w_dummy.as_mut_ptr(),
+                work_query.as_mut_ptr(),
+                &lwork,
+                &mut info,
+            );
+        }
+        if info != 0 {
+            return Err("LAPACK ERROR (dsyev): workspace query failed");
+        }
+        let lwork_min = usize::max(1, 3 * m - 1);
+        let lwork_opt = usize::max(work_query[0] as usize, lwork_min);
+        Ok(EigenSymWorkspace {
+            m,
+            work: vec![0.0; lwork_opt],
+        })
+    }
+
+    /// (dsyev) Calculates the eigenvalues and eigenvectors of a symmetric matrix
+    ///
+    /// Computes the eigenvalues `l` and eigenvectors `v`, such that:
+    ///
+    /// ```text
+    /// A ⋅ vj = lj ⋅ vj
+    /// ```
+    ///
+    /// # Input
+    ///
+    /// * `A` -- (modified on exit) matrix to compute eigenvalues (SYMMETRIC and SQUARE)
+    /// * `upper` -- Whether the upper triangle of `A` must be considered instead
+    ///    of the lower triangle.
+    ///
+    /// # Output
+    ///
+    /// * `l` -- (lambda) will hold the eigenvalues
+    /// * `a` -- will hold the eigenvectors as columns
+    pub fn calc(&mut self, l: &mut Vector, a: &mut Matrix, upper: bool) -> Result<(), StrError> {
+        let (m, n) = a.dims();
+        if m != self.m || n != self.m {
+            return Err("matrix dimension is incompatible with the workspace");
+        }
+        if l.dim() != n {
+            return Err("l vector has incompatible dimension");
+        }
+        let c_upper = if upper { C_TRUE } else { C_FALSE };
+        let n_i32 = to_i32(n);
+        let lda = n_i32;
+        let lwork = to_i32(self.work.len());
+        let mut info = 0;
+        unsafe {
+            c_dsyev(
+                C_TRUE,
+                c_upper,
+                &n_i32,
+                a.as_mut_data().as_mut_ptr(),
+                &lda,
+                l.as_mut_data().as_mut_ptr(),
+                self.work.as_mut_ptr(),
+                &lwork,
+                &mut info,
+            );
+        }
+        if info < 0 {
+            println!("LAPACK ERROR (dsyev): Argument #{} had an illegal value", -info);
+            return Err("LAPACK ERROR (dsyev): An argument had an illegal value");
+        } else if info > 0 {
+            println!("LAPACK ERROR (dsyev): {} off-diagonal elements of an intermediate tri-diagonal form did not converge to zero", info - 1);
+            return Err("LAPACK ERROR (dsyev): The algorithm failed to converge");
+        }
+        Ok(())
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#[cfg(test)]
+mod tests {
+    use super::EigenSymWorkspace;
+    use crate::{mat_approx_eq, mat_eigen_sym, vec_approx_eq, Matrix, Vector};
+
+    #[test]
+    fn new_and_calc_capture_errors() {
+        assert_eq!(EigenSymWorkspace::new(0).err(), Some("matrix dimension must be ≥ 1"));
+        let mut workspace = EigenSymWorkspace::new(2).unwrap();
+        let mut a = Matrix::new(3, 3);
+        let mut l = Vector::new(3);
+        assert_eq!(
+            workspace.calc(&mut l, &mut a, false).err(),
+            Some("matrix dimension is incompatible with the workspace")
+        );
+        let mut a = Matrix::new(2, 2);
+        assert_eq!(
+            workspace.calc(&mut l, &mut a, false).err(),
+            Some("l vector has incompatible dimension")
+        );
+    }
+
+    #[test]
+    fn calc_works() {
+        let mut workspace = EigenSymWorkspace::new(3).unwrap();
+        let mut l = Vector::new(3);
+        let mut l_ref = Vector::new(3);
+        for shift in [0.0, 1.0, 10.0] {
+            #[rustfmt::skip]
+            let data = [
+                [2.0 + shift, 1.0,         0.5        ],
+                [1.0,         3.0 + shift, 4.0        ],
+                [0.5,         4.0,         9.0 + shift],
+            ];
+            let mut a = Matrix::from(&data);
+            let mut a_ref = Matrix::from(&data);
+            workspace.calc(&mut l, &mut a, false).unwrap();
+            mat_eigen_sym(&mut l_ref, &mut a_ref, false).unwrap();
+            vec_approx_eq(&l, l_ref.as_data(), 1e-13);
+            mat_approx_eq(&a, &a_ref, 1e-13);
+        }
+    }
+}
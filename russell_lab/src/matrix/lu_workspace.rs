@@ -0,0 +1,316 @@
+use super::{mat_copy, mat_inverse, Matrix};
+use crate::{to_i32, StrError, Vector};
+
+extern "C" {
+    // Computes the LU factorization of a general (m,n) matrix
+    /// <https://www.netlib.org/lapack/explore-html/d3/d6a/dgetrf_8f.html>
+    fn c_dgetrf(m: *const i32, n: *const i32, a: *mut f64, lda: *const i32, ipiv: *mut i32, info: *mut i32);
+
+    // Computes the inverse of a matrix using the LU factorization computed by dgetrf
+    /// <https://www.netlib.org/lapack/explore-html/df/da4/dgetri_8f.html>
+    fn c_dgetri(
+        n: *const i32,
+        a: *mut f64,
+        lda: *const i32,
+        ipiv: *const i32,
+        work: *mut f64,
+        lwork: *const i32,
+        info: *mut i32,
+    );
+
+    // Computes the solution to a system of linear equations
+    // <https://www.netlib.org/lapack/explore-html/d8/d72/dgesv_8f.html>
+    fn c_dgesv(
+        n: *const i32,
+        nrhs: *const i32,
+        a: *mut f64,
+        lda: *const i32,
+        ipiv: *mut i32,
+        b: *mut f64,
+        ldb: *const i32,
+        info: *mut i32,
+    );
+}
+
+/// Holds the workspace for the LU-based inverse and linear solver of square matrices of the same dimension (dgetrf, dgetri, dgesv)
+///
+/// The pivot indices and the optimal workspace of dgetri (obtained by a workspace query with lwork = -1)
+/// are allocated once in [LuWorkspace::new()]. Afterwards, [LuWorkspace::inverse()] and [LuWorkspace::solve()]
+/// may be called many times without allocating memory.
+///
+/// See also: [crate::mat_inverse()] and [crate::solve_lin_sys()]
+///
+/// # Examples
+///
+/// ```
+/// use russell_lab::{mat_approx_eq, vec_approx_eq, LuWorkspace, Matrix, Vector, StrError};
+///
+/// fn main() -> Result<(), StrError> {
+///     let mut workspace = LuWorkspace::new(4)?;
+///     let mut ai = Matrix::new(4, 4);
+///     for d in [1.0, 2.0, 4.0] {
+///         let a = Matrix::diagonal(&[d, 2.0 * d, 4.0 * d, 8.0 * d]);
+///         let det = workspace.inverse(&mut ai, &a)?;
+///         assert_eq!(det, 64.0 * d * d * d * d);
+///         mat_approx_eq(&ai, &Matrix::diagonal(&[1.0 / d, 0.5 / d, 0.25 / d, 0.125 / d]), 1e-15);
+///
+///         let mut a = a.clone();
+///         let mut b = Vector::from(&[d, 2.0 * d, 4.0 * d, 8.0 * d]);
+///         workspace.solve(&mut b, &mut a)?;
+///         vec_approx_eq(&b, &[1.0, 1.0, 1.0, 1.0], 1e-15);
+///     }
+///     Ok(())
+/// }
+/// ```
+pub struct LuWorkspace {
+    /// Holds the dimension of the matrices
+    m: usize,
+
+    /// Holds the pivot indices
+    ipiv: Vec<i32>,
+
+    /// Holds the workspace array of dgetri
+    work: Vec<f64>,
+}
+
+impl LuWorkspace {
+    /// Allocates a new instance (performs the workspace query)
+    ///
+    /// # Input
+    ///
+    /// * `m` -- dimension of the (square) matrices
+    pub fn new(m: usize) -> Result<Self, StrError> {
+        if m == 0 {
+            return Err("matrix dimension must be ≥ 1");
+        }
+        let m_i32 = to_i32(m);
+        let lda = m_i32;
+        let lwork = -1;
+        let mut a_dummy = [0.0];
+        let ipiv_dummy = [0];
+        let mut work_query = [0.0];
+        let mut info = 0;
+        unsafe {
+            c_dgetri(
+                &m_i32,
+                a_dummy.as_mut_ptr(),
+                &lda,
+                ipiv_dummy.as_ptr(),
+                work_query.as_mut_ptr(),
+                &lwork,
+                &mut info,
+            );
+        }
+        if info != 0 {
+            return Err("LAPACK ERROR (dgetri): workspace query failed");
+        }
+        let lwork_opt = usize::max(work_query[0] as usize, m);
+        Ok(LuWorkspace {
+            m,
+            ipiv: vec![0; m],
+            work: vec![0.0; lwork_opt],
+        })
+    }
+
+    /// (dgetrf, dgetri) Computes the inverse of a square matrix and returns its determinant
+    ///
+    /// ```text
+    /// ai := a⁻¹
+    /// ```
+    ///
+    /// **Note:** Matrices with m ≤ 3 are inverted by [crate::mat_inverse()] using closed-form expressions.
+    ///
+    /// # Output
+    ///
+    /// * `ai` -- (m,m) inverse matrix
+    /// * Returns the matrix determinant
+    ///
+    /// # Input
+    ///
+    /// * `a` -- (m,m) matrix, symmetric or not
+    pub fn inverse(&mut self, ai: &mut Matrix, a: &Matrix) -> Result<f64, StrError> {
+        let (m, n) = a.dims();
+        if m != self.m || n != self.m {
+            return Err("matrix dimension is incompatible with the workspace");
+        }
+        if m <= 3 {
+            return mat_inverse(ai, a);
+        }
+        if ai.nrow() != m || ai.ncol() != n {
+            return Err("matrices are incompatible");
+        }
+
+        // copy a into ai
+        mat_copy(ai, a).unwrap();
+
+        // compute LU factorization
+        let m_i32 = to_i32(m);
+        let lda = m_i32;
+        let mut info = 0;
+        unsafe {
+            c_dgetrf(
+                &m_i32,
+                &m_i32,
+                ai.as_mut_data().as_mut_ptr(),
+                &lda,
+                self.ipiv.as_mut_ptr(),
+                &mut info,
+            );
+        }
+        if info < 0 {
+            println!("LAPACK ERROR (dgetrf): Argument #{} had an illegal value", -info);
+            return Err("LAPACK ERROR (dgetrf): An argument had an illegal value");
+        } else if info > 0 {
+            println!("LAPACK ERROR (dgetrf): U({},{}) is exactly zero", info - 1, info - 1);
+            return Err(
+                "LAPACK ERROR (dgetrf): The factorization has been completed, but the factor U is exactly singular",
+            );
+        }
+
+        // first, compute the determinant ai.data from dgetrf
+        let mut det = 1.0;
+        for i in 0..m_i32 {
+            let iu = i as usize;
+            // NOTE: ipiv are 1-based indices
+            if self.ipiv[iu] - 1 == i {
+                det = det * ai.get(iu, iu);
+            } else {
+                det = -det * ai.get(iu, iu);
+            }
+        }
+
+        // second, perform the inversion
+        let lwork = to_i32(self.work.len());
+        unsafe {
+            c_dgetri(
+                &m_i32,
+                ai.as_mut_data().as_mut_ptr(),
+                &lda,
+                self.ipiv.as_ptr(),
+                self.work.as_mut_ptr(),
+                &lwork,
+                &mut info,
+            );
+        }
+        Ok(det)
+    }
+
+    /// (dgesv) Solves a general linear system (real numbers)
+    ///
+    /// ```text
+    ///   a   ⋅  x  =  b
+    /// (m,m)   (m)   (m)
+    /// ```
+    ///
+    /// However, the right-hand-side will hold the solution:
+    ///
+    /// ```text
+    /// b := a⁻¹⋅b == x
+    /// ```
+    ///
+    /// # Note
+    ///
+    /// 1. The matrix `a` will be modified
+    /// 2. The right-hand-side `b` will contain the solution `x`
+    pub fn solve(&mut self, b: &mut Vector, a: &mut Matrix) -> Result<(), StrError> {
+        let (m, n) = a.dims();
+        if m != self.m || n != self.m {
+            return Err("matrix dimension is incompatible with the workspace");
+        }
+        if b.dim() != m {
+            return Err("vector has wrong dimension");
+        }
+        let m_i32 = to_i32(m);
+        let lda = m_i32;
+        let ldb = m_i32;
+        let nrhs = 1;
+        let mut info = 0;
+        unsafe {
+            c_dgesv(
+                &m_i32,
+                &nrhs,
+                a.as_mut_data().as_mut_ptr(),
+                &lda,
+                self.ipiv.as_mut_ptr(),
+                b.as_mut_data().as_mut_ptr(),
+                &ldb,
+                &mut info,
+            );
+        }
+        if info < 0 {
+            println!("LAPACK ERROR (dgesv): Argument #{} had an illegal value", -info);
+            return Err("LAPACK ERROR (dgesv): An argument had an illegal value");
+        } else if info > 0 {
+            println!("LAPACK ERROR (dgesv): U({},{}) is exactly zero", info - 1, info - 1);
+            return Err(
+                "LAPACK ERROR (dgesv): The factorization has been completed, but the factor U is exactly singular",
+            );
+        }
+        Ok(())
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#[cfg(test)]
+mod tests {
+    use super::LuWorkspace;
+    use crate::{approx_eq, mat_approx_eq, mat_inverse, solve_lin_sys, vec_approx_eq, Matrix, Vector};
+
+    #[test]
+    fn new_inverse_and_solve_capture_errors() {
+        assert_eq!(LuWorkspace::new(0).err(), Some("matrix dimension must be ≥ 1"));
+        let mut workspace = LuWorkspace::new(4).unwrap();
+        let mut a = Matrix::new(3, 3);
+        let mut ai = Matrix::new(3, 3);
+        assert_eq!(
+            workspace.inverse(&mut ai, &a).err(),
+            Some("matrix dimension is incompatible with the workspace")
+        );
+        let mut b = Vector::new(3);
+        assert_eq!(
+            workspace.solve(&mut b, &mut a).err(),
+            Some("matrix dimension is incompatible with the workspace")
+        );
+        let mut a = Matrix::new(4, 4);
+        assert_eq!(workspace.inverse(&mut ai, &a).err(), Some("matrices are incompatible"));
+        assert_eq!(
+            workspace.solve(&mut b, &mut a).err(),
+            Some("vector has wrong dimension")
+        );
+    }
+
+    #[test]
+    fn inverse_and_solve_work() {
+        for m in [2, 3, 5] {
+            let mut workspace = LuWorkspace::new(m).unwrap();
+            let mut ai = Matrix::new(m, m);
+            let mut ai_ref = Matrix::new(m, m);
+            for p in 0..3 {
+                let mut a = Matrix::new(m, m);
+                let mut b = Vector::new(m);
+                for i in 0..m {
+                    for j in 0..m {
+                        let v = if i == j {
+                            (4 + i + p) as f64
+                        } else {
+                            1.0 / (1 + i + 2 * j) as f64
+                        };
+                        a.set(i, j, v);
+                    }
+                    b[i] = (i + p) as f64;
+                }
+                let det = workspace.inverse(&mut ai, &a).unwrap();
+                let det_ref = mat_inverse(&mut ai_ref, &a).unwrap();
+                approx_eq(det / det_ref, 1.0, 1e-13); // mat_inverse is native for small m (different rounding)
+                mat_approx_eq(&ai, &ai_ref, 1e-15);
+
+                let mut a_ref = a.clone();
+                let mut b_ref = b.clone();
+                workspace.solve(&mut b, &mut a).unwrap();
+                solve_lin_sys(&mut b_ref, &mut a_ref).unwrap();
+                vec_approx_eq(&b, b_ref.as_data(), 1e-15);
+            }
+        }
+    }
+}
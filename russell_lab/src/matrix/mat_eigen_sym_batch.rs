@@ -0,0 +1,174 @@
+use crate::{to_i32, CcBool, StrError, C_FALSE, C_TRUE};
+
+extern "C" {
+    // Computes the eigenvalues and eigenvectors of a batch of symmetric matrices stored contiguously (strided)
+    // Calls dsyev for each matrix, sharing the workspace
+    fn c_dsyev_batch_strided(
+        upper: CcBool,
+        n: *const i32,
+        a: *mut f64,
+        stride_a: *const i32,
+        w: *mut f64,
+        work: *mut f64,
+        lwork: *const i32,
+        batch_size: *const i32,
+        info: *mut i32,
+    );
+}
+
+/// (dsyev) Calculates the eigenvalues and eigenvectors of a batch of symmetric matrices of the same dimension
+///
+/// Computes the eigenvalues `l[i]` and eigenvectors `v[i]` of each matrix `A[i]` in the batch, such that:
+///
+/// ```text
+/// A[i] ⋅ v[i]j = l[i]j ⋅ v[i]j
+/// ```
+///
+/// The matrices are packed contiguously (each one in col-major order) in the slice `a` with length
+/// `m * m * batch_size` and the eigenvalues are packed contiguously in the slice `l` with length
+/// `m * batch_size`. The whole batch is computed with a single call to the C-code and a single
+/// workspace allocation. There is no batched `dsyev` in LAPACK or Intel MKL; thus, `dsyev` is called
+/// for each matrix by the C-code.
+///
+/// See also: <https://netlib.org/lapack/explore-html/dd/d4c/dsyev_8f.html>
+///
+/// # Input
+///
+/// * `a` -- (modified on exit) symmetric matrices (col-major; packed contiguously)
+/// * `m` -- the dimension of each matrix
+/// * `upper` -- Whether the upper triangle of `A[i]` must be considered instead
+///    of the lower triangle.
+///
+/// # Output
+///
+/// * `l` -- (lambda) will hold the eigenvalues of each matrix (in ascending order)
+/// * `a` -- will hold the eigenvectors of each matrix as columns
+///
+/// # Examples
+///
+/// ```
+/// use russell_lab::{mat_eigen_sym_batch, array_approx_eq, StrError};
+///
+/// fn main() -> Result<(), StrError> {
+///     // two 2x2 symmetric matrices (col-major)
+///     let mut a = [2.0, 0.0, 0.0, 3.0, /**/ 2.0, 1.0, 1.0, 2.0];
+///     let mut l = [0.0; 4];
+///
+///     // compute the eigenvalues and eigenvectors
+///     mat_eigen_sym_batch(&mut l, &mut a, 2, false)?;
+///
+///     // check the eigenvalues
+///     array_approx_eq(&l, &[2.0, 3.0, /**/ 1.0, 3.0], 1e-15);
+///     Ok(())
+/// }
+/// ```
+pub fn mat_eigen_sym_batch(l: &mut [f64], a: &mut [f64], m: usize, upper: bool) -> Result<(), StrError> {
+    if m == 0 {
+        return Err("matrix dimension must be ≥ 1");
+    }
+    if l.len() % m != 0 {
+        return Err("the length of l must be a multiple of m");
+    }
+    let batch_size = l.len() / m;
+    if a.len() != m * m * batch_size {
+        return Err("the length of a must be equal to m * m * batch_size");
+    }
+    if batch_size == 0 {
+        return Ok(());
+    }
+    let c_upper = if upper { C_TRUE } else { C_FALSE };
+    let n_i32 = to_i32(m);
+    let stride_a = to_i32(m * m);
+    let batch_size_i32 = to_i32(batch_size);
+    const EXTRA: i32 = 1;
+    let lwork = 3 * n_i32 + EXTRA; // max(1,3*N-1), thus, 2 extra spaces effectively
+    let mut work = vec![0.0; lwork as usize];
+    let mut info = vec![0_i32; batch_size];
+    unsafe {
+        c_dsyev_batch_strided(
+            c_upper,
+            &n_i32,
+            a.as_mut_ptr(),
+            &stride_a,
+            l.as_mut_ptr(),
+            work.as_mut_ptr(),
+            &lwork,
+            &batch_size_i32,
+            info.as_mut_ptr(),
+        );
+    }
+    for i in 0..batch_size {
+        if info[i] < 0 {
+            println!(
+                "LAPACK ERROR (dsyev_batch): Argument #{} had an illegal value",
+                -info[i]
+            );
+            return Err("LAPACK ERROR (dsyev_batch): An argument had an illegal value");
+        } else if info[i] > 0 {
+            println!("LAPACK ERROR (dsyev_batch): matrix #{} did not converge", i);
+            return Err("LAPACK ERROR (dsyev_batch): The algorithm failed to converge");
+        }
+    }
+    Ok(())
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#[cfg(test)]
+mod tests {
+    use super::mat_eigen_sym_batch;
+    use crate::{array_approx_eq, mat_approx_eq, mat_eigen_sym, Matrix, Vector};
+
+    #[test]
+    fn mat_eigen_sym_batch_captures_errors() {
+        let mut a = vec![0.0; 4];
+        let mut l = vec![0.0; 3];
+        assert_eq!(
+            mat_eigen_sym_batch(&mut l, &mut a, 0, false).err(),
+            Some("matrix dimension must be ≥ 1")
+        );
+        assert_eq!(
+            mat_eigen_sym_batch(&mut l, &mut a, 2, false).err(),
+            Some("the length of l must be a multiple of m")
+        );
+        let mut l = vec![0.0; 4];
+        assert_eq!(
+            mat_eigen_sym_batch(&mut l, &mut a, 2, false).err(),
+            Some("the length of a must be equal to m * m * batch_size")
+        );
+    }
+
+    #[test]
+    fn mat_eigen_sym_batch_works() {
+        let batch_size = 4;
+        for m in [1, 3, 6_usize] {
+            let mut a = vec![0.0; m * m * batch_size];
+            let mut mats = Vec::new();
+            for p in 0..batch_size {
+                let mut mat = Matrix::new(m, m);
+                for i in 0..m {
+                    for j in 0..m {
+                        let v = if i == j {
+                            (2 + i + p) as f64
+                        } else {
+                            1.0 / (1 + i + j + p) as f64
+                        };
+                        mat.set(i, j, v);
+                        a[p * m * m + i + j * m] = v;
+                    }
+                }
+                mats.push(mat);
+            }
+            let mut l = vec![0.0; m * batch_size];
+            mat_eigen_sym_batch(&mut l, &mut a, m, false).unwrap();
+            for p in 0..batch_size {
+                let mut l_ref = Vector::new(m);
+                mat_eigen_sym(&mut l_ref, &mut mats[p], false).unwrap();
+                array_approx_eq(&l[(p * m)..((p + 1) * m)], l_ref.as_data(), 1e-14);
+                let mut v = Matrix::new(m, m);
+                v.as_mut_data().copy_from_slice(&a[(p * m * m)..((p + 1) * m * m)]);
+                mat_approx_eq(&v, &mats[p], 1e-14);
+            }
+        }
+    }
+}
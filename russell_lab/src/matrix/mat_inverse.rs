@@ -1,5 +1,5 @@
 use super::{mat_copy, Matrix};
-use crate::{to_i32, StrError};
+use crate::{native_mat_inverse, to_i32, StrError, MAX_DIM_FOR_NATIVE_MAT_INVERSE};
 
 extern "C" {
     // Computes the LU factorization of a general (m,n) matrix
@@ -32,6 +32,10 @@ const ZERO_DETERMINANT: f64 = 1e-15;
 ///
 /// And: <https://www.netlib.org/lapack/explore-html/df/da4/dgetri_8f.html>
 ///
+/// **Note:** Matrices with m ≤ 3 are inverted using closed-form expressions. Matrices with m ≤ 12 are
+/// inverted by native Rust code (LU factorization with partial pivoting) because the overhead of calling
+/// LAPACK dominates the computational cost in this case.
+///
 /// # Output
 ///
 /// * `ai` -- (m,m) inverse matrix
@@ -194,6 +198,11 @@ pub fn mat_inverse(ai: &mut Matrix, a: &Matrix) -> Result<f64, StrError> {
         return Ok(det);
     }
 
+    // handle small matrix natively (avoiding the overhead of calling LAPACK)
+    if m <= MAX_DIM_FOR_NATIVE_MAT_INVERSE {
+        return native_mat_inverse(ai.as_mut_data(), a.as_data(), m);
+    }
+
     // copy a into ai
     mat_copy(ai, a).unwrap();
 
@@ -257,6 +266,7 @@ pub fn mat_inverse(ai: &mut Matrix, a: &Matrix) -> Result<f64, StrError> {
 #[cfg(test)]
 mod tests {
     use super::{mat_inverse, Matrix, ZERO_DETERMINANT};
+    use crate::MAX_DIM_FOR_NATIVE_MAT_INVERSE;
     use crate::{approx_eq, mat_approx_eq};
 
     /// Computes a⋅ai that should equal I for a square matrix
@@ -381,6 +391,22 @@ mod tests {
         assert_eq!(res, Err("cannot compute inverse due to zero determinant"));
     }
 
+    #[test]
+    fn inverse_4x4_fails_on_singular_matrix() {
+        #[rustfmt::skip]
+        let a = Matrix::from(&[
+            [1.0, 2.0, 0.0, 3.0],
+            [2.0, 4.0, 0.0, 1.0],
+            [0.0, 0.0, 1.0, 0.0],
+            [1.0, 2.0, 0.0, 1.0],
+        ]);
+        let mut ai = Matrix::new(4, 4);
+        assert_eq!(
+            mat_inverse(&mut ai, &a).err(),
+            Some("LAPACK ERROR (dgetrf): The factorization has been completed, but the factor U is exactly singular")
+        );
+    }
+
     #[test]
     fn inverse_4x4_works() {
         #[rustfmt::skip]
@@ -468,4 +494,21 @@ mod tests {
         let a_ai = get_a_times_ai(&a_copy, &ai);
         mat_approx_eq(&a_ai, &identity, 1e-12);
     }
+
+    #[test]
+    fn inverse_native_and_lapack_work() {
+        // the first size is inverted natively and the second by LAPACK
+        for m in [MAX_DIM_FOR_NATIVE_MAT_INVERSE, MAX_DIM_FOR_NATIVE_MAT_INVERSE + 2] {
+            let mut a = Matrix::new(m, m);
+            for i in 0..m {
+                for j in 0..m {
+                    a.set(i, j, if i == j { 5.0 } else { 1.0 / (1 + i + 2 * j) as f64 });
+                }
+            }
+            let mut ai = Matrix::new(m, m);
+            mat_inverse(&mut ai, &a).unwrap();
+            let a_ai = get_a_times_ai(&a, &ai);
+            mat_approx_eq(&a_ai, &Matrix::identity(m), 1e-15);
+        }
+    }
 }
@@ -1,5 +1,5 @@
 use super::Matrix;
-use crate::{to_i32, StrError, CBLAS_COL_MAJOR, CBLAS_NO_TRANS};
+use crate::{native_mat_mat_mul, to_i32, StrError, CBLAS_COL_MAJOR, CBLAS_NO_TRANS, MAX_DIM_FOR_NATIVE_MAT_MAT_MUL};
 
 extern "C" {
     // Performs the matrix-matrix multiplication
@@ -31,6 +31,9 @@ extern "C" {
 ///
 /// See also: <https://www.netlib.org/lapack/explore-html/d7/d2b/dgemm_8f.html>
 ///
+/// **Note:** Small matrices (m, n, k ≤ 4) are handled by native Rust code because the overhead
+/// of calling BLAS dominates the computational cost of such products.
+///
 /// # Examples
 ///
 /// ```
@@ -70,6 +73,11 @@ pub fn mat_mat_mul(c: &mut Matrix, alpha: f64, a: &Matrix, b: &Matrix, beta: f64
         c.fill(0.0);
         return Ok(());
     }
+    if m <= MAX_DIM_FOR_NATIVE_MAT_MAT_MUL && n <= MAX_DIM_FOR_NATIVE_MAT_MAT_MUL && k <= MAX_DIM_FOR_NATIVE_MAT_MAT_MUL
+    {
+        native_mat_mat_mul(c.as_mut_data(), alpha, a.as_data(), b.as_data(), beta, m, n, k);
+        return Ok(());
+    }
     let m_i32: i32 = to_i32(m);
     let n_i32: i32 = to_i32(n);
     let k_i32: i32 = to_i32(k);
@@ -0,0 +1,193 @@
+use crate::{native_mat_mat_mul, to_i32, using_intel_mkl, StrError, MAX_DIM_FOR_NATIVE_MAT_MAT_MUL};
+
+extern "C" {
+    // Performs a batch of matrix-matrix multiplications (strided; col-major)
+    // Uses cblas_dgemm_batch_strided with Intel MKL; otherwise, calls cblas_dgemm for each matrix
+    fn c_dgemm_batch_strided(
+        m: i32,
+        n: i32,
+        k: i32,
+        alpha: f64,
+        a: *const f64,
+        stride_a: i32,
+        b: *const f64,
+        stride_b: i32,
+        beta: f64,
+        c: *mut f64,
+        stride_c: i32,
+        batch_size: i32,
+    );
+}
+
+/// (dgemm) Performs a batch of matrix-matrix multiplications with matrices of the same dimensions
+///
+/// ```text
+///  c[i]  :=  α  a[i]  ⋅  b[i]  +  β  c[i]
+/// (m,n)        (m,k)    (k,n)       (m,n)
+/// ```
+///
+/// The matrices are packed contiguously (each one in col-major order) in the slices `a`, `b`, and `c`
+/// with lengths `m * k * batch_size`, `k * n * batch_size`, and `m * n * batch_size`, respectively.
+/// The whole batch is computed with a single call to the C-code, thus the FFI overhead is paid once per batch.
+///
+/// With Intel MKL, the products are computed by `cblas_dgemm_batch_strided`. Otherwise, small
+/// products (m, n, k ≤ 4) are computed natively (as in [crate::mat_mat_mul()]) and larger products
+/// are computed by calling `cblas_dgemm` for each matrix. As in BLAS, `c` is not read if `β = 0`.
+///
+/// See also: <https://www.netlib.org/lapack/explore-html/d7/d2b/dgemm_8f.html>
+///
+/// # Examples
+///
+/// ```
+/// use russell_lab::{mat_mat_mul_batch, array_approx_eq, StrError};
+///
+/// fn main() -> Result<(), StrError> {
+///     // two 2x2 matrices (col-major)
+///     let a = [1.0, 3.0, 2.0, 4.0, /**/ 1.0, 0.0, 0.0, 1.0];
+///     let b = [1.0, 0.0, 0.0, 1.0, /**/ 5.0, 7.0, 6.0, 8.0];
+///     let mut c = [0.0; 8];
+///
+///     // compute c[i] := a[i] ⋅ b[i]
+///     mat_mat_mul_batch(&mut c, 1.0, &a, &b, 0.0, 2, 2, 2)?;
+///
+///     // check
+///     array_approx_eq(&c, &[1.0, 3.0, 2.0, 4.0, /**/ 5.0, 7.0, 6.0, 8.0], 1e-15);
+///     Ok(())
+/// }
+/// ```
+pub fn mat_mat_mul_batch(
+    c: &mut [f64],
+    alpha: f64,
+    a: &[f64],
+    b: &[f64],
+    beta: f64,
+    m: usize,
+    n: usize,
+    k: usize,
+) -> Result<(), StrError> {
+    if m == 0 || n == 0 {
+        return Err("m and n must be ≥ 1");
+    }
+    if c.len() % (m * n) != 0 {
+        return Err("the length of c must be a multiple of m * n");
+    }
+    let batch_size = c.len() / (m * n);
+    if a.len() != m * k * batch_size {
+        return Err("the length of a must be equal to m * k * batch_size");
+    }
+    if b.len() != k * n * batch_size {
+        return Err("the length of b must be equal to k * n * batch_size");
+    }
+    if batch_size == 0 {
+        return Ok(());
+    }
+    if k == 0 {
+        c.fill(0.0);
+        return Ok(());
+    }
+    if m <= MAX_DIM_FOR_NATIVE_MAT_MAT_MUL
+        && n <= MAX_DIM_FOR_NATIVE_MAT_MAT_MUL
+        && k <= MAX_DIM_FOR_NATIVE_MAT_MAT_MUL
+        && !using_intel_mkl()
+    {
+        for p in 0..batch_size {
+            let aa = &a[(p * m * k)..((p + 1) * m * k)];
+            let bb = &b[(p * k * n)..((p + 1) * k * n)];
+            let cc = &mut c[(p * m * n)..((p + 1) * m * n)];
+            native_mat_mat_mul(cc, alpha, aa, bb, beta, m, n, k);
+        }
+        return Ok(());
+    }
+    unsafe {
+        c_dgemm_batch_strided(
+            to_i32(m),
+            to_i32(n),
+            to_i32(k),
+            alpha,
+            a.as_ptr(),
+            to_i32(m * k),
+            b.as_ptr(),
+            to_i32(k * n),
+            beta,
+            c.as_mut_ptr(),
+            to_i32(m * n),
+            to_i32(batch_size),
+        );
+    }
+    Ok(())
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#[cfg(test)]
+mod tests {
+    use super::mat_mat_mul_batch;
+    use crate::{array_approx_eq, mat_mat_mul, Matrix};
+
+    #[test]
+    fn mat_mat_mul_batch_captures_errors() {
+        let a = vec![0.0; 4];
+        let b = vec![0.0; 4];
+        let mut c = vec![0.0; 3];
+        assert_eq!(
+            mat_mat_mul_batch(&mut c, 1.0, &a, &b, 0.0, 0, 2, 2).err(),
+            Some("m and n must be ≥ 1")
+        );
+        assert_eq!(
+            mat_mat_mul_batch(&mut c, 1.0, &a, &b, 0.0, 2, 2, 2).err(),
+            Some("the length of c must be a multiple of m * n")
+        );
+        let mut c = vec![0.0; 8];
+        assert_eq!(
+            mat_mat_mul_batch(&mut c, 1.0, &a, &b, 0.0, 2, 2, 2).err(),
+            Some("the length of a must be equal to m * k * batch_size")
+        );
+        let a = vec![0.0; 8];
+        assert_eq!(
+            mat_mat_mul_batch(&mut c, 1.0, &a, &b, 0.0, 2, 2, 2).err(),
+            Some("the length of b must be equal to k * n * batch_size")
+        );
+    }
+
+    #[test]
+    fn mat_mat_mul_batch_works() {
+        let batch_size = 5;
+        for (m, n, k) in [(1, 1, 1), (3, 3, 3), (2, 4, 3), (6, 5, 4), (9, 9, 9)] {
+            let a: Vec<_> = (0..(m * k * batch_size)).map(|v| (v % 7) as f64 - 3.0).collect();
+            let b: Vec<_> = (0..(k * n * batch_size)).map(|v| (v % 5) as f64 + 0.5).collect();
+            let c0: Vec<_> = (0..(m * n * batch_size)).map(|v| (v % 3) as f64).collect();
+            let mut c = c0.clone();
+            mat_mat_mul_batch(&mut c, 2.0, &a, &b, -1.0, m, n, k).unwrap();
+            for p in 0..batch_size {
+                let mut aa = Matrix::new(m, k);
+                let mut bb = Matrix::new(k, n);
+                let mut cc = Matrix::new(m, n);
+                aa.as_mut_data().copy_from_slice(&a[(p * m * k)..((p + 1) * m * k)]);
+                bb.as_mut_data().copy_from_slice(&b[(p * k * n)..((p + 1) * k * n)]);
+                cc.as_mut_data().copy_from_slice(&c0[(p * m * n)..((p + 1) * m * n)]);
+                mat_mat_mul(&mut cc, 2.0, &aa, &bb, -1.0).unwrap();
+                array_approx_eq(&c[(p * m * n)..((p + 1) * m * n)], cc.as_data(), 1e-13);
+            }
+        }
+    }
+
+    #[test]
+    fn mat_mat_mul_batch_does_not_read_c_if_beta_is_zero() {
+        let batch_size = 3;
+        for (m, n, k) in [(2, 2, 2), (3, 2, 4), (5, 5, 5)] {
+            let a: Vec<_> = (0..(m * k * batch_size)).map(|v| (v % 7) as f64 - 3.0).collect();
+            let b: Vec<_> = (0..(k * n * batch_size)).map(|v| (v % 5) as f64 + 0.5).collect();
+            let mut c = vec![f64::NAN; m * n * batch_size];
+            mat_mat_mul_batch(&mut c, 2.0, &a, &b, 0.0, m, n, k).unwrap();
+            for p in 0..batch_size {
+                let mut aa = Matrix::new(m, k);
+                let mut bb = Matrix::new(k, n);
+                let mut cc = Matrix::new(m, n);
+                aa.as_mut_data().copy_from_slice(&a[(p * m * k)..((p + 1) * m * k)]);
+                bb.as_mut_data().copy_from_slice(&b[(p * k * n)..((p + 1) * k * n)]);
+                mat_mat_mul(&mut cc, 2.0, &aa, &bb, 0.0).unwrap();
+                array_approx_eq(&c[(p * m * n)..((p + 1) * m * n)], cc.as_data(), 1e-13);
+            }
+        }
+    }
+}
@@ -19,6 +19,8 @@ mod complex_mat_t_mat_mul;
 mod complex_mat_unzip;
 mod complex_mat_update;
 mod complex_mat_zip;
+mod eigen_sym_workspace;
+mod lu_workspace;
 mod mat_add;
 mod mat_approx_eq;
 mod mat_cholesky;
@@ -26,10 +28,12 @@ mod mat_convert_to_blas_band;
 mod mat_copy;
 mod mat_eigen;
 mod mat_eigen_sym;
+mod mat_eigen_sym_batch;
 mod mat_eigen_sym_jacobi;
 mod mat_gen_eigen;
 mod mat_inverse;
 mod mat_mat_mul;
+mod mat_mat_mul_batch;
 mod mat_max_abs_diff;
 mod mat_norm;
 mod mat_pseudo_inverse;
@@ -40,6 +44,7 @@ mod mat_t_mat_mul;
 mod mat_update;
 mod mat_write_vismatrix;
 mod num_matrix;
+mod svd_workspace;
 mod testing;
 pub use crate::matrix::aliases::*;
 pub use crate::matrix::complex_mat_add::*;
@@ -60,6 +65,8 @@ pub use crate::matrix::complex_mat_t_mat_mul::*;
 pub use crate::matrix::complex_mat_unzip::*;
 pub use crate::matrix::complex_mat_update::*;
 pub use crate::matrix::complex_mat_zip::*;
+pub use crate::matrix::eigen_sym_workspace::*;
+pub use crate::matrix::lu_workspace::*;
 pub use crate::matrix::mat_add::*;
 pub use crate::matrix::mat_approx_eq::*;
 pub use crate::matrix::mat_cholesky::*;
@@ -67,10 +74,12 @@ pub use crate::matrix::mat_convert_to_blas_band::*;
 pub use crate::matrix::mat_copy::*;
 pub use crate::matrix::mat_eigen::*;
 pub use crate::matrix::mat_eigen_sym::*;
+pub use crate::matrix::mat_eigen_sym_batch::*;
 pub use crate::matrix::mat_eigen_sym_jacobi::*;
 pub use crate::matrix::mat_gen_eigen::*;
 pub use crate::matrix::mat_inverse::*;
 pub use crate::matrix::mat_mat_mul::*;
+pub use crate::matrix::mat_mat_mul_batch::*;
 pub use crate::matrix::mat_max_abs_diff::*;
 pub use crate::matrix::mat_norm::*;
 pub use crate::matrix::mat_pseudo_inverse::*;
@@ -81,3 +90,4 @@ pub use crate::matrix::mat_t_mat_mul::*;
 pub use crate::matrix::mat_update::*;
 pub use crate::matrix::mat_write_vismatrix::*;
 pub use crate::matrix::num_matrix::*;
+pub use crate::matrix::svd_workspace::*;
@@ -0,0 +1,246 @@
+use crate::matrix::Matrix;
+use crate::vector::Vector;
+use crate::{to_i32, StrError, SVD_CODE_A};
+
+extern "C" {
+    // Computes the singular value decomposition (SVD)
+    // <https://www.netlib.org/lapack/explore-html/d8/d2d/dgesvd_8f.html>
+    fn c_dgesvd(
+        jobu_code: i32,
+        jobvt_code: i32,
+        m: *const i32,
+        n: *const i32,
+        a: *mut f64,
+        lda: *const i32,
+        s: *mut f64,
+        u: *mut f64,
+        ldu: *const i32,
+        vt: *mut f64,
+        ldvt: *const i32,
+        work: *mut f64,
+        lwork: *const i32,
+        info: *mut i32,
+    );
+}
+
+/// Holds the workspace for the singular value decomposition of matrices of the same dimensions (dgesvd)
+///
+/// The optimal size of the workspace is obtained once by a workspace query (lwork = -1) in [SvdWorkspace::new()].
+/// Afterwards, [SvdWorkspace::calc()] may be called many times without allocating memory.
+///
+/// See also: [crate::mat_svd()]
+///
+/// # Examples
+///
+/// ```
+/// use russell_lab::{vec_approx_eq, Matrix, SvdWorkspace, Vector, StrError};
+///
+/// fn main() -> Result<(), StrError> {
+///     let mut workspace = SvdWorkspace::new(2, 3)?;
+///     let mut s = Vector::new(2);
+///     let mut u = Matrix::new(2, 2);
+///     let mut vt = Matrix::new(3, 3);
+///     for d in [1.0, 2.0] {
+///         let mut a = Matrix::from(&[[3.0 * d, 2.0 * d, 2.0 * d], [2.0 * d, 3.0 * d, -2.0 * d]]);
+///         workspace.calc(&mut s, &mut u, &mut vt, &mut a)?;
+///         vec_approx_eq(&s, &[5.0 * d, 3.0 * d], 1e-14);
+///     }
+///     Ok(())
+/// }
+/// ```
+pub struct SvdWorkspace {
+    /// Holds the number of rows of the matrices
+    m: usize,
+
+    /// Holds the number of columns of the matrices
+    n: usize,
+
+    /// Holds the workspace array
+    work: Vec<f64>,
+}
+
+impl SvdWorkspace {
+    /// Allocates a new instance (performs the workspace query)
+    ///
+    /// # Input
+    ///
+    /// * `m` -- number of rows of the matrices
+    /// * `n` -- number of columns of the matrices
+    pub fn new(m: usize, n: usize) -> Result<Self, StrError> {
+        if m == 0 || n == 0 {
+            return Err("matrix dimensions must be ≥ 1");
+        }
+        let m_i32 = to_i32(m);
+        let n_i32 = to_i32(n);
+        let lda = m_i32;
+        let ldu = m_i32;
+        let ldvt = n_i32;
+        let lwork = -1;
+        let mut dummy = [0.0];
+        let mut work_query = [0.0];
+        let mut info = 0;
+        unsafe {
+            c_dgesvd(
+                SVD_CODE_A,
+                SVD_CODE_A,
+                &m_i32,
+                &n_i32,
+                dummy.as_mut_ptr(),
+                &lda,
+                dummy.as_mut_ptr(),
+                dummy.as_mut_ptr(),
+                &ldu,
+                dummy.as_mut_ptr(),
+                &ldvt,
+                work_query.as_mut_ptr(),
+                &lwork,
+                &mut info,
+            );
+        }
+        if info != 0 {
+            return Err("LAPACK ERROR (dgesvd): workspace query failed");
+        }
+        let min_mn = usize::min(m, n);
+        let max_mn = usize::max(m, n);
+        let lwork_min = usize::max(1, usize::max(3 * min_mn + max_mn, 5 * min_mn));
+        let lwork_opt = usize::max(work_query[0] as usize, lwork_min);
+        Ok(SvdWorkspace {
+            m,
+            n,
+            work: vec![0.0; lwork_opt],
+        })
+    }
+
+    /// (dgesvd) Computes the singular value decomposition (SVD) of a matrix
+    ///
+    /// Finds `u`, `s`, and `v`, such that:
+    ///
+    /// ```text
+    ///   a  :=  u   ⋅   s   ⋅   vᵀ
+    /// (m,n)  (m,m)   (m,n)   (n,n)
+    /// ```
+    ///
+    /// # Output
+    ///
+    /// * `s` -- min(m,n) vector with the diagonal elements
+    /// * `u` -- (m,m) orthogonal matrix
+    /// * `vt` -- (n,n) orthogonal matrix with the transpose of v
+    ///
+    /// # Input
+    ///
+    /// * `a` -- (m,n) matrix, symmetric or not (will be modified)
+    pub fn calc(&mut self, s: &mut Vector, u: &mut Matrix, vt: &mut Matrix, a: &mut Matrix) -> Result<(), StrError> {
+        let (m, n) = a.dims();
+        if m != self.m || n != self.n {
+            return Err("matrix dimensions are incompatible with the workspace");
+        }
+        let min_mn = if m < n { m } else { n };
+        if s.dim() != min_mn {
+            return Err("[s] must be a min(m,n) vector");
+        }
+        if u.nrow() != m || u.ncol() != m {
+            return Err("[u] must be an m-by-m square matrix");
+        }
+        if vt.nrow() != n || vt.ncol() != n {
+            return Err("[vt] must be an n-by-n square matrix");
+        }
+        let m_i32 = to_i32(m);
+        let n_i32 = to_i32(n);
+        let lda = m_i32;
+        let ldu = m_i32;
+        let ldvt = n_i32;
+        let lwork = to_i32(self.work.len());
+        let mut info = 0;
+        unsafe {
+            c_dgesvd(
+                SVD_CODE_A,
+                SVD_CODE_A,
+                &m_i32,
+                &n_i32,
+                a.as_mut_data().as_mut_ptr(),
+                &lda,
+                s.as_mut_data().as_mut_ptr(),
+                u.as_mut_data().as_mut_ptr(),
+                &ldu,
+                vt.as_mut_data().as_mut_ptr(),
+                &ldvt,
+                self.work.as_mut_ptr(),
+                &lwork,
+                &mut info,
+            );
+        }
+        if info < 0 {
+            println!("LAPACK ERROR (dgesvd): Argument #{} had an illegal value", -info);
+            return Err("LAPACK ERROR (dgesvd): An argument had an illegal value");
+        } else if info > 0 {
+            println!("LAPACK ERROR (dgesvd): {} is the number of super-diagonals of an intermediate bi-diagonal form B which did not converge to zero",info);
+            return Err("LAPACK ERROR (dgesvd): Algorithm did not converge");
+        }
+        Ok(())
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#[cfg(test)]
+mod tests {
+    use super::SvdWorkspace;
+    use crate::{mat_approx_eq, mat_svd, vec_approx_eq, Matrix, Vector};
+
+    #[test]
+    fn new_and_calc_capture_errors() {
+        assert_eq!(SvdWorkspace::new(0, 1).err(), Some("matrix dimensions must be ≥ 1"));
+        let mut workspace = SvdWorkspace::new(3, 2).unwrap();
+        let mut s = Vector::new(2);
+        let mut u = Matrix::new(3, 3);
+        let mut vt = Matrix::new(2, 2);
+        let mut a = Matrix::new(2, 3);
+        assert_eq!(
+            workspace.calc(&mut s, &mut u, &mut vt, &mut a).err(),
+            Some("matrix dimensions are incompatible with the workspace")
+        );
+        let mut a = Matrix::new(3, 2);
+        let mut s_wrong = Vector::new(3);
+        assert_eq!(
+            workspace.calc(&mut s_wrong, &mut u, &mut vt, &mut a).err(),
+            Some("[s] must be a min(m,n) vector")
+        );
+    }
+
+    #[test]
+    fn calc_works() {
+        let s33 = f64::sqrt(3.0) / 3.0;
+        #[rustfmt::skip]
+        let data = [
+            [-s33, -s33, 1.0],
+            [ s33, -s33, 1.0],
+            [-s33,  s33, 1.0],
+            [ s33,  s33, 1.0],
+        ];
+        let mut workspace = SvdWorkspace::new(4, 3).unwrap();
+        let mut s = Vector::new(3);
+        let mut u = Matrix::new(4, 4);
+        let mut vt = Matrix::new(3, 3);
+        let mut s_ref = Vector::new(3);
+        let mut u_ref = Matrix::new(4, 4);
+        let mut vt_ref = Matrix::new(3, 3);
+        for _ in 0..3 {
+            let mut a = Matrix::from(&data);
+            let mut a_ref = Matrix::from(&data);
+            workspace.calc(&mut s, &mut u, &mut vt, &mut a).unwrap();
+            mat_svd(&mut s_ref, &mut u_ref, &mut vt_ref, &mut a_ref).unwrap();
+            vec_approx_eq(&s, s_ref.as_data(), 1e-14);
+            // check SVD: a == u * s * vt
+            let a_copy = Matrix::from(&data);
+            let mut usv = Matrix::new(4, 3);
+            for i in 0..4 {
+                for j in 0..3 {
+                    for k in 0..3 {
+                        usv.add(i, j, u.get(i, k) * s[k] * vt.get(k, j));
+                    }
+                }
+            }
+            mat_approx_eq(&usv, &a_copy, 1e-14);
+        }
+    }
+}
@@ -1,6 +1,6 @@
 use crate::matrix::Matrix;
 use crate::vector::Vector;
-use crate::{to_i32, StrError, CBLAS_COL_MAJOR, CBLAS_NO_TRANS};
+use crate::{native_mat_vec_mul, to_i32, StrError, CBLAS_COL_MAJOR, CBLAS_NO_TRANS, MAX_DIM_FOR_NATIVE_MAT_VEC_MUL};
 
 extern "C" {
     // Performs one of the matrix-vector multiplication
@@ -30,6 +30,9 @@ extern "C" {
 ///
 /// See also: <https://www.netlib.org/lapack/explore-html/dc/da8/dgemv_8f.html>
 ///
+/// **Note:** Small matrices (m, n ≤ 9) are handled by native Rust code because the overhead
+/// of calling BLAS dominates the computational cost of such products.
+///
 /// # Note
 ///
 /// The length of vector `u` must equal the number of columns of matrix `a` and
@@ -73,6 +76,10 @@ pub fn mat_vec_mul(v: &mut Vector, alpha: f64, a: &Matrix, u: &Vector) -> Result
         v.fill(0.0);
         return Ok(());
     }
+    if m <= MAX_DIM_FOR_NATIVE_MAT_VEC_MUL && n <= MAX_DIM_FOR_NATIVE_MAT_VEC_MUL {
+        native_mat_vec_mul(v.as_mut_data(), alpha, a.as_data(), u.as_data(), m, n);
+        return Ok(());
+    }
     let m_i32: i32 = to_i32(m);
     let n_i32: i32 = to_i32(n);
     let incx = 1;
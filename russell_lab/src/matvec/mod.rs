@@ -8,6 +8,7 @@ mod mat_sum_rows;
 mod mat_vec_mul;
 mod mat_vec_mul_update;
 mod solve_lin_sys;
+mod solve_lin_sys_batch;
 mod vec_mat_mul;
 mod vec_outer;
 pub use crate::matvec::complex_mat_vec_mul::*;
@@ -18,5 +19,6 @@ pub use crate::matvec::mat_sum_rows::*;
 pub use crate::matvec::mat_vec_mul::*;
 pub use crate::matvec::mat_vec_mul_update::*;
 pub use crate::matvec::solve_lin_sys::*;
+pub use crate::matvec::solve_lin_sys_batch::*;
 pub use crate::matvec::vec_mat_mul::*;
 pub use crate::matvec::vec_outer::*;
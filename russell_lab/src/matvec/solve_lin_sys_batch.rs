@@ -0,0 +1,268 @@
+use crate::{to_i32, using_intel_mkl, StrError};
+
+extern "C" {
+    // Solves a batch of linear systems with (n,n) matrices stored contiguously (strided)
+    // Uses dgetrf_batch_strided and dgetrs_batch_strided with Intel MKL; otherwise, calls dgesv for each matrix
+    fn c_dgesv_batch_strided(
+        n: *const i32,
+        a: *mut f64,
+        stride_a: *const i32,
+        ipiv: *mut i32,
+        b: *mut f64,
+        stride_b: *const i32,
+        batch_size: *const i32,
+        info: *mut i32,
+    );
+}
+
+// constants
+const ZERO_DETERMINANT: f64 = 1e-15;
+
+/// Holds the max dimension solved natively (without LAPACK) when not using Intel MKL
+const MAX_DIM_NATIVE: usize = 3;
+
+/// (dgesv) Solves a batch of general linear systems with matrices of the same dimension
+///
+/// For each matrix `a[i]` in the batch, find `x[i]` such that:
+///
+/// ```text
+///  a[i]  ⋅  x[i]  =  b[i]
+/// (m,m)     (m)      (m)
+/// ```
+///
+/// However, the right-hand-side will hold the solution:
+///
+/// ```text
+/// b[i] := a[i]⁻¹⋅b[i] == x[i]
+/// ```
+///
+/// The matrices are packed contiguously (each one in col-major order) in the slice `a` with length
+/// `m * m * batch_size`. The right-hand sides are packed contiguously in the slice `b` with length
+/// `m * batch_size`. The whole batch is solved with a single call to the C-code, thus the FFI overhead
+/// and the allocation of the pivot indices happen once per batch.
+///
+/// With Intel MKL, the solution is computed by `dgetrf_batch_strided` and `dgetrs_batch_strided`.
+/// Otherwise, small systems (m ≤ 3) are solved natively by Cramer's rule and larger systems are
+/// solved by calling `dgesv` for each matrix.
+///
+/// See also: <https://www.netlib.org/lapack/explore-html/d8/d72/dgesv_8f.html>
+///
+/// # Note
+///
+/// 1. The matrices in `a` will be modified
+/// 2. The right-hand-sides in `b` will contain the solutions `x`
+///
+/// # Examples
+///
+/// ```
+/// use russell_lab::{solve_lin_sys_batch, array_approx_eq, StrError};
+///
+/// fn main() -> Result<(), StrError> {
+///     // two 2x2 matrices (col-major) and right-hand sides
+///     let mut a = [
+///         2.0, 0.0, 0.0, 4.0, // diag(2, 4)
+///         1.0, 1.0, -1.0, 1.0, // [[1, -1], [1, 1]]
+///     ];
+///     let mut b = [2.0, 8.0, 0.0, 2.0];
+///
+///     // solve the linear systems b[i] := a[i]⁻¹⋅b[i]
+///     solve_lin_sys_batch(&mut b, &mut a, 2)?;
+///
+///     // check
+///     array_approx_eq(&b, &[1.0, 2.0, 1.0, 1.0], 1e-15);
+///     Ok(())
+/// }
+/// ```
+pub fn solve_lin_sys_batch(b: &mut [f64], a: &mut [f64], m: usize) -> Result<(), StrError> {
+    if m == 0 {
+        if a.len() != 0 || b.len() != 0 {
+            return Err("arrays must be empty if m = 0");
+        }
+        return Ok(());
+    }
+    if b.len() % m != 0 {
+        return Err("the length of b must be a multiple of m");
+    }
+    let batch_size = b.len() / m;
+    if a.len() != m * m * batch_size {
+        return Err("the length of a must be equal to m * m * batch_size");
+    }
+    if batch_size == 0 {
+        return Ok(());
+    }
+    if m <= MAX_DIM_NATIVE && !using_intel_mkl() {
+        for i in 0..batch_size {
+            let aa = &a[(i * m * m)..((i + 1) * m * m)];
+            let bb = &mut b[(i * m)..((i + 1) * m)];
+            if !solve_small(bb, aa, m) {
+                println!("ERROR (solve_lin_sys_batch): matrix #{} has a zero determinant", i);
+                return Err("cannot solve the linear system due to zero determinant");
+            }
+        }
+        return Ok(());
+    }
+    let n_i32 = to_i32(m);
+    let stride_a = to_i32(m * m);
+    let stride_b = n_i32;
+    let batch_size_i32 = to_i32(batch_size);
+    let mut ipiv = vec![0_i32; m * batch_size];
+    let mut info = vec![0_i32; batch_size];
+    unsafe {
+        c_dgesv_batch_strided(
+            &n_i32,
+            a.as_mut_ptr(),
+            &stride_a,
+            ipiv.as_mut_ptr(),
+            b.as_mut_ptr(),
+            &stride_b,
+            &batch_size_i32,
+            info.as_mut_ptr(),
+        );
+    }
+    for i in 0..batch_size {
+        if info[i] < 0 {
+            println!(
+                "LAPACK ERROR (dgesv_batch): Argument #{} had an illegal value",
+                -info[i]
+            );
+            return Err("LAPACK ERROR (dgesv_batch): An argument had an illegal value");
+        } else if info[i] > 0 {
+            println!(
+                "LAPACK ERROR (dgesv_batch): U({},{}) of matrix #{} is exactly zero",
+                info[i] - 1,
+                info[i] - 1,
+                i
+            );
+            return Err("LAPACK ERROR (dgesv_batch): The factorization has been completed, but the factor U is exactly singular");
+        }
+    }
+    Ok(())
+}
+
+/// Solves a small (m ≤ 3) linear system by Cramer's rule (a is col-major); returns false if the determinant is zero
+#[inline]
+fn solve_small(b: &mut [f64], a: &[f64], m: usize) -> bool {
+    match m {
+        1 => {
+            let det = a[0];
+            if f64::abs(det) <= ZERO_DETERMINANT {
+                return false;
+            }
+            b[0] /= det;
+        }
+        2 => {
+            let det = a[0] * a[3] - a[2] * a[1];
+            if f64::abs(det) <= ZERO_DETERMINANT {
+                return false;
+            }
+            let (b0, b1) = (b[0], b[1]);
+            b[0] = (a[3] * b0 - a[2] * b1) / det;
+            b[1] = (a[0] * b1 - a[1] * b0) / det;
+        }
+        _ => {
+            // a(i,j) = a[i + j * 3]
+            #[rustfmt::skip]
+            let det =
+                  a[0] * (a[4] * a[8] - a[7] * a[5])
+                - a[3] * (a[1] * a[8] - a[7] * a[2])
+                + a[6] * (a[1] * a[5] - a[4] * a[2]);
+            if f64::abs(det) <= ZERO_DETERMINANT {
+                return false;
+            }
+            let (b0, b1, b2) = (b[0], b[1], b[2]);
+            b[0] = ((a[4] * a[8] - a[7] * a[5]) * b0
+                + (a[6] * a[5] - a[3] * a[8]) * b1
+                + (a[3] * a[7] - a[6] * a[4]) * b2)
+                / det;
+            b[1] = ((a[7] * a[2] - a[1] * a[8]) * b0
+                + (a[0] * a[8] - a[6] * a[2]) * b1
+                + (a[6] * a[1] - a[0] * a[7]) * b2)
+                / det;
+            b[2] = ((a[1] * a[5] - a[4] * a[2]) * b0
+                + (a[3] * a[2] - a[0] * a[5]) * b1
+                + (a[0] * a[4] - a[3] * a[1]) * b2)
+                / det;
+        }
+    }
+    true
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#[cfg(test)]
+mod tests {
+    use super::{solve_lin_sys_batch, solve_small};
+    use crate::{array_approx_eq, solve_lin_sys, Matrix, Vector};
+
+    #[test]
+    fn solve_lin_sys_batch_captures_errors() {
+        let mut a = vec![0.0; 4];
+        let mut b = vec![0.0; 3];
+        assert_eq!(
+            solve_lin_sys_batch(&mut b, &mut a, 2).err(),
+            Some("the length of b must be a multiple of m")
+        );
+        let mut b = vec![0.0; 4];
+        assert_eq!(
+            solve_lin_sys_batch(&mut b, &mut a, 2).err(),
+            Some("the length of a must be equal to m * m * batch_size")
+        );
+        assert_eq!(
+            solve_lin_sys_batch(&mut b, &mut a, 0).err(),
+            Some("arrays must be empty if m = 0")
+        );
+        let mut a = vec![0.0; 8];
+        assert!(solve_lin_sys_batch(&mut b, &mut a, 2).is_err()); // singular
+    }
+
+    #[test]
+    fn solve_small_works() {
+        // 3x3 (col-major)
+        let a = [1.0, 3.0, 2.0, 3.0, 5.0, 4.0, -2.0, 6.0, 3.0];
+        let mut b = [5.0, 7.0, 8.0];
+        assert!(solve_small(&mut b, &a, 3));
+        array_approx_eq(&b, &[-15.0, 8.0, 2.0], 1e-13);
+        let singular = [1.0, 2.0, 3.0, 2.0, 4.0, 6.0, 0.0, 1.0, 1.0];
+        assert!(!solve_small(&mut b, &singular, 3));
+    }
+
+    #[test]
+    fn solve_lin_sys_batch_works() {
+        for m in [1, 2, 3, 4, 5_usize] {
+            // build a batch of diagonally dominant matrices
+            let batch_size = 7;
+            let mut a = vec![0.0; m * m * batch_size];
+            let mut b = vec![0.0; m * batch_size];
+            let mut a_mats = Vec::new();
+            let mut b_vecs = Vec::new();
+            for p in 0..batch_size {
+                let mut mat = Matrix::new(m, m);
+                let mut vec = Vector::new(m);
+                for i in 0..m {
+                    for j in 0..m {
+                        let v = if i == j {
+                            10.0 + (p + i) as f64
+                        } else {
+                            (1 + i + 2 * j + p) as f64 / 10.0
+                        };
+                        mat.set(i, j, v);
+                        a[p * m * m + i + j * m] = v;
+                    }
+                    vec[i] = (i + p) as f64 - 1.5;
+                    b[p * m + i] = vec[i];
+                }
+                a_mats.push(mat);
+                b_vecs.push(vec);
+            }
+
+            // solve the batch
+            solve_lin_sys_batch(&mut b, &mut a, m).unwrap();
+
+            // compare with the one-by-one solution
+            for p in 0..batch_size {
+                solve_lin_sys(&mut b_vecs[p], &mut a_mats[p]).unwrap();
+                array_approx_eq(&b[(p * m)..((p + 1) * m)], b_vecs[p].as_data(), 1e-14);
+            }
+        }
+    }
+}
@@ -160,3 +160,29 @@ fn test_modified_bessel_functions_neg() {
         approx_eq(math::bessel_in(3, *x), i3[i], 1e-12);
     }
 }
+
+#[test]
+fn test_bessel_slice_functions() {
+    for fp in [
+        "data/reference/as-9-bessel-integer-sml.cmp",
+        "data/reference/as-9-bessel-integer-big.cmp",
+    ] {
+        let dat: HashMap<String, Vec<f64>> = read_table(fp, Some(&["x", "J0", "J1", "J2", "Y0", "Y1", "Y2"])).unwrap();
+
+        let xx = dat.get("x").unwrap();
+        let mut y = vec![0.0; xx.len()];
+        for (n, key, tol) in [(0, "J0", 1e-15), (1, "J1", 1e-15), (2, "J2", 1e-14)] {
+            let reference = dat.get(key).unwrap();
+            math::bessel_jn_slice(&mut y, n, xx).unwrap();
+            for i in 0..xx.len() {
+                approx_eq(y[i], reference[i], tol);
+            }
+        }
+        let reference = dat.get("Y2").unwrap();
+        math::bessel_yn_slice(&mut y, 2, xx).unwrap();
+        assert_eq!(y[0], f64::NEG_INFINITY);
+        for i in 1..xx.len() {
+            approx_eq(y[i], reference[i], 1e-13);
+        }
+    }
+}
@@ -1,4 +1,4 @@
-use russell_lab::math::{elliptic_e, elliptic_f, elliptic_pi, PI};
+use russell_lab::math::{elliptic_e, elliptic_e_slice, elliptic_f, elliptic_f_slice, elliptic_pi, PI};
 use russell_lab::{approx_eq, read_table};
 use std::collections::HashMap;
 
@@ -90,3 +90,43 @@ fn test_elliptic_pi() {
         }
     }
 }
+
+#[test]
+fn test_elliptic_f_slice_and_e_slice() {
+    for (fp, key, tol) in [
+        ("data/reference/as-17-elliptic-integrals-table17.5-big.cmp", "F", 1e-13),
+        ("data/reference/as-17-elliptic-integrals-table17.6-big.cmp", "E", 1e-14),
+    ] {
+        let dat: HashMap<String, Vec<f64>> = read_table(fp, Some(&["phi", "k", key])).unwrap();
+
+        let all_phi = dat.get("phi").unwrap();
+        let k = dat.get("k").unwrap();
+        let reference = dat.get(key).unwrap();
+
+        // group the rows by k because m is fixed in each call to the slice functions
+        let mut all_k: Vec<f64> = Vec::new();
+        for kk in k {
+            if !all_k.contains(kk) {
+                all_k.push(*kk);
+            }
+        }
+        for kk in all_k {
+            let rows: Vec<usize> = (0..k.len()).filter(|i| k[*i] == kk).collect();
+            let phi: Vec<f64> = rows.iter().map(|i| f64::min(all_phi[*i], PI / 2.0)).collect();
+            let mut y = vec![0.0; phi.len()];
+            if key == "F" {
+                elliptic_f_slice(&mut y, &phi, kk * kk).unwrap();
+            } else {
+                elliptic_e_slice(&mut y, &phi, kk * kk).unwrap();
+            }
+            for (j, i) in rows.iter().enumerate() {
+                if y[j].is_infinite() {
+                    // handle k·sin(φ) == 1
+                    assert!(f64::abs(f64::sin(phi[j]) * kk - 1.0) < f64::EPSILON);
+                } else {
+                    approx_eq(y[j], reference[*i], tol);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,108 @@
+use criterion::BenchmarkId;
+use criterion::Criterion;
+use criterion::Throughput;
+use criterion::{criterion_group, criterion_main, BatchSize};
+use russell_ode::prelude::*;
+use russell_sparse::{Genie, LinSolver};
+
+// Run with:
+//
+//     cargo bench --bench ode_solvers_benchmark
+//
+// The MUMPS solver is only benchmarked if russell_sparse/with_mumps is enabled.
+
+/// Defines the linear solvers used by Radau5
+const GENIES: [Genie; 3] = [Genie::Klu, Genie::Umfpack, Genie::Mumps];
+
+/// Defines the number of points along each direction of the Brusselator PDE grid
+const NPOINTS: [usize; 3] = [5, 11, 21];
+
+fn bench_radau5_brusselator_pde(c: &mut Criterion) {
+    let mut group = c.benchmark_group("radau5_brusselator_pde");
+    group.sample_size(10);
+    for npoint in NPOINTS {
+        let (system, t0, yy0, mut args) = Samples::brusselator_pde(2e-3, npoint, false, false);
+        let t1 = 1.0;
+        group.throughput(Throughput::Elements(system.get_jac_nnz() as u64));
+        for genie in GENIES {
+            let mut params = Params::new(Method::Radau5);
+            params.newton.genie = genie;
+            params.set_tolerances(1e-4, 1e-4, None).unwrap();
+            // skip unavailable solvers
+            if LinSolver::new(genie).is_err() {
+                continue;
+            }
+            let mut solver = OdeSolver::new(params, &system).unwrap();
+            if solver.solve(&mut yy0.clone(), t0, t1, None, None, &mut args).is_err() {
+                continue;
+            }
+            group.bench_function(BenchmarkId::new(genie.to_string(), npoint), |b| {
+                b.iter_batched(
+                    || (OdeSolver::new(params, &system).unwrap(), yy0.clone()),
+                    |(mut solver, mut yy)| solver.solve(&mut yy, t0, t1, None, None, &mut args).unwrap(),
+                    BatchSize::PerIteration,
+                );
+            });
+        }
+    }
+    group.finish();
+}
+
+fn bench_dopri_brusselator_pde(c: &mut Criterion) {
+    // the Jacobian is not used by the explicit methods; thus, the throughput is given per equation
+    let mut group = c.benchmark_group("dopri_brusselator_pde");
+    group.sample_size(10);
+    for npoint in NPOINTS {
+        let (system, t0, yy0, mut args) = Samples::brusselator_pde(2e-3, npoint, false, false);
+        let t1 = 1.0;
+        group.throughput(Throughput::Elements(system.get_ndim() as u64));
+        for method in [Method::DoPri5, Method::DoPri8] {
+            let mut params = Params::new(method);
+            params.set_tolerances(1e-4, 1e-4, None).unwrap();
+            group.bench_function(BenchmarkId::new(format!("{:?}", method), npoint), |b| {
+                b.iter_batched(
+                    || (OdeSolver::new(params, &system).unwrap(), yy0.clone()),
+                    |(mut solver, mut yy)| solver.solve(&mut yy, t0, t1, None, None, &mut args).unwrap(),
+                    BatchSize::PerIteration,
+                );
+            });
+        }
+    }
+    group.finish();
+}
+
+fn bench_radau5_amplifier1t(c: &mut Criterion) {
+    let mut group = c.benchmark_group("radau5_amplifier1t");
+    group.sample_size(10);
+    let (system, x0, y0, mut args) = Samples::amplifier1t();
+    let x1 = 0.05;
+    group.throughput(Throughput::Elements(system.get_jac_nnz() as u64));
+    for genie in GENIES {
+        let mut params = Params::new(Method::Radau5);
+        params.newton.genie = genie;
+        // skip unavailable solvers
+        if LinSolver::new(genie).is_err() {
+            continue;
+        }
+        let mut solver = OdeSolver::new(params, &system).unwrap();
+        if solver.solve(&mut y0.clone(), x0, x1, None, None, &mut args).is_err() {
+            continue;
+        }
+        group.bench_function(genie.to_string(), |b| {
+            b.iter_batched(
+                || (OdeSolver::new(params, &system).unwrap(), y0.clone()),
+                |(mut solver, mut y)| solver.solve(&mut y, x0, x1, None, None, &mut args).unwrap(),
+                BatchSize::PerIteration,
+            );
+        });
+    }
+    group.finish();
+}
+
+criterion_group!(
+    benches,
+    bench_radau5_brusselator_pde,
+    bench_dopri_brusselator_pde,
+    bench_radau5_amplifier1t
+);
+criterion_main!(benches);
@@ -18,6 +18,7 @@
 //! * [OdeSolver] implements the "time-stepping" loop and calls the *actual* numerical solver
 //! * [Params] holds numeric parameters needed by all methods
 //! * (optional) [Output] holds the results from accepted steps (all methods) or the *dense output* (DoPri5, DoPri8, and Radau5 only)
+//!   (the results may also be streamed to a binary file with bounded memory; see [OutStream])
 //! * (optional) [Stats] holds statistics and benchmarking data
 //!
 //! ![ODE principal structs](https://raw.githubusercontent.com/cpmech/russell/main/russell_ode/data/figures/ode-principal-structs.svg)
@@ -26,6 +27,8 @@
 //!
 //! The [OdeSolver] approximates the solution of the ODE/DAE using either fixed or variable steps. Some methods can only be run with fixed steps (this is automatically detected). In addition to the system struct, the solver takes [Params] as input.
 //!
+//! The [OdeEnsemble] integrates the same system for many initial states and arguments (e.g., Monte Carlo simulations) concurrently, reusing one [OdeSolver] per thread, and collects the final states into [EnsembleResults].
+//!
 //! A set of default (~optimal) parameters are allocated by [Params::new()]. If needed, the user may *tweak* the parameters by accessing each parameter subgroup:
 //!
 //! * [ParamsNewton] parameters for Newton's iterations' for the methods that use iterations such asBwEuler and Radau5
@@ -195,8 +198,10 @@ mod erk_dense_out;
 mod euler_backward;
 mod euler_forward;
 mod explicit_runge_kutta;
+mod ode_ensemble;
 mod ode_solver;
 mod ode_solver_trait;
+mod out_stream;
 mod output;
 mod params;
 mod pde_discrete_laplacian_2d;
@@ -213,8 +218,10 @@ use crate::erk_dense_out::*;
 use crate::euler_backward::*;
 use crate::euler_forward::*;
 use crate::explicit_runge_kutta::*;
+pub use crate::ode_ensemble::*;
 pub use crate::ode_solver::*;
 use crate::ode_solver_trait::*;
+pub use crate::out_stream::*;
 pub use crate::output::*;
 pub use crate::params::*;
 pub use crate::pde_discrete_laplacian_2d::*;
@@ -0,0 +1,348 @@
+use crate::StrError;
+use crate::{OdeSolver, Params, Stats, System};
+use russell_lab::{vec_copy, Vector};
+use russell_sparse::CooMatrix;
+use std::sync::Mutex;
+use std::thread;
+
+/// Holds the results of an ensemble of integrations
+///
+/// The final states are stored in a single (preallocated) buffer, one contiguous column
+/// of `ndim` values per member, i.e., `y1[k * ndim + i]` is the i-th component of
+/// the k-th member. The buffers may be reused in subsequent calls to [OdeEnsemble::solve()].
+pub struct EnsembleResults {
+    /// Holds the dimension of the ODE system
+    pub ndim: usize,
+
+    /// Holds the number of members (integrations)
+    pub n_member: usize,
+
+    /// Holds the final states (ndim values for each member)
+    pub y1: Vec<f64>,
+
+    /// Holds the statistics of each member
+    pub stats: Vec<Stats>,
+
+    /// Holds the error (if any) of each member
+    pub errors: Vec<Option<StrError>>,
+}
+
+/// Integrates the same ODE system for many initial states and arguments concurrently
+///
+/// Each thread allocates one [OdeSolver] (i.e., one workspace and, if needed, one set of linear
+/// solvers) which is reused for all members processed by this thread. The members are handed
+/// out dynamically (one at a time) from a shared queue; thus, threads that finish their
+/// (cheaper) integrations earlier take over the remaining members.
+///
+/// **Note:** The system function and Jacobian must be `Sync` and the arguments must be `Send`.
+///
+/// # Examples
+///
+/// ```
+/// use russell_lab::{approx_eq, StrError, Vector};
+/// use russell_ode::prelude::*;
+///
+/// fn main() -> Result<(), StrError> {
+///     // dy/dx = -λ y
+///     let system = System::new(
+///         1,
+///         |f, _x, y, lambda: &mut f64| {
+///             f[0] = -(*lambda) * y[0];
+///             Ok(())
+///         },
+///         no_jacobian,
+///         HasJacobian::No,
+///         None,
+///         None,
+///     );
+///
+///     // one member per λ
+///     let mut args: Vec<f64> = (1..=8).map(|i| i as f64).collect();
+///     let y0 = vec![Vector::from(&[1.0]); args.len()];
+///
+///     // solve from x = 0 to x = 1
+///     let params = Params::new(Method::DoPri5);
+///     let mut ensemble = OdeEnsemble::new(params, &system)?;
+///     ensemble.set_num_threads(2);
+///     let mut results = EnsembleResults::new(1, args.len());
+///     ensemble.solve(&mut results, &y0, 0.0, 1.0, None, &mut args)?;
+///
+///     // check
+///     for k in 0..args.len() {
+///         assert!(results.errors[k].is_none());
+///         approx_eq(results.y1[k], f64::exp(-args[k]), 1e-4);
+///     }
+///     Ok(())
+/// }
+/// ```
+pub struct OdeEnsemble<'a, F, J, A>
+where
+    F: Fn(&mut Vector, f64, &Vector, &mut A) -> Result<(), StrError>,
+    J: Fn(&mut CooMatrix, f64, f64, &Vector, &mut A) -> Result<(), StrError>,
+{
+    /// Holds the parameters
+    params: Params,
+
+    /// ODE system
+    system: &'a System<F, J, A>,
+
+    /// Holds the number of threads
+    num_threads: usize,
+}
+
+impl EnsembleResults {
+    /// Allocates a new instance
+    pub fn new(ndim: usize, n_member: usize) -> Self {
+        EnsembleResults {
+            ndim,
+            n_member,
+            y1: vec![0.0; ndim * n_member],
+            stats: Vec::with_capacity(n_member),
+            errors: vec![None; n_member],
+        }
+    }
+
+    /// Returns the final state of a member
+    pub fn get_y1(&self, member: usize) -> &[f64] {
+        &self.y1[(member * self.ndim)..((member + 1) * self.ndim)]
+    }
+
+    /// Returns the number of members that failed
+    pub fn n_failed(&self) -> usize {
+        self.errors.iter().filter(|e| e.is_some()).count()
+    }
+}
+
+impl<'a, F, J, A> OdeEnsemble<'a, F, J, A>
+where
+    F: Fn(&mut Vector, f64, &Vector, &mut A) -> Result<(), StrError> + Sync,
+    J: Fn(&mut CooMatrix, f64, f64, &Vector, &mut A) -> Result<(), StrError> + Sync,
+    A: Send,
+{
+    /// Allocates a new instance
+    ///
+    /// # Input
+    ///
+    /// * `params` -- holds all parameters, including the selection of the numerical method
+    /// * `system` -- defines the ODE system
+    ///
+    /// **Note:** The number of threads is initially set to the available parallelism.
+    pub fn new(params: Params, system: &'a System<F, J, A>) -> Result<Self, StrError> {
+        OdeSolver::new(params, system)?; // check the parameters and the system
+        Ok(OdeEnsemble {
+            params,
+            system,
+            num_threads: thread::available_parallelism().map_or(1, |n| n.get()),
+        })
+    }
+
+    /// Sets the number of threads (a value of zero means one thread)
+    pub fn set_num_threads(&mut self, num_threads: usize) -> &mut Self {
+        self.num_threads = usize::max(1, num_threads);
+        self
+    }
+
+    /// Solves the ODE system for all members
+    ///
+    /// # Output
+    ///
+    /// * `results` -- the final states, statistics, and errors of each member.
+    ///   The dimensions must be consistent with the system and the number of members.
+    ///
+    /// # Input
+    ///
+    /// * `y0` -- the initial states (one for each member)
+    /// * `x0` -- the initial value of the independent variable (for all members)
+    /// * `x1` -- the final value of the independent variable (for all members)
+    /// * `h_equal` -- a constant stepsize for solving with equal-steps (see [OdeSolver::solve()])
+    /// * `args` -- the arguments (one for each member)
+    ///
+    /// **Note:** An error in one member does not stop the other integrations; see [EnsembleResults::errors].
+    pub fn solve(
+        &self,
+        results: &mut EnsembleResults,
+        y0: &[Vector],
+        x0: f64,
+        x1: f64,
+        h_equal: Option<f64>,
+        args: &mut [A],
+    ) -> Result<(), StrError> {
+        let ndim = self.system.ndim;
+        let n_member = y0.len();
+        if args.len() != n_member {
+            return Err("args.len() must be equal to y0.len()");
+        }
+        if results.ndim != ndim || results.n_member != n_member {
+            return Err("the results must be allocated with the system ndim and the number of members");
+        }
+        if y0.iter().any(|y| y.dim() != ndim) {
+            return Err("y0[k].dim() must be equal to ndim");
+        }
+        results.y1.resize(ndim * n_member, 0.0);
+        results.stats.clear();
+        results.stats.resize(n_member, Stats::new(self.params.method));
+        results.errors.clear();
+        results.errors.resize(n_member, None);
+
+        // queue of members: (initial state, final state, stats, error, args)
+        let queue = Mutex::new(
+            y0.iter()
+                .zip(results.y1.chunks_mut(ndim))
+                .zip(results.stats.iter_mut())
+                .zip(results.errors.iter_mut())
+                .zip(args.iter_mut()),
+        );
+
+        // run the threads
+        let num_threads = usize::min(self.num_threads, usize::max(1, n_member));
+        thread::scope(|scope| {
+            let handles: Vec<_> = (0..num_threads)
+                .map(|_| {
+                    scope.spawn(|| -> Result<(), StrError> {
+                        let mut solver = OdeSolver::new(self.params, self.system)?;
+                        let mut y = Vector::new(ndim);
+                        loop {
+                            let next = queue.lock().map_err(|_| "another thread has panicked")?.next();
+                            let ((((y0_k, y1_k), stats_k), error_k), args_k) = match next {
+                                Some(member) => member,
+                                None => return Ok(()),
+                            };
+                            vec_copy(&mut y, y0_k).unwrap();
+                            if let Err(e) = solver.solve(&mut y, x0, x1, h_equal, None, args_k) {
+                                *error_k = Some(e);
+                            }
+                            y1_k.copy_from_slice(y.as_data());
+                            *stats_k = *solver.stats();
+                        }
+                    })
+                })
+                .collect();
+            let mut status = Ok(());
+            for handle in handles {
+                match handle.join() {
+                    Ok(Ok(())) => (),
+                    Ok(Err(e)) => status = Err(e),
+                    Err(_) => status = Err("a thread of the ensemble has panicked"),
+                }
+            }
+            status
+        })
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#[cfg(test)]
+mod tests {
+    use super::{EnsembleResults, OdeEnsemble};
+    use crate::{no_jacobian, HasJacobian, Method, OdeSolver, Params, Samples, System};
+    use russell_lab::{approx_eq, Vector};
+    use russell_sparse::Genie;
+
+    #[test]
+    fn results_new_works() {
+        let results = EnsembleResults::new(3, 2);
+        assert_eq!(results.y1.len(), 6);
+        assert_eq!(results.errors.len(), 2);
+        assert_eq!(results.get_y1(1), &[0.0, 0.0, 0.0]);
+        assert_eq!(results.n_failed(), 0);
+    }
+
+    #[test]
+    fn solve_captures_errors() {
+        let (system, x0, y0, _) = Samples::robertson();
+        let params = Params::new(Method::Radau5);
+        let ensemble = OdeEnsemble::new(params, &system).unwrap();
+        let mut args = vec![0; 2];
+        let mut results = EnsembleResults::new(3, 2);
+        assert_eq!(
+            ensemble
+                .solve(&mut results, &[y0.clone()], x0, 1.0, None, &mut args)
+                .err(),
+            Some("args.len() must be equal to y0.len()")
+        );
+        let y0s = vec![y0.clone(), y0.clone()];
+        let mut wrong = EnsembleResults::new(2, 2);
+        assert_eq!(
+            ensemble.solve(&mut wrong, &y0s, x0, 1.0, None, &mut args).err(),
+            Some("the results must be allocated with the system ndim and the number of members")
+        );
+        let y0s = vec![y0.clone(), Vector::new(2)];
+        assert_eq!(
+            ensemble.solve(&mut results, &y0s, x0, 1.0, None, &mut args).err(),
+            Some("y0[k].dim() must be equal to ndim")
+        );
+    }
+
+    #[test]
+    fn solve_works_explicit() {
+        // dy/dx = -λ y with y(0) = y0
+        let system = System::new(
+            1,
+            |f, _x, y, lambda: &mut f64| {
+                f[0] = -(*lambda) * y[0];
+                if *lambda < 0.0 {
+                    return Err("λ must be positive");
+                }
+                Ok(())
+            },
+            no_jacobian,
+            HasJacobian::No,
+            None,
+            None,
+        );
+        let n_member = 13;
+        let mut args: Vec<f64> = (0..n_member).map(|k| 0.5 * (k as f64)).collect();
+        args[7] = -1.0; // error
+        let y0: Vec<_> = (0..n_member).map(|k| Vector::from(&[1.0 + k as f64])).collect();
+        let params = Params::new(Method::DoPri5);
+        let mut ensemble = OdeEnsemble::new(params, &system).unwrap();
+        let mut results = EnsembleResults::new(1, n_member);
+        for num_threads in [1, 4] {
+            ensemble.set_num_threads(num_threads);
+            ensemble.solve(&mut results, &y0, 0.0, 1.0, None, &mut args).unwrap();
+            assert_eq!(results.n_failed(), 1);
+            assert_eq!(results.errors[7], Some("λ must be positive"));
+            for k in 0..n_member {
+                if k != 7 {
+                    approx_eq(results.get_y1(k)[0], y0[k][0] * f64::exp(-args[k]), 1e-4);
+                    assert!(results.stats[k].n_accepted > 0);
+                }
+            }
+        }
+    }
+
+    #[test]
+    fn solve_works_radau5_same_as_serial() {
+        // the ensemble (with reused solvers) must yield the same results as separate solvers
+        let (system, x0, y0, _) = Samples::robertson();
+        let x1 = 0.3;
+        let mut params = Params::new(Method::Radau5);
+        params.step.h_ini = 1e-6;
+        params.set_tolerances(1e-8, 1e-2, None).unwrap();
+        params.newton.genie = Genie::Klu;
+        let n_member = 6;
+        let y0s: Vec<_> = (0..n_member)
+            .map(|k| {
+                let mut y = y0.clone();
+                y[0] -= 0.01 * (k as f64);
+                y[2] += 0.01 * (k as f64);
+                y
+            })
+            .collect();
+        let mut args = vec![0; n_member];
+        let mut ensemble = OdeEnsemble::new(params, &system).unwrap();
+        ensemble.set_num_threads(2);
+        let mut results = EnsembleResults::new(3, n_member);
+        ensemble.solve(&mut results, &y0s, x0, x1, None, &mut args).unwrap();
+        assert_eq!(results.n_failed(), 0);
+        for k in 0..n_member {
+            let mut solver = OdeSolver::new(params, &system).unwrap();
+            let mut y = y0s[k].clone();
+            solver.solve(&mut y, x0, x1, None, None, &mut 0).unwrap();
+            assert_eq!(results.get_y1(k), y.as_data());
+            assert_eq!(results.stats[k].n_accepted, solver.stats().n_accepted);
+            assert_eq!(results.stats[k].n_factor, solver.stats().n_factor);
+        }
+    }
+}
@@ -228,6 +228,7 @@ impl<'a, A> OdeSolver<'a, A> {
 
         // reset variables
         self.work.reset(h, self.params.step.rel_error_prev_min);
+        self.actual.reset();
 
         // current values
         let mut x = x0; // will become x1 at the end
@@ -406,7 +407,7 @@ impl<'a, A> OdeSolver<'a, A> {
 #[cfg(test)]
 mod tests {
     use super::OdeSolver;
-    use crate::{no_jacobian, HasJacobian, NoArgs, OutCallback, OutCount, OutData, Output};
+    use crate::{no_jacobian, HasJacobian, NoArgs, OutCallback, OutCount, OutData, OutStream, Output};
     use crate::{Method, Params, Samples, System};
     use russell_lab::{approx_eq, array_approx_eq, vec_approx_eq, Vector};
     use russell_sparse::Genie;
@@ -608,7 +609,7 @@ mod tests {
         assert_eq!(cb(&solver.stats(), 0.0, 0.0, &y0, &mut args).err(), Some("unreachable"));
 
         // run again without step output
-        out.clear();
+        out.clear().unwrap();
         out.set_step_file_writing(false, path_key)
             .set_step_recording(false, &[])
             .set_step_callback(false, cb);
@@ -621,7 +622,7 @@ mod tests {
         assert_eq!(out.step_global_error.len(), 0);
 
         // run again and stop earlier
-        out.clear();
+        out.clear().unwrap();
         out.set_step_callback(true, |stats, _h, _x, _y, _args| {
             if stats.n_accepted > 0 {
                 Ok(true) // stop
@@ -634,7 +635,7 @@ mod tests {
         assert!(y[0] > 0.0 && y[0] < 0.4);
 
         // run again and stop due to error
-        out.clear();
+        out.clear().unwrap();
         out.set_step_callback(true, |stats, _h, _x, _y, _args| {
             if stats.n_accepted > 0 {
                 Err("stop with error")
@@ -705,7 +706,7 @@ mod tests {
         assert_eq!(cb(&solver.stats(), 0.0, 0.0, &y0, &mut args).err(), Some("unreachable"));
 
         // run again without dense output
-        out.clear();
+        out.clear().unwrap();
         out.set_dense_file_writing(false, H_OUT, path_key).unwrap();
         out.set_dense_recording(false, H_OUT, &[]).unwrap();
         out.set_dense_callback(false, H_OUT, cb).unwrap();
@@ -717,7 +718,7 @@ mod tests {
         assert_eq!(out.dense_y.len(), 0);
 
         // run again but stop at the first output
-        out.clear();
+        out.clear().unwrap();
         out.set_dense_callback(true, H_OUT, |_stats, _h, _x, _y, _args| {
             Ok(true) // stop
         })
@@ -728,7 +729,7 @@ mod tests {
         assert_eq!(y[0], 0.0);
 
         // run again and stop earlier
-        out.clear();
+        out.clear().unwrap();
         out.set_dense_callback(true, H_OUT, |stats, _h, _x, _y, _args| {
             if stats.n_accepted > 0 {
                 Ok(true) // stop
@@ -749,7 +750,7 @@ mod tests {
         assert!(y[0] > 0.0 && y[0] < 0.4);
 
         // run again and stop due to error
-        out.clear();
+        out.clear().unwrap();
         // ... first step
         out.set_dense_callback(true, H_OUT, |_stats, _h, _x, _y, _args| Err("stop with error"))
             .unwrap();
@@ -774,6 +775,72 @@ mod tests {
         );
     }
 
+    #[test]
+    fn solve_with_streamed_output_works() {
+        // system and solver
+        let (system, _, y0, mut args, _) = Samples::simple_equation_constant();
+        let params = Params::new(Method::DoPri5);
+        let mut solver = OdeSolver::new(params, &system).unwrap();
+
+        // output
+        let mut out = Output::new();
+        const H_OUT: f64 = 0.1;
+        let path_step = "/tmp/russell_ode/test_solve_streamed_output_works_step.bin";
+        let path_dense = "/tmp/russell_ode/test_solve_streamed_output_works_dense.bin";
+        out.set_step_streaming(true, Some(path_step), &[0], 2, 2).unwrap();
+        out.set_dense_streaming(true, H_OUT, Some(path_dense), &[0], 2, 2)
+            .unwrap();
+
+        // solve
+        let h_equal = Some(0.2);
+        let mut y = y0.clone();
+        solver
+            .solve(&mut y, 0.0, 0.4, h_equal, Some(&mut out), &mut args)
+            .unwrap();
+        vec_approx_eq(&y, &[0.4], 1e-15);
+
+        // check the ring buffers
+        let step_stream = out.step_stream.as_ref().unwrap();
+        assert_eq!(step_stream.n_record(), 3);
+        assert_eq!(step_stream.n_recent(), 2);
+        let (h, x, ys) = step_stream.get_recent(0).unwrap();
+        assert_eq!(h, 0.2);
+        approx_eq(x, 0.4, 1e-15);
+        approx_eq(ys[0], 0.4, 1e-15);
+        let dense_stream = out.dense_stream.as_ref().unwrap();
+        assert_eq!(dense_stream.n_record(), 5);
+
+        // check the files (the streams are flushed at the end of the simulation)
+        let data = OutStream::read_file(path_step).unwrap();
+        assert_eq!(data.components, &[0]);
+        array_approx_eq(&data.h, &[0.2, 0.2, 0.2], 1e-15);
+        array_approx_eq(&data.x, &[0.0, 0.2, 0.4], 1e-15);
+        array_approx_eq(&data.y, &[0.0, 0.2, 0.4], 1e-15);
+        let data = OutStream::read_file(path_dense).unwrap();
+        array_approx_eq(&data.x, &[0.0, 0.1, 0.2, 0.3, 0.4], 1e-15);
+        array_approx_eq(&data.y, &[0.0, 0.1, 0.2, 0.3, 0.4], 1e-15);
+
+        // clear and run again (the files do not keep the records of the previous run)
+        out.clear().unwrap();
+        let mut y = y0.clone();
+        solver
+            .solve(&mut y, 0.0, 0.4, h_equal, Some(&mut out), &mut args)
+            .unwrap();
+        assert_eq!(out.step_stream.as_ref().unwrap().n_record(), 3);
+        let data = OutStream::read_file(path_step).unwrap();
+        array_approx_eq(&data.x, &[0.0, 0.2, 0.4], 1e-15);
+        let data = OutStream::read_file(path_dense).unwrap();
+        array_approx_eq(&data.x, &[0.0, 0.1, 0.2, 0.3, 0.4], 1e-15);
+
+        // run again without streaming
+        out.set_step_streaming(false, None, &[], 1, 0).unwrap();
+        out.set_dense_streaming(false, H_OUT, None, &[], 1, 0).unwrap();
+        let mut y = y0.clone();
+        solver.solve(&mut y, 0.0, 0.4, None, Some(&mut out), &mut args).unwrap();
+        assert!(out.step_stream.is_none());
+        assert!(out.dense_stream.is_none());
+    }
+
     #[test]
     fn solve_captures_errors_from_f_and_out() {
         // args
@@ -28,4 +28,7 @@ pub(crate) trait OdeSolverTrait<A> {
 
     /// Update the parameters (e.g., for sensitive analyses)
     fn update_params(&mut self, params: Params);
+
+    /// Resets the state carried over from a previous integration (e.g., reused factorizations)
+    fn reset(&mut self) {}
 }
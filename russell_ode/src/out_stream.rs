@@ -0,0 +1,387 @@
+use crate::StrError;
+use russell_lab::Vector;
+use std::fs::{self, File};
+use std::io::{BufReader, BufWriter, Read, Seek, SeekFrom, Write};
+use std::path::Path;
+
+/// Defines the signature (magic bytes) of the binary files written by [OutStream]
+const OUT_STREAM_MAGIC: &[u8; 8] = b"RODEOUT1";
+
+/// Streams the output (h, x, and selected y components) to a single binary file with bounded memory
+///
+/// The records are collected in a chunk buffer, which is appended to the file when full (and at the end).
+/// Within each chunk, the data are stored column-wise: `n` values of h, `n` values of x, and then
+/// `n` values of each selected component. All values are little-endian.
+///
+/// ```text
+/// header: b"RODEOUT1" | n_component (u64) | component indices (u64 each)
+/// chunk:  n (u64) | h[0..n] | x[0..n] | y[c0][0..n] | y[c1][0..n] | ...   (f64 each)
+/// ```
+///
+/// In addition, the most recent records are kept in a ring buffer (with contiguous components)
+/// so that, e.g., the last states can be inspected without reading the file.
+///
+/// The file may be read back with [OutStream::read_file()].
+pub struct OutStream {
+    /// Holds the selected y components
+    components: Vec<usize>,
+
+    /// Holds the number of records in a chunk
+    chunk_size: usize,
+
+    /// Holds the chunk buffer (column-wise: h, x, and the components)
+    chunk: Vec<f64>,
+
+    /// Holds the number of records in the chunk buffer
+    chunk_len: usize,
+
+    /// Holds the file writer (None if only the ring buffer is used)
+    writer: Option<BufWriter<File>>,
+
+    /// Holds the max number of records in the ring buffer
+    ring_capacity: usize,
+
+    /// Holds the ring buffer (row-wise: h, x, and the components of each record)
+    ring: Vec<f64>,
+
+    /// Holds the index of the next record to be written in the ring buffer
+    ring_next: usize,
+
+    /// Holds the total number of records
+    n_record: usize,
+}
+
+/// Holds the data read from a file written by [OutStream]
+#[derive(Clone, Debug)]
+pub struct OutStreamData {
+    /// Holds the selected y components
+    pub components: Vec<usize>,
+
+    /// Holds the stepsizes
+    pub h: Vec<f64>,
+
+    /// Holds the x values
+    pub x: Vec<f64>,
+
+    /// Holds the values of the selected components (column-wise)
+    ///
+    /// The value of the j-th selected component at the i-th record is `y[j * n + i]` where `n = x.len()`
+    pub y: Vec<f64>,
+}
+
+impl OutStream {
+    /// Allocates a new instance
+    ///
+    /// # Input
+    ///
+    /// * `full_path` -- the binary file (the directory is created if needed); None means no file (ring buffer only)
+    /// * `selected_y_components` -- specifies which components of the `y` vector are to be saved
+    /// * `chunk_size` -- the number of records in the chunk buffer before appending to the file (≥ 1)
+    /// * `ring_capacity` -- the number of most recent records kept in memory (may be zero)
+    pub fn new(
+        full_path: Option<&str>,
+        selected_y_components: &[usize],
+        chunk_size: usize,
+        ring_capacity: usize,
+    ) -> Result<Self, StrError> {
+        if chunk_size < 1 {
+            return Err("chunk_size must be ≥ 1");
+        }
+        let width = 2 + selected_y_components.len();
+        let writer = match full_path {
+            Some(fp) => {
+                let path = Path::new(fp);
+                if let Some(p) = path.parent() {
+                    fs::create_dir_all(p).map_err(|_| "cannot create directory")?;
+                }
+                let file = File::create(path).map_err(|_| "cannot create file")?;
+                let mut writer = BufWriter::new(file);
+                write_header(&mut writer, selected_y_components)?;
+                Some(writer)
+            }
+            None => None,
+        };
+        Ok(OutStream {
+            components: selected_y_components.to_vec(),
+            chunk_size,
+            chunk: if writer.is_some() {
+                vec![0.0; width * chunk_size]
+            } else {
+                Vec::new()
+            },
+            chunk_len: 0,
+            writer,
+            ring_capacity,
+            ring: vec![0.0; width * ring_capacity],
+            ring_next: 0,
+            n_record: 0,
+        })
+    }
+
+    /// Appends a record
+    pub fn push(&mut self, h: f64, x: f64, y: &Vector) -> Result<(), StrError> {
+        if self.components.iter().any(|m| *m >= y.dim()) {
+            return Err("the selected component is out of range");
+        }
+        let width = 2 + self.components.len();
+
+        // ring buffer
+        if self.ring_capacity > 0 {
+            let start = self.ring_next * width;
+            let record = &mut self.ring[start..(start + width)];
+            record[0] = h;
+            record[1] = x;
+            for (j, m) in self.components.iter().enumerate() {
+                record[2 + j] = y[*m];
+            }
+            self.ring_next = (self.ring_next + 1) % self.ring_capacity;
+        }
+        self.n_record += 1;
+
+        // chunk buffer
+        if self.writer.is_some() {
+            let (n, i) = (self.chunk_size, self.chunk_len);
+            self.chunk[i] = h;
+            self.chunk[n + i] = x;
+            for (j, m) in self.components.iter().enumerate() {
+                self.chunk[(2 + j) * n + i] = y[*m];
+            }
+            self.chunk_len += 1;
+            if self.chunk_len == self.chunk_size {
+                self.flush()?;
+            }
+        }
+        Ok(())
+    }
+
+    /// Appends the records in the chunk buffer to the file and flushes the file
+    pub fn flush(&mut self) -> Result<(), StrError> {
+        if let Some(writer) = self.writer.as_mut() {
+            if self.chunk_len > 0 {
+                let (n, len) = (self.chunk_size, self.chunk_len);
+                let width = 2 + self.components.len();
+                let mut bytes = Vec::with_capacity(8 + 8 * width * len);
+                bytes.extend_from_slice(&(len as u64).to_le_bytes());
+                for col in 0..width {
+                    for value in &self.chunk[(col * n)..(col * n + len)] {
+                        bytes.extend_from_slice(&value.to_le_bytes());
+                    }
+                }
+                writer.write_all(&bytes).map_err(|_| "cannot write file")?;
+                self.chunk_len = 0;
+            }
+            writer.flush().map_err(|_| "cannot write file")?;
+        }
+        Ok(())
+    }
+
+    /// Discards all records (truncates the file and rewrites the header)
+    ///
+    /// The stream is left as if it had just been allocated; e.g., to write the results of a new run.
+    pub fn reset(&mut self) -> Result<(), StrError> {
+        if let Some(writer) = self.writer.as_mut() {
+            writer.flush().map_err(|_| "cannot write file")?;
+            let file = writer.get_mut();
+            file.set_len(0).map_err(|_| "cannot truncate file")?;
+            file.seek(SeekFrom::Start(0)).map_err(|_| "cannot truncate file")?;
+            write_header(writer, &self.components)?;
+            writer.flush().map_err(|_| "cannot write file")?;
+        }
+        self.chunk_len = 0;
+        self.ring_next = 0;
+        self.n_record = 0;
+        Ok(())
+    }
+
+    /// Returns the selected y components
+    pub fn components(&self) -> &[usize] {
+        &self.components
+    }
+
+    /// Returns the total number of records
+    pub fn n_record(&self) -> usize {
+        self.n_record
+    }
+
+    /// Returns the number of records available in the ring buffer
+    pub fn n_recent(&self) -> usize {
+        usize::min(self.n_record, self.ring_capacity)
+    }
+
+    /// Returns a recent record (h, x, and the selected components) from the ring buffer
+    ///
+    /// # Input
+    ///
+    /// * `age` -- zero means the latest record, one the record before it, and so on (must be < `n_recent()`)
+    pub fn get_recent(&self, age: usize) -> Result<(f64, f64, &[f64]), StrError> {
+        if age >= self.n_recent() {
+            return Err("the record is not available in the ring buffer");
+        }
+        let width = 2 + self.components.len();
+        let slot = (self.ring_next + self.ring_capacity - 1 - age) % self.ring_capacity;
+        let record = &self.ring[(slot * width)..((slot + 1) * width)];
+        Ok((record[0], record[1], &record[2..]))
+    }
+
+    /// Reads a file written by OutStream
+    pub fn read_file(full_path: &str) -> Result<OutStreamData, StrError> {
+        let file = File::open(Path::new(full_path)).map_err(|_| "cannot open file")?;
+        let mut reader = BufReader::new(file);
+        let mut bytes = Vec::new();
+        reader.read_to_end(&mut bytes).map_err(|_| "cannot read file")?;
+
+        // header
+        if bytes.len() < 16 || &bytes[0..8] != OUT_STREAM_MAGIC {
+            return Err("the file has not been written by OutStream");
+        }
+        let mut pos = 8;
+        let next_u64 = |pos: &mut usize| -> Result<u64, StrError> {
+            let chunk = bytes.get(*pos..(*pos + 8)).ok_or("the file is truncated")?;
+            *pos += 8;
+            Ok(u64::from_le_bytes(chunk.try_into().unwrap()))
+        };
+        let n_component = next_u64(&mut pos)? as usize;
+        let mut components = Vec::with_capacity(n_component);
+        for _ in 0..n_component {
+            components.push(next_u64(&mut pos)? as usize);
+        }
+
+        // chunks
+        let width = 2 + n_component;
+        let mut columns = vec![Vec::new(); width];
+        while pos < bytes.len() {
+            let len = next_u64(&mut pos)? as usize;
+            for col in 0..width {
+                for _ in 0..len {
+                    columns[col].push(f64::from_bits(next_u64(&mut pos)?));
+                }
+            }
+        }
+        let mut columns = columns.into_iter();
+        let h = columns.next().unwrap();
+        let x = columns.next().unwrap();
+        let y = columns.flatten().collect();
+        Ok(OutStreamData { components, h, x, y })
+    }
+}
+
+/// Writes the header of the binary file (magic bytes and selected components)
+fn write_header(writer: &mut BufWriter<File>, components: &[usize]) -> Result<(), StrError> {
+    let mut header = OUT_STREAM_MAGIC.to_vec();
+    header.extend_from_slice(&(components.len() as u64).to_le_bytes());
+    for m in components {
+        header.extend_from_slice(&(*m as u64).to_le_bytes());
+    }
+    writer.write_all(&header).map_err(|_| "cannot write file")
+}
+
+impl Drop for OutStream {
+    /// Appends the remaining records to the file (errors are ignored; call `flush` to handle them)
+    fn drop(&mut self) {
+        self.flush().unwrap_or(());
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#[cfg(test)]
+mod tests {
+    use super::OutStream;
+    use russell_lab::Vector;
+
+    #[test]
+    fn new_and_push_capture_errors() {
+        assert_eq!(OutStream::new(None, &[0], 0, 1).err(), Some("chunk_size must be ≥ 1"));
+        let mut stream = OutStream::new(None, &[2], 1, 1).unwrap();
+        assert_eq!(
+            stream.push(0.1, 0.0, &Vector::new(2)).err(),
+            Some("the selected component is out of range")
+        );
+        assert_eq!(
+            stream.get_recent(0).err(),
+            Some("the record is not available in the ring buffer")
+        );
+        assert_eq!(
+            OutStream::read_file("/tmp/russell_ode/__not_a_file__").err(),
+            Some("cannot open file")
+        );
+    }
+
+    #[test]
+    fn ring_buffer_works() {
+        let mut stream = OutStream::new(None, &[1, 0], 1, 3).unwrap();
+        let mut y = Vector::new(2);
+        for i in 0..5 {
+            y[0] = i as f64;
+            y[1] = 10.0 * (i as f64);
+            stream.push(0.5, 0.5 * (i as f64), &y).unwrap();
+        }
+        assert_eq!(stream.components(), &[1, 0]);
+        assert_eq!(stream.n_record(), 5);
+        assert_eq!(stream.n_recent(), 3);
+        assert_eq!(stream.get_recent(0).unwrap(), (0.5, 2.0, &[40.0, 4.0][..]));
+        assert_eq!(stream.get_recent(2).unwrap(), (0.5, 1.0, &[20.0, 2.0][..]));
+        assert!(stream.get_recent(3).is_err());
+    }
+
+    #[test]
+    fn write_and_read_file_work() {
+        let path = "/tmp/russell_ode/test_out_stream.bin";
+        let n = 10;
+        {
+            // chunk size is not a divisor of n; thus, the last chunk is written on drop
+            let mut stream = OutStream::new(Some(path), &[2, 0], 4, 0).unwrap();
+            let mut y = Vector::new(3);
+            for i in 0..n {
+                y[0] = i as f64;
+                y[1] = -1.0;
+                y[2] = 100.0 + i as f64;
+                stream.push(0.1 * (i as f64), i as f64, &y).unwrap();
+            }
+            assert_eq!(stream.n_recent(), 0);
+        }
+        let data = OutStream::read_file(path).unwrap();
+        assert_eq!(data.components, &[2, 0]);
+        assert_eq!(data.x.len(), n);
+        assert_eq!(data.y.len(), 2 * n);
+        for i in 0..n {
+            assert_eq!(data.h[i], 0.1 * (i as f64));
+            assert_eq!(data.x[i], i as f64);
+            assert_eq!(data.y[i], 100.0 + i as f64);
+            assert_eq!(data.y[n + i], i as f64);
+        }
+    }
+
+    #[test]
+    fn reset_works() {
+        let path = "/tmp/russell_ode/test_out_stream_reset.bin";
+        let mut stream = OutStream::new(Some(path), &[0], 2, 2).unwrap();
+        let mut y = Vector::new(1);
+        for i in 0..5 {
+            y[0] = i as f64;
+            stream.push(0.1, i as f64, &y).unwrap();
+        }
+        stream.flush().unwrap();
+        assert_eq!(OutStream::read_file(path).unwrap().x.len(), 5);
+
+        // the old records are discarded
+        stream.reset().unwrap();
+        assert_eq!(stream.n_record(), 0);
+        assert_eq!(stream.n_recent(), 0);
+        let data = OutStream::read_file(path).unwrap();
+        assert_eq!(data.components, &[0]);
+        assert_eq!(data.x.len(), 0);
+
+        // new records
+        for i in 0..3 {
+            y[0] = 10.0 + i as f64;
+            stream.push(0.2, 10.0 + i as f64, &y).unwrap();
+        }
+        stream.flush().unwrap();
+        assert_eq!(stream.get_recent(0).unwrap(), (0.2, 12.0, &[12.0][..]));
+        let data = OutStream::read_file(path).unwrap();
+        assert_eq!(data.h, &[0.2, 0.2, 0.2]);
+        assert_eq!(data.x, &[10.0, 11.0, 12.0]);
+        assert_eq!(data.y, &[10.0, 11.0, 12.0]);
+    }
+}
@@ -1,4 +1,4 @@
-use crate::{OdeSolverTrait, Workspace};
+use crate::{OdeSolverTrait, OutStream, Workspace};
 use crate::{Stats, StrError};
 use russell_lab::{vec_max_abs_diff, Vector};
 use serde::{Deserialize, Serialize};
@@ -83,6 +83,9 @@ pub struct Output<A> {
     /// the ones computed by `YxFunction` (see [russell_lab::vec_max_abs_diff])
     pub step_global_error: Vec<f64>,
 
+    /// Holds the stream receiving the selected y components at accepted steps (bounded memory)
+    pub step_stream: Option<OutStream>,
+
     // --- dense -------------------------------------------------------------------------------------------
     /// Holds the stepsize to perform the dense output
     ///
@@ -115,6 +118,9 @@ pub struct Output<A> {
     /// Holds the selected y components computed during the dense output
     pub dense_y: HashMap<usize, Vec<f64>>,
 
+    /// Holds the stream receiving the selected y components during the dense output (bounded memory)
+    pub dense_stream: Option<OutStream>,
+
     // --- stiffness ---------------------------------------------------------------------------------------
     /// Records the stations where stiffness has been detected
     pub(crate) stiff_record: bool,
@@ -202,6 +208,7 @@ impl<A> Output<A> {
             step_x: Vec::new(),
             step_y: HashMap::new(),
             step_global_error: Vec::new(),
+            step_stream: None,
             // dense
             dense_h_out: f64::MAX,
             dense_last_x: 0.0,
@@ -212,6 +219,7 @@ impl<A> Output<A> {
             dense_step_index: Vec::new(),
             dense_x: Vec::new(),
             dense_y: HashMap::new(),
+            dense_stream: None,
             // stiffness
             stiff_record: false,
             stiff_step_index: Vec::new(),
@@ -282,6 +290,43 @@ impl<A> Output<A> {
         self
     }
 
+    /// Sets the streaming of results at accepted steps
+    ///
+    /// Differently from [Output::set_step_recording()], the selected components are stored contiguously and
+    /// appended in chunks to a single binary file; thus, the memory usage does not grow with the number of steps.
+    ///
+    /// # Input
+    ///
+    /// * `enable` -- Enable/disable the output
+    /// * `full_path` -- the binary file, e.g., `/tmp/russell_ode/my_simulation.bin` (None means ring buffer only)
+    /// * `selected_y_components` -- Specifies which components of the `y` vector are to be saved
+    /// * `chunk_size` -- the number of records buffered before appending to the file
+    /// * `ring_capacity` -- the number of most recent records kept in memory
+    ///
+    /// # Results
+    ///
+    /// * The results will be available in the `step_stream` (see [OutStream])
+    pub fn set_step_streaming(
+        &mut self,
+        enable: bool,
+        full_path: Option<&str>,
+        selected_y_components: &[usize],
+        chunk_size: usize,
+        ring_capacity: usize,
+    ) -> Result<&mut Self, StrError> {
+        self.step_stream = if enable {
+            Some(OutStream::new(
+                full_path,
+                selected_y_components,
+                chunk_size,
+                ring_capacity,
+            )?)
+        } else {
+            None
+        };
+        Ok(self)
+    }
+
     /// Sets a callback function called on the dense output
     ///
     /// Use `|stats, h, x, y, args|` or `|stats: &Stats, h: f64, x: f64, y: &Vector, args: &mut A|`
@@ -376,6 +421,52 @@ impl<A> Output<A> {
         Ok(self)
     }
 
+    /// Sets the streaming of results at a predefined dense sequence of steps
+    ///
+    /// Differently from [Output::set_dense_recording()], the selected components are stored contiguously and
+    /// appended in chunks to a single binary file; thus, the memory usage does not grow with the number of stations.
+    ///
+    /// # Input
+    ///
+    /// * `enable` -- Enable/disable the output
+    /// * `h_out` -- is the stepsize (possibly different from the actual `h` stepsize) for the equally spaced "dense" results
+    /// * `full_path` -- the binary file, e.g., `/tmp/russell_ode/my_simulation.bin` (None means ring buffer only)
+    /// * `selected_y_components` -- Specifies which components of the `y` vector are to be saved
+    /// * `chunk_size` -- the number of records buffered before appending to the file
+    /// * `ring_capacity` -- the number of most recent records kept in memory
+    ///
+    /// # Results
+    ///
+    /// * The results will be available in the `dense_stream` (see [OutStream])
+    /// * The `h` value of a record is the stepsize of the associated accepted step
+    ///
+    /// **Note:** The same `h_out` is used for the callback, file, and "recording" options
+    pub fn set_dense_streaming(
+        &mut self,
+        enable: bool,
+        h_out: f64,
+        full_path: Option<&str>,
+        selected_y_components: &[usize],
+        chunk_size: usize,
+        ring_capacity: usize,
+    ) -> Result<&mut Self, StrError> {
+        if h_out <= f64::EPSILON {
+            return Err("h_out must be > EPSILON");
+        }
+        self.dense_h_out = h_out;
+        self.dense_stream = if enable {
+            Some(OutStream::new(
+                full_path,
+                selected_y_components,
+                chunk_size,
+                ring_capacity,
+            )?)
+        } else {
+            None
+        };
+        Ok(self)
+    }
+
     /// Sets the function to compute the correct/reference results y(x)
     pub fn set_yx_correct(&mut self, y_fn_x: fn(&mut Vector, f64, &mut A)) -> &mut Self {
         self.yx_function = Some(y_fn_x);
@@ -384,11 +475,16 @@ impl<A> Output<A> {
 
     /// Indicates whether dense output is enabled or not
     pub(crate) fn with_dense_output(&self) -> bool {
-        self.dense_callback.is_some() || self.dense_file_key.is_some() || self.dense_recording
+        self.dense_callback.is_some()
+            || self.dense_file_key.is_some()
+            || self.dense_recording
+            || self.dense_stream.is_some()
     }
 
     /// Clears the results
-    pub fn clear(&mut self) {
+    ///
+    /// The step and dense streams (if any) are also reset; i.e., their files are truncated.
+    pub fn clear(&mut self) -> Result<(), StrError> {
         // step
         self.step_h.clear();
         self.step_x.clear();
@@ -402,6 +498,14 @@ impl<A> Output<A> {
         self.stiff_step_index.clear();
         self.stiff_x.clear();
         self.stiff_h_times_rho.clear();
+        // streams
+        if let Some(stream) = self.step_stream.as_mut() {
+            stream.reset()?;
+        }
+        if let Some(stream) = self.dense_stream.as_mut() {
+            stream.reset()?;
+        }
+        Ok(())
     }
 
     /// Executes the output at an accepted step
@@ -449,6 +553,11 @@ impl<A> Output<A> {
             }
         }
 
+        // step output: stream results
+        if let Some(stream) = self.step_stream.as_mut() {
+            stream.push(h, x, y)?;
+        }
+
         // --- dense -------------------------------------------------------------------------------------------
         //
         if self.with_dense_output() {
@@ -480,6 +589,11 @@ impl<A> Output<A> {
                         ym.push(y[*m]);
                     }
                 }
+
+                // first dense output: stream results
+                if let Some(stream) = self.dense_stream.as_mut() {
+                    stream.push(h, x, y)?;
+                }
             } else {
                 // maybe allocate y_aux
                 if self.y_aux.dim() != y.dim() {
@@ -521,6 +635,11 @@ impl<A> Output<A> {
                         }
                     }
 
+                    // subsequent dense output: stream results
+                    if let Some(stream) = self.dense_stream.as_mut() {
+                        stream.push(h, x_out, y_out)?;
+                    }
+
                     // next station
                     x_out += self.dense_h_out;
                 }
@@ -584,6 +703,17 @@ impl<A> Output<A> {
                 ym.push(y[*m]);
             }
         }
+
+        // dense output: stream results
+        if let Some(stream) = self.dense_stream.as_mut() {
+            stream.push(h, x, y)?;
+            stream.flush()?;
+        }
+
+        // step output: flush stream
+        if let Some(stream) = self.step_stream.as_mut() {
+            stream.flush()?;
+        }
         Ok(())
     }
 }
@@ -676,5 +806,13 @@ mod tests {
             out.set_dense_recording(true, 0.0, &[]).err(),
             Some("h_out must be > EPSILON")
         );
+        assert_eq!(
+            out.set_dense_streaming(true, 0.0, None, &[], 1, 0).err(),
+            Some("h_out must be > EPSILON")
+        );
+        assert_eq!(
+            out.set_step_streaming(true, None, &[], 0, 0).err(),
+            Some("chunk_size must be ≥ 1")
+        );
     }
 }
@@ -177,8 +177,25 @@ pub struct ParamsRadau5 {
     /// Enable concurrent factorization and solution of the two linear systems
     pub concurrent: bool,
 
+    /// Also enable the concurrent factorization and solution if the linear solver is MUMPS
+    ///
+    /// **Warning:** This option requires a thread-safe build of the MUMPS library (see `SolverMUMPS`).
+    ///
+    /// If `concurrent` and this flag are true, the OpenMP threads (ICNTL(16)) are split between the
+    /// real and complex systems. The thread budget is given by `mumps_num_threads` in `lin_sol_params`;
+    /// if zero and Intel MKL is used, the available parallelism is split.
+    pub concurrent_mumps: bool,
+
     /// Gustafsson's predictive controller
     pub use_pred_control: bool,
+
+    /// Enables the KLU refactorization (klu_refactor) of K_real and K_comp (KLU only)
+    ///
+    /// The sparsity pattern of the coefficient matrices is the same in all steps; thus, the pivot
+    /// sequence of the previous factorization may be reused, which is much cheaper than a full factorization.
+    /// A full factorization is still performed if the pivots become unstable (see `klu_refactor_min_rgrowth`
+    /// and `klu_refactor_min_rcond` in `lin_sol_params`). This option sets `klu_use_refactor` in `lin_sol_params`.
+    pub klu_refactor: bool,
 }
 
 /// Holds the parameters for explicit Runge-Kutta methods
@@ -347,7 +364,9 @@ impl ParamsRadau5 {
             c1h: 1.0,        // line 508 of radau5.f
             c2h: 1.2,        // line 513 of radau5.f
             concurrent: true,
+            concurrent_mumps: false,
             use_pred_control: true,
+            klu_refactor: false,
         }
     }
 
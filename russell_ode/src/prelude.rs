@@ -4,7 +4,9 @@
 //! access to commonly used functionality.
 
 pub use crate::enums::*;
+pub use crate::ode_ensemble::*;
 pub use crate::ode_solver::*;
+pub use crate::out_stream::*;
 pub use crate::output::*;
 pub use crate::params::*;
 pub use crate::samples::*;
@@ -1,8 +1,8 @@
 use crate::StrError;
-use crate::{OdeSolverTrait, Params, System, Workspace};
+use crate::{OdeSolverTrait, Params, ParamsRadau5, System, Workspace};
 use russell_lab::math::SQRT_6;
-use russell_lab::{complex_vec_zip, cpx, format_fortran, vec_copy, Complex64, ComplexVector, Vector};
-use russell_sparse::{numerical_jacobian, ComplexCscMatrix, CscMatrix};
+use russell_lab::{complex_vec_zip, cpx, format_fortran, using_intel_mkl, vec_copy, Complex64, ComplexVector, Vector};
+use russell_sparse::{numerical_jacobian, ComplexCscMatrix, CscMatrix, LinSolParams};
 use russell_sparse::{ComplexLinSolver, ComplexSparseMatrix, CooMatrix, Genie, LinSolver, SparseMatrix};
 use std::thread;
 
@@ -50,17 +50,17 @@ where
     /// Linear solver (for complex system)
     solver_comp: ComplexLinSolver<'a>,
 
-    /// Indicates that the Jacobian can be reused (once)
-    reuse_jacobian: bool,
+    /// Enables the concurrent factorization and solution of the real and complex systems
+    concurrent: bool,
 
-    /// Indicates that the J, K_real, and K_comp matrices (and their factorizations) can be reused (once)
-    reuse_jacobian_kk_and_fact: bool,
+    /// Holds the parameters for the real linear solver
+    lin_sol_params_real: Option<LinSolParams>,
 
-    /// Indicates that the Jacobian has been computed
-    ///
-    /// This flag assists in reusing the Jacobian if the step has been rejected.
-    /// Make sure to set this flag to false in `accept`.
-    jacobian_computed: bool,
+    /// Holds the parameters for the complex linear solver
+    lin_sol_params_comp: Option<LinSolParams>,
+
+    /// Decides whether the Jacobian and the factorizations can be reused or not
+    reuse: ReusePolicy,
 
     /// eta tolerance for stepsize control
     eta: f64,
@@ -138,6 +138,7 @@ where
         };
         let nnz = mass_nnz + jac_nnz;
         let theta = params.radau5.theta_max;
+        let (concurrent, lin_sol_params_real, lin_sol_params_comp) = lin_sol_config(&params);
         Radau5 {
             params,
             system,
@@ -146,9 +147,10 @@ where
             kk_comp: ComplexSparseMatrix::new_coo(ndim, ndim, nnz, system.jac_sym).unwrap(),
             solver_real: LinSolver::new(params.newton.genie).unwrap(),
             solver_comp: ComplexLinSolver::new(params.newton.genie).unwrap(),
-            reuse_jacobian: false,
-            reuse_jacobian_kk_and_fact: false,
-            jacobian_computed: false,
+            concurrent,
+            lin_sol_params_real,
+            lin_sol_params_comp,
+            reuse: ReusePolicy::new(),
             eta: 1.0,
             theta,
             k_accepted: Vector::new(ndim),
@@ -193,9 +195,9 @@ where
         let kk_comp = self.kk_comp.get_coo_mut().unwrap(); // K_comp = (α + βi) M - J
 
         // Jacobian matrix
-        if self.reuse_jacobian {
-            self.reuse_jacobian = false; // just once
-        } else if !self.jacobian_computed {
+        if self.reuse.jacobian() {
+            work.stats.n_jacobian_reused += 1;
+        } else {
             work.stats.sw_jacobian.reset();
             work.stats.n_jacobian += 1;
             if self.params.newton.use_numerical_jacobian || !self.system.jac_available {
@@ -208,7 +210,7 @@ where
             } else {
                 (self.system.jacobian)(jj, 1.0, x, y, args)?;
             }
-            self.jacobian_computed = true;
+            self.reuse.set_jacobian_computed();
             work.stats.stop_sw_jacobian();
         }
 
@@ -253,10 +255,10 @@ where
     fn factorize(&mut self) -> Result<(), StrError> {
         self.solver_real
             .actual
-            .factorize(&mut self.kk_real, self.params.newton.lin_sol_params)?;
+            .factorize(&mut self.kk_real, self.lin_sol_params_real)?;
         self.solver_comp
             .actual
-            .factorize(&mut self.kk_comp, self.params.newton.lin_sol_params)
+            .factorize(&mut self.kk_comp, self.lin_sol_params_comp)
     }
 
     /// Factorizes the real and complex systems concurrently
@@ -265,13 +267,13 @@ where
             let handle_real = scope.spawn(|| {
                 self.solver_real
                     .actual
-                    .factorize(&mut self.kk_real, self.params.newton.lin_sol_params)
+                    .factorize(&mut self.kk_real, self.lin_sol_params_real)
                     .unwrap();
             });
             let handle_comp = scope.spawn(|| {
                 self.solver_comp
                     .actual
-                    .factorize(&mut self.kk_comp, self.params.newton.lin_sol_params)
+                    .factorize(&mut self.kk_comp, self.lin_sol_params_comp)
                     .unwrap();
             });
             let err_real = handle_real.join();
@@ -347,12 +349,12 @@ where
         }
 
         // constants
-        let concurrent = self.params.radau5.concurrent && self.params.newton.genie != Genie::Mumps;
+        let concurrent = self.concurrent;
         let ndim = self.system.ndim;
 
         // Jacobian, K_real, K_comp, and factorizations (for all iterations: simple Newton's method)
-        if self.reuse_jacobian_kk_and_fact {
-            self.reuse_jacobian_kk_and_fact = false; // just once
+        if self.reuse.factorizations() {
+            work.stats.n_factor_reused += 1;
         } else {
             self.assemble(work, x, y, h, args)?;
             work.stats.sw_factor.reset();
@@ -601,11 +603,6 @@ where
         h: f64,
         args: &mut A,
     ) -> Result<(), StrError> {
-        // do not reuse current Jacobian and decomposition by default
-        self.reuse_jacobian_kk_and_fact = false;
-        self.reuse_jacobian = false;
-        self.jacobian_computed = false;
-
         // update y and collocation points
         for m in 0..self.system.ndim {
             y[m] += self.z2[m];
@@ -637,20 +634,11 @@ where
             }
         }
 
-        // update h_new if not reusing factorizations
-        let h_ratio = h_new / h;
-        self.reuse_jacobian_kk_and_fact = self.theta <= self.params.radau5.theta_max
-            && h_ratio >= self.params.radau5.c1h
-            && h_ratio <= self.params.radau5.c2h;
-        if !self.reuse_jacobian_kk_and_fact {
+        // decide whether the Jacobian and the factorizations can be reused (h is kept in the latter case)
+        if !self.reuse.accept(self.theta, h_new / h, &self.params.radau5) {
             work.h_new = h_new;
         }
 
-        // check θ to decide if at least the Jacobian can be reused
-        if !self.reuse_jacobian_kk_and_fact {
-            self.reuse_jacobian = self.theta <= self.params.radau5.theta_max;
-        }
-
         // update x
         *x += h;
 
@@ -684,9 +672,109 @@ where
     /// Update the parameters (e.g., for sensitive analyses)
     fn update_params(&mut self, params: Params) {
         self.params = params;
+        (self.concurrent, self.lin_sol_params_real, self.lin_sol_params_comp) = lin_sol_config(&self.params);
+    }
+
+    /// Resets the reuse flags and the Newton convergence variables (the matrices of a previous integration are stale)
+    fn reset(&mut self) {
+        self.reuse = ReusePolicy::new();
+        self.eta = 1.0;
+        self.theta = self.params.radau5.theta_max;
     }
 }
 
+/// Implements the policy for reusing the Jacobian and the factorizations (as in radau5.f)
+///
+/// After an accepted step, the factorizations (and thus J, K_real, and K_comp) are kept if the Newton
+/// iterations converged fast, i.e., θ ≤ theta_max (THET of radau5.f), and the ratio h_new/h is within
+/// [c1h, c2h] (QUOT1 and QUOT2 of radau5.f); in this case, the stepsize is not changed. Otherwise, only
+/// the Jacobian is kept if θ ≤ theta_max, and K_real and K_comp are assembled and factorized with the new
+/// stepsize (see also [ParamsRadau5::klu_refactor]). After a rejected step, the Jacobian is kept if it
+/// has been computed at the current (x, y).
+#[derive(Clone, Copy, Debug)]
+struct ReusePolicy {
+    /// Indicates that the Jacobian can be reused (once)
+    jacobian: bool,
+
+    /// Indicates that the J, K_real, and K_comp matrices (and their factorizations) can be reused (once)
+    factorizations: bool,
+
+    /// Indicates that the Jacobian has been computed at the current (x, y)
+    ///
+    /// This flag assists in reusing the Jacobian if the step has been rejected.
+    jacobian_computed: bool,
+}
+
+impl ReusePolicy {
+    /// Allocates a new instance
+    fn new() -> Self {
+        ReusePolicy {
+            jacobian: false,
+            factorizations: false,
+            jacobian_computed: false,
+        }
+    }
+
+    /// Returns true if the factorizations can be reused in this step (just once)
+    fn factorizations(&mut self) -> bool {
+        let reuse = self.factorizations;
+        self.factorizations = false;
+        reuse
+    }
+
+    /// Returns true if the Jacobian can be reused in this assembly (a reuse after accept happens just once)
+    fn jacobian(&mut self) -> bool {
+        let reuse = self.jacobian || self.jacobian_computed;
+        self.jacobian = false;
+        reuse
+    }
+
+    /// Records that the Jacobian has been computed at the current (x, y)
+    fn set_jacobian_computed(&mut self) {
+        self.jacobian_computed = true;
+    }
+
+    /// Updates the flags after an accepted step and returns true if the factorizations (and h) are kept
+    fn accept(&mut self, theta: f64, h_ratio: f64, params: &ParamsRadau5) -> bool {
+        let fast = theta <= params.theta_max;
+        self.factorizations = fast && h_ratio >= params.c1h && h_ratio <= params.c2h;
+        self.jacobian = fast && !self.factorizations;
+        self.jacobian_computed = false;
+        self.factorizations
+    }
+}
+
+/// Returns the concurrent flag and the parameters for the real and complex linear solvers
+///
+/// If MUMPS is used concurrently, the OpenMP threads (ICNTL(16)) are split between the two systems.
+/// If [ParamsRadau5::klu_refactor] is true, the KLU refactorization is enabled for both systems.
+fn lin_sol_config(params: &Params) -> (bool, Option<LinSolParams>, Option<LinSolParams>) {
+    let mumps = params.newton.genie == Genie::Mumps;
+    let concurrent = params.radau5.concurrent && (!mumps || params.radau5.concurrent_mumps);
+    let mut lin_sol_params = params.newton.lin_sol_params;
+    if params.radau5.klu_refactor {
+        let mut p = lin_sol_params.unwrap_or(LinSolParams::new());
+        p.klu_use_refactor = true;
+        lin_sol_params = Some(p);
+    }
+    let unchanged = (concurrent, lin_sol_params, lin_sol_params);
+    if !mumps || !concurrent {
+        return unchanged;
+    }
+    let mut real = lin_sol_params.unwrap_or(LinSolParams::new());
+    let total = if real.mumps_num_threads > 0 {
+        real.mumps_num_threads
+    } else if using_intel_mkl() {
+        thread::available_parallelism().map_or(1, |n| n.get())
+    } else {
+        return unchanged; // single-threaded MUMPS with OpenBLAS (see SolverMUMPS)
+    };
+    let mut comp = real;
+    real.mumps_num_threads = usize::max(1, total / 2);
+    comp.mumps_num_threads = usize::max(1, total - total / 2);
+    (concurrent, Some(real), Some(comp))
+}
+
 /// Computes the scaled RMS norm
 fn rms_norm(err: &Vector, scaling: &Vector) -> f64 {
     let ndim = err.dim();
@@ -735,10 +823,10 @@ const TI: [[f64; 3]; 3] = [
 
 #[cfg(test)]
 mod tests {
-    use super::Radau5;
-    use crate::{HasJacobian, Method, OdeSolverTrait, Params, Samples, System, Workspace};
+    use super::{lin_sol_config, Radau5, ReusePolicy};
+    use crate::{HasJacobian, Method, OdeSolver, OdeSolverTrait, Params, ParamsRadau5, Samples, System, Workspace};
     use russell_lab::{format_fortran, format_scientific, Vector};
-    use russell_sparse::Genie;
+    use russell_sparse::{Genie, LinSolParams};
 
     #[cfg(feature = "with_mumps")]
     use serial_test::serial;
@@ -746,6 +834,100 @@ mod tests {
     // IMPORTANT:
     // Since MUMPS is not thread-safe, we need to use serial_test::serial
 
+    #[test]
+    fn lin_sol_config_works() {
+        let mut params = Params::new(Method::Radau5);
+        params.newton.genie = Genie::Umfpack;
+        let (concurrent, real, comp) = lin_sol_config(&params);
+        assert!(concurrent);
+        assert!(real.is_none());
+        assert!(comp.is_none());
+
+        params.newton.genie = Genie::Mumps;
+        let (concurrent, _, _) = lin_sol_config(&params);
+        assert!(!concurrent);
+
+        params.radau5.concurrent_mumps = true;
+        let mut lin_sol_params = LinSolParams::new();
+        lin_sol_params.mumps_num_threads = 5;
+        params.newton.lin_sol_params = Some(lin_sol_params);
+        let (concurrent, real, comp) = lin_sol_config(&params);
+        assert!(concurrent);
+        assert_eq!(real.unwrap().mumps_num_threads, 2);
+        assert_eq!(comp.unwrap().mumps_num_threads, 3);
+
+        params.radau5.concurrent = false;
+        let (concurrent, real, comp) = lin_sol_config(&params);
+        assert!(!concurrent);
+        assert_eq!(real.unwrap().mumps_num_threads, 5);
+        assert_eq!(comp.unwrap().mumps_num_threads, 5);
+
+        params.newton.genie = Genie::Klu;
+        params.newton.lin_sol_params = None;
+        params.radau5.klu_refactor = true;
+        let (_, real, comp) = lin_sol_config(&params);
+        assert!(real.unwrap().klu_use_refactor);
+        assert!(comp.unwrap().klu_use_refactor);
+    }
+
+    #[test]
+    fn reuse_policy_works() {
+        let params = ParamsRadau5::new();
+        let mut reuse = ReusePolicy::new();
+        assert!(!reuse.factorizations());
+        assert!(!reuse.jacobian());
+
+        // rejected step: the Jacobian computed at (x, y) is reused in all trials
+        reuse.set_jacobian_computed();
+        assert!(reuse.jacobian());
+        assert!(reuse.jacobian());
+
+        // fast convergence and small change of h: keep everything (once)
+        assert!(reuse.accept(params.theta_max, 1.1, &params));
+        assert!(reuse.factorizations());
+        assert!(!reuse.factorizations());
+        assert!(!reuse.jacobian());
+
+        // fast convergence and large change of h: keep the Jacobian (once)
+        assert!(!reuse.accept(params.theta_max / 2.0, 2.0, &params));
+        assert!(!reuse.factorizations());
+        assert!(reuse.jacobian());
+        assert!(!reuse.jacobian());
+
+        // slow convergence: recompute everything
+        assert!(!reuse.accept(2.0 * params.theta_max, 1.0, &params));
+        assert!(!reuse.factorizations());
+        assert!(!reuse.jacobian());
+    }
+
+    #[test]
+    fn radau5_reuse_stats_and_klu_refactor_work() {
+        let (system, x0, y0, mut args) = Samples::robertson();
+        let x1 = 0.3;
+        let mut results = Vec::new();
+        for klu_refactor in [false, true] {
+            let mut params = Params::new(Method::Radau5);
+            params.step.h_ini = 1e-6;
+            params.set_tolerances(1e-8, 1e-2, None).unwrap();
+            params.newton.genie = Genie::Klu;
+            params.radau5.klu_refactor = klu_refactor;
+            let mut solver = OdeSolver::new(params, &system).unwrap();
+            let mut y = y0.clone();
+            solver.solve(&mut y, x0, x1, None, None, &mut args).unwrap();
+            let stats = solver.stats();
+            assert!(stats.n_factor_reused > 0);
+            assert!(stats.n_jacobian_reused > 0);
+            assert_eq!(stats.n_factor + stats.n_factor_reused, stats.n_steps);
+            assert_eq!(stats.n_jacobian + stats.n_jacobian_reused, stats.n_factor);
+            results.push((y, stats.n_accepted));
+        }
+        // the refactorization yields (almost) the same results
+        assert_eq!(results[0].1, results[1].1);
+        for i in 0..3 {
+            assert!(f64::abs(results[0].0[i] - results[1].0[i]) < 1e-10);
+        }
+    }
+
     #[test]
     fn radau5_works() {
         // This test relates to Table 21.13 of Kreyszig's book, page 921
@@ -17,6 +17,12 @@ pub struct Stats {
     /// Number of factorizations
     pub n_factor: usize,
 
+    /// Number of assemblies of the coefficient matrices that reused the previous Jacobian matrix
+    pub n_jacobian_reused: usize,
+
+    /// Number of steps that reused the previous factorizations
+    pub n_factor_reused: usize,
+
     /// Number of linear system solutions
     pub n_lin_sol: usize,
 
@@ -77,6 +83,8 @@ impl Stats {
             n_function: 0,
             n_jacobian: 0,
             n_factor: 0,
+            n_jacobian_reused: 0,
+            n_factor_reused: 0,
             n_lin_sol: 0,
             n_steps: 0,
             n_accepted: 0,
@@ -102,6 +110,8 @@ impl Stats {
         self.n_function = 0;
         self.n_jacobian = 0;
         self.n_factor = 0;
+        self.n_jacobian_reused = 0;
+        self.n_factor_reused = 0;
         self.n_lin_sol = 0;
         self.n_steps = 0;
         self.n_accepted = 0;
@@ -216,6 +226,8 @@ impl fmt::Display for Stats {
                 f,
                 "{}\n\
                  Number of iterations (last step) = {}\n\
+                 Number of reused Jacobians       = {}\n\
+                 Number of reused factorizations  = {}\n\
                  Last accepted/suggested stepsize = {}\n\
                  Max time spent on a step         = {}\n\
                  Max time spent on the Jacobian   = {}\n\
@@ -224,6 +236,8 @@ impl fmt::Display for Stats {
                  Total time                       = {}",
                 self.summary(),
                 self.n_iterations,
+                self.n_jacobian_reused,
+                self.n_factor_reused,
                 self.h_accepted,
                 format_nanoseconds(self.nanos_step_max),
                 format_nanoseconds(self.nanos_jacobian_max),
@@ -309,6 +323,8 @@ mod tests {
              Number of rejected steps         = 0\n\
              Number of iterations (maximum)   = 0\n\
              Number of iterations (last step) = 0\n\
+             Number of reused Jacobians       = 0\n\
+             Number of reused factorizations  = 0\n\
              Last accepted/suggested stepsize = 0\n\
              Max time spent on a step         = 0ns\n\
              Max time spent on the Jacobian   = 0ns\n\
@@ -0,0 +1,322 @@
+use criterion::BenchmarkId;
+use criterion::Criterion;
+use criterion::Throughput;
+use criterion::{criterion_group, criterion_main, BatchSize};
+use russell_lab::{cpx, Complex64, ComplexVector, Matrix, Vector};
+use russell_sparse::prelude::*;
+use russell_sparse::Samples;
+use std::env;
+
+// Run with:
+//
+//     cargo bench --bench solvers_benchmark
+//
+// Additional Matrix Market files may be given (separated by colons) via:
+//
+//     RUSSELL_SPARSE_BENCH_MM=/path/to/a.mtx:/path/to/b.mtx cargo bench --bench solvers_benchmark
+//
+// The MUMPS solver is only benchmarked if the with_mumps feature is enabled.
+
+/// Defines the environment variable with a list of Matrix Market files
+const ENV_MATRIX_MARKET: &str = "RUSSELL_SPARSE_BENCH_MM";
+
+/// Defines the direct solvers
+const GENIES: [Genie; 3] = [Genie::Klu, Genie::Umfpack, Genie::Mumps];
+
+/// Defines the number of points along each direction of the generated Laplacians
+const LAPLACIAN_SIZES: [usize; 3] = [10, 30, 60];
+
+/// Generates the (unsymmetric storage) matrix of the 2D Laplacian operator (5-point stencil)
+fn laplacian_2d(m: usize) -> CooMatrix {
+    let ndim = m * m;
+    let mut coo = CooMatrix::new(ndim, ndim, 5 * ndim, Sym::No).unwrap();
+    for i in 0..m {
+        for j in 0..m {
+            let k = i * m + j;
+            coo.put(k, k, 4.0).unwrap();
+            if i > 0 {
+                coo.put(k, k - m, -1.0).unwrap();
+            }
+            if i < m - 1 {
+                coo.put(k, k + m, -1.0).unwrap();
+            }
+            if j > 0 {
+                coo.put(k, k - 1, -1.0).unwrap();
+            }
+            if j < m - 1 {
+                coo.put(k, k + 1, -1.0).unwrap();
+            }
+        }
+    }
+    coo
+}
+
+/// Generates the complex version of the 2D Laplacian (e.g., as in the Helmholtz equation with damping)
+fn complex_laplacian_2d(m: usize) -> ComplexCooMatrix {
+    let real = laplacian_2d(m);
+    let (ndim, _, nnz, _) = real.get_info();
+    let mut coo = ComplexCooMatrix::new(ndim, ndim, nnz, Sym::No).unwrap();
+    let (ii, jj, vv) = (real.get_row_indices(), real.get_col_indices(), real.get_values());
+    for p in 0..nnz {
+        let (i, j) = (ii[p] as usize, jj[p] as usize);
+        let imag = if i == j { 1.0 } else { 0.0 };
+        coo.put(i, j, cpx!(vv[p], imag)).unwrap();
+    }
+    coo
+}
+
+/// Returns the real matrices: samples, generated Laplacians, and the user-supplied Matrix Market files
+fn real_matrices() -> Vec<(String, CooMatrix)> {
+    let mut matrices = vec![
+        ("umfpack_5x5".to_string(), Samples::umfpack_unsymmetric_5x5().0),
+        ("mkl_5x5".to_string(), Samples::mkl_unsymmetric_5x5().0),
+    ];
+    for m in LAPLACIAN_SIZES {
+        matrices.push((format!("laplacian_{}x{}", m, m), laplacian_2d(m)));
+    }
+    if let Ok(paths) = env::var(ENV_MATRIX_MARKET) {
+        for path in paths.split(':').filter(|p| !p.is_empty()) {
+            match read_matrix_market(path, MMsym::MakeItFull) {
+                Ok((Some(coo), None)) => {
+                    let name = path.rsplit('/').next().unwrap_or(path).trim_end_matches(".mtx");
+                    matrices.push((name.to_string(), coo));
+                }
+                Ok(_) => println!("skipping {} (complex matrices are not benchmarked)", path),
+                Err(e) => println!("skipping {} ({})", path, e),
+            }
+        }
+    }
+    matrices
+}
+
+/// Returns the number of non-zeros as the throughput
+fn throughput(coo: &CooMatrix) -> Throughput {
+    let (_, _, nnz, _) = coo.get_info();
+    Throughput::Elements(nnz as u64)
+}
+
+/// Returns a factorized solver or None if the solver is not available or fails with the matrix
+fn factorized_solver(genie: Genie, mat: &mut SparseMatrix) -> Option<LinSolver<'static>> {
+    let mut solver = LinSolver::new(genie).ok()?;
+    solver.actual.factorize(mat, None).ok()?;
+    Some(solver)
+}
+
+fn bench_coo_to_csc(c: &mut Criterion) {
+    let mut group = c.benchmark_group("coo_to_csc");
+    for (name, coo) in &real_matrices() {
+        group.throughput(throughput(coo));
+        group.bench_with_input(BenchmarkId::new("from_coo", name), coo, |b, coo| {
+            b.iter(|| CscMatrix::from_coo(coo).unwrap());
+        });
+        group.bench_with_input(BenchmarkId::new("update_from_coo", name), coo, |b, coo| {
+            let mut csc = CscMatrix::from_coo(coo).unwrap();
+            b.iter(|| csc.update_from_coo(coo).unwrap());
+        });
+    }
+    group.finish();
+}
+
+/// Defines the number of elements along each direction of the generated finite element meshes
+const MESH_SIZES: [usize; 2] = [30, 100];
+
+/// Returns the dofs of the elements of a mesh with m×m bilinear quadrilaterals (one dof per node)
+fn quad_mesh(m: usize) -> Vec<[usize; 4]> {
+    let mut elements = Vec::with_capacity(m * m);
+    for i in 0..m {
+        for j in 0..m {
+            let n0 = i * (m + 1) + j;
+            elements.push([n0, n0 + 1, n0 + m + 2, n0 + m + 1]);
+        }
+    }
+    elements
+}
+
+fn bench_assembly(c: &mut Criterion) {
+    let mut group = c.benchmark_group("assembly");
+    #[rustfmt::skip]
+    let kk_local = Matrix::from(&[
+        [ 4.0, -1.0, -2.0, -1.0],
+        [-1.0,  4.0, -1.0, -2.0],
+        [-2.0, -1.0,  4.0, -1.0],
+        [-1.0, -2.0, -1.0,  4.0],
+    ]);
+    for m in MESH_SIZES {
+        let elements = quad_mesh(m);
+        let (ndof, nel) = ((m + 1) * (m + 1), elements.len());
+        let name = format!("quad_mesh_{}x{}", m, m);
+        group.throughput(Throughput::Elements(nel as u64));
+        group.bench_function(BenchmarkId::new("put", &name), |b| {
+            let mut coo = CooMatrix::new(ndof, ndof, 16 * nel, Sym::No).unwrap();
+            b.iter(|| {
+                coo.reset();
+                for dofs in &elements {
+                    for (r, i) in dofs.iter().enumerate() {
+                        for (s, j) in dofs.iter().enumerate() {
+                            coo.put(*i, *j, kk_local.get(r, s)).unwrap();
+                        }
+                    }
+                }
+            });
+        });
+        group.bench_function(BenchmarkId::new("put_block", &name), |b| {
+            let mut coo = CooMatrix::new(ndof, ndof, 16 * nel, Sym::No).unwrap();
+            b.iter(|| {
+                coo.reset();
+                for dofs in &elements {
+                    coo.put_block(dofs, dofs, &kk_local).unwrap();
+                }
+            });
+        });
+        group.bench_function(BenchmarkId::new("put_parallel_4_threads", &name), |b| {
+            let nthread = 4;
+            let per_part = (nel + nthread - 1) / nthread;
+            let mut coo = CooMatrix::new(ndof, ndof, 16 * per_part * nthread, Sym::No).unwrap();
+            b.iter(|| {
+                coo.reset();
+                coo.put_parallel(&vec![16 * per_part; nthread], |part, slice| {
+                    let end = usize::min(nel, (part + 1) * per_part);
+                    for dofs in &elements[(part * per_part)..end] {
+                        slice.put_block(dofs, dofs, &kk_local)?;
+                    }
+                    Ok(())
+                })
+                .unwrap();
+            });
+        });
+    }
+    group.finish();
+}
+
+fn bench_mat_vec_mul(c: &mut Criterion) {
+    let mut group = c.benchmark_group("mat_vec_mul");
+    for (name, coo) in &real_matrices() {
+        let (nrow, ncol, _, _) = coo.get_info();
+        let u = Vector::filled(ncol, 1.0);
+        let csc = CscMatrix::from_coo(coo).unwrap();
+        let csr = CsrMatrix::from_coo(coo).unwrap();
+        group.throughput(throughput(coo));
+        group.bench_with_input(BenchmarkId::new("COO", name), coo, |b, coo| {
+            let mut v = Vector::new(nrow);
+            b.iter(|| coo.mat_vec_mul(&mut v, 1.0, &u).unwrap());
+        });
+        group.bench_with_input(BenchmarkId::new("CSC", name), &csc, |b, csc| {
+            let mut v = Vector::new(nrow);
+            b.iter(|| csc.mat_vec_mul(&mut v, 1.0, &u).unwrap());
+        });
+        group.bench_with_input(BenchmarkId::new("CSR", name), &csr, |b, csr| {
+            let mut v = Vector::new(nrow);
+            b.iter(|| csr.mat_vec_mul(&mut v, 1.0, &u).unwrap());
+        });
+        group.bench_with_input(BenchmarkId::new("CSR_4_threads", name), &csr, |b, csr| {
+            let mut v = Vector::new(nrow);
+            b.iter(|| csr.mat_vec_mul_parallel(&mut v, 1.0, &u, 4).unwrap());
+        });
+    }
+    group.finish();
+}
+
+fn bench_analyze_and_factorize(c: &mut Criterion) {
+    let mut group = c.benchmark_group("analyze_and_factorize");
+    for (name, coo) in &real_matrices() {
+        group.throughput(throughput(coo));
+        for genie in GENIES {
+            // skip unavailable solvers and unsuitable matrices
+            if factorized_solver(genie, &mut SparseMatrix::from_coo(coo.clone())).is_none() {
+                continue;
+            }
+            group.bench_with_input(BenchmarkId::new(genie.to_string(), name), coo, |b, coo| {
+                b.iter_batched(
+                    || (LinSolver::new(genie).unwrap(), SparseMatrix::from_coo(coo.clone())),
+                    |(mut solver, mut mat)| solver.actual.factorize(&mut mat, None).unwrap(),
+                    BatchSize::PerIteration,
+                );
+            });
+        }
+    }
+    group.finish();
+}
+
+fn bench_factorize(c: &mut Criterion) {
+    // the symbolic analysis is performed once; thus, only the numeric factorization is measured
+    let mut group = c.benchmark_group("factorize");
+    for (name, coo) in &real_matrices() {
+        group.throughput(throughput(coo));
+        for genie in GENIES {
+            let mut mat = SparseMatrix::from_coo(coo.clone());
+            let mut solver = match factorized_solver(genie, &mut mat) {
+                Some(s) => s,
+                None => continue,
+            };
+            group.bench_function(BenchmarkId::new(genie.to_string(), name), |b| {
+                b.iter(|| solver.actual.factorize(&mut mat, None).unwrap());
+            });
+        }
+    }
+    group.finish();
+}
+
+fn bench_solve(c: &mut Criterion) {
+    let mut group = c.benchmark_group("solve");
+    for (name, coo) in &real_matrices() {
+        let (ndim, _, _, _) = coo.get_info();
+        let rhs = Vector::filled(ndim, 1.0);
+        group.throughput(throughput(coo));
+        for genie in GENIES {
+            let mut mat = SparseMatrix::from_coo(coo.clone());
+            let mut solver = match factorized_solver(genie, &mut mat) {
+                Some(s) => s,
+                None => continue,
+            };
+            let mut x = Vector::new(ndim);
+            group.bench_function(BenchmarkId::new(genie.to_string(), name), |b| {
+                b.iter(|| solver.actual.solve(&mut x, &mat, &rhs, false).unwrap());
+            });
+        }
+    }
+    group.finish();
+}
+
+fn bench_complex_solvers(c: &mut Criterion) {
+    let mut group = c.benchmark_group("complex_factorize_and_solve");
+    for m in LAPLACIAN_SIZES {
+        let name = format!("laplacian_{}x{}", m, m);
+        let coo = complex_laplacian_2d(m);
+        let (ndim, _, nnz, _) = coo.get_info();
+        let rhs = ComplexVector::filled(ndim, cpx!(1.0, 1.0));
+        group.throughput(Throughput::Elements(nnz as u64));
+        for genie in GENIES {
+            let mut solver = match ComplexLinSolver::new(genie) {
+                Ok(s) => s,
+                Err(_) => continue,
+            };
+            let mut mat = ComplexSparseMatrix::from_coo(coo.clone());
+            if solver.actual.factorize(&mut mat, None).is_err() {
+                continue;
+            }
+            let mut x = ComplexVector::new(ndim);
+            group.bench_function(
+                BenchmarkId::new(format!("{}_factorize", genie.to_string()), &name),
+                |b| {
+                    b.iter(|| solver.actual.factorize(&mut mat, None).unwrap());
+                },
+            );
+            group.bench_function(BenchmarkId::new(format!("{}_solve", genie.to_string()), &name), |b| {
+                b.iter(|| solver.actual.solve(&mut x, &mat, &rhs, false).unwrap());
+            });
+        }
+    }
+    group.finish();
+}
+
+criterion_group!(
+    benches,
+    bench_assembly,
+    bench_coo_to_csc,
+    bench_mat_vec_mul,
+    bench_analyze_and_factorize,
+    bench_factorize,
+    bench_solve,
+    bench_complex_solvers
+);
+criterion_main!(benches);
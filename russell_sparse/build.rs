@@ -38,7 +38,7 @@ fn main() {
 
     // MUMPS ----------------------------------------------------------------
 
-    #[cfg(feature = "with_mumps")]
+    #[cfg(all(feature = "with_mumps", not(feature = "with_mumps_mpi")))]
     {
         cc::Build::new()
             .file("c_code/interface_complex_mumps.c")
@@ -49,4 +49,19 @@ fn main() {
         println!("cargo:rustc-link-lib=dylib=dmumps_cpmech");
         println!("cargo:rustc-link-lib=dylib=zmumps_cpmech");
     }
+
+    // MUMPS with MPI -------------------------------------------------------
+
+    #[cfg(feature = "with_mumps_mpi")]
+    {
+        cc::Build::new()
+            .file("c_code/interface_complex_mumps.c")
+            .file("c_code/interface_mumps.c")
+            .include("/usr/local/include/mumps_mpi")
+            .define("WITH_MUMPS_MPI", None)
+            .compile("c_code_mumps");
+        println!("cargo:rustc-link-search=native=/usr/local/lib/mumps_mpi");
+        println!("cargo:rustc-link-lib=dylib=dmumps_cpmech_mpi");
+        println!("cargo:rustc-link-lib=dylib=zmumps_cpmech_mpi");
+    }
 }
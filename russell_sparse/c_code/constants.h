@@ -10,6 +10,7 @@
 #define ERROR_NEED_INITIALIZATION 500000
 #define ERROR_NEED_FACTORIZATION 600000
 #define ERROR_ALREADY_INITIALIZED 700000
+#define ERROR_PATH_TOO_LONG 800000
 #define C_TRUE 1
 #define C_FALSE 0
 
@@ -17,6 +18,31 @@
 
 #define COMPLEX64 double
 
+/// @brief Holds the fill-in, flop count, and memory usage of a factorization (the same for all interfaces)
+/// @note Must match StatsLinSolFactors (Rust). The values not reported by a solver are set to zero.
+struct FactorsInfo {
+    int64_t nnz_a;                // number of non-zeros of the factorized matrix
+    int64_t nnz_l;                // number of entries in L (UMFPACK and KLU)
+    int64_t nnz_u;                // number of entries in U (UMFPACK and KLU)
+    int64_t nnz_factors;          // number of entries in the factors
+    int64_t nnz_factors_estimate; // number of entries in the factors estimated by the analysis
+    int64_t num_reallocations;    // number of reallocations during the factorization (UMFPACK and KLU)
+    double fill_in_ratio;         // nnz_factors / nnz_a
+    double flops_estimate;        // floating-point operations estimated by the analysis
+    double flops_assembly;        // floating-point operations of the assembly (MUMPS)
+    double flops_elimination;     // floating-point operations of the elimination (factorization)
+    double memory_estimate_mb;    // memory estimated by the analysis in MB
+    double memory_peak_mb;        // peak memory used by the factorization in MB
+};
+
+/// @brief Sets the fill-in ratio from nnz_factors and nnz_a
+static inline void set_fill_in_ratio(struct FactorsInfo *info) {
+    info->fill_in_ratio = info->nnz_a > 0 ? ((double)info->nnz_factors) / ((double)info->nnz_a) : 0.0;
+}
+
+/// @brief Defines the number of bytes in one megabyte
+#define BYTES_PER_MB 1048576.0
+
 // UMFPACK -------------------------------------------------------------------------------------------
 
 #define UMFPACK_PRINT_LEVEL_SILENT 0.0  // page 116
@@ -31,15 +57,31 @@
 // MUMPS ---------------------------------------------------------------------------------------------
 
 #define MUMPS_IGNORED 0 // to ignore the Fortran communicator since we're not using MPI
+#define MUMPS_USE_COMM_WORLD -987654 // special value selecting MPI_COMM_WORLD (with_mumps_mpi only)
 
 #define MUMPS_JOB_INITIALIZE -1 // section 5.1.1, page 24
 #define MUMPS_JOB_TERMINATE -2  // section 5.1.1, page 24
 #define MUMPS_JOB_ANALYZE 1     // section 5.1.1, page 24
 #define MUMPS_JOB_FACTORIZE 2   // section 5.1.1, page 25
 #define MUMPS_JOB_SOLVE 3       // section 5.1.1, page 25
+#define MUMPS_JOB_SAVE 7        // section 5.1.1 (save/restore feature)
+#define MUMPS_JOB_RESTORE 8     // section 5.1.1 (save/restore feature)
 
 #define MUMPS_PAR_HOST_ALSO_WORKS 1     // section 5.1.4, page 26
 #define MUMPS_ICNTL5_ASSEMBLED_MATRIX 0 // section 5.2.2, page 27
 #define MUMPS_ICNTL18_CENTRALIZED 0     // section 5.2.2, page 27
+#define MUMPS_ICNTL18_DISTRIBUTED 3     // section 5.2.2, page 27
 #define MUMPS_ICNTL6_PERMUT_AUTO 7      // section 5.3, page 32
+#define MUMPS_ICNTL7_USER_ORDERING 1    // section 5.4, page 33 (ordering given in perm_in)
 #define MUMPS_ICNTL28_SEQUENTIAL 1      // section 5.4, page 33
+#define MUMPS_ICNTL28_PARALLEL 2        // section 5.4, page 33
+#define MUMPS_ICNTL20_DENSE_RHS 0       // section 5.14 (sparse right-hand sides)
+#define MUMPS_ICNTL20_SPARSE_RHS 1      // section 5.14 (sparse right-hand sides; automatic pruning)
+#define MUMPS_ICNTL22_IN_CORE 0         // section 5.15 (out-of-core facility)
+#define MUMPS_ICNTL22_OUT_OF_CORE 1     // section 5.15 (out-of-core facility)
+#define MUMPS_ICNTL30_NO_INVERSE 0      // section 5.17 (entries of the inverse)
+#define MUMPS_ICNTL30_INVERSE 1         // section 5.17 (entries of the inverse)
+#define MUMPS_ICNTL35_BLR_NONE 0        // section 5.16 (block low-rank feature)
+#define MUMPS_ICNTL35_BLR_AUTO 1        // section 5.16 (block low-rank feature)
+#define MUMPS_ICNTL36_BLR_UFSC 0        // section 5.16 (block low-rank feature)
+#define MUMPS_ICNTL36_BLR_UCFS 1        // section 5.16 (block low-rank feature)
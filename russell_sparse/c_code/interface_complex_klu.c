@@ -96,12 +96,55 @@ int32_t complex_solver_klu_initialize(struct InterfaceComplexKLU *solver,
     return SUCCESSFUL_EXIT;
 }
 
+/// @brief Performs the numeric refactorization with the pivot sequence of the previous factorization
+/// @return C_TRUE if the refactorization succeeded and passed the pivot growth and condition checks
+static C_BOOL complex_solver_klu_refactor(struct InterfaceComplexKLU *solver,
+                                          double refactor_min_rgrowth,
+                                          double refactor_min_rcond,
+                                          const int32_t *col_pointers,
+                                          const int32_t *row_indices,
+                                          const COMPLEX64 *values) {
+    // remove "const" here assuming that klu will not change those variables
+    int status = klu_z_refactor((int32_t *)col_pointers,
+                                (int32_t *)row_indices,
+                                (COMPLEX64 *)values,
+                                solver->symbolic,
+                                solver->numeric,
+                                &solver->common);
+    if (status == C_FALSE) {
+        return C_FALSE;
+    }
+
+    // reciprocal pivot growth: a small value indicates that the old pivots became unstable
+    status = klu_z_rgrowth((int32_t *)col_pointers,
+                           (int32_t *)row_indices,
+                           (COMPLEX64 *)values,
+                           solver->symbolic,
+                           solver->numeric,
+                           &solver->common);
+    if (status == C_FALSE || solver->common.rgrowth < refactor_min_rgrowth) {
+        return C_FALSE;
+    }
+
+    // cheap reciprocal condition number estimate: min(abs(diag(U))) / max(abs(diag(U)))
+    status = klu_z_rcond(solver->symbolic, solver->numeric, &solver->common);
+    if (status == C_FALSE || solver->common.rcond < refactor_min_rcond) {
+        return C_FALSE;
+    }
+
+    return C_TRUE;
+}
+
 /// @brief Performs the numeric factorization
 int32_t complex_solver_klu_factorize(struct InterfaceComplexKLU *solver,
                                      int32_t *effective_ordering,
                                      int32_t *effective_scaling,
                                      double *cond_estimate,
                                      C_BOOL compute_cond,
+                                     C_BOOL *refactorized,
+                                     C_BOOL use_refactor,
+                                     double refactor_min_rgrowth,
+                                     double refactor_min_rcond,
                                      const int32_t *col_pointers,
                                      const int32_t *row_indices,
                                      const COMPLEX64 *values) {
@@ -113,20 +156,33 @@ int32_t complex_solver_klu_factorize(struct InterfaceComplexKLU *solver,
         return ERROR_NEED_INITIALIZATION;
     }
 
-    if (solver->factorization_completed == C_TRUE) {
-        // free the previous numeric to avoid memory leak
-        klu_free_numeric(&solver->numeric, &solver->common);
-        solver->numeric = NULL;
+    // try to reuse the pivot sequence of the previous factorization
+    *refactorized = C_FALSE;
+    if (use_refactor == C_TRUE && solver->factorization_completed == C_TRUE && solver->numeric != NULL) {
+        *refactorized = complex_solver_klu_refactor(solver,
+                                                    refactor_min_rgrowth,
+                                                    refactor_min_rcond,
+                                                    col_pointers,
+                                                    row_indices,
+                                                    values);
     }
 
-    // remove "const" here assuming that klu will not change those variables
-    solver->numeric = klu_z_factor((int32_t *)col_pointers,
-                                   (int32_t *)row_indices,
-                                   (COMPLEX64 *)values,
-                                   solver->symbolic,
-                                   &solver->common);
-    if (solver->numeric == NULL) {
-        return KLU_ERROR_FACTOR;
+    if (*refactorized == C_FALSE) {
+        if (solver->factorization_completed == C_TRUE) {
+            // free the previous numeric to avoid memory leak
+            klu_free_numeric(&solver->numeric, &solver->common);
+            solver->numeric = NULL;
+        }
+
+        // remove "const" here assuming that klu will not change those variables
+        solver->numeric = klu_z_factor((int32_t *)col_pointers,
+                                       (int32_t *)row_indices,
+                                       (COMPLEX64 *)values,
+                                       solver->symbolic,
+                                       &solver->common);
+        if (solver->numeric == NULL) {
+            return KLU_ERROR_FACTOR;
+        }
     }
 
     // save ordering and scaling
@@ -151,9 +207,42 @@ int32_t complex_solver_klu_factorize(struct InterfaceComplexKLU *solver,
     return SUCCESSFUL_EXIT;
 }
 
+/// @brief Gets the fill-in, flop count, and memory usage of the last factorization
+int32_t complex_solver_klu_get_factors_info(struct InterfaceComplexKLU *solver, struct FactorsInfo *factors_info) {
+    if (solver == NULL) {
+        return ERROR_NULL_POINTER;
+    }
+
+    if (solver->factorization_completed == C_FALSE) {
+        return ERROR_NEED_FACTORIZATION;
+    }
+
+    // the flop count is only computed on request
+    if (klu_z_flops(solver->symbolic, solver->numeric, &solver->common) == 0) {
+        return solver->common.status;
+    }
+
+    factors_info->nnz_a = solver->symbolic->nz;
+    factors_info->nnz_l = solver->numeric->lnz;
+    factors_info->nnz_u = solver->numeric->unz;
+    factors_info->nnz_factors = factors_info->nnz_l + factors_info->nnz_u;
+    factors_info->nnz_factors_estimate = solver->symbolic->lnz + solver->symbolic->unz;
+    factors_info->num_reallocations = solver->common.nrealloc;
+    factors_info->flops_estimate = solver->symbolic->est_flops > 0.0 ? solver->symbolic->est_flops : 0.0; // EMPTY = -1
+    factors_info->flops_assembly = 0.0;
+    factors_info->flops_elimination = solver->common.flops;
+    factors_info->memory_estimate_mb = 0.0;
+    factors_info->memory_peak_mb = ((double)solver->common.mempeak) / BYTES_PER_MB;
+    set_fill_in_ratio(factors_info);
+
+    return SUCCESSFUL_EXIT;
+}
+
 /// @brief Computes the solution of the linear system
+/// @param adjoint solves the conjugate transposed system (A^H x = rhs) with the same factorization
 int32_t complex_solver_klu_solve(struct InterfaceComplexKLU *solver,
                                  int32_t ndim,
+                                 C_BOOL adjoint,
                                  COMPLEX64 *in_rhs_out_x) {
     if (solver == NULL) {
         return ERROR_NULL_POINTER;
@@ -163,12 +252,22 @@ int32_t complex_solver_klu_solve(struct InterfaceComplexKLU *solver,
         return ERROR_NEED_FACTORIZATION;
     }
 
-    klu_z_solve(solver->symbolic,
-                solver->numeric,
-                ndim,
-                1,
-                in_rhs_out_x,
-                &solver->common);
+    if (adjoint == C_TRUE) {
+        klu_z_tsolve(solver->symbolic,
+                     solver->numeric,
+                     ndim,
+                     1,
+                     in_rhs_out_x,
+                     1, // conj_solve
+                     &solver->common);
+    } else {
+        klu_z_solve(solver->symbolic,
+                    solver->numeric,
+                    ndim,
+                    1,
+                    in_rhs_out_x,
+                    &solver->common);
+    }
 
     return SUCCESSFUL_EXIT;
 }
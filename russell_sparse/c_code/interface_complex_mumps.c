@@ -8,6 +8,7 @@
 #include "constants.h"
 
 #define ICNTL(i) icntl[(i)-1]   // macro to make indices match documentation
+#define CNTL(i) cntl[(i)-1]     // macro to make indices match documentation
 #define RINFOG(i) rinfog[(i)-1] // macro to make indices match documentation
 #define INFOG(i) infog[(i)-1]   // macro to make indices match documentation
 #define INFO(i) info[(i)-1]     // macro to make indices match documentation
@@ -42,6 +43,11 @@ static inline void set_mumps_verbose(ZMUMPS_STRUC_C *data, int32_t verbose) {
     }
 }
 
+/// @brief Converts a MUMPS counter from INFOG (a negative value means that the absolute value is in millions)
+static inline int64_t mumps_infog_counter(int32_t value) {
+    return value < 0 ? -((int64_t)value) * 1000000 : (int64_t)value;
+}
+
 /// @brief Allocates a new MUMPS interface
 struct InterfaceComplexMUMPS *complex_solver_mumps_new() {
     struct InterfaceComplexMUMPS *solver = (struct InterfaceComplexMUMPS *)malloc(sizeof(struct InterfaceComplexMUMPS));
@@ -53,6 +59,9 @@ struct InterfaceComplexMUMPS *complex_solver_mumps_new() {
     solver->data.irn = NULL;
     solver->data.jcn = NULL;
     solver->data.a = NULL;
+    solver->data.irn_loc = NULL;
+    solver->data.jcn_loc = NULL;
+    solver->data.a_loc = NULL;
     solver->done_job_init = C_FALSE;
     solver->initialization_completed = C_FALSE;
     solver->factorization_completed = C_FALSE;
@@ -70,6 +79,9 @@ void complex_solver_mumps_drop(struct InterfaceComplexMUMPS *solver) {
     solver->data.irn = NULL;
     solver->data.jcn = NULL;
     solver->data.a = NULL;
+    solver->data.irn_loc = NULL;
+    solver->data.jcn_loc = NULL;
+    solver->data.a_loc = NULL;
 
     if (solver->done_job_init == C_TRUE) {
         set_mumps_verbose(&solver->data, C_FALSE);
@@ -87,11 +99,19 @@ int32_t complex_solver_mumps_initialize(struct InterfaceComplexMUMPS *solver,
                                         int32_t pct_inc_workspace,
                                         int32_t max_work_memory,
                                         int32_t openmp_num_threads,
+                                        C_BOOL blr,
+                                        C_BOOL blr_ucfs,
+                                        double blr_tolerance,
+                                        C_BOOL out_of_core,
+                                        char const *ooc_tmpdir,
+                                        int32_t comm_fortran,
+                                        C_BOOL distributed,
+                                        C_BOOL parallel_analysis,
                                         C_BOOL verbose,
                                         C_BOOL general_symmetric,
                                         C_BOOL positive_definite,
                                         int32_t ndim,
-                                        int32_t nnz,
+                                        int64_t nnz,
                                         int32_t const *indices_i,
                                         int32_t const *indices_j,
                                         ZMUMPS_COMPLEX const *values_aij) {
@@ -103,7 +123,19 @@ int32_t complex_solver_mumps_initialize(struct InterfaceComplexMUMPS *solver,
         return ERROR_ALREADY_INITIALIZED;
     }
 
+    if (ooc_tmpdir != NULL && strlen(ooc_tmpdir) >= sizeof(solver->data.ooc_tmpdir)) {
+        return ERROR_PATH_TOO_LONG;
+    }
+
+#ifdef WITH_MUMPS_MPI
+    solver->data.comm_fortran = comm_fortran;
+#else
+    (void)comm_fortran; // only used with MPI
+    if (distributed == C_TRUE || parallel_analysis == C_TRUE) {
+        return ERROR_NOT_AVAILABLE;
+    }
     solver->data.comm_fortran = MUMPS_IGNORED;
+#endif
     solver->data.par = MUMPS_PAR_HOST_ALSO_WORKS;
     solver->data.sym = 0; // unsymmetric (page 27)
     if (general_symmetric == C_TRUE) {
@@ -137,16 +169,40 @@ int32_t complex_solver_mumps_initialize(struct InterfaceComplexMUMPS *solver,
     solver->data.ICNTL(8) = scaling;
     solver->data.ICNTL(14) = pct_inc_workspace;
     solver->data.ICNTL(16) = openmp_num_threads;
-    solver->data.ICNTL(18) = MUMPS_ICNTL18_CENTRALIZED;
+    solver->data.ICNTL(18) = distributed == C_TRUE ? MUMPS_ICNTL18_DISTRIBUTED : MUMPS_ICNTL18_CENTRALIZED;
     solver->data.ICNTL(23) = max_work_memory;
-    solver->data.ICNTL(28) = MUMPS_ICNTL28_SEQUENTIAL;
+    solver->data.ICNTL(28) = parallel_analysis == C_TRUE ? MUMPS_ICNTL28_PARALLEL : MUMPS_ICNTL28_SEQUENTIAL;
     solver->data.ICNTL(29) = MUMPS_IGNORED;
+    if (blr == C_TRUE) {
+        solver->data.ICNTL(35) = MUMPS_ICNTL35_BLR_AUTO;
+        solver->data.ICNTL(36) = blr_ucfs == C_TRUE ? MUMPS_ICNTL36_BLR_UCFS : MUMPS_ICNTL36_BLR_UFSC;
+        solver->data.CNTL(7) = blr_tolerance;
+    } else {
+        solver->data.ICNTL(35) = MUMPS_ICNTL35_BLR_NONE;
+    }
+    if (out_of_core == C_TRUE) {
+        solver->data.ICNTL(22) = MUMPS_ICNTL22_OUT_OF_CORE;
+        if (ooc_tmpdir != NULL) {
+            strncpy(solver->data.ooc_tmpdir, ooc_tmpdir, sizeof(solver->data.ooc_tmpdir) - 1);
+            solver->data.ooc_tmpdir[sizeof(solver->data.ooc_tmpdir) - 1] = '\0';
+        }
+    } else {
+        solver->data.ICNTL(22) = MUMPS_ICNTL22_IN_CORE;
+    }
 
     solver->data.n = ndim;
-    solver->data.nz = nnz;
-    solver->data.irn = (int *)indices_i;
-    solver->data.jcn = (int *)indices_j;
-    solver->data.a = (ZMUMPS_COMPLEX *)values_aij;
+    if (distributed == C_TRUE) {
+        // each process supplies its own entries (with global indices)
+        solver->data.nnz_loc = nnz;
+        solver->data.irn_loc = (int *)indices_i;
+        solver->data.jcn_loc = (int *)indices_j;
+        solver->data.a_loc = (ZMUMPS_COMPLEX *)values_aij;
+    } else {
+        solver->data.nnz = nnz; // 64-bit number of non-zeros (MUMPS >= 5.1)
+        solver->data.irn = (int *)indices_i;
+        solver->data.jcn = (int *)indices_j;
+        solver->data.a = (ZMUMPS_COMPLEX *)values_aij;
+    }
 
     set_mumps_verbose(&solver->data, verbose);
     solver->data.job = MUMPS_JOB_ANALYZE;
@@ -168,6 +224,11 @@ int32_t complex_solver_mumps_factorize(struct InterfaceComplexMUMPS *solver,
                                        double *determinant_coefficient_real,
                                        double *determinant_coefficient_imag,
                                        double *determinant_exponent,
+                                       int64_t *factors_entries,
+                                       int64_t *factors_entries_blr,
+                                       int64_t *ooc_estimated_memory_mb,
+                                       int64_t *effective_memory_mb,
+                                       double *ooc_disk_mb,
                                        C_BOOL compute_determinant,
                                        C_BOOL verbose) {
     if (solver == NULL) {
@@ -197,6 +258,11 @@ int32_t complex_solver_mumps_factorize(struct InterfaceComplexMUMPS *solver,
 
     *effective_ordering = solver->data.INFOG(7);
     *effective_scaling = solver->data.INFOG(33);
+    *factors_entries = mumps_infog_counter(solver->data.INFOG(29));
+    *factors_entries_blr = mumps_infog_counter(solver->data.INFOG(35));
+    *ooc_estimated_memory_mb = solver->data.INFOG(27);
+    *effective_memory_mb = solver->data.INFOG(22);
+    *ooc_disk_mb = solver->data.ICNTL(22) == MUMPS_ICNTL22_OUT_OF_CORE ? solver->data.RINFOG(16) : 0.0;
 
     // read the determinant
 
@@ -215,11 +281,40 @@ int32_t complex_solver_mumps_factorize(struct InterfaceComplexMUMPS *solver,
     return solver->data.INFOG(1);
 }
 
+/// @brief Gets the fill-in, flop count, and memory usage of the last factorization
+/// @note The memory values are the total over all processors
+int32_t complex_solver_mumps_get_factors_info(struct InterfaceComplexMUMPS *solver, struct FactorsInfo *factors_info) {
+    if (solver == NULL) {
+        return ERROR_NULL_POINTER;
+    }
+
+    if (solver->factorization_completed == C_FALSE) {
+        return ERROR_NEED_FACTORIZATION;
+    }
+
+    factors_info->nnz_a = solver->data.nnz > 0 ? solver->data.nnz : solver->data.nnz_loc; // local if distributed
+    factors_info->nnz_l = 0;
+    factors_info->nnz_u = 0;
+    factors_info->nnz_factors = mumps_infog_counter(solver->data.INFOG(9));
+    factors_info->nnz_factors_estimate = mumps_infog_counter(solver->data.INFOG(20));
+    factors_info->num_reallocations = 0;
+    factors_info->flops_estimate = solver->data.RINFOG(1);
+    factors_info->flops_assembly = solver->data.RINFOG(2);
+    factors_info->flops_elimination = solver->data.RINFOG(3);
+    factors_info->memory_estimate_mb = solver->data.INFOG(17);
+    factors_info->memory_peak_mb = solver->data.INFOG(19);
+    set_fill_in_ratio(factors_info);
+
+    return SUCCESSFUL_EXIT;
+}
+
 /// @brief Computes the solution of the linear system
 /// @param error_analysis_array_len_8 array of size 8 to hold the results from the error analysis
+/// @param transposed solves the (non-conjugate) transposed system (A^T x = rhs) with the same factorization; ICNTL(9)
 /// @param error_analysis_option ICNTL(11): 0 (nothing), 1 (all; slow), 2 (just errors)
 int32_t complex_solver_mumps_solve(struct InterfaceComplexMUMPS *solver,
                                    ZMUMPS_COMPLEX *rhs,
+                                   C_BOOL transposed,
                                    double *error_analysis_array_len_8,
                                    int32_t error_analysis_option,
                                    C_BOOL verbose) {
@@ -231,6 +326,7 @@ int32_t complex_solver_mumps_solve(struct InterfaceComplexMUMPS *solver,
         return ERROR_NEED_FACTORIZATION;
     }
 
+    solver->data.ICNTL(9) = transposed == C_TRUE ? 0 : 1;
     solver->data.ICNTL(11) = error_analysis_option;
 
     solver->data.rhs = rhs;
@@ -45,6 +45,10 @@ struct InterfaceComplexUMFPACK *complex_solver_umfpack_new() {
 
     umfpack_zi_defaults(solver->control);
 
+    for (int i = 0; i < UMFPACK_INFO; i++) {
+        solver->info[i] = 0.0;
+    }
+
     solver->symbolic = NULL;
     solver->numeric = NULL;
     solver->initialization_completed = C_FALSE;
@@ -183,10 +187,40 @@ int32_t complex_solver_umfpack_factorize(struct InterfaceComplexUMFPACK *solver,
     return code;
 }
 
+/// @brief Gets the fill-in, flop count, and memory usage of the last factorization
+int32_t complex_solver_umfpack_get_factors_info(struct InterfaceComplexUMFPACK *solver,
+                                                struct FactorsInfo *factors_info) {
+    if (solver == NULL) {
+        return ERROR_NULL_POINTER;
+    }
+
+    if (solver->factorization_completed == C_FALSE) {
+        return ERROR_NEED_FACTORIZATION;
+    }
+
+    double unit = solver->info[UMFPACK_SIZE_OF_UNIT];
+    factors_info->nnz_a = solver->info[UMFPACK_NZ];
+    factors_info->nnz_l = solver->info[UMFPACK_LNZ];
+    factors_info->nnz_u = solver->info[UMFPACK_UNZ];
+    factors_info->nnz_factors = factors_info->nnz_l + factors_info->nnz_u;
+    factors_info->nnz_factors_estimate = solver->info[UMFPACK_LNZ_ESTIMATE] + solver->info[UMFPACK_UNZ_ESTIMATE];
+    factors_info->num_reallocations = solver->info[UMFPACK_NUMERIC_REALLOC];
+    factors_info->flops_estimate = solver->info[UMFPACK_FLOPS_ESTIMATE];
+    factors_info->flops_assembly = 0.0;
+    factors_info->flops_elimination = solver->info[UMFPACK_FLOPS];
+    factors_info->memory_estimate_mb = solver->info[UMFPACK_PEAK_MEMORY_ESTIMATE] * unit / BYTES_PER_MB;
+    factors_info->memory_peak_mb = solver->info[UMFPACK_PEAK_MEMORY] * unit / BYTES_PER_MB;
+    set_fill_in_ratio(factors_info);
+
+    return SUCCESSFUL_EXIT;
+}
+
 /// @brief Computes the solution of the linear system
+/// @param adjoint solves the conjugate transposed system (A^H x = rhs) with the same factorization
 int32_t complex_solver_umfpack_solve(struct InterfaceComplexUMFPACK *solver,
                                      COMPLEX64 *x,
                                      const COMPLEX64 *rhs,
+                                     C_BOOL adjoint,
                                      const int32_t *col_pointers,
                                      const int32_t *row_indices,
                                      const COMPLEX64 *values,
@@ -201,7 +235,10 @@ int32_t complex_solver_umfpack_solve(struct InterfaceComplexUMFPACK *solver,
 
     set_complex_umfpack_verbose(solver, verbose);
 
-    int code = umfpack_zi_solve(UMFPACK_A,
+    // UMFPACK_At is the conjugate transpose for complex matrices (UMFPACK_Aat is the array transpose)
+    int sys = adjoint == C_TRUE ? UMFPACK_At : UMFPACK_A;
+
+    int code = umfpack_zi_solve(sys,
                                 col_pointers,
                                 row_indices,
                                 values,
@@ -58,9 +58,13 @@ void solver_klu_drop(struct InterfaceKLU *solver) {
 }
 
 /// @brief Performs the symbolic factorization
+/// @param row_permutation is the row permutation from a previous analysis (NULL => compute the ordering)
+/// @param col_permutation is the column permutation from a previous analysis (NULL => compute the ordering)
 int32_t solver_klu_initialize(struct InterfaceKLU *solver,
                               int32_t ordering,
                               int32_t scaling,
+                              const int32_t *row_permutation,
+                              const int32_t *col_permutation,
                               int32_t ndim,
                               const int32_t *col_pointers,
                               const int32_t *row_indices) {
@@ -83,10 +87,20 @@ int32_t solver_klu_initialize(struct InterfaceKLU *solver,
     }
 
     // remove "const" here assuming that klu will not change those variables
-    solver->symbolic = klu_analyze(ndim,
-                                   (int32_t *)col_pointers,
-                                   (int32_t *)row_indices,
-                                   &solver->common);
+    if (row_permutation != NULL && col_permutation != NULL) {
+        // skip the fill-reducing ordering (AMD/COLAMD)
+        solver->symbolic = klu_analyze_given(ndim,
+                                             (int32_t *)col_pointers,
+                                             (int32_t *)row_indices,
+                                             (int32_t *)row_permutation,
+                                             (int32_t *)col_permutation,
+                                             &solver->common);
+    } else {
+        solver->symbolic = klu_analyze(ndim,
+                                       (int32_t *)col_pointers,
+                                       (int32_t *)row_indices,
+                                       &solver->common);
+    }
     if (solver->symbolic == NULL) {
         return KLU_ERROR_ANALYZE;
     }
@@ -96,12 +110,105 @@ int32_t solver_klu_initialize(struct InterfaceKLU *solver,
     return SUCCESSFUL_EXIT;
 }
 
+/// @brief Computes the block triangular form (BTF) of a matrix via klu_analyze (the matrix is not factorized)
+/// @param num_blocks is the number of diagonal blocks of the BTF
+/// @param max_block_size is the dimension of the largest diagonal block
+/// @note This function does not need an interface because the symbolic factorization is discarded
+int32_t solver_klu_btf_probe(int32_t *num_blocks,
+                             int32_t *max_block_size,
+                             int32_t ndim,
+                             const int32_t *col_pointers,
+                             const int32_t *row_indices) {
+    klu_common common;
+    klu_defaults(&common);
+
+    // remove "const" here assuming that klu will not change those variables
+    klu_symbolic *symbolic = klu_analyze(ndim, (int32_t *)col_pointers, (int32_t *)row_indices, &common);
+    if (symbolic == NULL) {
+        return KLU_ERROR_ANALYZE;
+    }
+
+    *num_blocks = symbolic->nblocks;
+    *max_block_size = symbolic->maxblock;
+
+    klu_free_symbolic(&symbolic, &common);
+
+    return SUCCESSFUL_EXIT;
+}
+
+/// @brief Gets the row and column permutations computed by the symbolic factorization
+/// @param row_permutation is the output array with size equal to ndim
+/// @param col_permutation is the output array with size equal to ndim
+/// @note The permutations may be given to solver_klu_initialize of another solver (same sparsity pattern)
+int32_t solver_klu_get_ordering(struct InterfaceKLU *solver,
+                                int32_t ndim,
+                                int32_t *row_permutation,
+                                int32_t *col_permutation) {
+    if (solver == NULL) {
+        return ERROR_NULL_POINTER;
+    }
+
+    if (solver->initialization_completed == C_FALSE) {
+        return ERROR_NEED_INITIALIZATION;
+    }
+
+    for (int32_t k = 0; k < ndim; k++) {
+        row_permutation[k] = solver->symbolic->P[k];
+        col_permutation[k] = solver->symbolic->Q[k];
+    }
+
+    return SUCCESSFUL_EXIT;
+}
+
+/// @brief Performs the numeric refactorization with the pivot sequence of the previous factorization
+/// @return C_TRUE if the refactorization succeeded and passed the pivot growth and condition checks
+static C_BOOL solver_klu_refactor(struct InterfaceKLU *solver,
+                                  double refactor_min_rgrowth,
+                                  double refactor_min_rcond,
+                                  const int32_t *col_pointers,
+                                  const int32_t *row_indices,
+                                  const double *values) {
+    // remove "const" here assuming that klu will not change those variables
+    int status = klu_refactor((int32_t *)col_pointers,
+                              (int32_t *)row_indices,
+                              (double *)values,
+                              solver->symbolic,
+                              solver->numeric,
+                              &solver->common);
+    if (status == C_FALSE) {
+        return C_FALSE;
+    }
+
+    // reciprocal pivot growth: a small value indicates that the old pivots became unstable
+    status = klu_rgrowth((int32_t *)col_pointers,
+                         (int32_t *)row_indices,
+                         (double *)values,
+                         solver->symbolic,
+                         solver->numeric,
+                         &solver->common);
+    if (status == C_FALSE || solver->common.rgrowth < refactor_min_rgrowth) {
+        return C_FALSE;
+    }
+
+    // cheap reciprocal condition number estimate: min(abs(diag(U))) / max(abs(diag(U)))
+    status = klu_rcond(solver->symbolic, solver->numeric, &solver->common);
+    if (status == C_FALSE || solver->common.rcond < refactor_min_rcond) {
+        return C_FALSE;
+    }
+
+    return C_TRUE;
+}
+
 /// @brief Performs the numeric factorization
 int32_t solver_klu_factorize(struct InterfaceKLU *solver,
                              int32_t *effective_ordering,
                              int32_t *effective_scaling,
                              double *cond_estimate,
                              C_BOOL compute_cond,
+                             C_BOOL *refactorized,
+                             C_BOOL use_refactor,
+                             double refactor_min_rgrowth,
+                             double refactor_min_rcond,
                              const int32_t *col_pointers,
                              const int32_t *row_indices,
                              const double *values) {
@@ -113,20 +220,33 @@ int32_t solver_klu_factorize(struct InterfaceKLU *solver,
         return ERROR_NEED_INITIALIZATION;
     }
 
-    if (solver->factorization_completed == C_TRUE) {
-        // free the previous numeric to avoid memory leak
-        klu_free_numeric(&solver->numeric, &solver->common);
-        solver->numeric = NULL;
+    // try to reuse the pivot sequence of the previous factorization
+    *refactorized = C_FALSE;
+    if (use_refactor == C_TRUE && solver->factorization_completed == C_TRUE && solver->numeric != NULL) {
+        *refactorized = solver_klu_refactor(solver,
+                                            refactor_min_rgrowth,
+                                            refactor_min_rcond,
+                                            col_pointers,
+                                            row_indices,
+                                            values);
     }
 
-    // remove "const" here assuming that klu will not change those variables
-    solver->numeric = klu_factor((int32_t *)col_pointers,
-                                 (int32_t *)row_indices,
-                                 (double *)values,
-                                 solver->symbolic,
-                                 &solver->common);
-    if (solver->numeric == NULL) {
-        return KLU_ERROR_FACTOR;
+    if (*refactorized == C_FALSE) {
+        if (solver->factorization_completed == C_TRUE) {
+            // free the previous numeric to avoid memory leak
+            klu_free_numeric(&solver->numeric, &solver->common);
+            solver->numeric = NULL;
+        }
+
+        // remove "const" here assuming that klu will not change those variables
+        solver->numeric = klu_factor((int32_t *)col_pointers,
+                                     (int32_t *)row_indices,
+                                     (double *)values,
+                                     solver->symbolic,
+                                     &solver->common);
+        if (solver->numeric == NULL) {
+            return KLU_ERROR_FACTOR;
+        }
     }
 
     // save ordering and scaling
@@ -151,9 +271,43 @@ int32_t solver_klu_factorize(struct InterfaceKLU *solver,
     return SUCCESSFUL_EXIT;
 }
 
+/// @brief Gets the fill-in, flop count, and memory usage of the last factorization
+int32_t solver_klu_get_factors_info(struct InterfaceKLU *solver, struct FactorsInfo *factors_info) {
+    if (solver == NULL) {
+        return ERROR_NULL_POINTER;
+    }
+
+    if (solver->factorization_completed == C_FALSE) {
+        return ERROR_NEED_FACTORIZATION;
+    }
+
+    // the flop count is only computed on request
+    if (klu_flops(solver->symbolic, solver->numeric, &solver->common) == 0) {
+        return solver->common.status;
+    }
+
+    factors_info->nnz_a = solver->symbolic->nz;
+    factors_info->nnz_l = solver->numeric->lnz;
+    factors_info->nnz_u = solver->numeric->unz;
+    factors_info->nnz_factors = factors_info->nnz_l + factors_info->nnz_u;
+    factors_info->nnz_factors_estimate = solver->symbolic->lnz + solver->symbolic->unz;
+    factors_info->num_reallocations = solver->common.nrealloc;
+    factors_info->flops_estimate = solver->symbolic->est_flops > 0.0 ? solver->symbolic->est_flops : 0.0; // EMPTY = -1
+    factors_info->flops_assembly = 0.0;
+    factors_info->flops_elimination = solver->common.flops;
+    factors_info->memory_estimate_mb = 0.0;
+    factors_info->memory_peak_mb = ((double)solver->common.mempeak) / BYTES_PER_MB;
+    set_fill_in_ratio(factors_info);
+
+    return SUCCESSFUL_EXIT;
+}
+
 /// @brief Computes the solution of the linear system
+/// @param transposed solves the transposed system (A^T x = rhs) with the same factorization
 int32_t solver_klu_solve(struct InterfaceKLU *solver,
                          int32_t ndim,
+                         int32_t nrhs,
+                         C_BOOL transposed,
                          double *in_rhs_out_x) {
     if (solver == NULL) {
         return ERROR_NULL_POINTER;
@@ -163,12 +317,21 @@ int32_t solver_klu_solve(struct InterfaceKLU *solver,
         return ERROR_NEED_FACTORIZATION;
     }
 
-    klu_solve(solver->symbolic,
-              solver->numeric,
-              ndim,
-              1,
-              in_rhs_out_x,
-              &solver->common);
+    if (transposed == C_TRUE) {
+        klu_tsolve(solver->symbolic,
+                   solver->numeric,
+                   ndim,
+                   nrhs,
+                   in_rhs_out_x,
+                   &solver->common);
+    } else {
+        klu_solve(solver->symbolic,
+                  solver->numeric,
+                  ndim,
+                  nrhs,
+                  in_rhs_out_x,
+                  &solver->common);
+    }
 
     return SUCCESSFUL_EXIT;
 }
@@ -8,6 +8,7 @@
 #include "constants.h"
 
 #define ICNTL(i) icntl[(i)-1]   // macro to make indices match documentation
+#define CNTL(i) cntl[(i)-1]     // macro to make indices match documentation
 #define RINFOG(i) rinfog[(i)-1] // macro to make indices match documentation
 #define INFOG(i) infog[(i)-1]   // macro to make indices match documentation
 #define INFO(i) info[(i)-1]     // macro to make indices match documentation
@@ -42,6 +43,11 @@ static inline void set_mumps_verbose(DMUMPS_STRUC_C *data, int32_t verbose) {
     }
 }
 
+/// @brief Converts a MUMPS counter from INFOG (a negative value means that the absolute value is in millions)
+static inline int64_t mumps_infog_counter(int32_t value) {
+    return value < 0 ? -((int64_t)value) * 1000000 : (int64_t)value;
+}
+
 /// @brief Allocates a new MUMPS interface
 struct InterfaceMUMPS *solver_mumps_new() {
     struct InterfaceMUMPS *solver = (struct InterfaceMUMPS *)malloc(sizeof(struct InterfaceMUMPS));
@@ -53,6 +59,12 @@ struct InterfaceMUMPS *solver_mumps_new() {
     solver->data.irn = NULL;
     solver->data.jcn = NULL;
     solver->data.a = NULL;
+    solver->data.irn_loc = NULL;
+    solver->data.jcn_loc = NULL;
+    solver->data.a_loc = NULL;
+    solver->data.irhs_sparse = NULL;
+    solver->data.rhs_sparse = NULL;
+    solver->data.irhs_ptr = NULL;
     solver->done_job_init = C_FALSE;
     solver->initialization_completed = C_FALSE;
     solver->factorization_completed = C_FALSE;
@@ -70,6 +82,9 @@ void solver_mumps_drop(struct InterfaceMUMPS *solver) {
     solver->data.irn = NULL;
     solver->data.jcn = NULL;
     solver->data.a = NULL;
+    solver->data.irn_loc = NULL;
+    solver->data.jcn_loc = NULL;
+    solver->data.a_loc = NULL;
 
     if (solver->done_job_init == C_TRUE) {
         set_mumps_verbose(&solver->data, C_FALSE);
@@ -81,17 +96,27 @@ void solver_mumps_drop(struct InterfaceMUMPS *solver) {
 }
 
 /// @brief Perform analysis just once (considering that the matrix structure remains constant)
+/// @param user_ordering is the (one-based) pivot order from a previous analysis (NULL => compute the ordering)
 int32_t solver_mumps_initialize(struct InterfaceMUMPS *solver,
                                 int32_t ordering,
                                 int32_t scaling,
                                 int32_t pct_inc_workspace,
                                 int32_t max_work_memory,
                                 int32_t openmp_num_threads,
+                                C_BOOL blr,
+                                C_BOOL blr_ucfs,
+                                double blr_tolerance,
+                                C_BOOL out_of_core,
+                                char const *ooc_tmpdir,
+                                int32_t comm_fortran,
+                                C_BOOL distributed,
+                                C_BOOL parallel_analysis,
                                 C_BOOL verbose,
                                 C_BOOL general_symmetric,
                                 C_BOOL positive_definite,
+                                int32_t const *user_ordering,
                                 int32_t ndim,
-                                int32_t nnz,
+                                int64_t nnz,
                                 int32_t const *indices_i,
                                 int32_t const *indices_j,
                                 double const *values_aij) {
@@ -103,7 +128,19 @@ int32_t solver_mumps_initialize(struct InterfaceMUMPS *solver,
         return ERROR_ALREADY_INITIALIZED;
     }
 
+    if (ooc_tmpdir != NULL && strlen(ooc_tmpdir) >= sizeof(solver->data.ooc_tmpdir)) {
+        return ERROR_PATH_TOO_LONG;
+    }
+
+#ifdef WITH_MUMPS_MPI
+    solver->data.comm_fortran = comm_fortran;
+#else
+    (void)comm_fortran; // only used with MPI
+    if (distributed == C_TRUE || parallel_analysis == C_TRUE) {
+        return ERROR_NOT_AVAILABLE;
+    }
     solver->data.comm_fortran = MUMPS_IGNORED;
+#endif
     solver->data.par = MUMPS_PAR_HOST_ALSO_WORKS;
     solver->data.sym = 0; // unsymmetric (page 27)
     if (general_symmetric == C_TRUE) {
@@ -134,19 +171,48 @@ int32_t solver_mumps_initialize(struct InterfaceMUMPS *solver,
     solver->data.ICNTL(5) = MUMPS_ICNTL5_ASSEMBLED_MATRIX;
     solver->data.ICNTL(6) = MUMPS_ICNTL6_PERMUT_AUTO;
     solver->data.ICNTL(7) = ordering;
+    if (user_ordering != NULL) {
+        // skip the fill-reducing ordering (AMD/METIS/...)
+        solver->data.ICNTL(7) = MUMPS_ICNTL7_USER_ORDERING;
+        solver->data.perm_in = (int *)user_ordering;
+    }
     solver->data.ICNTL(8) = scaling;
     solver->data.ICNTL(14) = pct_inc_workspace;
     solver->data.ICNTL(16) = openmp_num_threads;
-    solver->data.ICNTL(18) = MUMPS_ICNTL18_CENTRALIZED;
+    solver->data.ICNTL(18) = distributed == C_TRUE ? MUMPS_ICNTL18_DISTRIBUTED : MUMPS_ICNTL18_CENTRALIZED;
     solver->data.ICNTL(23) = max_work_memory;
-    solver->data.ICNTL(28) = MUMPS_ICNTL28_SEQUENTIAL;
+    solver->data.ICNTL(28) = parallel_analysis == C_TRUE ? MUMPS_ICNTL28_PARALLEL : MUMPS_ICNTL28_SEQUENTIAL;
     solver->data.ICNTL(29) = MUMPS_IGNORED;
+    if (blr == C_TRUE) {
+        solver->data.ICNTL(35) = MUMPS_ICNTL35_BLR_AUTO;
+        solver->data.ICNTL(36) = blr_ucfs == C_TRUE ? MUMPS_ICNTL36_BLR_UCFS : MUMPS_ICNTL36_BLR_UFSC;
+        solver->data.CNTL(7) = blr_tolerance;
+    } else {
+        solver->data.ICNTL(35) = MUMPS_ICNTL35_BLR_NONE;
+    }
+    if (out_of_core == C_TRUE) {
+        solver->data.ICNTL(22) = MUMPS_ICNTL22_OUT_OF_CORE;
+        if (ooc_tmpdir != NULL) {
+            strncpy(solver->data.ooc_tmpdir, ooc_tmpdir, sizeof(solver->data.ooc_tmpdir) - 1);
+            solver->data.ooc_tmpdir[sizeof(solver->data.ooc_tmpdir) - 1] = '\0';
+        }
+    } else {
+        solver->data.ICNTL(22) = MUMPS_ICNTL22_IN_CORE;
+    }
 
     solver->data.n = ndim;
-    solver->data.nz = nnz;
-    solver->data.irn = (int *)indices_i;
-    solver->data.jcn = (int *)indices_j;
-    solver->data.a = (double *)values_aij;
+    if (distributed == C_TRUE) {
+        // each process supplies its own entries (with global indices)
+        solver->data.nnz_loc = nnz;
+        solver->data.irn_loc = (int *)indices_i;
+        solver->data.jcn_loc = (int *)indices_j;
+        solver->data.a_loc = (double *)values_aij;
+    } else {
+        solver->data.nnz = nnz; // 64-bit number of non-zeros (MUMPS >= 5.1)
+        solver->data.irn = (int *)indices_i;
+        solver->data.jcn = (int *)indices_j;
+        solver->data.a = (double *)values_aij;
+    }
 
     set_mumps_verbose(&solver->data, verbose);
     solver->data.job = MUMPS_JOB_ANALYZE;
@@ -161,12 +227,40 @@ int32_t solver_mumps_initialize(struct InterfaceMUMPS *solver,
     return SUCCESSFUL_EXIT;
 }
 
+/// @brief Gets the (one-based) pivot order computed by the analysis
+/// @param ordering is the output array with size equal to ndim
+/// @note The pivot order may be given to solver_mumps_initialize of another solver (same sparsity pattern)
+int32_t solver_mumps_get_ordering(struct InterfaceMUMPS *solver, int32_t ndim, int32_t *ordering) {
+    if (solver == NULL) {
+        return ERROR_NULL_POINTER;
+    }
+
+    if (solver->initialization_completed == C_FALSE) {
+        return ERROR_NEED_INITIALIZATION;
+    }
+
+    if (solver->data.sym_perm == NULL) {
+        return ERROR_NOT_AVAILABLE;
+    }
+
+    for (int32_t k = 0; k < ndim; k++) {
+        ordering[k] = solver->data.sym_perm[k];
+    }
+
+    return SUCCESSFUL_EXIT;
+}
+
 /// @brief Performs the factorization
 int32_t solver_mumps_factorize(struct InterfaceMUMPS *solver,
                                int32_t *effective_ordering,
                                int32_t *effective_scaling,
                                double *determinant_coefficient,
                                double *determinant_exponent,
+                               int64_t *factors_entries,
+                               int64_t *factors_entries_blr,
+                               int64_t *ooc_estimated_memory_mb,
+                               int64_t *effective_memory_mb,
+                               double *ooc_disk_mb,
                                C_BOOL compute_determinant,
                                C_BOOL verbose) {
     if (solver == NULL) {
@@ -196,6 +290,11 @@ int32_t solver_mumps_factorize(struct InterfaceMUMPS *solver,
 
     *effective_ordering = solver->data.INFOG(7);
     *effective_scaling = solver->data.INFOG(33);
+    *factors_entries = mumps_infog_counter(solver->data.INFOG(29));
+    *factors_entries_blr = mumps_infog_counter(solver->data.INFOG(35));
+    *ooc_estimated_memory_mb = solver->data.INFOG(27);
+    *effective_memory_mb = solver->data.INFOG(22);
+    *ooc_disk_mb = solver->data.ICNTL(22) == MUMPS_ICNTL22_OUT_OF_CORE ? solver->data.RINFOG(16) : 0.0;
 
     // read the determinant
 
@@ -212,11 +311,131 @@ int32_t solver_mumps_factorize(struct InterfaceMUMPS *solver,
     return solver->data.INFOG(1);
 }
 
+/// @brief Saves the analysis and factorization data (JOB=7) to files in save_dir named with save_prefix
+int32_t solver_mumps_save(struct InterfaceMUMPS *solver, char const *save_dir, char const *save_prefix) {
+    if (solver == NULL) {
+        return ERROR_NULL_POINTER;
+    }
+
+    if (solver->factorization_completed == C_FALSE) {
+        return ERROR_NEED_FACTORIZATION;
+    }
+
+    if (strlen(save_dir) >= sizeof(solver->data.save_dir) || strlen(save_prefix) >= sizeof(solver->data.save_prefix)) {
+        return ERROR_PATH_TOO_LONG;
+    }
+
+    strncpy(solver->data.save_dir, save_dir, sizeof(solver->data.save_dir) - 1);
+    solver->data.save_dir[sizeof(solver->data.save_dir) - 1] = '\0';
+    strncpy(solver->data.save_prefix, save_prefix, sizeof(solver->data.save_prefix) - 1);
+    solver->data.save_prefix[sizeof(solver->data.save_prefix) - 1] = '\0';
+
+    set_mumps_verbose(&solver->data, C_FALSE);
+    solver->data.job = MUMPS_JOB_SAVE;
+    dmumps_c(&solver->data);
+
+    return solver->data.INFOG(1);
+}
+
+/// @brief Restores the analysis and factorization data (JOB=8) saved by solver_mumps_save
+/// @note This function replaces solver_mumps_initialize and solver_mumps_factorize
+/// @note The matrix is not restored; thus, the error analysis (ICNTL(11)) is not available
+int32_t solver_mumps_restore(struct InterfaceMUMPS *solver,
+                             int32_t comm_fortran,
+                             C_BOOL general_symmetric,
+                             C_BOOL positive_definite,
+                             char const *save_dir,
+                             char const *save_prefix) {
+    if (solver == NULL) {
+        return ERROR_NULL_POINTER;
+    }
+
+    if (solver->initialization_completed == C_TRUE) {
+        return ERROR_ALREADY_INITIALIZED;
+    }
+
+    if (strlen(save_dir) >= sizeof(solver->data.save_dir) || strlen(save_prefix) >= sizeof(solver->data.save_prefix)) {
+        return ERROR_PATH_TOO_LONG;
+    }
+
+#ifdef WITH_MUMPS_MPI
+    solver->data.comm_fortran = comm_fortran;
+#else
+    (void)comm_fortran; // only used with MPI
+    solver->data.comm_fortran = MUMPS_IGNORED;
+#endif
+    solver->data.par = MUMPS_PAR_HOST_ALSO_WORKS;
+    solver->data.sym = 0; // unsymmetric (page 27)
+    if (general_symmetric == C_TRUE) {
+        solver->data.sym = 2; // general symmetric (page 27)
+    } else if (positive_definite == C_TRUE) {
+        solver->data.sym = 1; // symmetric positive-definite (page 27)
+    }
+
+    set_mumps_verbose(&solver->data, C_FALSE);
+    solver->data.job = MUMPS_JOB_INITIALIZE;
+    dmumps_c(&solver->data);
+    if (solver->data.INFOG(1) != 0) {
+        return solver->data.INFOG(1);
+    }
+
+    solver->done_job_init = C_TRUE;
+
+    strncpy(solver->data.save_dir, save_dir, sizeof(solver->data.save_dir) - 1);
+    solver->data.save_dir[sizeof(solver->data.save_dir) - 1] = '\0';
+    strncpy(solver->data.save_prefix, save_prefix, sizeof(solver->data.save_prefix) - 1);
+    solver->data.save_prefix[sizeof(solver->data.save_prefix) - 1] = '\0';
+
+    set_mumps_verbose(&solver->data, C_FALSE);
+    solver->data.job = MUMPS_JOB_RESTORE;
+    dmumps_c(&solver->data);
+    if (solver->data.INFOG(1) != 0) {
+        return solver->data.INFOG(1);
+    }
+
+    solver->initialization_completed = C_TRUE;
+    solver->factorization_completed = C_TRUE;
+
+    return SUCCESSFUL_EXIT;
+}
+
+/// @brief Gets the fill-in, flop count, and memory usage of the last factorization
+/// @note The memory values are the total over all processors
+int32_t solver_mumps_get_factors_info(struct InterfaceMUMPS *solver, struct FactorsInfo *factors_info) {
+    if (solver == NULL) {
+        return ERROR_NULL_POINTER;
+    }
+
+    if (solver->factorization_completed == C_FALSE) {
+        return ERROR_NEED_FACTORIZATION;
+    }
+
+    factors_info->nnz_a = solver->data.nnz > 0 ? solver->data.nnz : solver->data.nnz_loc; // local if distributed
+    factors_info->nnz_l = 0;
+    factors_info->nnz_u = 0;
+    factors_info->nnz_factors = mumps_infog_counter(solver->data.INFOG(9));
+    factors_info->nnz_factors_estimate = mumps_infog_counter(solver->data.INFOG(20));
+    factors_info->num_reallocations = 0;
+    factors_info->flops_estimate = solver->data.RINFOG(1);
+    factors_info->flops_assembly = solver->data.RINFOG(2);
+    factors_info->flops_elimination = solver->data.RINFOG(3);
+    factors_info->memory_estimate_mb = solver->data.INFOG(17);
+    factors_info->memory_peak_mb = solver->data.INFOG(19);
+    set_fill_in_ratio(factors_info);
+
+    return SUCCESSFUL_EXIT;
+}
+
 /// @brief Computes the solution of the linear system
 /// @param error_analysis_array_len_8 array of size 8 to hold the results from the error analysis
 /// @param error_analysis_option ICNTL(11): 0 (nothing), 1 (all; slow), 2 (just errors)
+/// @param nrhs number of right-hand sides stored (col-major) in rhs, with leading dimension equal to n
+/// @param transposed solves the transposed system (A^T x = rhs) with the same factorization; ICNTL(9)
+/// @note The error analysis is only performed if nrhs is 1
 int32_t solver_mumps_solve(struct InterfaceMUMPS *solver,
                            double *rhs,
+                           int32_t nrhs,
+                           C_BOOL transposed,
                            double *error_analysis_array_len_8,
                            int32_t error_analysis_option,
                            C_BOOL verbose) {
@@ -228,9 +447,17 @@ int32_t solver_mumps_solve(struct InterfaceMUMPS *solver,
         return ERROR_NEED_FACTORIZATION;
     }
 
+    if (nrhs != 1) {
+        error_analysis_option = 0;
+    }
+    solver->data.ICNTL(9) = transposed == C_TRUE ? 0 : 1;
     solver->data.ICNTL(11) = error_analysis_option;
+    solver->data.ICNTL(20) = MUMPS_ICNTL20_DENSE_RHS;
+    solver->data.ICNTL(30) = MUMPS_ICNTL30_NO_INVERSE;
 
     solver->data.rhs = rhs;
+    solver->data.nrhs = nrhs;
+    solver->data.lrhs = solver->data.n;
 
     set_mumps_verbose(&solver->data, verbose);
     solver->data.job = MUMPS_JOB_SOLVE;
@@ -251,3 +478,96 @@ int32_t solver_mumps_solve(struct InterfaceMUMPS *solver,
 
     return solver->data.INFOG(1);
 }
+
+/// @brief Computes the solution of the linear system with a sparse right-hand side
+/// @param x array of size n to hold the (dense) solution
+/// @param nz_rhs number of non-zero values of the right-hand side
+/// @param irhs_sparse array of size nz_rhs with the (one-based) row indices of the non-zero values
+/// @param rhs_sparse array of size nz_rhs with the non-zero values
+/// @param irhs_ptr array of size 2 with the (one-based) pointers to the first and one-past-the-last entries
+/// @note MUMPS exploits the sparsity of the right-hand side by pruning the elimination tree; ICNTL(20)
+int32_t solver_mumps_solve_sparse_rhs(struct InterfaceMUMPS *solver,
+                                      double *x,
+                                      int32_t nz_rhs,
+                                      int32_t *irhs_sparse,
+                                      double *rhs_sparse,
+                                      int32_t *irhs_ptr,
+                                      C_BOOL verbose) {
+    if (solver == NULL) {
+        return ERROR_NULL_POINTER;
+    }
+
+    if (solver->factorization_completed == C_FALSE) {
+        return ERROR_NEED_FACTORIZATION;
+    }
+
+    solver->data.ICNTL(9) = 1;
+    solver->data.ICNTL(11) = 0;
+    solver->data.ICNTL(20) = MUMPS_ICNTL20_SPARSE_RHS;
+    solver->data.ICNTL(30) = MUMPS_ICNTL30_NO_INVERSE;
+
+    solver->data.rhs = x;
+    solver->data.nrhs = 1;
+    solver->data.lrhs = solver->data.n;
+    solver->data.nz_rhs = nz_rhs;
+    solver->data.irhs_sparse = irhs_sparse;
+    solver->data.rhs_sparse = rhs_sparse;
+    solver->data.irhs_ptr = irhs_ptr;
+
+    set_mumps_verbose(&solver->data, verbose);
+    solver->data.job = MUMPS_JOB_SOLVE;
+    dmumps_c(&solver->data);
+
+    // prevent MUMPS from using these later
+    solver->data.irhs_sparse = NULL;
+    solver->data.rhs_sparse = NULL;
+    solver->data.irhs_ptr = NULL;
+
+    return solver->data.INFOG(1);
+}
+
+/// @brief Computes selected entries of the inverse matrix
+/// @param nz_rhs number of requested entries
+/// @param irhs_sparse array of size nz_rhs with the (one-based) row indices of the requested entries (sorted by column)
+/// @param rhs_sparse array of size nz_rhs to hold the computed entries
+/// @param irhs_ptr array of size n+1 with the (one-based) pointers to the first entry of each column
+/// @note MUMPS only computes the requested entries by pruning the elimination tree; ICNTL(30)
+int32_t solver_mumps_inverse_entries(struct InterfaceMUMPS *solver,
+                                     int32_t nz_rhs,
+                                     int32_t *irhs_sparse,
+                                     double *rhs_sparse,
+                                     int32_t *irhs_ptr,
+                                     C_BOOL verbose) {
+    if (solver == NULL) {
+        return ERROR_NULL_POINTER;
+    }
+
+    if (solver->factorization_completed == C_FALSE) {
+        return ERROR_NEED_FACTORIZATION;
+    }
+
+    solver->data.ICNTL(9) = 1;
+    solver->data.ICNTL(11) = 0;
+    solver->data.ICNTL(20) = MUMPS_ICNTL20_DENSE_RHS;
+    solver->data.ICNTL(30) = MUMPS_ICNTL30_INVERSE;
+
+    solver->data.rhs = NULL;
+    solver->data.nrhs = solver->data.n;
+    solver->data.lrhs = solver->data.n;
+    solver->data.nz_rhs = nz_rhs;
+    solver->data.irhs_sparse = irhs_sparse;
+    solver->data.rhs_sparse = rhs_sparse;
+    solver->data.irhs_ptr = irhs_ptr;
+
+    set_mumps_verbose(&solver->data, verbose);
+    solver->data.job = MUMPS_JOB_SOLVE;
+    dmumps_c(&solver->data);
+
+    // prevent MUMPS from using these later
+    solver->data.irhs_sparse = NULL;
+    solver->data.rhs_sparse = NULL;
+    solver->data.irhs_ptr = NULL;
+    solver->data.ICNTL(30) = MUMPS_ICNTL30_NO_INVERSE;
+
+    return solver->data.INFOG(1);
+}
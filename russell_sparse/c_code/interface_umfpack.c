@@ -45,6 +45,10 @@ struct InterfaceUMFPACK *solver_umfpack_new() {
 
     umfpack_di_defaults(solver->control);
 
+    for (int i = 0; i < UMFPACK_INFO; i++) {
+        solver->info[i] = 0.0;
+    }
+
     solver->symbolic = NULL;
     solver->numeric = NULL;
     solver->initialization_completed = C_FALSE;
@@ -72,11 +76,13 @@ void solver_umfpack_drop(struct InterfaceUMFPACK *solver) {
 }
 
 /// @brief Performs the symbolic factorization
+/// @param col_permutation is the column pre-ordering from a previous analysis (NULL => compute the ordering)
 int32_t solver_umfpack_initialize(struct InterfaceUMFPACK *solver,
                                   int32_t ordering,
                                   int32_t scaling,
                                   C_BOOL verbose,
                                   C_BOOL enforce_unsymmetric_strategy,
+                                  const int32_t *col_permutation,
                                   int32_t ndim,
                                   const int32_t *col_pointers,
                                   const int32_t *row_indices,
@@ -99,7 +105,20 @@ int32_t solver_umfpack_initialize(struct InterfaceUMFPACK *solver,
 
     set_umfpack_verbose(solver, verbose);
 
-    int code = umfpack_di_symbolic(ndim,
+    int code = UMFPACK_OK;
+    if (col_permutation != NULL) {
+        // skip the fill-reducing ordering (AMD/COLAMD/METIS)
+        code = umfpack_di_qsymbolic(ndim,
+                                    ndim,
+                                    col_pointers,
+                                    row_indices,
+                                    values,
+                                    col_permutation,
+                                    &solver->symbolic,
+                                    solver->control,
+                                    solver->info);
+    } else {
+        code = umfpack_di_symbolic(ndim,
                                    ndim,
                                    col_pointers,
                                    row_indices,
@@ -107,6 +126,7 @@ int32_t solver_umfpack_initialize(struct InterfaceUMFPACK *solver,
                                    &solver->symbolic,
                                    solver->control,
                                    solver->info);
+    }
     if (code != UMFPACK_OK) {
         return code;
     }
@@ -178,10 +198,119 @@ int32_t solver_umfpack_factorize(struct InterfaceUMFPACK *solver,
     return code;
 }
 
+/// @brief Gets the column permutation used by the numeric factorization
+/// @param col_permutation is the output array with size equal to ndim
+/// @note The permutation may be given to solver_umfpack_initialize of another solver (same sparsity pattern)
+int32_t solver_umfpack_get_ordering(struct InterfaceUMFPACK *solver, int32_t *col_permutation) {
+    if (solver == NULL) {
+        return ERROR_NULL_POINTER;
+    }
+
+    if (solver->factorization_completed == C_FALSE) {
+        return ERROR_NEED_FACTORIZATION;
+    }
+
+    return umfpack_di_get_numeric(NULL,
+                                  NULL,
+                                  NULL,
+                                  NULL,
+                                  NULL,
+                                  NULL,
+                                  NULL,
+                                  col_permutation,
+                                  NULL,
+                                  NULL,
+                                  NULL,
+                                  solver->numeric);
+}
+
+/// @brief Saves the symbolic and numeric factorizations to files
+/// @param symbolic_path is the full path of the file with the symbolic factorization
+/// @param numeric_path is the full path of the file with the numeric factorization
+int32_t solver_umfpack_save(struct InterfaceUMFPACK *solver, char const *symbolic_path, char const *numeric_path) {
+    if (solver == NULL) {
+        return ERROR_NULL_POINTER;
+    }
+
+    if (solver->factorization_completed == C_FALSE) {
+        return ERROR_NEED_FACTORIZATION;
+    }
+
+    // remove "const" here assuming that umfpack will not change those variables
+    int code = umfpack_di_save_symbolic(solver->symbolic, (char *)symbolic_path);
+    if (code != UMFPACK_OK) {
+        return code;
+    }
+
+    return umfpack_di_save_numeric(solver->numeric, (char *)numeric_path);
+}
+
+/// @brief Loads the symbolic and numeric factorizations saved by solver_umfpack_save
+/// @note This function replaces solver_umfpack_initialize and solver_umfpack_factorize
+int32_t solver_umfpack_load(struct InterfaceUMFPACK *solver, char const *symbolic_path, char const *numeric_path) {
+    if (solver == NULL) {
+        return ERROR_NULL_POINTER;
+    }
+
+    if (solver->initialization_completed == C_TRUE) {
+        return ERROR_ALREADY_INITIALIZED;
+    }
+
+    // remove "const" here assuming that umfpack will not change those variables
+    int code = umfpack_di_load_symbolic(&solver->symbolic, (char *)symbolic_path);
+    if (code != UMFPACK_OK) {
+        return code;
+    }
+
+    code = umfpack_di_load_numeric(&solver->numeric, (char *)numeric_path);
+    if (code != UMFPACK_OK) {
+        return code;
+    }
+
+    solver->initialization_completed = C_TRUE;
+    solver->factorization_completed = C_TRUE;
+
+    return SUCCESSFUL_EXIT;
+}
+
+/// @brief Gets the fill-in, flop count, and memory usage of the last factorization
+int32_t solver_umfpack_get_factors_info(struct InterfaceUMFPACK *solver, struct FactorsInfo *factors_info) {
+    if (solver == NULL) {
+        return ERROR_NULL_POINTER;
+    }
+
+    if (solver->factorization_completed == C_FALSE) {
+        return ERROR_NEED_FACTORIZATION;
+    }
+
+    double unit = solver->info[UMFPACK_SIZE_OF_UNIT];
+    factors_info->nnz_a = solver->info[UMFPACK_NZ];
+    factors_info->nnz_l = solver->info[UMFPACK_LNZ];
+    factors_info->nnz_u = solver->info[UMFPACK_UNZ];
+    factors_info->nnz_factors = factors_info->nnz_l + factors_info->nnz_u;
+    factors_info->nnz_factors_estimate = solver->info[UMFPACK_LNZ_ESTIMATE] + solver->info[UMFPACK_UNZ_ESTIMATE];
+    factors_info->num_reallocations = solver->info[UMFPACK_NUMERIC_REALLOC];
+    factors_info->flops_estimate = solver->info[UMFPACK_FLOPS_ESTIMATE];
+    factors_info->flops_assembly = 0.0;
+    factors_info->flops_elimination = solver->info[UMFPACK_FLOPS];
+    factors_info->memory_estimate_mb = solver->info[UMFPACK_PEAK_MEMORY_ESTIMATE] * unit / BYTES_PER_MB;
+    factors_info->memory_peak_mb = solver->info[UMFPACK_PEAK_MEMORY] * unit / BYTES_PER_MB;
+    set_fill_in_ratio(factors_info);
+
+    return SUCCESSFUL_EXIT;
+}
+
 /// @brief Computes the solution of the linear system
+/// @param x is the (ndim, nrhs) col-major block of unknowns
+/// @param rhs is the (ndim, nrhs) col-major block of right-hand sides
+/// @param transposed solves the transposed system (A^T x = rhs) with the same factorization
+/// @note UMFPACK works with one right-hand side at a time; thus, we loop over the columns here
 int32_t solver_umfpack_solve(struct InterfaceUMFPACK *solver,
                              double *x,
                              const double *rhs,
+                             int32_t ndim,
+                             int32_t nrhs,
+                             C_BOOL transposed,
                              const int32_t *col_pointers,
                              const int32_t *row_indices,
                              const double *values,
@@ -196,15 +325,22 @@ int32_t solver_umfpack_solve(struct InterfaceUMFPACK *solver,
 
     set_umfpack_verbose(solver, verbose);
 
-    int code = umfpack_di_solve(UMFPACK_A,
+    int sys = transposed == C_TRUE ? UMFPACK_At : UMFPACK_A;
+    int code = UMFPACK_OK;
+    for (int32_t k = 0; k < nrhs; k++) {
+        code = umfpack_di_solve(sys,
                                 col_pointers,
                                 row_indices,
                                 values,
-                                x,
-                                rhs,
+                                &x[k * ndim],
+                                &rhs[k * ndim],
                                 solver->numeric,
                                 solver->control,
                                 solver->info);
+        if (code != UMFPACK_OK) {
+            break;
+        }
+    }
     if (verbose == C_TRUE) {
         umfpack_di_report_info(solver->control, solver->info);
     }
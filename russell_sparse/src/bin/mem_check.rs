@@ -8,6 +8,8 @@ fn test_solver(genie: Genie) {
         Genie::Klu => println!("Testing KLU solver\n"),
         Genie::Mumps => println!("Testing MUMPS solver\n"),
         Genie::Umfpack => println!("Testing UMFPACK solver\n"),
+        Genie::Iterative => println!("Testing Iterative solver\n"),
+        Genie::Auto => println!("Testing Auto solver\n"),
     }
 
     let mut solver = match LinSolver::new(genie) {
@@ -59,6 +61,8 @@ fn test_complex_solver(genie: Genie) {
         Genie::Klu => println!("Testing Complex KLU solver\n"),
         Genie::Mumps => println!("Testing Complex MUMPS solver\n"),
         Genie::Umfpack => println!("Testing Complex UMFPACK solver\n"),
+        Genie::Iterative => println!("Testing Complex Iterative solver\n"),
+        Genie::Auto => println!("Testing Complex Auto solver\n"),
     }
 
     let mut solver = match ComplexLinSolver::new(genie) {
@@ -73,6 +77,8 @@ fn test_complex_solver(genie: Genie) {
         Genie::Klu => Samples::complex_symmetric_3x3_full().0,
         Genie::Mumps => Samples::complex_symmetric_3x3_lower().0,
         Genie::Umfpack => Samples::complex_symmetric_3x3_full().0,
+        Genie::Iterative => Samples::complex_symmetric_3x3_full().0,
+        Genie::Auto => Samples::complex_symmetric_3x3_full().0,
     };
     let mut mat = ComplexSparseMatrix::from_coo(coo);
 
@@ -114,6 +120,8 @@ fn test_solver_singular(genie: Genie) {
         Genie::Klu => println!("Testing KLU solver (singular matrix)\n"),
         Genie::Mumps => println!("Testing MUMPS solver (singular matrix)\n"),
         Genie::Umfpack => println!("Testing UMFPACK solver (singular matrix)\n"),
+        Genie::Iterative => println!("Testing Iterative solver (singular matrix)\n"),
+        Genie::Auto => println!("Testing Auto solver (singular matrix)\n"),
     }
 
     let (ndim, nnz) = (2, 2);
@@ -147,6 +155,7 @@ fn main() {
     test_solver(Genie::Klu);
     test_solver(Genie::Mumps);
     test_solver(Genie::Umfpack);
+    test_solver(Genie::Auto);
 
     // complex
     test_complex_solver(Genie::Klu);
@@ -1,5 +1,8 @@
 use russell_lab::{cpx, set_num_threads, using_intel_mkl, Complex64, ComplexVector, Stopwatch, StrError, Vector};
 use russell_sparse::prelude::*;
+use std::fs;
+use std::path::Path;
+use std::time::UNIX_EPOCH;
 use structopt::StructOpt;
 
 /// Command line options
@@ -32,6 +35,14 @@ struct Options {
     #[structopt(short = "n", long, default_value = "0")]
     nt: u32,
 
+    /// Number of threads to parse the Matrix-Market file (0 means the serial reader)
+    #[structopt(long, default_value = "0")]
+    read_nt: u32,
+
+    /// Caches the (real) matrix in a binary file within /tmp/russell_sparse/cache to skip parsing in the next runs
+    #[structopt(long)]
+    binary_cache: bool,
+
     /// Overrides the prevention of number-of-threads issue with OpenBLAS (not recommended)
     #[structopt(long)]
     override_prevent_issue: bool,
@@ -82,6 +93,8 @@ fn main() -> Result<(), StrError> {
         Genie::Klu => MMsym::MakeItFull,
         Genie::Mumps => MMsym::LeaveAsLower,
         Genie::Umfpack => MMsym::MakeItFull,
+        Genie::Iterative => MMsym::MakeItFull,
+        Genie::Auto => MMsym::MakeItFull,
     };
 
     // configuration parameters
@@ -107,7 +120,39 @@ fn main() -> Result<(), StrError> {
 
     // read the matrix
     let mut sw = Stopwatch::new();
-    let (coo_real, coo_complex) = read_matrix_market(&opt.matrix_market_file, handling)?;
+    let cache = if opt.binary_cache {
+        // the size and modification time of the source file are in the key; thus, an edited file is parsed again
+        let metadata = fs::metadata(&opt.matrix_market_file).map_err(|_| "cannot read the matrix file metadata")?;
+        let mtime = metadata
+            .modified()
+            .ok()
+            .and_then(|t| t.duration_since(UNIX_EPOCH).ok())
+            .map_or(0, |d| d.as_nanos());
+        format!(
+            "/tmp/russell_sparse/cache/{}_{:?}_{}_{}.coo.bin",
+            Path::new(&opt.matrix_market_file)
+                .file_stem()
+                .unwrap_or_default()
+                .to_string_lossy(),
+            handling,
+            metadata.len(),
+            mtime
+        )
+    } else {
+        String::new()
+    };
+    let (coo_real, coo_complex) = if opt.binary_cache && Path::new(&cache).exists() {
+        (Some(CooMatrix::read_binary(&cache)?), None)
+    } else if opt.read_nt > 0 {
+        read_matrix_market_parallel(&opt.matrix_market_file, handling, opt.read_nt as usize)?
+    } else {
+        read_matrix_market(&opt.matrix_market_file, handling)?
+    };
+    if opt.binary_cache && !Path::new(&cache).exists() {
+        if let Some(coo) = &coo_real {
+            coo.write_binary(&cache)?;
+        }
+    }
     stats.time_nanoseconds.read_matrix = sw.stop();
 
     // --- real ---------------------------------------------------------------------------------
@@ -157,6 +202,8 @@ fn main() -> Result<(), StrError> {
                 Genie::Klu => 1e-10,
                 Genie::Mumps => 1e-10,
                 Genie::Umfpack => 1e-10,
+                Genie::Iterative => 1e-6,
+                Genie::Auto => 1e-10,
             };
             let correct_x = get_bfwb62_correct_x();
             for i in 0..nrow {
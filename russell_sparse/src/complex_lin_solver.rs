@@ -54,6 +54,38 @@ pub trait ComplexLinSolTrait {
         verbose: bool,
     ) -> Result<(), StrError>;
 
+    /// Computes the solution of the conjugate transposed (adjoint) linear system
+    ///
+    /// Solves the linear system:
+    ///
+    /// ```text
+    ///   Aᴴ  · x = rhs
+    /// (n,m)  (m)  (n)
+    /// ```
+    ///
+    /// where `Aᴴ = conj(Aᵀ)`.
+    ///
+    /// # Output
+    ///
+    /// * `x` -- the vector of unknown values with dimension equal to mat.nrow
+    ///
+    /// # Input
+    ///
+    /// * `mat` -- the coefficient matrix A.
+    /// * `rhs` -- the right-hand side vector with know values an dimension equal to mat.ncol
+    /// * `verbose` -- shows messages
+    ///
+    /// **Note:** The factorization computed by `factorize` is reused (no new factorization is needed).
+    ///
+    /// **Warning:** the matrix must be same one used in `factorize`.
+    fn solve_adjoint(
+        &mut self,
+        x: &mut ComplexVector,
+        mat: &ComplexSparseMatrix,
+        rhs: &ComplexVector,
+        verbose: bool,
+    ) -> Result<(), StrError>;
+
     /// Updates the stats structure (should be called after solve)
     fn update_stats(&self, stats: &mut StatsLinSol);
 
@@ -85,12 +117,16 @@ impl<'a> ComplexLinSolver<'a> {
             Genie::Klu => Box::new(ComplexSolverKLU::new()?),
             Genie::Mumps => Box::new(ComplexSolverMUMPS::new()?),
             Genie::Umfpack => Box::new(ComplexSolverUMFPACK::new()?),
+            Genie::Iterative => return Err("the iterative solver is not available for complex matrices"),
+            Genie::Auto => return Err("the automatic selection is not available for complex matrices"),
         };
         #[cfg(not(feature = "with_mumps"))]
         let actual: Box<dyn Send + ComplexLinSolTrait> = match genie {
             Genie::Klu => Box::new(ComplexSolverKLU::new()?),
             Genie::Mumps => return Err("MUMPS solver is not available"),
             Genie::Umfpack => Box::new(ComplexSolverUMFPACK::new()?),
+            Genie::Iterative => return Err("the iterative solver is not available for complex matrices"),
+            Genie::Auto => return Err("the automatic selection is not available for complex matrices"),
         };
         Ok(ComplexLinSolver { actual })
     }
@@ -1,5 +1,5 @@
 use super::{handle_klu_error_code, klu_ordering, klu_scaling};
-use super::{ComplexLinSolTrait, ComplexSparseMatrix, LinSolParams, StatsLinSol, Sym};
+use super::{ComplexLinSolTrait, ComplexSparseMatrix, LinSolParams, StatsLinSol, StatsLinSolFactors, Sym};
 use super::{KLU_ORDERING_AMD, KLU_ORDERING_COLAMD, KLU_SCALE_MAX, KLU_SCALE_NONE, KLU_SCALE_SUM};
 use crate::constants::*;
 use crate::StrError;
@@ -41,11 +41,24 @@ extern "C" {
         effective_scaling: *mut i32,
         cond_estimate: *mut f64,
         compute_cond: CcBool,
+        refactorized: *mut CcBool,
+        use_refactor: CcBool,
+        refactor_min_rgrowth: f64,
+        refactor_min_rcond: f64,
         col_pointers: *const i32,
         row_indices: *const i32,
         values: *const Complex64,
     ) -> i32;
-    fn complex_solver_klu_solve(solver: *mut InterfaceComplexKLU, ndim: i32, in_rhs_out_x: *mut Complex64) -> i32;
+    fn complex_solver_klu_get_factors_info(
+        solver: *mut InterfaceComplexKLU,
+        factors_info: *mut StatsLinSolFactors,
+    ) -> i32;
+    fn complex_solver_klu_solve(
+        solver: *mut InterfaceComplexKLU,
+        ndim: i32,
+        adjoint: CcBool,
+        in_rhs_out_x: *mut Complex64,
+    ) -> i32;
 }
 
 /// Wraps the KLU solver for sparse linear systems
@@ -79,6 +92,15 @@ pub struct ComplexSolverKLU {
     /// Holds the 1-norm condition number estimate (after factorize)
     cond_estimate: f64,
 
+    /// Indicates whether the last factorization has reused the previous pivot sequence (klu_refactor)
+    refactorized: CcBool,
+
+    /// Holds the fill-in, flop count, and memory usage of the last factorization
+    factors_info: StatsLinSolFactors,
+
+    /// Time spent on the COO to CSC conversion (in factorize)
+    time_convert_ns: u128,
+
     /// Stopwatch to measure computation times
     stopwatch: Stopwatch,
 
@@ -119,6 +141,9 @@ impl ComplexSolverKLU {
                 effective_ordering: -1,
                 effective_scaling: -1,
                 cond_estimate: 0.0,
+                refactorized: 0,
+                factors_info: StatsLinSolFactors::default(),
+                time_convert_ns: 0,
                 stopwatch: Stopwatch::new(),
                 time_initialize_ns: 0,
                 time_factorize_ns: 0,
@@ -126,6 +151,61 @@ impl ComplexSolverKLU {
             })
         }
     }
+
+    /// Computes the solution of the linear system or of the conjugate transposed (adjoint) system
+    fn solve_system(
+        &mut self,
+        x: &mut ComplexVector,
+        mat: &ComplexSparseMatrix,
+        rhs: &ComplexVector,
+        adjoint: bool,
+        _verbose: bool,
+    ) -> Result<(), StrError> {
+        // check
+        if !self.factorized {
+            return Err("the function factorize must be called before solve");
+        }
+
+        // access CSC matrix
+        // (possibly already converted from COO, because factorize was (should have been) called)
+        let csc = mat.get_csc()?;
+
+        // check already factorized data
+        let (nrow, ncol, nnz, sym) = csc.get_info();
+        if sym != self.initialized_sym {
+            return Err("solve must use the same matrix (symmetric differs)");
+        }
+        if nrow != self.initialized_ndim || ncol != self.initialized_ndim {
+            return Err("solve must use the same matrix (ndim differs)");
+        }
+        if nnz != self.initialized_nnz {
+            return Err("solve must use the same matrix (nnz differs)");
+        }
+
+        // check vectors
+        if x.dim() != self.initialized_ndim {
+            return Err("the dimension of the vector of unknown values x is incorrect");
+        }
+        if rhs.dim() != self.initialized_ndim {
+            return Err("the dimension of the right-hand side vector is incorrect");
+        }
+
+        // call KLU solve
+        let ndim = to_i32(self.initialized_ndim);
+        let adj = if adjoint { 1 } else { 0 };
+        complex_vec_copy(x, rhs).unwrap();
+        self.stopwatch.reset();
+        unsafe {
+            let status = complex_solver_klu_solve(self.solver, ndim, adj, x.as_mut_data().as_mut_ptr());
+            if status != SUCCESSFUL_EXIT {
+                return Err(handle_klu_error_code(status));
+            }
+        }
+        self.time_solve_ns = self.stopwatch.stop();
+
+        // done
+        Ok(())
+    }
 }
 
 impl ComplexLinSolTrait for ComplexSolverKLU {
@@ -148,10 +228,15 @@ impl ComplexLinSolTrait for ComplexSolverKLU {
     /// 3. If the structure of the matrix needs to be changed, the solver must
     ///    be "dropped" and a new solver allocated.
     /// 4. For symmetric matrices, `KLU` requires [Sym::YesFull]
+    /// 5. If [LinSolParams::klu_use_refactor] is set, the subsequent calls to `factorize` will
+    ///    reuse the previous pivot sequence (klu_refactor) unless the pivot growth or condition
+    ///    number checks fail, in which case a full factorization is performed.
     fn factorize(&mut self, mat: &mut ComplexSparseMatrix, params: Option<LinSolParams>) -> Result<(), StrError> {
         // get CSC matrix
         // (or convert from COO if CSC is not available and COO is available)
+        self.stopwatch.reset();
         let csc = mat.get_csc_or_from_coo()?;
+        self.time_convert_ns = self.stopwatch.stop();
 
         // check
         if self.initialized {
@@ -185,6 +270,7 @@ impl ComplexLinSolTrait for ComplexSolverKLU {
 
         // requests
         let compute_cond = if par.compute_condition_numbers { 1 } else { 0 };
+        let use_refactor = if par.klu_use_refactor { 1 } else { 0 };
 
         // matrix config
         let ndim = to_i32(csc.nrow);
@@ -218,6 +304,10 @@ impl ComplexLinSolTrait for ComplexSolverKLU {
                 &mut self.effective_scaling,
                 &mut self.cond_estimate,
                 compute_cond,
+                &mut self.refactorized,
+                use_refactor,
+                par.klu_refactor_min_rgrowth,
+                par.klu_refactor_min_rcond,
                 csc.col_pointers.as_ptr(),
                 csc.row_indices.as_ptr(),
                 csc.values.as_ptr(),
@@ -228,6 +318,14 @@ impl ComplexLinSolTrait for ComplexSolverKLU {
         }
         self.time_factorize_ns = self.stopwatch.stop();
 
+        // get the fill-in, flop count, and memory usage
+        unsafe {
+            let status = complex_solver_klu_get_factors_info(self.solver, &mut self.factors_info);
+            if status != SUCCESSFUL_EXIT {
+                return Err(handle_klu_error_code(status));
+            }
+        }
+
         // done
         self.factorized = true;
         Ok(())
@@ -258,51 +356,41 @@ impl ComplexLinSolTrait for ComplexSolverKLU {
         x: &mut ComplexVector,
         mat: &ComplexSparseMatrix,
         rhs: &ComplexVector,
-        _verbose: bool,
+        verbose: bool,
     ) -> Result<(), StrError> {
-        // check
-        if !self.factorized {
-            return Err("the function factorize must be called before solve");
-        }
-
-        // access CSC matrix
-        // (possibly already converted from COO, because factorize was (should have been) called)
-        let csc = mat.get_csc()?;
-
-        // check already factorized data
-        let (nrow, ncol, nnz, sym) = csc.get_info();
-        if sym != self.initialized_sym {
-            return Err("solve must use the same matrix (symmetric differs)");
-        }
-        if nrow != self.initialized_ndim || ncol != self.initialized_ndim {
-            return Err("solve must use the same matrix (ndim differs)");
-        }
-        if nnz != self.initialized_nnz {
-            return Err("solve must use the same matrix (nnz differs)");
-        }
-
-        // check vectors
-        if x.dim() != self.initialized_ndim {
-            return Err("the dimension of the vector of unknown values x is incorrect");
-        }
-        if rhs.dim() != self.initialized_ndim {
-            return Err("the dimension of the right-hand side vector is incorrect");
-        }
-
-        // call KLU solve
-        let ndim = to_i32(self.initialized_ndim);
-        complex_vec_copy(x, rhs).unwrap();
-        self.stopwatch.reset();
-        unsafe {
-            let status = complex_solver_klu_solve(self.solver, ndim, x.as_mut_data().as_mut_ptr());
-            if status != SUCCESSFUL_EXIT {
-                return Err(handle_klu_error_code(status));
-            }
-        }
-        self.time_solve_ns = self.stopwatch.stop();
+        self.solve_system(x, mat, rhs, false, verbose)
+    }
 
-        // done
-        Ok(())
+    /// Computes the solution of the conjugate transposed (adjoint) linear system
+    ///
+    /// Solves the linear system:
+    ///
+    /// ```text
+    ///   Aᴴ  · x = rhs
+    /// (m,m)  (m)  (m)
+    /// ```
+    ///
+    /// # Output
+    ///
+    /// * `x` -- the vector of unknown values with dimension equal to mat.nrow
+    ///
+    /// # Input
+    ///
+    /// * `mat` -- the coefficient matrix A; must be square and, if symmetric, [Sym::YesFull].
+    /// * `rhs` -- the right-hand side vector with know values an dimension equal to mat.nrow
+    /// * `verbose` -- NOT AVAILABLE
+    ///
+    /// **Note:** The factorization computed by `factorize` is reused (no new factorization is needed).
+    ///
+    /// **Warning:** the matrix must be same one used in `factorize`.
+    fn solve_adjoint(
+        &mut self,
+        x: &mut ComplexVector,
+        mat: &ComplexSparseMatrix,
+        rhs: &ComplexVector,
+        verbose: bool,
+    ) -> Result<(), StrError> {
+        self.solve_system(x, mat, rhs, true, verbose)
     }
 
     /// Updates the stats structure (should be called after solve)
@@ -327,6 +415,8 @@ impl ComplexLinSolTrait for ComplexSolverKLU {
         stats.time_nanoseconds.initialize = self.time_initialize_ns;
         stats.time_nanoseconds.factorize = self.time_factorize_ns;
         stats.time_nanoseconds.solve = self.time_solve_ns;
+        stats.time_nanoseconds.convert_matrix = self.time_convert_ns;
+        stats.factors = self.factors_info;
     }
 
     /// Returns the nanoseconds spent on initialize
@@ -441,6 +531,40 @@ mod tests {
         solver.factorize(&mut mat, Some(params)).unwrap();
     }
 
+    #[test]
+    fn factorize_with_refactor_works() {
+        let mut solver = ComplexSolverKLU::new().unwrap();
+        let mut mat = ComplexSparseMatrix::new_coo(2, 2, 3, Sym::No).unwrap();
+        mat.put(0, 0, cpx!(2.0, 0.0)).unwrap();
+        mat.put(0, 1, cpx!(1.0, 0.0)).unwrap();
+        mat.put(1, 1, cpx!(4.0, 0.0)).unwrap();
+        let mut params = LinSolParams::new();
+        params.klu_use_refactor = true;
+
+        // the first call performs the full factorization
+        solver.factorize(&mut mat, Some(params)).unwrap();
+        assert_eq!(solver.refactorized, 0);
+
+        // the subsequent calls reuse the pivot sequence
+        mat.reset().unwrap();
+        mat.put(0, 0, cpx!(4.0, 1.0)).unwrap();
+        mat.put(0, 1, cpx!(2.0, 0.0)).unwrap();
+        mat.put(1, 1, cpx!(5.0, 0.0)).unwrap();
+        solver.factorize(&mut mat, Some(params)).unwrap();
+        assert_eq!(solver.refactorized, 1);
+        let mut x = ComplexVector::new(2);
+        let rhs = ComplexVector::from(&[cpx!(8.0, 1.0), cpx!(10.0, 0.0)]);
+        solver.solve(&mut x, &mat, &rhs, false).unwrap();
+        complex_vec_approx_eq(&x, &[cpx!(1.0, 0.0), cpx!(2.0, 0.0)], 1e-15);
+
+        // the checks fail and the full factorization is performed
+        params.klu_refactor_min_rgrowth = 2.0; // rgrowth ≤ 1
+        solver.factorize(&mut mat, Some(params)).unwrap();
+        assert_eq!(solver.refactorized, 0);
+        solver.solve(&mut x, &mat, &rhs, false).unwrap();
+        complex_vec_approx_eq(&x, &[cpx!(1.0, 0.0), cpx!(2.0, 0.0)], 1e-15);
+    }
+
     #[test]
     fn factorize_fails_on_singular_matrix() {
         let mut solver = ComplexSolverKLU::new().unwrap();
@@ -537,5 +661,35 @@ mod tests {
         solver.update_stats(&mut stats);
         assert_eq!(stats.output.effective_ordering, "Amd");
         assert_eq!(stats.output.effective_scaling, "Max");
+        let (_, _, nnz, _) = mat.get_csc().unwrap().get_info();
+        assert_eq!(stats.factors.nnz_a, nnz as i64);
+        assert_eq!(stats.factors.nnz_factors, stats.factors.nnz_l + stats.factors.nnz_u);
+        assert!(stats.factors.nnz_factors > 0);
+        assert!(stats.factors.fill_in_ratio > 0.0);
+        assert!(stats.factors.flops_elimination > 0.0);
+        assert!(stats.factors.memory_peak_mb > 0.0);
+    }
+
+    #[test]
+    fn solve_adjoint_works() {
+        // A = [[1+i, 2], [0, 3-i]]
+        let mut coo = ComplexCooMatrix::new(2, 2, 3, Sym::No).unwrap();
+        coo.put(0, 0, cpx!(1.0, 1.0)).unwrap();
+        coo.put(0, 1, cpx!(2.0, 0.0)).unwrap();
+        coo.put(1, 1, cpx!(3.0, -1.0)).unwrap();
+        let mut mat = ComplexSparseMatrix::from_coo(coo);
+        let mut solver = ComplexSolverKLU::new().unwrap();
+        solver.factorize(&mut mat, None).unwrap();
+
+        // Aᴴ · x = rhs with x = [1, i]
+        let mut x = ComplexVector::new(2);
+        let rhs = ComplexVector::from(&[cpx!(1.0, -1.0), cpx!(1.0, 3.0)]);
+        solver.solve_adjoint(&mut x, &mat, &rhs, false).unwrap();
+        complex_vec_approx_eq(&x, &[cpx!(1.0, 0.0), cpx!(0.0, 1.0)], 1e-15);
+
+        // A · x = rhs with x = [1, i]
+        let rhs = ComplexVector::from(&[cpx!(1.0, 3.0), cpx!(1.0, 3.0)]);
+        solver.solve(&mut x, &mat, &rhs, false).unwrap();
+        complex_vec_approx_eq(&x, &[cpx!(1.0, 0.0), cpx!(0.0, 1.0)], 1e-15);
     }
 }
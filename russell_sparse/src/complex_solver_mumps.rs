@@ -1,5 +1,5 @@
-use super::{handle_mumps_error_code, mumps_ordering, mumps_scaling};
-use super::{ComplexLinSolTrait, ComplexSparseMatrix, LinSolParams, StatsLinSol, Sym};
+use super::{handle_mumps_error_code, mumps_ordering, mumps_scaling, MUMPS_GLOBAL_LOCK};
+use super::{ComplexLinSolTrait, ComplexSparseMatrix, LinSolParams, StatsLinSol, StatsLinSolFactors, Sym};
 use super::{
     MUMPS_ORDERING_AMD, MUMPS_ORDERING_AMF, MUMPS_ORDERING_AUTO, MUMPS_ORDERING_METIS, MUMPS_ORDERING_PORD,
     MUMPS_ORDERING_QAMD, MUMPS_ORDERING_SCOTCH, MUMPS_SCALING_AUTO, MUMPS_SCALING_COLUMN, MUMPS_SCALING_DIAGONAL,
@@ -8,6 +8,7 @@ use super::{
 use crate::constants::*;
 use crate::StrError;
 use russell_lab::{complex_vec_copy, using_intel_mkl, Complex64, ComplexVector, Stopwatch};
+use std::ffi::c_char;
 
 /// Opaque struct holding a C-pointer to InterfaceComplexMUMPS
 ///
@@ -38,11 +39,19 @@ extern "C" {
         pct_inc_workspace: i32,
         max_work_memory: i32,
         openmp_num_threads: i32,
+        blr: CcBool,
+        blr_ucfs: CcBool,
+        blr_tolerance: f64,
+        out_of_core: CcBool,
+        ooc_tmpdir: *const c_char,
+        comm_fortran: i32,
+        distributed: CcBool,
+        parallel_analysis: CcBool,
         verbose: CcBool,
         general_symmetric: CcBool,
         positive_definite: CcBool,
         ndim: i32,
-        nnz: i32,
+        nnz: i64,
         indices_i: *const i32,
         indices_j: *const i32,
         values_aij: *const Complex64,
@@ -54,12 +63,22 @@ extern "C" {
         determinant_coefficient_real: *mut f64,
         determinant_coefficient_imag: *mut f64,
         determinant_exponent: *mut f64,
+        factors_entries: *mut i64,
+        factors_entries_blr: *mut i64,
+        ooc_estimated_memory_mb: *mut i64,
+        effective_memory_mb: *mut i64,
+        ooc_disk_mb: *mut f64,
         compute_determinant: CcBool,
         verbose: CcBool,
     ) -> i32;
+    fn complex_solver_mumps_get_factors_info(
+        solver: *mut InterfaceComplexMUMPS,
+        factors_info: *mut StatsLinSolFactors,
+    ) -> i32;
     fn complex_solver_mumps_solve(
         solver: *mut InterfaceComplexMUMPS,
         rhs: *mut Complex64,
+        transposed: CcBool,
         error_analysis_array_len_8: *mut f64,
         error_analysis_option: i32,
         verbose: CcBool,
@@ -68,7 +87,11 @@ extern "C" {
 
 /// Wraps the MUMPS solver for (very large) sparse linear systems
 ///
-/// **Warning:** This solver is **not** thread-safe, thus use only use in single-thread applications.
+/// **Warning:** The MUMPS library is **not** guaranteed to be thread-safe, thus use only use in single-thread
+/// applications. Nonetheless, the calls involving the global state of MUMPS (initialization/analysis and
+/// termination) are serialized by a lock shared by the real and complex solvers. Thus, if MUMPS has been
+/// compiled thread-safe (e.g., with OpenMP and recursive Fortran procedures), two distinct instances
+/// may be factorized and solved concurrently (e.g., the real and complex systems of Radau5).
 pub struct ComplexSolverMUMPS {
     /// Holds a pointer to the C interface to MUMPS
     solver: *mut InterfaceComplexMUMPS,
@@ -112,6 +135,21 @@ pub struct ComplexSolverMUMPS {
     /// det = coefficient * pow(2, exponent)
     determinant_exponent: f64,
 
+    /// Holds the effective number of entries in the factors, INFOG(29) (after factorize)
+    factors_entries: i64,
+
+    /// Holds the effective number of entries in the factors after the BLR compression, INFOG(35) (after factorize)
+    factors_entries_blr: i64,
+
+    /// Holds the estimated memory in MB for the out-of-core factorization, INFOG(27)
+    ooc_estimated_memory_mb: i64,
+
+    /// Holds the effective memory in MB used by the factorization, INFOG(22)
+    effective_memory_mb: i64,
+
+    /// Holds the disk space in MB used by the out-of-core files, RINFOG(16)
+    ooc_disk_mb: f64,
+
     /// MUMPS code for error analysis (after solve)
     ///
     /// ICNTL(11): 0 (nothing), 1 (all; slow), 2 (just errors)
@@ -120,6 +158,9 @@ pub struct ComplexSolverMUMPS {
     /// Holds the error analysis "stat" results
     error_analysis_array_len_8: Vec<f64>,
 
+    /// Holds the fill-in, flop count, and memory usage of the last factorization
+    factors_info: StatsLinSolFactors,
+
     /// Stopwatch to measure computation times
     stopwatch: Stopwatch,
 
@@ -142,6 +183,7 @@ pub struct ComplexSolverMUMPS {
 impl Drop for ComplexSolverMUMPS {
     /// Tells the c-code to release memory
     fn drop(&mut self) {
+        let _guard = MUMPS_GLOBAL_LOCK.lock().unwrap_or_else(|e| e.into_inner());
         unsafe {
             complex_solver_mumps_drop(self.solver);
         }
@@ -169,8 +211,14 @@ impl ComplexSolverMUMPS {
                 determinant_coefficient_real: 0.0,
                 determinant_coefficient_imag: 0.0,
                 determinant_exponent: 0.0,
+                factors_entries: 0,
+                factors_entries_blr: 0,
+                ooc_estimated_memory_mb: 0,
+                effective_memory_mb: 0,
+                ooc_disk_mb: 0.0,
                 error_analysis_option: 0,
                 error_analysis_array_len_8: vec![0.0; 8],
+                factors_info: StatsLinSolFactors::default(),
                 stopwatch: Stopwatch::new(),
                 time_initialize_ns: 0,
                 time_factorize_ns: 0,
@@ -180,6 +228,74 @@ impl ComplexSolverMUMPS {
             })
         }
     }
+
+    /// Computes the solution of the linear system or of the conjugate transposed (adjoint) system
+    fn solve_system(
+        &mut self,
+        x: &mut ComplexVector,
+        mat: &ComplexSparseMatrix,
+        rhs: &ComplexVector,
+        adjoint: bool,
+        verbose: bool,
+    ) -> Result<(), StrError> {
+        // check
+        if !self.factorized {
+            return Err("the function factorize must be called before solve");
+        }
+
+        // access COO matrix
+        let coo = mat.get_coo()?;
+
+        // check already factorized data
+        let (nrow, ncol, nnz, sym) = coo.get_info();
+        if sym != self.initialized_sym {
+            return Err("solve must use the same matrix (symmetric differs)");
+        }
+        if nrow != self.initialized_ndim || ncol != self.initialized_ndim {
+            return Err("solve must use the same matrix (ndim differs)");
+        }
+        if nnz != self.initialized_nnz {
+            return Err("solve must use the same matrix (nnz differs)");
+        }
+
+        // check vectors
+        if x.dim() != self.initialized_ndim {
+            return Err("the dimension of the vector of unknown values x is incorrect");
+        }
+        if rhs.dim() != self.initialized_ndim {
+            return Err("the dimension of the right-hand side vector is incorrect");
+        }
+
+        // call MUMPS solve
+        // (MUMPS solves Aᵀ·x = rhs only; thus, Aᴴ·x = rhs is solved via Aᵀ·conj(x) = conj(rhs))
+        complex_vec_copy(x, rhs).unwrap();
+        if adjoint {
+            x.as_mut_data().iter_mut().for_each(|v| *v = v.conj());
+        }
+        let trans = if adjoint { 1 } else { 0 };
+        let verb = if verbose { 1 } else { 0 };
+        self.stopwatch.reset();
+        unsafe {
+            let status = complex_solver_mumps_solve(
+                self.solver,
+                x.as_mut_data().as_mut_ptr(),
+                trans,
+                self.error_analysis_array_len_8.as_mut_ptr(),
+                self.error_analysis_option,
+                verb,
+            );
+            if status != SUCCESSFUL_EXIT {
+                return Err(handle_mumps_error_code(status));
+            }
+        }
+        self.time_solve_ns = self.stopwatch.stop();
+        if adjoint {
+            x.as_mut_data().iter_mut().for_each(|v| *v = v.conj());
+        }
+
+        // done
+        Ok(())
+    }
 }
 
 impl ComplexLinSolTrait for ComplexSolverMUMPS {
@@ -265,17 +381,26 @@ impl ComplexLinSolTrait for ComplexSolverMUMPS {
 
         // requests
         let compute_determinant = if par.compute_determinant { 1 } else { 0 };
+        let blr = if par.mumps_blr { 1 } else { 0 };
+        let blr_ucfs = if par.mumps_blr_ucfs { 1 } else { 0 };
+        let out_of_core = if par.mumps_out_of_core { 1 } else { 0 };
+        let distributed = if par.mumps_distributed_input { 1 } else { 0 };
+        let parallel_analysis = if par.mumps_parallel_analysis { 1 } else { 0 };
+        if !cfg!(feature = "with_mumps_mpi") && (par.mumps_distributed_input || par.mumps_parallel_analysis) {
+            return Err("the distributed input and the parallel analysis require the with_mumps_mpi feature");
+        }
         let verbose = if par.verbose { 1 } else { 0 };
 
         // matrix config
         let general_symmetric = if coo.symmetric == Sym::YesLower { 1 } else { 0 };
         let positive_definite = if par.positive_definite { 1 } else { 0 };
         let ndim = to_i32(coo.nrow);
-        let nnz = to_i32(coo.nnz);
+        let nnz = to_i64(coo.nnz); // MUMPS takes a 64-bit nnz
 
         // call initialize just once
         if !self.initialized {
             self.stopwatch.reset();
+            let _guard = MUMPS_GLOBAL_LOCK.lock().unwrap_or_else(|e| e.into_inner());
             unsafe {
                 let status = complex_solver_mumps_initialize(
                     self.solver,
@@ -284,6 +409,14 @@ impl ComplexLinSolTrait for ComplexSolverMUMPS {
                     pct_inc_workspace,
                     max_work_memory,
                     self.effective_num_threads,
+                    blr,
+                    blr_ucfs,
+                    par.mumps_blr_tolerance,
+                    out_of_core,
+                    par.get_mumps_ooc_tmpdir_ptr(),
+                    par.mumps_comm_fortran,
+                    distributed,
+                    parallel_analysis,
                     verbose,
                     general_symmetric,
                     positive_definite,
@@ -311,6 +444,11 @@ impl ComplexLinSolTrait for ComplexSolverMUMPS {
                 &mut self.determinant_coefficient_real,
                 &mut self.determinant_coefficient_imag,
                 &mut self.determinant_exponent,
+                &mut self.factors_entries,
+                &mut self.factors_entries_blr,
+                &mut self.ooc_estimated_memory_mb,
+                &mut self.effective_memory_mb,
+                &mut self.ooc_disk_mb,
                 compute_determinant,
                 verbose,
             );
@@ -320,6 +458,14 @@ impl ComplexLinSolTrait for ComplexSolverMUMPS {
         }
         self.time_factorize_ns = self.stopwatch.stop();
 
+        // get the fill-in, flop count, and memory usage
+        unsafe {
+            let status = complex_solver_mumps_get_factors_info(self.solver, &mut self.factors_info);
+            if status != SUCCESSFUL_EXIT {
+                return Err(handle_mumps_error_code(status));
+            }
+        }
+
         // done
         self.factorized = true;
         Ok(())
@@ -352,54 +498,39 @@ impl ComplexLinSolTrait for ComplexSolverMUMPS {
         rhs: &ComplexVector,
         verbose: bool,
     ) -> Result<(), StrError> {
-        // check
-        if !self.factorized {
-            return Err("the function factorize must be called before solve");
-        }
-
-        // access COO matrix
-        let coo = mat.get_coo()?;
-
-        // check already factorized data
-        let (nrow, ncol, nnz, sym) = coo.get_info();
-        if sym != self.initialized_sym {
-            return Err("solve must use the same matrix (symmetric differs)");
-        }
-        if nrow != self.initialized_ndim || ncol != self.initialized_ndim {
-            return Err("solve must use the same matrix (ndim differs)");
-        }
-        if nnz != self.initialized_nnz {
-            return Err("solve must use the same matrix (nnz differs)");
-        }
-
-        // check vectors
-        if x.dim() != self.initialized_ndim {
-            return Err("the dimension of the vector of unknown values x is incorrect");
-        }
-        if rhs.dim() != self.initialized_ndim {
-            return Err("the dimension of the right-hand side vector is incorrect");
-        }
-
-        // call MUMPS solve
-        complex_vec_copy(x, rhs).unwrap();
-        let verb = if verbose { 1 } else { 0 };
-        self.stopwatch.reset();
-        unsafe {
-            let status = complex_solver_mumps_solve(
-                self.solver,
-                x.as_mut_data().as_mut_ptr(),
-                self.error_analysis_array_len_8.as_mut_ptr(),
-                self.error_analysis_option,
-                verb,
-            );
-            if status != SUCCESSFUL_EXIT {
-                return Err(handle_mumps_error_code(status));
-            }
-        }
-        self.time_solve_ns = self.stopwatch.stop();
+        self.solve_system(x, mat, rhs, false, verbose)
+    }
 
-        // done
-        Ok(())
+    /// Computes the solution of the conjugate transposed (adjoint) linear system
+    ///
+    /// Solves the linear system:
+    ///
+    /// ```text
+    ///   Aᴴ  · x = rhs
+    /// (m,m)  (m)  (m)
+    /// ```
+    ///
+    /// # Output
+    ///
+    /// * `x` -- the vector of unknown values with dimension equal to mat.nrow
+    ///
+    /// # Input
+    ///
+    /// * `mat` -- the coefficient matrix A; must be square and, if symmetric, [Sym::YesLower].
+    /// * `rhs` -- the right-hand side vector with know values an dimension equal to mat.nrow
+    /// * `verbose` -- shows messages
+    ///
+    /// **Note:** The factorization computed by `factorize` is reused (no new factorization is needed).
+    ///
+    /// **Warning:** the matrix must be same one used in `factorize`.
+    fn solve_adjoint(
+        &mut self,
+        x: &mut ComplexVector,
+        mat: &ComplexSparseMatrix,
+        rhs: &ComplexVector,
+        verbose: bool,
+    ) -> Result<(), StrError> {
+        self.solve_system(x, mat, rhs, true, verbose)
     }
 
     /// Updates the stats structure (should be called after solve)
@@ -439,9 +570,15 @@ impl ComplexLinSolTrait for ComplexSolverMUMPS {
         stats.mumps_stats.normalized_delta_x = self.error_analysis_array_len_8[5];
         stats.mumps_stats.condition_number1 = self.error_analysis_array_len_8[6];
         stats.mumps_stats.condition_number2 = self.error_analysis_array_len_8[7];
+        stats.mumps_stats.factors_entries = self.factors_entries;
+        stats.mumps_stats.factors_entries_blr = self.factors_entries_blr;
+        stats.mumps_stats.ooc_estimated_memory_mb = self.ooc_estimated_memory_mb;
+        stats.mumps_stats.effective_memory_mb = self.effective_memory_mb;
+        stats.mumps_stats.ooc_disk_mb = self.ooc_disk_mb;
         stats.time_nanoseconds.initialize = self.time_initialize_ns;
         stats.time_nanoseconds.factorize = self.time_factorize_ns;
         stats.time_nanoseconds.solve = self.time_solve_ns;
+        stats.factors = self.factors_info;
     }
 
     /// Returns the nanoseconds spent on initialize
@@ -698,4 +835,28 @@ mod tests {
         ];
         complex_vec_approx_eq(&x, x_correct, 1e-10);
     }
+
+    #[test]
+    #[serial]
+    fn solve_adjoint_works() {
+        // A = [[1+i, 2], [0, 3-i]]
+        let mut coo = ComplexCooMatrix::new(2, 2, 3, Sym::No).unwrap();
+        coo.put(0, 0, cpx!(1.0, 1.0)).unwrap();
+        coo.put(0, 1, cpx!(2.0, 0.0)).unwrap();
+        coo.put(1, 1, cpx!(3.0, -1.0)).unwrap();
+        let mut mat = ComplexSparseMatrix::from_coo(coo);
+        let mut solver = ComplexSolverMUMPS::new().unwrap();
+        solver.factorize(&mut mat, None).unwrap();
+
+        // Aᴴ · x = rhs with x = [1, i]
+        let mut x = ComplexVector::new(2);
+        let rhs = ComplexVector::from(&[cpx!(1.0, -1.0), cpx!(1.0, 3.0)]);
+        solver.solve_adjoint(&mut x, &mat, &rhs, false).unwrap();
+        complex_vec_approx_eq(&x, &[cpx!(1.0, 0.0), cpx!(0.0, 1.0)], 1e-15);
+
+        // A · x = rhs with x = [1, i]
+        let rhs = ComplexVector::from(&[cpx!(1.0, 3.0), cpx!(1.0, 3.0)]);
+        solver.solve(&mut x, &mat, &rhs, false).unwrap();
+        complex_vec_approx_eq(&x, &[cpx!(1.0, 0.0), cpx!(0.0, 1.0)], 1e-15);
+    }
 }
@@ -1,5 +1,5 @@
 use super::{handle_umfpack_error_code, umfpack_ordering, umfpack_scaling};
-use super::{ComplexLinSolTrait, ComplexSparseMatrix, LinSolParams, StatsLinSol, Sym};
+use super::{ComplexLinSolTrait, ComplexSparseMatrix, LinSolParams, StatsLinSol, StatsLinSolFactors, Sym};
 use super::{
     UMFPACK_ORDERING_AMD, UMFPACK_ORDERING_BEST, UMFPACK_ORDERING_CHOLMOD, UMFPACK_ORDERING_METIS,
     UMFPACK_ORDERING_NONE, UMFPACK_SCALE_MAX, UMFPACK_SCALE_NONE, UMFPACK_SCALE_SUM, UMFPACK_STRATEGY_AUTO,
@@ -57,10 +57,15 @@ extern "C" {
         row_indices: *const i32,
         values: *const Complex64,
     ) -> i32;
+    fn complex_solver_umfpack_get_factors_info(
+        solver: *mut InterfaceComplexUMFPACK,
+        factors_info: *mut StatsLinSolFactors,
+    ) -> i32;
     fn complex_solver_umfpack_solve(
         solver: *mut InterfaceComplexUMFPACK,
         x: *mut Complex64,
         rhs: *const Complex64,
+        adjoint: CcBool,
         col_pointers: *const i32,
         row_indices: *const i32,
         values: *const Complex64,
@@ -117,6 +122,12 @@ pub struct ComplexSolverUMFPACK {
     /// det = coefficient * pow(10, exponent)
     determinant_exponent: f64,
 
+    /// Holds the fill-in, flop count, and memory usage of the last factorization
+    factors_info: StatsLinSolFactors,
+
+    /// Time spent on the COO to CSC conversion (in factorize)
+    time_convert_ns: u128,
+
     /// Stopwatch to measure computation times
     stopwatch: Stopwatch,
 
@@ -161,6 +172,8 @@ impl ComplexSolverUMFPACK {
                 determinant_coefficient_real: 0.0,
                 determinant_coefficient_imag: 0.0,
                 determinant_exponent: 0.0,
+                factors_info: StatsLinSolFactors::default(),
+                time_convert_ns: 0,
                 stopwatch: Stopwatch::new(),
                 time_initialize_ns: 0,
                 time_factorize_ns: 0,
@@ -168,6 +181,69 @@ impl ComplexSolverUMFPACK {
             })
         }
     }
+
+    /// Computes the solution of the linear system or of the conjugate transposed (adjoint) system
+    fn solve_system(
+        &mut self,
+        x: &mut ComplexVector,
+        mat: &ComplexSparseMatrix,
+        rhs: &ComplexVector,
+        adjoint: bool,
+        verbose: bool,
+    ) -> Result<(), StrError> {
+        // check
+        if !self.factorized {
+            return Err("the function factorize must be called before solve");
+        }
+
+        // access CSC matrix
+        // (possibly already converted from COO, because factorize was (should have been) called)
+        let csc = mat.get_csc()?;
+
+        // check already factorized data
+        let (nrow, ncol, nnz, sym) = csc.get_info();
+        if sym != self.initialized_sym {
+            return Err("solve must use the same matrix (symmetric differs)");
+        }
+        if nrow != self.initialized_ndim || ncol != self.initialized_ndim {
+            return Err("solve must use the same matrix (ndim differs)");
+        }
+        if nnz != self.initialized_nnz {
+            return Err("solve must use the same matrix (nnz differs)");
+        }
+
+        // check vectors
+        if x.dim() != self.initialized_ndim {
+            return Err("the dimension of the vector of unknown values x is incorrect");
+        }
+        if rhs.dim() != self.initialized_ndim {
+            return Err("the dimension of the right-hand side vector is incorrect");
+        }
+
+        // call UMFPACK solve
+        let adj = if adjoint { 1 } else { 0 };
+        let verb = if verbose { 1 } else { 0 };
+        self.stopwatch.reset();
+        unsafe {
+            let status = complex_solver_umfpack_solve(
+                self.solver,
+                x.as_mut_data().as_mut_ptr(),
+                rhs.as_data().as_ptr(),
+                adj,
+                csc.col_pointers.as_ptr(),
+                csc.row_indices.as_ptr(),
+                csc.values.as_ptr(),
+                verb,
+            );
+            if status != SUCCESSFUL_EXIT {
+                return Err(handle_umfpack_error_code(status));
+            }
+        }
+        self.time_solve_ns = self.stopwatch.stop();
+
+        // done
+        Ok(())
+    }
 }
 
 impl ComplexLinSolTrait for ComplexSolverUMFPACK {
@@ -193,7 +269,9 @@ impl ComplexLinSolTrait for ComplexSolverUMFPACK {
     fn factorize(&mut self, mat: &mut ComplexSparseMatrix, params: Option<LinSolParams>) -> Result<(), StrError> {
         // get CSC matrix
         // (or convert from COO if CSC is not available and COO is available)
+        self.stopwatch.reset();
         let csc = mat.get_csc_or_from_coo()?;
+        self.time_convert_ns = self.stopwatch.stop();
 
         // check
         if self.initialized {
@@ -280,6 +358,14 @@ impl ComplexLinSolTrait for ComplexSolverUMFPACK {
         }
         self.time_factorize_ns = self.stopwatch.stop();
 
+        // get the fill-in, flop count, and memory usage
+        unsafe {
+            let status = complex_solver_umfpack_get_factors_info(self.solver, &mut self.factors_info);
+            if status != SUCCESSFUL_EXIT {
+                return Err(handle_umfpack_error_code(status));
+            }
+        }
+
         // done
         self.factorized = true;
         Ok(())
@@ -312,56 +398,39 @@ impl ComplexLinSolTrait for ComplexSolverUMFPACK {
         rhs: &ComplexVector,
         verbose: bool,
     ) -> Result<(), StrError> {
-        // check
-        if !self.factorized {
-            return Err("the function factorize must be called before solve");
-        }
-
-        // access CSC matrix
-        // (possibly already converted from COO, because factorize was (should have been) called)
-        let csc = mat.get_csc()?;
-
-        // check already factorized data
-        let (nrow, ncol, nnz, sym) = csc.get_info();
-        if sym != self.initialized_sym {
-            return Err("solve must use the same matrix (symmetric differs)");
-        }
-        if nrow != self.initialized_ndim || ncol != self.initialized_ndim {
-            return Err("solve must use the same matrix (ndim differs)");
-        }
-        if nnz != self.initialized_nnz {
-            return Err("solve must use the same matrix (nnz differs)");
-        }
-
-        // check vectors
-        if x.dim() != self.initialized_ndim {
-            return Err("the dimension of the vector of unknown values x is incorrect");
-        }
-        if rhs.dim() != self.initialized_ndim {
-            return Err("the dimension of the right-hand side vector is incorrect");
-        }
-
-        // call UMFPACK solve
-        let verb = if verbose { 1 } else { 0 };
-        self.stopwatch.reset();
-        unsafe {
-            let status = complex_solver_umfpack_solve(
-                self.solver,
-                x.as_mut_data().as_mut_ptr(),
-                rhs.as_data().as_ptr(),
-                csc.col_pointers.as_ptr(),
-                csc.row_indices.as_ptr(),
-                csc.values.as_ptr(),
-                verb,
-            );
-            if status != SUCCESSFUL_EXIT {
-                return Err(handle_umfpack_error_code(status));
-            }
-        }
-        self.time_solve_ns = self.stopwatch.stop();
+        self.solve_system(x, mat, rhs, false, verbose)
+    }
 
-        // done
-        Ok(())
+    /// Computes the solution of the conjugate transposed (adjoint) linear system
+    ///
+    /// Solves the linear system:
+    ///
+    /// ```text
+    ///   Aᴴ  · x = rhs
+    /// (m,m)  (m)  (m)
+    /// ```
+    ///
+    /// # Output
+    ///
+    /// * `x` -- the vector of unknown values with dimension equal to mat.nrow
+    ///
+    /// # Input
+    ///
+    /// * `mat` -- the coefficient matrix A; must be square and, if symmetric, [Sym::YesFull].
+    /// * `rhs` -- the right-hand side vector with know values an dimension equal to mat.nrow
+    /// * `verbose` -- shows messages
+    ///
+    /// **Note:** The factorization computed by `factorize` is reused (no new factorization is needed).
+    ///
+    /// **Warning:** the matrix must be same one used in `factorize`.
+    fn solve_adjoint(
+        &mut self,
+        x: &mut ComplexVector,
+        mat: &ComplexSparseMatrix,
+        rhs: &ComplexVector,
+        verbose: bool,
+    ) -> Result<(), StrError> {
+        self.solve_system(x, mat, rhs, true, verbose)
     }
 
     /// Updates the stats structure (should be called after solve)
@@ -399,6 +468,8 @@ impl ComplexLinSolTrait for ComplexSolverUMFPACK {
         stats.time_nanoseconds.initialize = self.time_initialize_ns;
         stats.time_nanoseconds.factorize = self.time_factorize_ns;
         stats.time_nanoseconds.solve = self.time_solve_ns;
+        stats.time_nanoseconds.convert_matrix = self.time_convert_ns;
+        stats.factors = self.factors_info;
     }
 
     /// Returns the nanoseconds spent on initialize
@@ -613,5 +684,35 @@ mod tests {
         solver.update_stats(&mut stats);
         assert_eq!(stats.output.effective_ordering, "Amd");
         assert_eq!(stats.output.effective_scaling, "Sum");
+        let (_, _, nnz, _) = mat.get_csc().unwrap().get_info();
+        assert_eq!(stats.factors.nnz_a, nnz as i64);
+        assert_eq!(stats.factors.nnz_factors, stats.factors.nnz_l + stats.factors.nnz_u);
+        assert!(stats.factors.nnz_factors > 0);
+        assert!(stats.factors.fill_in_ratio > 0.0);
+        assert!(stats.factors.flops_elimination > 0.0);
+        assert!(stats.factors.memory_peak_mb > 0.0);
+    }
+
+    #[test]
+    fn solve_adjoint_works() {
+        // A = [[1+i, 2], [0, 3-i]]
+        let mut coo = ComplexCooMatrix::new(2, 2, 3, Sym::No).unwrap();
+        coo.put(0, 0, cpx!(1.0, 1.0)).unwrap();
+        coo.put(0, 1, cpx!(2.0, 0.0)).unwrap();
+        coo.put(1, 1, cpx!(3.0, -1.0)).unwrap();
+        let mut mat = ComplexSparseMatrix::from_coo(coo);
+        let mut solver = ComplexSolverUMFPACK::new().unwrap();
+        solver.factorize(&mut mat, None).unwrap();
+
+        // Aᴴ · x = rhs with x = [1, i]
+        let mut x = ComplexVector::new(2);
+        let rhs = ComplexVector::from(&[cpx!(1.0, -1.0), cpx!(1.0, 3.0)]);
+        solver.solve_adjoint(&mut x, &mat, &rhs, false).unwrap();
+        complex_vec_approx_eq(&x, &[cpx!(1.0, 0.0), cpx!(0.0, 1.0)], 1e-15);
+
+        // A · x = rhs with x = [1, i]
+        let rhs = ComplexVector::from(&[cpx!(1.0, 3.0), cpx!(1.0, 3.0)]);
+        solver.solve(&mut x, &mat, &rhs, false).unwrap();
+        complex_vec_approx_eq(&x, &[cpx!(1.0, 0.0), cpx!(0.0, 1.0)], 1e-15);
     }
 }
@@ -7,6 +7,8 @@ pub(crate) const ERROR_NOT_AVAILABLE: i32 = 400000;
 pub(crate) const ERROR_NEED_INITIALIZATION: i32 = 500000;
 pub(crate) const ERROR_NEED_FACTORIZATION: i32 = 600000;
 pub(crate) const ERROR_ALREADY_INITIALIZED: i32 = 700000;
+#[cfg(feature = "with_mumps")]
+pub(crate) const ERROR_PATH_TOO_LONG: i32 = 800000; // only returned by the MUMPS interface
 
 /// Represents the type of boolean flags interchanged with the C-code
 pub(crate) type CcBool = i32;
@@ -20,3 +22,14 @@ pub(crate) type CcBool = i32;
 pub(crate) fn to_i32(num: usize) -> i32 {
     i32::try_from(num).unwrap()
 }
+
+/// Converts usize to i64
+///
+/// # Panics
+///
+/// Will panic if usize is too large to be an i64
+#[inline]
+#[cfg(feature = "with_mumps")]
+pub(crate) fn to_i64(num: usize) -> i64 {
+    i64::try_from(num).unwrap()
+}
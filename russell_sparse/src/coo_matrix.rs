@@ -1,4 +1,4 @@
-use super::Sym;
+use super::{NumCooSlice, Sym};
 use crate::to_i32;
 use crate::StrError;
 use num_traits::{Num, NumCast};
@@ -6,6 +6,15 @@ use russell_lab::{NumMatrix, NumVector};
 use serde::de::DeserializeOwned;
 use serde::{Deserialize, Serialize};
 use std::ops::{AddAssign, MulAssign};
+use std::sync::atomic::{self, AtomicU64};
+
+/// Holds the next pattern token (zero is reserved for an unknown pattern)
+static NEXT_PATTERN_TOKEN: AtomicU64 = AtomicU64::new(1);
+
+/// Returns a new (unique) pattern token
+pub(crate) fn new_pattern_token() -> u64 {
+    NEXT_PATTERN_TOKEN.fetch_add(1, atomic::Ordering::Relaxed)
+}
 
 /// Holds the row index, col index, and values of a matrix (also known as Triplet)
 ///
@@ -31,7 +40,7 @@ where
     /// Holds the number of columns (must fit i32)
     pub(crate) ncol: usize,
 
-    /// Holds the current index/number of non-zeros, including duplicates (must fit i32)
+    /// Holds the current index/number of non-zeros, including duplicates (must fit i32, or i64 if used with MUMPS only)
     ///
     /// This will equal the number of non-zeros (nnz) after all items have been `put`.
     ///
@@ -40,7 +49,7 @@ where
     /// ```
     pub(crate) nnz: usize,
 
-    /// Defines the maximum allowed number of entries/non-zero values (must fit i32)
+    /// Defines the maximum allowed number of entries/non-zero values (must fit i32, or i64 if used with MUMPS only)
     ///
     /// This may be greater than the number of non-zeros (nnz)
     ///
@@ -70,6 +79,14 @@ where
     /// ```
     #[serde(bound(deserialize = "Vec<T>: Deserialize<'de>"))]
     pub(crate) values: Vec<T>,
+
+    /// Identifies the contents of `indices_i` and `indices_j` (zero means unknown)
+    ///
+    /// A new token is taken whenever an index is overwritten by a different value; thus, the token
+    /// is unchanged after `reset` and the same sequence of `put`. This token allows
+    /// [crate::NumCscMatrix::update_from_coo()] to reuse its "assembly map" without comparing the indices.
+    #[serde(skip)]
+    pub(crate) pattern_token: u64,
 }
 
 impl<T> NumCooMatrix<T>
@@ -83,7 +100,7 @@ where
     /// * `nrow` -- (≥ 1) Is the number of rows of the sparse matrix (must be fit i32)
     /// * `ncol` -- (≥ 1) Is the number of columns of the sparse matrix (must be fit i32)
     /// * `max_nnz` -- (≥ 1) Maximum number of entries ≥ nnz (number of non-zeros),
-    ///   including entries with repeated indices. (must be fit i32)
+    ///   including entries with repeated indices. (must fit i32, or i64 if used with MUMPS only)
     /// * `symmetric` -- indicates whether the matrix is symmetric or not.
     ///   If symmetric, indicates the representation too.
     ///
@@ -187,6 +204,7 @@ where
             indices_i: vec![0; max_nnz],
             indices_j: vec![0; max_nnz],
             values: vec![T::zero(); max_nnz],
+            pattern_token: new_pattern_token(),
         })
     }
 
@@ -279,6 +297,7 @@ where
             indices_i: row_indices,
             indices_j: col_indices,
             values,
+            pattern_token: new_pattern_token(),
         })
     }
 
@@ -339,13 +358,77 @@ where
         // insert a new entry
         let i_i32 = to_i32(i);
         let j_i32 = to_i32(j);
-        self.indices_i[self.nnz] = i_i32;
-        self.indices_j[self.nnz] = j_i32;
+        if self.indices_i[self.nnz] != i_i32 || self.indices_j[self.nnz] != j_i32 {
+            self.indices_i[self.nnz] = i_i32;
+            self.indices_j[self.nnz] = j_i32;
+            self.pattern_token = new_pattern_token();
+        }
         self.values[self.nnz] = aij;
         self.nnz += 1;
         Ok(())
     }
 
+    /// Puts all entries of a dense block (e.g., an element matrix in the finite element method)
+    ///
+    /// Performs (with possible duplicates):
+    ///
+    /// ```text
+    /// A(rows[r], cols[c]) += block(r, c)
+    /// ```
+    ///
+    /// If the matrix is stored as lower (upper) triangular, only the entries with `i ≥ j` (`i ≤ j`)
+    /// are put; the other entries are ignored (thus, the block is assumed to be symmetric). Note that
+    /// zero values in the block are put as well; thus, the sparsity pattern does not depend on the values.
+    ///
+    /// All indices and the available space are checked once, before inserting any entry.
+    ///
+    /// # Input
+    ///
+    /// * `rows` -- the (global) row indices corresponding to the rows of the block
+    /// * `cols` -- the (global) column indices corresponding to the columns of the block
+    /// * `block` -- the `(rows.len(), cols.len())` dense matrix
+    ///
+    /// # Examples
+    ///
+    /// ```
+    /// use russell_lab::Matrix;
+    /// use russell_sparse::prelude::*;
+    /// use russell_sparse::StrError;
+    ///
+    /// fn main() -> Result<(), StrError> {
+    ///     // two "elements" sharing the "degree of freedom" 1
+    ///     let kk_local = Matrix::from(&[[1.0, -1.0], [-1.0, 1.0]]);
+    ///     let mut coo = CooMatrix::new(3, 3, 6, Sym::YesLower)?;
+    ///     coo.put_block(&[0, 1], &[0, 1], &kk_local)?;
+    ///     coo.put_block(&[1, 2], &[1, 2], &kk_local)?;
+    ///     let a = coo.as_dense();
+    ///     let correct = "┌          ┐\n\
+    ///                    │  1 -1  0 │\n\
+    ///                    │ -1  2 -1 │\n\
+    ///                    │  0 -1  1 │\n\
+    ///                    └          ┘";
+    ///     assert_eq!(format!("{}", a), correct);
+    ///     Ok(())
+    /// }
+    /// ```
+    pub fn put_block(&mut self, rows: &[usize], cols: &[usize], block: &NumMatrix<T>) -> Result<(), StrError> {
+        let start = self.nnz;
+        let mut slice = NumCooSlice::new(
+            self.symmetric,
+            self.nrow,
+            self.ncol,
+            &mut self.indices_i[start..],
+            &mut self.indices_j[start..],
+            &mut self.values[start..],
+        );
+        slice.put_block(rows, cols, block)?;
+        self.nnz += slice.len();
+        if slice.pattern_changed() {
+            self.pattern_token = new_pattern_token();
+        }
+        Ok(())
+    }
+
     /// Resets the position of the current non-zero value
     ///
     /// This function allows using `put` all over again.
@@ -578,12 +661,7 @@ where
             return Err("matrices must have the same symmetry");
         }
         self.reset();
-        for p in 0..other.nnz {
-            let i = other.indices_i[p] as usize;
-            let j = other.indices_j[p] as usize;
-            self.put(i, j, alpha * other.values[p])?;
-        }
-        Ok(())
+        self.augment(alpha, other)
     }
 
     /// Augments this matrix with the entries of another matrix (scaled)
@@ -605,11 +683,24 @@ where
         if other.symmetric != self.symmetric {
             return Err("matrices must have the same symmetry");
         }
-        for p in 0..other.nnz {
-            let i = other.indices_i[p] as usize;
-            let j = other.indices_j[p] as usize;
-            self.put(i, j, alpha * other.values[p])?;
+        // the indices of other have already been checked; thus, the entries are copied in bulk
+        // (the indices are only written if they differ; e.g., not after `reset` and the same calls)
+        let (start, nnz) = (self.nnz, other.nnz);
+        if start + nnz > self.max_nnz {
+            return Err("COO matrix: max number of items has been reached");
+        }
+        let range = start..(start + nnz);
+        if self.indices_i[range.clone()] != other.indices_i[..nnz]
+            || self.indices_j[range.clone()] != other.indices_j[..nnz]
+        {
+            self.indices_i[range.clone()].copy_from_slice(&other.indices_i[..nnz]);
+            self.indices_j[range].copy_from_slice(&other.indices_j[..nnz]);
+            self.pattern_token = new_pattern_token();
+        }
+        for (v, o) in self.values[start..(start + nnz)].iter_mut().zip(&other.values[..nnz]) {
+            *v = alpha * *o;
         }
+        self.nnz += nnz;
         Ok(())
     }
 
@@ -808,6 +899,55 @@ mod tests {
         assert_eq!(coo.nnz, 0);
     }
 
+    #[test]
+    fn pattern_token_works() {
+        let mut coo = NumCooMatrix::<f64>::new(2, 2, 3, Sym::No).unwrap();
+        let other = NumCooMatrix::<f64>::new(2, 2, 3, Sym::No).unwrap();
+        assert!(coo.pattern_token != 0);
+        assert!(coo.pattern_token != other.pattern_token);
+        coo.put(0, 0, 1.0).unwrap();
+        coo.put(1, 1, 2.0).unwrap();
+        let token = coo.pattern_token;
+
+        // same sequence after reset (only the values change)
+        coo.reset();
+        coo.put(0, 0, 3.0).unwrap();
+        coo.put(1, 1, 4.0).unwrap();
+        assert_eq!(coo.pattern_token, token);
+
+        // different sequence
+        coo.reset();
+        coo.put(0, 0, 3.0).unwrap();
+        coo.put(0, 1, 4.0).unwrap();
+        assert!(coo.pattern_token != token);
+        let token = coo.pattern_token;
+
+        // put_block with the same sequence
+        let block = NumMatrix::<f64>::from(&[[1.0, 2.0]]);
+        coo.reset();
+        coo.put_block(&[0], &[0, 1], &block).unwrap();
+        assert_eq!(coo.pattern_token, token);
+        coo.reset();
+        coo.put_block(&[1], &[0, 1], &block).unwrap();
+        assert!(coo.pattern_token != token);
+        let token = coo.pattern_token;
+
+        // augment with the same and a different sequence
+        let mut b = NumCooMatrix::<f64>::new(2, 2, 2, Sym::No).unwrap();
+        b.put(1, 0, 5.0).unwrap();
+        b.put(1, 1, 6.0).unwrap();
+        coo.reset();
+        coo.augment(1.0, &b).unwrap();
+        assert_eq!(coo.pattern_token, token);
+        coo.augment(1.0, &other).unwrap();
+        assert_eq!(coo.pattern_token, token);
+        coo.reset();
+        b.reset();
+        b.put(0, 0, 5.0).unwrap();
+        coo.augment(1.0, &b).unwrap();
+        assert!(coo.pattern_token != token);
+    }
+
     #[test]
     fn to_dense_fails_on_wrong_dims() {
         let mut coo = NumCooMatrix::<f64>::new(1, 1, 1, Sym::No).unwrap();
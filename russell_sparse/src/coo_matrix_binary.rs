@@ -0,0 +1,217 @@
+use super::{CooMatrix, Sym};
+use crate::StrError;
+use std::ffi::OsStr;
+use std::fs::{self, File};
+use std::io::{BufWriter, Write};
+use std::path::Path;
+
+/// Holds the magic bytes identifying the binary COO format (including the format version)
+const BINARY_COO_MAGIC: &[u8; 8] = b"RSCOO001";
+
+/// Holds the size of the header: magic + nrow + ncol + nnz + symmetric
+const BINARY_COO_HEADER_SIZE: usize = 8 + 4 * 8;
+
+impl CooMatrix {
+    /// Writes the COO matrix to a compact binary file (e.g., to cache a parsed MatrixMarket file)
+    ///
+    /// The file stores the triplets exactly as they are in memory (including duplicates) using
+    /// little-endian numbers. Thus, [CooMatrix::read_binary()] recovers the same matrix without
+    /// having to parse any text. The layout is:
+    ///
+    /// ```text
+    /// "RSCOO001" (8 bytes)
+    /// nrow, ncol, nnz, symmetric (u64 each)
+    /// row indices (nnz × i32)
+    /// column indices (nnz × i32)
+    /// values (nnz × f64)
+    /// ```
+    ///
+    /// # Input
+    ///
+    /// * `full_path` -- may be a String, &str, or Path
+    ///
+    /// # Examples
+    ///
+    /// ```
+    /// use russell_sparse::prelude::*;
+    /// use russell_sparse::StrError;
+    ///
+    /// fn main() -> Result<(), StrError> {
+    ///     let name = "./data/matrix_market/ok_simple_general.mtx";
+    ///     let (coo_real, _) = read_matrix_market(name, MMsym::LeaveAsLower)?;
+    ///     let coo = coo_real.unwrap();
+    ///
+    ///     let cache = "/tmp/russell_sparse/doc_ok_simple_general.coo.bin";
+    ///     coo.write_binary(cache)?;
+    ///     let copy = CooMatrix::read_binary(cache)?;
+    ///     assert_eq!(copy.get_info(), coo.get_info());
+    ///     assert_eq!(copy.get_values(), coo.get_values());
+    ///     Ok(())
+    /// }
+    /// ```
+    pub fn write_binary<P>(&self, full_path: &P) -> Result<(), StrError>
+    where
+        P: AsRef<OsStr> + ?Sized,
+    {
+        let path = Path::new(full_path).to_path_buf();
+        if let Some(p) = path.parent() {
+            fs::create_dir_all(p).map_err(|_| "cannot create directory")?;
+        }
+        let file = File::create(&path).map_err(|_| "cannot create file")?;
+        let mut writer = BufWriter::new(file);
+        let symmetric: u64 = match self.symmetric {
+            Sym::No => 0,
+            Sym::YesFull => 1,
+            Sym::YesLower => 2,
+            Sym::YesUpper => 3,
+        };
+        let mut header = Vec::with_capacity(BINARY_COO_HEADER_SIZE);
+        header.extend_from_slice(BINARY_COO_MAGIC);
+        for value in [self.nrow as u64, self.ncol as u64, self.nnz as u64, symmetric] {
+            header.extend_from_slice(&value.to_le_bytes());
+        }
+        let mut write = |bytes: &[u8]| writer.write_all(bytes).map_err(|_| "cannot write file");
+        write(&header)?;
+        for index in &self.indices_i[..self.nnz] {
+            write(&index.to_le_bytes())?;
+        }
+        for index in &self.indices_j[..self.nnz] {
+            write(&index.to_le_bytes())?;
+        }
+        for value in &self.values[..self.nnz] {
+            write(&value.to_le_bytes())?;
+        }
+        writer.flush().map_err(|_| "cannot write file")?;
+        Ok(())
+    }
+
+    /// Reads a COO matrix from a binary file written by [CooMatrix::write_binary()]
+    ///
+    /// The whole file is loaded with a single read; the resulting matrix has `max_nnz = nnz`.
+    ///
+    /// # Input
+    ///
+    /// * `full_path` -- may be a String, &str, or Path
+    pub fn read_binary<P>(full_path: &P) -> Result<Self, StrError>
+    where
+        P: AsRef<OsStr> + ?Sized,
+    {
+        let path = Path::new(full_path).to_path_buf();
+        let bytes = fs::read(path).map_err(|_| "cannot open file")?;
+        if bytes.len() < BINARY_COO_HEADER_SIZE || &bytes[0..8] != BINARY_COO_MAGIC {
+            return Err("the file is not a binary COO file");
+        }
+        let read_u64 = |k: usize| {
+            let start = 8 + 8 * k;
+            u64::from_le_bytes(bytes[start..(start + 8)].try_into().unwrap()) as usize
+        };
+        let (nrow, ncol, nnz) = (read_u64(0), read_u64(1), read_u64(2));
+        let symmetric = match read_u64(3) {
+            0 => Sym::No,
+            1 => Sym::YesFull,
+            2 => Sym::YesLower,
+            3 => Sym::YesUpper,
+            _ => return Err("the binary COO file has an invalid symmetric flag"),
+        };
+        let size = nnz
+            .checked_mul(4 + 4 + 8)
+            .and_then(|s| s.checked_add(BINARY_COO_HEADER_SIZE));
+        if size != Some(bytes.len()) {
+            return Err("the size of the binary COO file is incorrect");
+        }
+        let mut coo = CooMatrix::new(nrow, ncol, usize::max(1, nnz), symmetric)?;
+        let data_i = &bytes[BINARY_COO_HEADER_SIZE..];
+        let data_j = &data_i[(4 * nnz)..];
+        let data_v = &data_j[(4 * nnz)..];
+        for (k, chunk) in data_i[..(4 * nnz)].chunks_exact(4).enumerate() {
+            coo.indices_i[k] = i32::from_le_bytes(chunk.try_into().unwrap());
+        }
+        for (k, chunk) in data_j[..(4 * nnz)].chunks_exact(4).enumerate() {
+            coo.indices_j[k] = i32::from_le_bytes(chunk.try_into().unwrap());
+        }
+        for (k, chunk) in data_v.chunks_exact(8).enumerate() {
+            coo.values[k] = f64::from_le_bytes(chunk.try_into().unwrap());
+        }
+        for k in 0..nnz {
+            let (i, j) = (coo.indices_i[k], coo.indices_j[k]);
+            if i < 0 || i as usize >= nrow || j < 0 || j as usize >= ncol {
+                return Err("the binary COO file contains an invalid index");
+            }
+        }
+        coo.nnz = nnz;
+        Ok(coo)
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#[cfg(test)]
+mod tests {
+    use crate::{read_matrix_market, CooMatrix, MMsym, Sym};
+    use std::fs;
+
+    #[test]
+    fn read_binary_captures_errors() {
+        assert_eq!(CooMatrix::read_binary("__wrong__").err(), Some("cannot open file"));
+        assert_eq!(
+            CooMatrix::read_binary("./data/matrix_market/ok_simple_general.mtx").err(),
+            Some("the file is not a binary COO file")
+        );
+        let path = "/tmp/russell_sparse/test_read_binary_captures_errors.coo.bin";
+        let mut coo = CooMatrix::new(2, 2, 2, Sym::No).unwrap();
+        coo.put(1, 1, 3.0).unwrap();
+        coo.write_binary(path).unwrap();
+        let mut bytes = fs::read(path).unwrap();
+        bytes[32] = 9; // symmetric flag
+        fs::write(path, &bytes).unwrap();
+        assert_eq!(
+            CooMatrix::read_binary(path).err(),
+            Some("the binary COO file has an invalid symmetric flag")
+        );
+        bytes[32] = 0;
+        bytes.pop();
+        fs::write(path, &bytes).unwrap();
+        assert_eq!(
+            CooMatrix::read_binary(path).err(),
+            Some("the size of the binary COO file is incorrect")
+        );
+        bytes.push(0);
+        bytes[40] = 7; // row index
+        fs::write(path, &bytes).unwrap();
+        assert_eq!(
+            CooMatrix::read_binary(path).err(),
+            Some("the binary COO file contains an invalid index")
+        );
+        bytes.truncate(40); // header only
+        bytes[24..32].copy_from_slice(&(1_u64 << 60).to_le_bytes()); // nnz × 16 overflows
+        fs::write(path, &bytes).unwrap();
+        assert_eq!(
+            CooMatrix::read_binary(path).err(),
+            Some("the size of the binary COO file is incorrect")
+        );
+    }
+
+    #[test]
+    fn write_and_read_binary_work() {
+        for (name, handling) in [
+            ("ok_general.mtx", MMsym::LeaveAsLower),
+            ("ok_symmetric.mtx", MMsym::LeaveAsLower),
+            ("ok_symmetric.mtx", MMsym::SwapToUpper),
+            ("ok_symmetric.mtx", MMsym::MakeItFull),
+        ] {
+            let (coo_real, _) = read_matrix_market(&format!("./data/matrix_market/{}", name), handling).unwrap();
+            let coo = coo_real.unwrap();
+            let path = "/tmp/russell_sparse/test_write_and_read_binary_work.coo.bin";
+            coo.write_binary(path).unwrap();
+            let copy = CooMatrix::read_binary(path).unwrap();
+            assert_eq!(copy.symmetric, coo.symmetric);
+            assert_eq!(
+                (copy.nrow, copy.ncol, copy.nnz, copy.max_nnz),
+                (coo.nrow, coo.ncol, coo.nnz, coo.nnz)
+            );
+            assert_eq!(copy.indices_i, &coo.indices_i[..coo.nnz]);
+            assert_eq!(copy.indices_j, &coo.indices_j[..coo.nnz]);
+            assert_eq!(copy.values, &coo.values[..coo.nnz]);
+        }
+    }
+}
@@ -0,0 +1,252 @@
+use super::{NumCooMatrix, NumCooSlice};
+use crate::coo_matrix::new_pattern_token;
+use crate::StrError;
+use num_traits::{Num, NumCast};
+use serde::de::DeserializeOwned;
+use serde::Serialize;
+use std::ops::{AddAssign, MulAssign};
+use std::thread;
+
+impl<T> NumCooMatrix<T>
+where
+    T: AddAssign + MulAssign + Num + NumCast + Copy + DeserializeOwned + Serialize + Send + Sync,
+{
+    /// Puts new entries using multiple threads, each one filling its own (disjoint) range of the triplets
+    ///
+    /// The space after the current entries is split into `max_nnz_per_part.len()` slices and
+    /// `task(part, slice)` is called by one scoped thread per part. Since each slice owns its range of
+    /// the triplets arrays, no locking is needed. For instance, in the finite element method, each part
+    /// assembles the element matrices of a subset of the elements with [NumCooSlice::put_block()].
+    ///
+    /// After all threads have finished, the entries are compacted in the order of the parts; thus,
+    /// `max_nnz_per_part` may overestimate the number of entries. Also, the order of the entries
+    /// does not depend on the scheduling of the threads; thus, the "assembly map" of
+    /// [crate::NumCscMatrix::update_from_coo()] is reused if the same assembly is repeated (after `reset`).
+    /// Note that, if the compaction moves entries, the indices are compared with the existing ones.
+    ///
+    /// # Input
+    ///
+    /// * `max_nnz_per_part` -- the max number of entries put by each part (one thread per part)
+    /// * `task` -- the function `task(part, slice)` putting the entries of each part
+    ///
+    /// # Errors
+    ///
+    /// If a task fails, the error of the first failed part is returned and the matrix keeps the
+    /// entries existing before the call.
+    ///
+    /// # Examples
+    ///
+    /// ```
+    /// use russell_lab::Matrix;
+    /// use russell_sparse::prelude::*;
+    /// use russell_sparse::StrError;
+    ///
+    /// fn main() -> Result<(), StrError> {
+    ///     // chain of four "elements" (springs) connecting five nodes
+    ///     let kk_local = Matrix::from(&[[1.0, -1.0], [-1.0, 1.0]]);
+    ///     let elements = [[0, 1], [1, 2], [2, 3], [3, 4]];
+    ///
+    ///     // two parts (threads) with two elements each
+    ///     let mut coo = CooMatrix::new(5, 5, 12, Sym::YesLower)?;
+    ///     coo.put_parallel(&[6, 6], |part, slice| {
+    ///         for dofs in &elements[(2 * part)..(2 * part + 2)] {
+    ///             slice.put_block(dofs, dofs, &kk_local)?;
+    ///         }
+    ///         Ok(())
+    ///     })?;
+    ///
+    ///     let a = coo.as_dense();
+    ///     let correct = "┌                ┐\n\
+    ///                    │  1 -1  0  0  0 │\n\
+    ///                    │ -1  2 -1  0  0 │\n\
+    ///                    │  0 -1  2 -1  0 │\n\
+    ///                    │  0  0 -1  2 -1 │\n\
+    ///                    │  0  0  0 -1  1 │\n\
+    ///                    └                ┘";
+    ///     assert_eq!(format!("{}", a), correct);
+    ///     Ok(())
+    /// }
+    /// ```
+    pub fn put_parallel<F>(&mut self, max_nnz_per_part: &[usize], task: F) -> Result<(), StrError>
+    where
+        F: Fn(usize, &mut NumCooSlice<T>) -> Result<(), StrError> + Sync,
+    {
+        // check
+        let start = self.nnz;
+        let total: usize = max_nnz_per_part.iter().sum();
+        if start + total > self.max_nnz {
+            return Err("COO matrix: max number of items has been reached");
+        }
+
+        // split the available space into slices
+        let (symmetric, nrow, ncol) = (self.symmetric, self.nrow, self.ncol);
+        let mut rest_i = &mut self.indices_i[start..(start + total)];
+        let mut rest_j = &mut self.indices_j[start..(start + total)];
+        let mut rest_v = &mut self.values[start..(start + total)];
+        let mut slices = Vec::with_capacity(max_nnz_per_part.len());
+        for count in max_nnz_per_part {
+            let (part_i, tail_i) = rest_i.split_at_mut(*count);
+            let (part_j, tail_j) = rest_j.split_at_mut(*count);
+            let (part_v, tail_v) = rest_v.split_at_mut(*count);
+            slices.push(NumCooSlice::new(symmetric, nrow, ncol, part_i, part_j, part_v));
+            (rest_i, rest_j, rest_v) = (tail_i, tail_j, tail_v);
+        }
+
+        // run the tasks
+        let task = &task;
+        let results: Vec<_> = if slices.len() == 1 {
+            let mut slice = slices.pop().unwrap();
+            vec![(task(0, &mut slice), slice.len(), slice.pattern_changed())]
+        } else {
+            thread::scope(|scope| {
+                let handles: Vec<_> = slices
+                    .into_iter()
+                    .enumerate()
+                    .map(|(part, mut slice)| {
+                        scope.spawn(move || {
+                            let res = task(part, &mut slice);
+                            (res, slice.len(), slice.pattern_changed())
+                        })
+                    })
+                    .collect();
+                handles.into_iter().map(|h| h.join().unwrap()).collect()
+            })
+        };
+
+        // compact the entries (in the order of the parts)
+        let mut offset = start;
+        let mut pos = start;
+        let mut pattern_changed = false;
+        for (part, (res, len, changed)) in results.into_iter().enumerate() {
+            res?;
+            pattern_changed |= changed;
+            if offset != pos {
+                let (src, dest) = (offset..(offset + len), pos..(pos + len));
+                if self.indices_i[src.clone()] != self.indices_i[dest.clone()]
+                    || self.indices_j[src.clone()] != self.indices_j[dest]
+                {
+                    self.indices_i.copy_within(src.clone(), pos);
+                    self.indices_j.copy_within(src.clone(), pos);
+                    pattern_changed = true;
+                }
+                self.values.copy_within(src, pos);
+            }
+            pos += len;
+            offset += max_nnz_per_part[part];
+        }
+        if pattern_changed {
+            self.pattern_token = new_pattern_token();
+        }
+        self.nnz = pos;
+        Ok(())
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#[cfg(test)]
+mod tests {
+    use crate::{CooMatrix, CscMatrix, Sym};
+    use russell_lab::{mat_approx_eq, Matrix};
+
+    /// Returns the element connectivity of a chain of `nel` two-node elements with two dofs per node
+    fn chain(nel: usize) -> Vec<[usize; 4]> {
+        (0..nel).map(|e| [2 * e, 2 * e + 1, 2 * e + 2, 2 * e + 3]).collect()
+    }
+
+    /// Returns the (symmetric) 4×4 element matrix of element `e`
+    fn element_matrix(e: usize) -> Matrix {
+        let mut kk = Matrix::new(4, 4);
+        for i in 0..4 {
+            for j in 0..4 {
+                kk.set(
+                    i,
+                    j,
+                    if i == j {
+                        4.0 + e as f64
+                    } else {
+                        1.0 / (1 + i + j) as f64
+                    },
+                );
+            }
+        }
+        kk
+    }
+
+    #[test]
+    fn put_parallel_captures_errors() {
+        let mut coo = CooMatrix::new(2, 2, 4, Sym::No).unwrap();
+        coo.put(0, 0, 1.0).unwrap();
+        assert_eq!(
+            coo.put_parallel(&[2, 2], |_, _| Ok(())).err(),
+            Some("COO matrix: max number of items has been reached")
+        );
+        assert_eq!(
+            coo.put_parallel(&[1, 2], |part, slice| {
+                slice.put(1, 1, 1.0)?;
+                if part == 1 {
+                    slice.put(2, 0, 1.0)?;
+                }
+                Ok(())
+            })
+            .err(),
+            Some("COO matrix: index of row is outside range")
+        );
+        let (_, _, nnz, _) = coo.get_info();
+        assert_eq!(nnz, 1);
+    }
+
+    #[test]
+    fn put_parallel_works() {
+        let nel = 9;
+        let ndof = 2 * nel + 2;
+        let elements = chain(nel);
+        for sym in [Sym::No, Sym::YesLower, Sym::YesUpper] {
+            // serial assembly (with an extra entry put beforehand)
+            let max_nnz = 1 + 16 * nel;
+            let mut serial = CooMatrix::new(ndof, ndof, max_nnz, sym).unwrap();
+            serial.put(0, 0, 100.0).unwrap();
+            for (e, dofs) in elements.iter().enumerate() {
+                serial.put_block(dofs, dofs, &element_matrix(e)).unwrap();
+            }
+
+            // parallel assembly with overestimated slices (thus, compaction is needed)
+            let nthread = 4;
+            let per_part = (nel + nthread - 1) / nthread;
+            let mut parallel = CooMatrix::new(ndof, ndof, 1 + nthread * (16 * per_part + 3), sym).unwrap();
+            parallel.put(0, 0, 100.0).unwrap();
+            parallel
+                .put_parallel(&vec![16 * per_part + 3; nthread], |part, slice| {
+                    let e_end = usize::min(nel, (part + 1) * per_part);
+                    for e in (part * per_part)..e_end {
+                        slice.put_block(&elements[e], &elements[e], &element_matrix(e))?;
+                    }
+                    Ok(())
+                })
+                .unwrap();
+
+            // the entries are the same (in the same order)
+            assert_eq!(parallel.get_row_indices(), serial.get_row_indices());
+            assert_eq!(parallel.get_col_indices(), serial.get_col_indices());
+            assert_eq!(parallel.get_values(), serial.get_values());
+            mat_approx_eq(&parallel.as_dense(), &serial.as_dense(), 1e-15);
+
+            // the repeated assembly reuses the pattern (assembly map)
+            let mut csc = CscMatrix::from_coo(&parallel).unwrap();
+            let token = parallel.pattern_token;
+            parallel.reset();
+            parallel.put(0, 0, 100.0).unwrap();
+            parallel
+                .put_parallel(&[16 * nel], |_, slice| {
+                    for (e, dofs) in elements.iter().enumerate() {
+                        slice.put_block(dofs, dofs, &element_matrix(e))?;
+                    }
+                    Ok(())
+                })
+                .unwrap();
+            assert_eq!(parallel.pattern_token, token);
+            csc.update_from_coo(&parallel).unwrap();
+            mat_approx_eq(&csc.as_dense(), &serial.as_dense(), 1e-15);
+        }
+    }
+}
@@ -0,0 +1,292 @@
+use super::Sym;
+use crate::StrError;
+use num_traits::{Num, NumCast};
+use russell_lab::NumMatrix;
+use serde::de::DeserializeOwned;
+use serde::Serialize;
+use std::ops::{AddAssign, MulAssign};
+
+/// Holds a mutable (disjoint) range of the triplets of a COO matrix
+///
+/// A slice is obtained via [crate::NumCooMatrix::put_parallel()] (one slice per thread) and is filled
+/// with [NumCooSlice::put()] or [NumCooSlice::put_block()] without any locking because each slice owns
+/// its own range of the triplets arrays.
+pub struct NumCooSlice<'a, T>
+where
+    T: AddAssign + MulAssign + Num + NumCast + Copy + DeserializeOwned + Serialize,
+{
+    /// Indicates whether the matrix is symmetric or not. If symmetric, indicates the representation too.
+    symmetric: Sym,
+
+    /// Holds the number of rows of the matrix
+    nrow: usize,
+
+    /// Holds the number of columns of the matrix
+    ncol: usize,
+
+    /// Holds the number of entries in this slice
+    len: usize,
+
+    /// Holds the row indices (the length is the max number of entries in this slice)
+    indices_i: &'a mut [i32],
+
+    /// Holds the column indices (the length is the max number of entries in this slice)
+    indices_j: &'a mut [i32],
+
+    /// Holds the values (the length is the max number of entries in this slice)
+    values: &'a mut [T],
+
+    /// Indicates that an index has been overwritten by a different value (see `pattern_token` of the COO matrix)
+    pattern_changed: bool,
+}
+
+impl<'a, T> NumCooSlice<'a, T>
+where
+    T: AddAssign + MulAssign + Num + NumCast + Copy + DeserializeOwned + Serialize,
+{
+    /// Allocates a new instance (the three arrays must have the same length)
+    pub(crate) fn new(
+        symmetric: Sym,
+        nrow: usize,
+        ncol: usize,
+        indices_i: &'a mut [i32],
+        indices_j: &'a mut [i32],
+        values: &'a mut [T],
+    ) -> Self {
+        assert_eq!(indices_j.len(), indices_i.len());
+        assert_eq!(values.len(), indices_i.len());
+        NumCooSlice {
+            symmetric,
+            nrow,
+            ncol,
+            len: 0,
+            indices_i,
+            indices_j,
+            values,
+            pattern_changed: false,
+        }
+    }
+
+    /// Puts a new entry (may be duplicate)
+    ///
+    /// The checks and error messages are the same as in [crate::NumCooMatrix::put()].
+    ///
+    /// # Input
+    ///
+    /// * `i` -- row index (indices start at zero; zero-based)
+    /// * `j` -- column index (indices start at zero; zero-based)
+    /// * `aij` -- the value A(i,j)
+    pub fn put(&mut self, i: usize, j: usize, aij: T) -> Result<(), StrError> {
+        // check range
+        if i >= self.nrow {
+            return Err("COO matrix: index of row is outside range");
+        }
+        if j >= self.ncol {
+            return Err("COO matrix: index of column is outside range");
+        }
+        if self.len >= self.values.len() {
+            return Err("COO matrix: max number of items has been reached");
+        }
+        if self.symmetric == Sym::YesLower {
+            if j > i {
+                return Err("COO matrix: j > i is incorrect for lower triangular storage");
+            }
+        }
+        if self.symmetric == Sym::YesUpper {
+            if j < i {
+                return Err("COO matrix: j < i is incorrect for upper triangular storage");
+            }
+        }
+
+        // insert a new entry
+        self.write_indices(self.len, i, j);
+        self.values[self.len] = aij;
+        self.len += 1;
+        Ok(())
+    }
+
+    /// Puts all entries of a dense block (e.g., an element matrix in the finite element method)
+    ///
+    /// Performs (with possible duplicates):
+    ///
+    /// ```text
+    /// A(rows[r], cols[c]) += block(r, c)
+    /// ```
+    ///
+    /// If the matrix is stored as lower (upper) triangular, only the entries with `i ≥ j` (`i ≤ j`)
+    /// are put; the other entries are ignored (thus, the block is assumed to be symmetric). Note that
+    /// zero values in the block are put as well; thus, the sparsity pattern does not depend on the values.
+    ///
+    /// All indices and the available space are checked before inserting any entry.
+    ///
+    /// # Input
+    ///
+    /// * `rows` -- the (global) row indices corresponding to the rows of the block
+    /// * `cols` -- the (global) column indices corresponding to the columns of the block
+    /// * `block` -- the `(rows.len(), cols.len())` dense matrix
+    pub fn put_block(&mut self, rows: &[usize], cols: &[usize], block: &NumMatrix<T>) -> Result<(), StrError> {
+        // check
+        if block.nrow() != rows.len() || block.ncol() != cols.len() {
+            return Err("COO matrix: the block dimensions are incompatible with the indices");
+        }
+        if rows.iter().any(|i| *i >= self.nrow) {
+            return Err("COO matrix: index of row is outside range");
+        }
+        if cols.iter().any(|j| *j >= self.ncol) {
+            return Err("COO matrix: index of column is outside range");
+        }
+        let symmetric = self.symmetric;
+        let keep = move |i: usize, j: usize| match symmetric {
+            Sym::YesLower => i >= j,
+            Sym::YesUpper => i <= j,
+            _ => true,
+        };
+        let count = match symmetric {
+            Sym::YesLower | Sym::YesUpper => cols.iter().map(|j| rows.iter().filter(|i| keep(**i, *j)).count()).sum(),
+            _ => rows.len() * cols.len(),
+        };
+        if self.len + count > self.values.len() {
+            return Err("COO matrix: max number of items has been reached");
+        }
+
+        // insert the entries (column-major, as in the block)
+        let mut p = self.len;
+        for (c, j) in cols.iter().enumerate() {
+            for (r, i) in rows.iter().enumerate() {
+                if keep(*i, *j) {
+                    self.write_indices(p, *i, *j);
+                    self.values[p] = block.get(r, c);
+                    p += 1;
+                }
+            }
+        }
+        self.len = p;
+        Ok(())
+    }
+
+    /// Returns the number of entries in this slice
+    pub fn len(&self) -> usize {
+        self.len
+    }
+
+    /// Returns the max number of entries in this slice
+    pub fn max_len(&self) -> usize {
+        self.values.len()
+    }
+
+    /// Returns whether an index has been overwritten by a different value or not
+    pub(crate) fn pattern_changed(&self) -> bool {
+        self.pattern_changed
+    }
+
+    /// Writes the indices of entry p (if they differ from the existing ones)
+    #[inline]
+    fn write_indices(&mut self, p: usize, i: usize, j: usize) {
+        let (i, j) = (i as i32, j as i32);
+        if self.indices_i[p] != i || self.indices_j[p] != j {
+            self.indices_i[p] = i;
+            self.indices_j[p] = j;
+            self.pattern_changed = true;
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#[cfg(test)]
+mod tests {
+    use super::NumCooSlice;
+    use crate::Sym;
+    use russell_lab::Matrix;
+
+    #[test]
+    fn put_captures_errors() {
+        let (mut ii, mut jj, mut vv) = (vec![0; 1], vec![0; 1], vec![0.0; 1]);
+        let mut slice = NumCooSlice::new(Sym::YesLower, 2, 2, &mut ii, &mut jj, &mut vv);
+        assert_eq!(
+            slice.put(2, 0, 1.0).err(),
+            Some("COO matrix: index of row is outside range")
+        );
+        assert_eq!(
+            slice.put(0, 2, 1.0).err(),
+            Some("COO matrix: index of column is outside range")
+        );
+        assert_eq!(
+            slice.put(0, 1, 1.0).err(),
+            Some("COO matrix: j > i is incorrect for lower triangular storage")
+        );
+        slice.put(1, 0, 1.0).unwrap();
+        assert_eq!(
+            slice.put(1, 1, 1.0).err(),
+            Some("COO matrix: max number of items has been reached")
+        );
+        let (mut ii, mut jj, mut vv) = (vec![0; 1], vec![0; 1], vec![0.0; 1]);
+        let mut slice = NumCooSlice::new(Sym::YesUpper, 2, 2, &mut ii, &mut jj, &mut vv);
+        assert_eq!(
+            slice.put(1, 0, 1.0).err(),
+            Some("COO matrix: j < i is incorrect for upper triangular storage")
+        );
+    }
+
+    #[test]
+    fn put_block_captures_errors() {
+        let (mut ii, mut jj, mut vv) = (vec![0; 3], vec![0; 3], vec![0.0; 3]);
+        let mut slice = NumCooSlice::new(Sym::No, 3, 3, &mut ii, &mut jj, &mut vv);
+        let block = Matrix::new(2, 2);
+        assert_eq!(
+            slice.put_block(&[0], &[0, 1], &block).err(),
+            Some("COO matrix: the block dimensions are incompatible with the indices")
+        );
+        assert_eq!(
+            slice.put_block(&[0, 3], &[0, 1], &block).err(),
+            Some("COO matrix: index of row is outside range")
+        );
+        assert_eq!(
+            slice.put_block(&[0, 1], &[3, 1], &block).err(),
+            Some("COO matrix: index of column is outside range")
+        );
+        assert_eq!(
+            slice.put_block(&[0, 1], &[0, 1], &block).err(),
+            Some("COO matrix: max number of items has been reached")
+        );
+        assert_eq!(slice.len(), 0);
+    }
+
+    #[test]
+    fn put_block_works() {
+        #[rustfmt::skip]
+        let block = Matrix::from(&[
+            [1.0, 2.0],
+            [2.0, 3.0],
+        ]);
+
+        // unsymmetric
+        let (mut ii, mut jj, mut vv) = (vec![0; 5], vec![0; 5], vec![0.0; 5]);
+        let mut slice = NumCooSlice::new(Sym::No, 3, 3, &mut ii, &mut jj, &mut vv);
+        slice.put(1, 1, 10.0).unwrap();
+        slice.put_block(&[2, 0], &[2, 0], &block).unwrap();
+        assert_eq!(slice.len(), 5);
+        assert_eq!(slice.max_len(), 5);
+        assert_eq!(ii, &[1, 2, 0, 2, 0]);
+        assert_eq!(jj, &[1, 2, 2, 0, 0]);
+        assert_eq!(vv, &[10.0, 1.0, 2.0, 2.0, 3.0]);
+
+        // lower triangular
+        let (mut ii, mut jj, mut vv) = (vec![0; 3], vec![0; 3], vec![0.0; 3]);
+        let mut slice = NumCooSlice::new(Sym::YesLower, 3, 3, &mut ii, &mut jj, &mut vv);
+        slice.put_block(&[2, 0], &[2, 0], &block).unwrap();
+        assert_eq!(slice.len(), 3);
+        assert_eq!(ii, &[2, 2, 0]);
+        assert_eq!(jj, &[2, 0, 0]);
+        assert_eq!(vv, &[1.0, 2.0, 3.0]);
+
+        // upper triangular
+        let (mut ii, mut jj, mut vv) = (vec![0; 3], vec![0; 3], vec![0.0; 3]);
+        let mut slice = NumCooSlice::new(Sym::YesUpper, 3, 3, &mut ii, &mut jj, &mut vv);
+        slice.put_block(&[2, 0], &[2, 0], &block).unwrap();
+        assert_eq!(slice.len(), 3);
+        assert_eq!(ii, &[2, 0, 0]);
+        assert_eq!(jj, &[2, 2, 0]);
+        assert_eq!(vv, &[1.0, 2.0, 3.0]);
+    }
+}
@@ -107,6 +107,14 @@ where
     /// Temporary workspace (for COO to CSC conversion)
     #[serde(skip)]
     temp_w: Vec<i32>,
+
+    /// Assembly map from each COO entry k to its position in `values` (for COO to CSC value-only updates)
+    #[serde(skip)]
+    assembly_map: Vec<usize>,
+
+    /// Pattern token of the COO matrix used to build the assembly map (zero means none)
+    #[serde(skip)]
+    assembly_token: u64,
 }
 
 impl<T> NumCscMatrix<T>
@@ -254,6 +262,8 @@ where
             temp_rx: Vec::new(),
             temp_rc: Vec::new(),
             temp_w: Vec::new(),
+            assembly_map: Vec::new(),
+            assembly_token: 0,
         })
     }
 
@@ -329,6 +339,9 @@ where
         if coo.nnz < 1 {
             return Err("COO to CSC requires nnz > 0");
         }
+        if coo.nnz > i32::MAX as usize {
+            return Err("COO to CSC requires nnz ≤ i32::MAX (only MUMPS accepts larger COO matrices)");
+        }
         let mut csc = NumCscMatrix {
             symmetric: coo.symmetric,
             nrow: coo.nrow,
@@ -341,6 +354,8 @@ where
             temp_rx: Vec::new(),
             temp_rc: Vec::new(),
             temp_w: Vec::new(),
+            assembly_map: Vec::new(),
+            assembly_token: 0,
         };
         csc.update_from_coo(coo).unwrap();
         Ok(csc)
@@ -353,6 +368,12 @@ where
     ///
     /// **Note:** The final nnz may be smaller than the initial nnz because duplicates
     /// may have been summed up. The final nnz is available as `nnz = col_pointers[ncol]`.
+    ///
+    /// **Note:** The first conversion builds an "assembly map" linking each COO entry to its
+    /// position in `values`. If the next COO matrix has the same pattern token, i.e., exactly the same
+    /// (i, j) sequence (e.g., after `reset` and the same sequence of `put`), the update is a single
+    /// scatter-add pass over the values, without comparing the indices, sorting, or summing duplicates.
+    /// Otherwise, the full conversion is performed and the assembly map is rebuilt.
     pub fn update_from_coo(&mut self, coo: &NumCooMatrix<T>) -> Result<(), StrError> {
         // check dimensions
         if coo.symmetric != self.symmetric {
@@ -381,6 +402,21 @@ where
         let aj = &coo.indices_j;
         let ax = &coo.values;
 
+        // value-only update using the assembly map (same structure as before)
+        if coo.pattern_token != 0 && coo.pattern_token == self.assembly_token && self.assembly_map.len() == nnz {
+            let final_nnz = self.col_pointers[ncol] as usize;
+            let bx = &mut self.values;
+            for p in 0..final_nnz {
+                bx[p] = T::zero();
+            }
+            for k in 0..nnz {
+                bx[self.assembly_map[k]] += ax[k];
+            }
+            return Ok(());
+        }
+        let mut map = vec![0_usize; nnz]; // map from k to the position in the row form
+        let mut pos = vec![0_usize; nnz]; // map from the row form to the compressed row form and then to the column form
+
         // access the CSC data
         let bp = &mut self.col_pointers;
         let bi = &mut self.row_indices;
@@ -424,6 +460,7 @@ where
             let p = w[i] as usize;
             rj[p] = aj[k];
             rx[p] = ax[k];
+            map[k] = p;
             w[i] += 1; // w[i] is advanced to the start of row i+1
         }
 
@@ -444,9 +481,11 @@ where
                     let pj = w[j] as usize;
                     let x = rx[p];
                     rx[pj] += x; // sum the entry
+                    pos[p] = pj;
                 } else {
                     // keep the entry
                     w[j] = dest as i32;
+                    pos[p] = dest;
                     if dest != p {
                         // move is not needed
                         rj[dest] = j as i32;
@@ -457,6 +496,9 @@ where
             }
             rc[i] = dest - p1;
         }
+        for k in 0..nnz {
+            map[k] = pos[map[k]];
+        }
 
         // count the entries in each column
         for j in 0..ncol {
@@ -489,9 +531,17 @@ where
                 let cp = w[j] as usize;
                 bi[cp] = i as i32;
                 bx[cp] = rx[p];
+                pos[p] = cp;
                 w[j] += 1;
             }
         }
+
+        // save the assembly map
+        for k in 0..nnz {
+            map[k] = pos[map[k]];
+        }
+        self.assembly_map = map;
+        self.assembly_token = coo.pattern_token;
         Ok(())
     }
 
@@ -529,6 +579,8 @@ where
             temp_rx: Vec::new(),
             temp_rc: Vec::new(),
             temp_w: Vec::new(),
+            assembly_map: Vec::new(),
+            assembly_token: 0,
         };
 
         // access the CSC data
@@ -912,11 +964,16 @@ mod tests {
 
     #[test]
     fn from_coo_captures_errors() {
-        let coo = CooMatrix::new(1, 1, 1, Sym::No).unwrap();
+        let mut coo = CooMatrix::new(1, 1, 1, Sym::No).unwrap();
         assert_eq!(
             NumCscMatrix::<f64>::from_coo(&coo).err(),
             Some("COO to CSC requires nnz > 0")
         );
+        coo.nnz = i32::MAX as usize + 1; // not allocated (the check comes first)
+        assert_eq!(
+            NumCscMatrix::<f64>::from_coo(&coo).err(),
+            Some("COO to CSC requires nnz ≤ i32::MAX (only MUMPS accepts larger COO matrices)")
+        );
     }
 
     #[test]
@@ -1011,10 +1068,10 @@ mod tests {
         let mut csc = NumCscMatrix::<f64>::from_coo(&coo).unwrap();
         let yes = Sym::YesLower;
         let no = Sym::No;
-        assert_eq!(csc.update_from_coo(&CooMatrix { symmetric: yes,  nrow: 1, ncol: 2, nnz: 1, max_nnz: 1, indices_i: vec![0], indices_j: vec![0], values: vec![0.0] }).err(), Some("coo.symmetry must be equal to csc.symmetry"));
-        assert_eq!(csc.update_from_coo(&CooMatrix { symmetric: no, nrow: 2, ncol: 2, nnz: 1, max_nnz: 1, indices_i: vec![0], indices_j: vec![0], values: vec![0.0] }).err(), Some("coo.nrow must be equal to csc.nrow"));
-        assert_eq!(csc.update_from_coo(&CooMatrix { symmetric: no, nrow: 1, ncol: 1, nnz: 1, max_nnz: 1, indices_i: vec![0], indices_j: vec![0], values: vec![0.0] }).err(), Some("coo.ncol must be equal to csc.ncol"));
-        assert_eq!(csc.update_from_coo(&CooMatrix { symmetric: no, nrow: 1, ncol: 2, nnz: 3, max_nnz: 3, indices_i: vec![0,0,0], indices_j: vec![0,0,0], values: vec![0.0,0.0,0.0] }).err(), Some("coo.nnz must be equal to nnz(dup) = csc.row_indices.len() = csc.values.len()"));
+        assert_eq!(csc.update_from_coo(&CooMatrix { symmetric: yes,  nrow: 1, ncol: 2, nnz: 1, max_nnz: 1, indices_i: vec![0], indices_j: vec![0], values: vec![0.0], pattern_token: 0 }).err(), Some("coo.symmetry must be equal to csc.symmetry"));
+        assert_eq!(csc.update_from_coo(&CooMatrix { symmetric: no, nrow: 2, ncol: 2, nnz: 1, max_nnz: 1, indices_i: vec![0], indices_j: vec![0], values: vec![0.0], pattern_token: 0 }).err(), Some("coo.nrow must be equal to csc.nrow"));
+        assert_eq!(csc.update_from_coo(&CooMatrix { symmetric: no, nrow: 1, ncol: 1, nnz: 1, max_nnz: 1, indices_i: vec![0], indices_j: vec![0], values: vec![0.0], pattern_token: 0 }).err(), Some("coo.ncol must be equal to csc.ncol"));
+        assert_eq!(csc.update_from_coo(&CooMatrix { symmetric: no, nrow: 1, ncol: 2, nnz: 3, max_nnz: 3, indices_i: vec![0,0,0], indices_j: vec![0,0,0], values: vec![0.0,0.0,0.0], pattern_token: 0 }).err(), Some("coo.nnz must be equal to nnz(dup) = csc.row_indices.len() = csc.values.len()"));
     }
 
     #[test]
@@ -1033,6 +1090,45 @@ mod tests {
         array_approx_eq(&csc.values[0..nnz], &csc_correct.values, 1e-15);
     }
 
+    #[test]
+    fn update_from_coo_uses_the_assembly_map() {
+        let (mut coo, csc_correct, _, _) = Samples::umfpack_unsymmetric_5x5();
+        let mut csc = NumCscMatrix::<f64>::from_coo(&coo).unwrap();
+        assert_eq!(csc.assembly_map.len(), coo.nnz);
+        assert_eq!(csc.assembly_token, coo.pattern_token);
+
+        // same structure, new values (duplicates are still summed up)
+        for k in 0..coo.nnz {
+            coo.values[k] *= 2.0;
+        }
+        csc.update_from_coo(&coo).unwrap();
+        assert_eq!(&csc.col_pointers, &csc_correct.col_pointers);
+        let nnz = csc.col_pointers[csc.ncol] as usize;
+        assert_eq!(&csc.row_indices[0..nnz], &csc_correct.row_indices);
+        let values_correct: Vec<_> = csc_correct.values.iter().map(|v| 2.0 * v).collect();
+        array_approx_eq(&csc.values[0..nnz], &values_correct, 1e-15);
+
+        // different structure (same nnz) triggers the full conversion
+        let mut coo = CooMatrix::new(2, 2, 3, Sym::No).unwrap();
+        coo.put(0, 0, 1.0).unwrap();
+        coo.put(1, 1, 2.0).unwrap();
+        coo.put(0, 1, 3.0).unwrap();
+        let mut csc = NumCscMatrix::<f64>::from_coo(&coo).unwrap();
+        assert_eq!(csc.assembly_map, &[0, 2, 1]);
+        let token = coo.pattern_token;
+        coo.reset();
+        coo.put(0, 0, 1.0).unwrap();
+        coo.put(1, 0, 4.0).unwrap();
+        coo.put(1, 1, 2.0).unwrap();
+        assert_ne!(coo.pattern_token, token);
+        csc.update_from_coo(&coo).unwrap();
+        assert_eq!(&csc.col_pointers, &[0, 2, 3]);
+        assert_eq!(&csc.row_indices, &[0, 1, 1]);
+        assert_eq!(&csc.values, &[1.0, 4.0, 2.0]);
+        assert_eq!(csc.assembly_map, &[0, 1, 2]);
+        assert_eq!(csc.assembly_token, coo.pattern_token);
+    }
+
     #[test]
     fn from_csr_works() {
         const IGNORED: bool = false;
@@ -1262,6 +1358,8 @@ mod tests {
             temp_rx: Vec::new(),
             temp_rc: Vec::new(),
             temp_w: Vec::new(),
+            assembly_map: Vec::new(),
+            assembly_token: 0,
         };
         let x = csc.get_values_mut();
         x.reverse();
@@ -324,6 +324,9 @@ where
         if coo.nnz < 1 {
             return Err("COO to CSR requires nnz > 0");
         }
+        if coo.nnz > i32::MAX as usize {
+            return Err("COO to CSR requires nnz ≤ i32::MAX (only MUMPS accepts larger COO matrices)");
+        }
         let mut csr = NumCsrMatrix {
             symmetric: coo.symmetric,
             nrow: coo.nrow,
@@ -885,11 +888,16 @@ mod tests {
 
     #[test]
     fn from_coo_captures_errors() {
-        let coo = CooMatrix::new(1, 1, 1, Sym::No).unwrap();
+        let mut coo = CooMatrix::new(1, 1, 1, Sym::No).unwrap();
         assert_eq!(
             NumCsrMatrix::<f64>::from_coo(&coo).err(),
             Some("COO to CSR requires nnz > 0")
         );
+        coo.nnz = i32::MAX as usize + 1; // not allocated (the check comes first)
+        assert_eq!(
+            NumCsrMatrix::<f64>::from_coo(&coo).err(),
+            Some("COO to CSR requires nnz ≤ i32::MAX (only MUMPS accepts larger COO matrices)")
+        );
     }
 
     #[test]
@@ -999,10 +1007,10 @@ mod tests {
         let mut csr = NumCsrMatrix::<f64>::from_coo(&coo).unwrap();
         let yes = Sym::YesLower;
         let no = Sym::No;
-        assert_eq!(csr.update_from_coo(&CooMatrix { symmetric: yes,  nrow: 1, ncol: 2, nnz: 1, max_nnz: 1, indices_i: vec![0], indices_j: vec![0], values: vec![0.0] }).err(), Some("coo.symmetry must be equal to csr.symmetry"));
-        assert_eq!(csr.update_from_coo(&CooMatrix { symmetric: no, nrow: 2, ncol: 2, nnz: 1, max_nnz: 1, indices_i: vec![0], indices_j: vec![0], values: vec![0.0] }).err(), Some("coo.nrow must be equal to csr.nrow"));
-        assert_eq!(csr.update_from_coo(&CooMatrix { symmetric: no, nrow: 1, ncol: 1, nnz: 1, max_nnz: 1, indices_i: vec![0], indices_j: vec![0], values: vec![0.0] }).err(), Some("coo.ncol must be equal to csr.ncol"));
-        assert_eq!(csr.update_from_coo(&CooMatrix { symmetric: no, nrow: 1, ncol: 2, nnz: 3, max_nnz: 3, indices_i: vec![0,0,0], indices_j: vec![0,0,0], values: vec![0.0,0.0,0.0] }).err(), Some("coo.nnz must be equal to nnz(dup) = self.col_indices.len() = csr.values.len()"));
+        assert_eq!(csr.update_from_coo(&CooMatrix { symmetric: yes,  nrow: 1, ncol: 2, nnz: 1, max_nnz: 1, indices_i: vec![0], indices_j: vec![0], values: vec![0.0], pattern_token: 0 }).err(), Some("coo.symmetry must be equal to csr.symmetry"));
+        assert_eq!(csr.update_from_coo(&CooMatrix { symmetric: no, nrow: 2, ncol: 2, nnz: 1, max_nnz: 1, indices_i: vec![0], indices_j: vec![0], values: vec![0.0], pattern_token: 0 }).err(), Some("coo.nrow must be equal to csr.nrow"));
+        assert_eq!(csr.update_from_coo(&CooMatrix { symmetric: no, nrow: 1, ncol: 1, nnz: 1, max_nnz: 1, indices_i: vec![0], indices_j: vec![0], values: vec![0.0], pattern_token: 0 }).err(), Some("coo.ncol must be equal to csr.ncol"));
+        assert_eq!(csr.update_from_coo(&CooMatrix { symmetric: no, nrow: 1, ncol: 2, nnz: 3, max_nnz: 3, indices_i: vec![0,0,0], indices_j: vec![0,0,0], values: vec![0.0,0.0,0.0], pattern_token: 0 }).err(), Some("coo.nnz must be equal to nnz(dup) = self.col_indices.len() = csr.values.len()"));
     }
 
     #[test]
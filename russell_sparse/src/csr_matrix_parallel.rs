@@ -0,0 +1,427 @@
+use super::NumCsrMatrix;
+use crate::StrError;
+use num_traits::{Num, NumCast};
+use russell_lab::{NumMatrix, NumVector};
+use serde::de::DeserializeOwned;
+use serde::Serialize;
+use std::ops::{AddAssign, MulAssign};
+use std::thread;
+
+impl<T> NumCsrMatrix<T>
+where
+    T: AddAssign + MulAssign + Num + NumCast + Copy + DeserializeOwned + Serialize + Send + Sync,
+{
+    /// Performs the matrix-vector multiplication using multiple threads
+    ///
+    /// ```text
+    ///  v  :=  α ⋅  a   ⋅  u
+    /// (m)        (m,n)   (n)
+    /// ```
+    ///
+    /// The rows are split into contiguous ranges with approximately the same number of non-zero
+    /// values and each range is processed by a scoped thread. Each thread writes into its own
+    /// (disjoint) range of `v`, thus no synchronization is needed.
+    ///
+    /// If the matrix is symmetric and only the lower or upper triangle is stored, the mirrored
+    /// contributions `v[j] += α aij u[i]` are accumulated into per-thread buffers which are then
+    /// summed up. Thus, the full matrix is never formed.
+    ///
+    /// # Input
+    ///
+    /// * `u` -- Vector with dimension equal to the number of columns of the matrix
+    /// * `nthread` -- the number of threads (0 or 1 means that the current thread does all the work)
+    ///
+    /// # Output
+    ///
+    /// * `v` -- Vector with dimension equal to the number of rows of the matrix
+    ///
+    /// # Examples
+    ///
+    /// ```
+    /// use russell_lab::{vec_approx_eq, Vector};
+    /// use russell_sparse::prelude::*;
+    /// use russell_sparse::StrError;
+    ///
+    /// fn main() -> Result<(), StrError> {
+    ///     // ┌       ┐
+    ///     // │ 2 1 . │
+    ///     // │ 1 2 1 │
+    ///     // │ . 1 2 │
+    ///     // └       ┘
+    ///     let mut coo = CooMatrix::new(3, 3, 5, Sym::YesLower)?;
+    ///     coo.put(0, 0, 2.0)?;
+    ///     coo.put(1, 0, 1.0)?;
+    ///     coo.put(1, 1, 2.0)?;
+    ///     coo.put(2, 1, 1.0)?;
+    ///     coo.put(2, 2, 2.0)?;
+    ///     let csr = CsrMatrix::from_coo(&coo)?;
+    ///
+    ///     let u = Vector::from(&[1.0, 2.0, 3.0]);
+    ///     let mut v = Vector::new(3);
+    ///     csr.mat_vec_mul_parallel(&mut v, 1.0, &u, 2)?;
+    ///     vec_approx_eq(&v, &[4.0, 8.0, 8.0], 1e-15);
+    ///     Ok(())
+    /// }
+    /// ```
+    pub fn mat_vec_mul_parallel(
+        &self,
+        v: &mut NumVector<T>,
+        alpha: T,
+        u: &NumVector<T>,
+        nthread: usize,
+    ) -> Result<(), StrError> {
+        if u.dim() != self.ncol {
+            return Err("u vector is incompatible");
+        }
+        if v.dim() != self.nrow {
+            return Err("v vector is incompatible");
+        }
+        let ranges = self.balanced_row_ranges(nthread);
+        let mut parts = Vec::with_capacity(ranges.len());
+        let mut rest = v.as_mut_data().as_mut_slice();
+        for (r0, r1) in &ranges {
+            let (part, tail) = rest.split_at_mut(r1 - r0);
+            parts.push(vec![part]);
+            rest = tail;
+        }
+        self.mul_kernel_parallel(&ranges, parts, alpha, u.as_data(), 1);
+        Ok(())
+    }
+
+    /// Performs the matrix-matrix multiplication (multiple right-hand sides) using multiple threads
+    ///
+    /// ```text
+    ///  c  :=  α ⋅  a   ⋅  b
+    /// (m,k)      (m,n)  (n,k)
+    /// ```
+    ///
+    /// This function is equivalent to calling [NumCsrMatrix::mat_vec_mul_parallel()] for each column
+    /// of `b`; however, the sparse matrix is traversed only once.
+    ///
+    /// # Input
+    ///
+    /// * `b` -- Matrix with the number of rows equal to the number of columns of the sparse matrix
+    /// * `nthread` -- the number of threads (0 or 1 means that the current thread does all the work)
+    ///
+    /// # Output
+    ///
+    /// * `c` -- Matrix with the number of rows equal to the number of rows of the sparse matrix
+    ///   and the number of columns equal to the number of columns of `b`
+    pub fn mat_mat_mul_parallel(
+        &self,
+        c: &mut NumMatrix<T>,
+        alpha: T,
+        b: &NumMatrix<T>,
+        nthread: usize,
+    ) -> Result<(), StrError> {
+        if b.nrow() != self.ncol {
+            return Err("b matrix is incompatible");
+        }
+        if c.nrow() != self.nrow || c.ncol() != b.ncol() {
+            return Err("c matrix is incompatible");
+        }
+        let nvec = b.ncol();
+        if nvec == 0 {
+            return Ok(());
+        }
+        let ranges = self.balanced_row_ranges(nthread);
+        let mut parts: Vec<Vec<&mut [T]>> = (0..ranges.len()).map(|_| Vec::with_capacity(nvec)).collect();
+        for column in c.as_mut_data().chunks_mut(self.nrow) {
+            let mut rest = column;
+            for (k, (r0, r1)) in ranges.iter().enumerate() {
+                let (part, tail) = rest.split_at_mut(r1 - r0);
+                parts[k].push(part);
+                rest = tail;
+            }
+        }
+        self.mul_kernel_parallel(&ranges, parts, alpha, b.as_data(), nvec);
+        Ok(())
+    }
+
+    /// Splits the rows into (at most) `nthread` contiguous ranges with approximately the same number of non-zeros
+    ///
+    /// Returns `(first_row, last_row + 1)` for each non-empty range
+    fn balanced_row_ranges(&self, nthread: usize) -> Vec<(usize, usize)> {
+        let nchunk = usize::max(1, usize::min(nthread, self.nrow));
+        let nnz = self.row_pointers[self.nrow] as usize;
+        let mut ranges = Vec::with_capacity(nchunk);
+        let mut r0 = 0;
+        for k in 1..=nchunk {
+            let r1 = if k == nchunk {
+                self.nrow
+            } else {
+                let target = k * nnz / nchunk;
+                let row = self.row_pointers[..self.nrow].partition_point(|&p| (p as usize) < target);
+                usize::max(r0, usize::min(row, self.nrow))
+            };
+            if r1 > r0 {
+                ranges.push((r0, r1));
+            }
+            r0 = r1;
+        }
+        ranges
+    }
+
+    /// Computes `c := α a b` where `b` and `c` are column-major with `nvec` columns
+    ///
+    /// `parts[k][col]` holds the rows `ranges[k]` of the column `col` of `c`.
+    fn mul_kernel_parallel(
+        &self,
+        ranges: &[(usize, usize)],
+        parts: Vec<Vec<&mut [T]>>,
+        alpha: T,
+        b: &[T],
+        nvec: usize,
+    ) {
+        let mirror_required = self.symmetric.triangular();
+        if ranges.len() < 2 {
+            for (range, mut cols) in ranges.iter().zip(parts) {
+                let mut mirrored = if mirror_required {
+                    vec![T::zero(); self.nrow * nvec]
+                } else {
+                    Vec::new()
+                };
+                self.mul_kernel(*range, &mut cols, &mut mirrored, alpha, b, nvec);
+                if mirror_required {
+                    add_mirrored(&mut cols, &mirrored, *range, self.nrow);
+                }
+            }
+            return;
+        }
+        let (results, buffers): (Vec<_>, Vec<_>) = thread::scope(|scope| {
+            let handles: Vec<_> = ranges
+                .iter()
+                .zip(parts.into_iter())
+                .map(|(range, mut cols)| {
+                    scope.spawn(move || {
+                        let mut mirrored = if mirror_required {
+                            vec![T::zero(); self.nrow * nvec]
+                        } else {
+                            Vec::new()
+                        };
+                        self.mul_kernel(*range, &mut cols, &mut mirrored, alpha, b, nvec);
+                        (cols, mirrored)
+                    })
+                })
+                .collect();
+            handles.into_iter().map(|h| h.join().unwrap()).unzip() // must panic if a thread panicked
+        });
+        if mirror_required {
+            // sum up the mirrored contributions; each thread reduces its own range of rows
+            let buffers = &buffers;
+            thread::scope(|scope| {
+                for (range, mut cols) in ranges.iter().zip(results.into_iter()) {
+                    scope.spawn(move || {
+                        for mirrored in buffers {
+                            add_mirrored(&mut cols, mirrored, *range, self.nrow);
+                        }
+                    });
+                }
+            });
+        }
+    }
+
+    /// Computes the rows `r0..r1` of `c := α a b` and the mirrored contributions (if triangular)
+    #[inline]
+    fn mul_kernel(
+        &self,
+        (r0, r1): (usize, usize),
+        cols: &mut [&mut [T]],
+        mirrored: &mut [T],
+        alpha: T,
+        b: &[T],
+        nvec: usize,
+    ) {
+        let (m, n) = (self.nrow, self.ncol);
+        let mirror_required = self.symmetric.triangular();
+        for col in cols.iter_mut() {
+            col.fill(T::zero());
+        }
+        for i in r0..r1 {
+            let start = self.row_pointers[i] as usize;
+            let end = self.row_pointers[i + 1] as usize;
+            for k in 0..nvec {
+                let bk = &b[(k * n)..((k + 1) * n)];
+                let mut sum = T::zero();
+                for p in start..end {
+                    let j = self.col_indices[p] as usize;
+                    let aij = self.values[p];
+                    sum += aij * bk[j];
+                    if mirror_required && i != j {
+                        mirrored[j + k * m] += alpha * aij * bk[i];
+                    }
+                }
+                cols[k][i - r0] = alpha * sum;
+            }
+        }
+    }
+}
+
+/// Adds the mirrored contributions corresponding to the rows `r0..r1`
+#[inline]
+fn add_mirrored<T>(cols: &mut [&mut [T]], mirrored: &[T], (r0, r1): (usize, usize), nrow: usize)
+where
+    T: AddAssign + Copy,
+{
+    for (k, col) in cols.iter_mut().enumerate() {
+        for i in r0..r1 {
+            col[i - r0] += mirrored[i + k * nrow];
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#[cfg(test)]
+mod tests {
+    use crate::{ComplexCsrMatrix, CooMatrix, CsrMatrix, Samples, Sym};
+    use russell_lab::{complex_vec_approx_eq, cpx, mat_approx_eq, vec_approx_eq};
+    use russell_lab::{Complex64, ComplexVector, Matrix, Vector};
+
+    /// Returns a banded matrix with a few dense rows (to unbalance the number of non-zeros per row)
+    fn banded(n: usize, sym: Sym) -> CsrMatrix {
+        let mut coo = CooMatrix::new(n, n, 10 * n, sym).unwrap();
+        for i in 0..n {
+            for j in 0..n {
+                let keep = match sym {
+                    Sym::YesLower => j <= i,
+                    Sym::YesUpper => j >= i,
+                    _ => true,
+                };
+                let band = i == j || i + 1 == j || j + 1 == i || i % 7 == 0 && j % 3 == 0 || j % 7 == 0 && i % 3 == 0;
+                if keep && band {
+                    coo.put(i, j, 1.0 + ((i * j) % 5) as f64 + 0.5 * ((i + j) % 3) as f64)
+                        .unwrap();
+                }
+            }
+        }
+        CsrMatrix::from_coo(&coo).unwrap()
+    }
+
+    #[test]
+    fn balanced_row_ranges_works() {
+        let csr = banded(30, Sym::No);
+        for nthread in [0, 1, 2, 3, 7, 30, 100] {
+            let ranges = csr.balanced_row_ranges(nthread);
+            assert!(ranges.len() <= usize::max(1, nthread));
+            assert_eq!(ranges[0].0, 0);
+            assert_eq!(ranges.last().unwrap().1, 30);
+            for k in 1..ranges.len() {
+                assert_eq!(ranges[k].0, ranges[k - 1].1);
+            }
+            for (r0, r1) in &ranges {
+                assert!(r1 > r0);
+            }
+        }
+        assert_eq!(csr.balanced_row_ranges(1), &[(0, 30)]);
+    }
+
+    #[test]
+    fn mat_vec_mul_parallel_captures_errors() {
+        let (_, _, csr, _) = Samples::rectangular_3x4();
+        let u = Vector::new(3);
+        let mut v = Vector::new(csr.nrow);
+        assert_eq!(
+            csr.mat_vec_mul_parallel(&mut v, 2.0, &u, 2).err(),
+            Some("u vector is incompatible")
+        );
+        let u = Vector::new(4);
+        let mut v = Vector::new(2);
+        assert_eq!(
+            csr.mat_vec_mul_parallel(&mut v, 2.0, &u, 2).err(),
+            Some("v vector is incompatible")
+        );
+        let b = Matrix::new(3, 2);
+        let mut c = Matrix::new(3, 2);
+        assert_eq!(
+            csr.mat_mat_mul_parallel(&mut c, 2.0, &b, 2).err(),
+            Some("b matrix is incompatible")
+        );
+        let b = Matrix::new(4, 2);
+        let mut c = Matrix::new(3, 1);
+        assert_eq!(
+            csr.mat_mat_mul_parallel(&mut c, 2.0, &b, 2).err(),
+            Some("c matrix is incompatible")
+        );
+    }
+
+    #[test]
+    fn mat_vec_mul_parallel_works() {
+        let (_, _, csr, _) = Samples::rectangular_3x4();
+        let u = Vector::from(&[1.0, 3.0, 8.0, 5.0]);
+        let mut v = Vector::new(csr.nrow);
+        for nthread in [0, 1, 2, 3, 8] {
+            csr.mat_vec_mul_parallel(&mut v, 2.0, &u, nthread).unwrap();
+            vec_approx_eq(&v, &[8.0, 16.0, 24.0], 1e-15);
+        }
+        let (_, _, csr, _) = Samples::mkl_symmetric_5x5_lower(false, false);
+        let u = Vector::from(&[1.0, 2.0, 3.0, 4.0, 5.0]);
+        let mut v = Vector::new(5);
+        for nthread in [0, 1, 2, 3, 8] {
+            csr.mat_vec_mul_parallel(&mut v, 2.0, &u, nthread).unwrap();
+            vec_approx_eq(&v, &[96.0, 5.0, 84.0, 6.5, 166.0], 1e-15);
+        }
+        let (_, _, csr, _) = Samples::mkl_symmetric_5x5_upper(false, false);
+        for nthread in [0, 1, 2, 3, 8] {
+            csr.mat_vec_mul_parallel(&mut v, 2.0, &u, nthread).unwrap();
+            vec_approx_eq(&v, &[96.0, 5.0, 84.0, 6.5, 166.0], 1e-15);
+        }
+    }
+
+    #[test]
+    fn mat_vec_mul_parallel_matches_serial() {
+        let n = 40;
+        let u = Vector::initialized(n, |i| 1.0 + 0.25 * (i as f64) - 0.01 * ((i * i) as f64));
+        for sym in [Sym::No, Sym::YesFull, Sym::YesLower, Sym::YesUpper] {
+            let csr = banded(n, sym);
+            let mut v_correct = Vector::new(n);
+            csr.mat_vec_mul(&mut v_correct, 3.0, &u).unwrap();
+            let mut v = Vector::new(n);
+            for nthread in [1, 2, 3, 5, 16] {
+                csr.mat_vec_mul_parallel(&mut v, 3.0, &u, nthread).unwrap();
+                vec_approx_eq(&v, v_correct.as_data(), 1e-12);
+            }
+        }
+    }
+
+    #[test]
+    fn mat_mat_mul_parallel_works() {
+        let n = 25;
+        let nvec = 3;
+        let b = Matrix::initialized(n, nvec, |i, k| 1.0 + (i as f64) * 0.1 - (k as f64) * 0.7);
+        for sym in [Sym::No, Sym::YesLower, Sym::YesUpper] {
+            let csr = banded(n, sym);
+            let mut c_correct = Matrix::new(n, nvec);
+            let mut v = Vector::new(n);
+            for k in 0..nvec {
+                let u = Vector::from(&b.extract_column(k));
+                csr.mat_vec_mul(&mut v, -2.0, &u).unwrap();
+                for i in 0..n {
+                    c_correct.set(i, k, v[i]);
+                }
+            }
+            let mut c = Matrix::new(n, nvec);
+            for nthread in [1, 2, 4] {
+                csr.mat_mat_mul_parallel(&mut c, -2.0, &b, nthread).unwrap();
+                mat_approx_eq(&c, &c_correct, 1e-12);
+            }
+        }
+    }
+
+    #[test]
+    fn mat_vec_mul_parallel_complex_works() {
+        let (_, _, csr, _): (_, _, ComplexCsrMatrix, _) = Samples::complex_rectangular_4x3();
+        let u = ComplexVector::from(&[cpx!(1.0, 1.0), cpx!(3.0, 1.0), cpx!(5.0, -1.0)]);
+        let mut v = ComplexVector::new(csr.nrow);
+        let correct = &[
+            cpx!(-40.0, 80.0),
+            cpx!(-10.0, 110.0),
+            cpx!(-64.0, 112.0),
+            cpx!(-2.0, 6.0),
+        ];
+        for nthread in [1, 2, 4] {
+            csr.mat_vec_mul_parallel(&mut v, cpx!(2.0, 4.0), &u, nthread).unwrap();
+            complex_vec_approx_eq(&v, correct, 1e-15);
+        }
+    }
+}
@@ -1,7 +1,7 @@
 use serde::{Deserialize, Serialize};
 
 /// Specifies the underlying library that does all the magic
-#[derive(Clone, Copy, Debug, Eq, PartialEq, Deserialize, Serialize)]
+#[derive(Clone, Copy, Debug, Eq, Hash, PartialEq, Deserialize, Serialize)]
 pub enum Genie {
     /// Selects KLU (LU factorization)
     ///
@@ -19,10 +19,20 @@ pub enum Genie {
     ///
     /// Reference: <https://github.com/DrTimothyAldenDavis/SuiteSparse>
     Umfpack,
+
+    /// Selects the preconditioned Krylov iterative solvers (CG, GMRES, BiCGStab) implemented in Rust
+    ///
+    /// See [crate::IterativeMethod] and [crate::Preconditioner]
+    Iterative,
+
+    /// Selects the direct solver (KLU, UMFPACK, or MUMPS) automatically by inspecting the matrix
+    ///
+    /// The decision is cached per sparsity pattern. See [crate::SolverAuto]
+    Auto,
 }
 
 /// Specifies the type of matrix symmetry
-#[derive(Clone, Copy, Debug, Eq, PartialEq, Deserialize, Serialize)]
+#[derive(Clone, Copy, Debug, Eq, Hash, PartialEq, Deserialize, Serialize)]
 pub enum Sym {
     /// Unknown symmetry (possibly unsymmetric)
     No,
@@ -65,6 +75,41 @@ pub enum MMsym {
     MakeItFull,
 }
 
+/// Specifies the Krylov method of the iterative solver
+#[derive(Clone, Copy, Debug, Eq, PartialEq, Deserialize, Serialize)]
+pub enum IterativeMethod {
+    /// Conjugate gradient method (symmetric positive-definite matrices only)
+    Cg,
+
+    /// Restarted generalized minimal residual method
+    Gmres,
+
+    /// Biconjugate gradient stabilized method
+    BiCgStab,
+}
+
+/// Specifies the preconditioner of the iterative solver
+#[derive(Clone, Copy, Debug, Eq, PartialEq, Deserialize, Serialize)]
+pub enum Preconditioner {
+    /// No preconditioner
+    No,
+
+    /// Diagonal (Jacobi) preconditioner
+    Jacobi,
+
+    /// Incomplete LU factorization with zero fill-in
+    Ilu0,
+
+    /// Incomplete Cholesky factorization with zero fill-in (symmetric positive-definite matrices only)
+    Ic0,
+
+    /// Direct factorization (e.g., from an earlier step) computed by [crate::LinSolParams::iterative_direct_genie]
+    ///
+    /// **Note:** The direct factorization is only refreshed every [crate::LinSolParams::iterative_direct_refresh]
+    /// calls to `factorize`. Thus, the iterative method corrects the solution of the outdated factorization.
+    Direct,
+}
+
 /// Ordering option
 #[derive(Clone, Copy, Debug, Eq, PartialEq, Deserialize, Serialize)]
 pub enum Ordering {
@@ -140,6 +185,8 @@ impl Genie {
             "klu" => Genie::Klu,
             "mumps" => Genie::Mumps,
             "umfpack" => Genie::Umfpack,
+            "iterative" => Genie::Iterative,
+            "auto" => Genie::Auto,
             _ => Genie::Umfpack,
         }
     }
@@ -150,6 +197,8 @@ impl Genie {
             Genie::Klu => "klu".to_string(),
             Genie::Mumps => "mumps".to_string(),
             Genie::Umfpack => "umfpack".to_string(),
+            Genie::Iterative => "iterative".to_string(),
+            Genie::Auto => "auto".to_string(),
         }
     }
 
@@ -160,6 +209,8 @@ impl Genie {
                 Genie::Klu => Sym::YesFull,
                 Genie::Mumps => Sym::YesLower,
                 Genie::Umfpack => Sym::YesFull,
+                Genie::Iterative => Sym::YesFull,
+                Genie::Auto => Sym::YesFull,
             }
         } else {
             Sym::No
@@ -178,6 +229,32 @@ impl Sym {
     }
 }
 
+impl IterativeMethod {
+    /// Returns the IterativeMethod by name (default is Gmres)
+    pub fn from(method: &str) -> Self {
+        match method.to_lowercase().as_str() {
+            "cg" => IterativeMethod::Cg,
+            "gmres" => IterativeMethod::Gmres,
+            "bicgstab" => IterativeMethod::BiCgStab,
+            _ => IterativeMethod::Gmres,
+        }
+    }
+}
+
+impl Preconditioner {
+    /// Returns the Preconditioner by name (default is Ilu0)
+    pub fn from(preconditioner: &str) -> Self {
+        match preconditioner.to_lowercase().as_str() {
+            "no" => Preconditioner::No,
+            "jacobi" => Preconditioner::Jacobi,
+            "ilu0" => Preconditioner::Ilu0,
+            "ic0" => Preconditioner::Ic0,
+            "direct" => Preconditioner::Direct,
+            _ => Preconditioner::Ilu0,
+        }
+    }
+}
+
 impl Ordering {
     /// Returns the Ordering by name (default is Auto)
     pub fn from(ordering: &str) -> Self {
@@ -347,6 +424,33 @@ mod tests {
         assert_eq!(genie.to_string(), "umfpack");
         assert_eq!(genie.symmetry(false,), Sym::No);
         assert_eq!(genie.symmetry(true), Sym::YesFull);
+
+        assert_eq!(Genie::from("Iterative"), Genie::Iterative);
+        let genie = Genie::Iterative;
+        assert_eq!(genie.to_string(), "iterative");
+        assert_eq!(genie.symmetry(false,), Sym::No);
+        assert_eq!(genie.symmetry(true), Sym::YesFull);
+
+        assert_eq!(Genie::from("Auto"), Genie::Auto);
+        let genie = Genie::Auto;
+        assert_eq!(genie.to_string(), "auto");
+        assert_eq!(genie.symmetry(false,), Sym::No);
+        assert_eq!(genie.symmetry(true), Sym::YesFull);
+    }
+
+    #[test]
+    fn iterative_method_and_preconditioner_functions_work() {
+        assert_eq!(IterativeMethod::from("CG"), IterativeMethod::Cg);
+        assert_eq!(IterativeMethod::from("gmres"), IterativeMethod::Gmres);
+        assert_eq!(IterativeMethod::from("BiCGStab"), IterativeMethod::BiCgStab);
+        assert_eq!(IterativeMethod::from("unknown"), IterativeMethod::Gmres);
+
+        assert_eq!(Preconditioner::from("No"), Preconditioner::No);
+        assert_eq!(Preconditioner::from("jacobi"), Preconditioner::Jacobi);
+        assert_eq!(Preconditioner::from("ILU0"), Preconditioner::Ilu0);
+        assert_eq!(Preconditioner::from("ic0"), Preconditioner::Ic0);
+        assert_eq!(Preconditioner::from("direct"), Preconditioner::Direct);
+        assert_eq!(Preconditioner::from("unknown"), Preconditioner::Ilu0);
     }
 
     #[test]
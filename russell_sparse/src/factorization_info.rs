@@ -0,0 +1,121 @@
+use super::{Genie, Sym};
+use crate::StrError;
+use serde::{Deserialize, Serialize};
+use std::ffi::CString;
+use std::fs::{self, File};
+use std::io::BufReader;
+use std::path::Path;
+
+/// Holds the data (besides the factors) needed to restore a saved factorization
+///
+/// The factors are saved by the solver library itself into the same directory.
+#[derive(Clone, Debug, PartialEq, Deserialize, Serialize)]
+pub(crate) struct FactorizationInfo {
+    /// Holds the solver that computed the factorization
+    pub genie: Genie,
+
+    /// Holds the symmetric flag of the factorized matrix
+    pub symmetric: Sym,
+
+    /// Holds the dimension of the factorized matrix
+    pub ndim: usize,
+
+    /// Holds the number of non-zeros of the factorized matrix
+    pub nnz: usize,
+
+    /// Indicates that the matrix has been factorized as positive-definite (MUMPS only)
+    pub positive_definite: bool,
+
+    /// Holds the used strategy (UMFPACK only)
+    pub effective_strategy: i32,
+
+    /// Holds the used ordering
+    pub effective_ordering: i32,
+
+    /// Holds the used scaling
+    pub effective_scaling: i32,
+
+    /// Holds the reciprocal condition number estimate (UMFPACK only)
+    pub rcond_estimate: f64,
+
+    /// Holds the determinant coefficient (if computed)
+    pub determinant_coefficient: f64,
+
+    /// Holds the determinant exponent (if computed)
+    pub determinant_exponent: f64,
+}
+
+/// Defines the name of the file with the FactorizationInfo (JSON)
+const INFO_FILENAME: &str = "factorization.json";
+
+impl FactorizationInfo {
+    /// Writes the JSON file into the directory (creates the directory if needed)
+    pub fn write(&self, full_path_dir: &str) -> Result<(), StrError> {
+        let dir = Path::new(full_path_dir);
+        fs::create_dir_all(dir).map_err(|_| "cannot create directory")?;
+        let mut file = File::create(dir.join(INFO_FILENAME)).map_err(|_| "cannot create file")?;
+        serde_json::to_writer_pretty(&mut file, &self).map_err(|_| "cannot write file")?;
+        Ok(())
+    }
+
+    /// Reads the JSON file from the directory and checks the genie
+    pub fn read(full_path_dir: &str, genie: Genie) -> Result<Self, StrError> {
+        let path = Path::new(full_path_dir).join(INFO_FILENAME);
+        let input = File::open(path).map_err(|_| "cannot open the factorization file")?;
+        let buffered = BufReader::new(input);
+        let info: FactorizationInfo =
+            serde_json::from_reader(buffered).map_err(|_| "cannot parse the factorization file")?;
+        if info.genie != genie {
+            return Err("the saved factorization has been computed by another solver");
+        }
+        Ok(info)
+    }
+
+    /// Returns the full path of a file in the directory (as a C string)
+    pub fn c_path(full_path_dir: &str, filename: &str) -> Result<CString, StrError> {
+        let path = Path::new(full_path_dir).join(filename);
+        let path = path.to_str().ok_or("the path of the factorization file is invalid")?;
+        CString::new(path).map_err(|_| "the path of the factorization file is invalid")
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#[cfg(test)]
+mod tests {
+    use super::FactorizationInfo;
+    use crate::{Genie, Sym};
+
+    #[test]
+    fn write_and_read_work() {
+        let info = FactorizationInfo {
+            genie: Genie::Umfpack,
+            symmetric: Sym::YesFull,
+            ndim: 3,
+            nnz: 9,
+            positive_definite: false,
+            effective_strategy: 3,
+            effective_ordering: 1,
+            effective_scaling: 1,
+            rcond_estimate: 0.5,
+            determinant_coefficient: 1.5,
+            determinant_exponent: 2.0,
+        };
+        let dir = "/tmp/russell_sparse/test_factorization_info";
+        info.write(dir).unwrap();
+        assert_eq!(FactorizationInfo::read(dir, Genie::Umfpack).unwrap(), info);
+        assert_eq!(
+            FactorizationInfo::read(dir, Genie::Mumps).err(),
+            Some("the saved factorization has been computed by another solver")
+        );
+        assert_eq!(
+            FactorizationInfo::read("/tmp/russell_sparse/__not_a_dir__", Genie::Umfpack).err(),
+            Some("cannot open the factorization file")
+        );
+        let path = FactorizationInfo::c_path(dir, "numeric.umf").unwrap();
+        assert_eq!(
+            path.to_str().unwrap(),
+            "/tmp/russell_sparse/test_factorization_info/numeric.umf"
+        );
+    }
+}
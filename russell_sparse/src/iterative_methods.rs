@@ -0,0 +1,388 @@
+use super::{CsrMatrix, IterativePrecond};
+use crate::StrError;
+use russell_lab::{vec_add, vec_copy, vec_inner, vec_norm, vec_update, Norm, Vector};
+
+/// Holds the control parameters of the Krylov methods
+#[derive(Clone, Copy, Debug)]
+pub(crate) struct KrylovControl {
+    /// Tolerance for the relative residual norm ‖b - A x‖ / ‖b‖
+    pub tolerance: f64,
+
+    /// Max number of iterations
+    pub max_iterations: usize,
+
+    /// Number of inner iterations before GMRES restarts
+    pub gmres_restart: usize,
+
+    /// Applies the transposed preconditioner (when solving the transposed system)
+    pub transposed: bool,
+
+    /// Number of threads for the matrix-vector products
+    pub num_threads: usize,
+}
+
+/// Holds the results of the Krylov methods
+#[derive(Clone, Copy, Debug, PartialEq)]
+pub(crate) struct KrylovResult {
+    /// Number of iterations
+    pub iterations: usize,
+
+    /// Final relative residual norm
+    pub relative_residual: f64,
+
+    /// Indicates whether the tolerance has been reached or not
+    pub converged: bool,
+}
+
+impl KrylovResult {
+    fn new(iterations: usize, relative_residual: f64, tolerance: f64) -> Self {
+        KrylovResult {
+            iterations,
+            relative_residual,
+            converged: relative_residual <= tolerance,
+        }
+    }
+}
+
+/// Solves `A x = b` with the preconditioned conjugate gradient method
+///
+/// The initial guess is `x = 0`. The matrix must be symmetric positive-definite.
+pub(crate) fn krylov_cg(
+    x: &mut Vector,
+    a: &CsrMatrix,
+    b: &Vector,
+    precond: &mut IterativePrecond,
+    ctrl: &KrylovControl,
+) -> Result<KrylovResult, StrError> {
+    let n = b.dim();
+    x.fill(0.0);
+    let b_norm = vec_norm(b, Norm::Euc);
+    if b_norm == 0.0 {
+        return Ok(KrylovResult::new(0, 0.0, ctrl.tolerance));
+    }
+    let mut r = b.clone();
+    let mut z = Vector::new(n);
+    let mut q = Vector::new(n);
+    precond.apply(&mut z, &r, ctrl.transposed)?;
+    let mut p = z.clone();
+    let mut rz = vec_inner(&r, &z);
+    let mut res = 1.0;
+    for it in 1..=ctrl.max_iterations {
+        a.mat_vec_mul_parallel(&mut q, 1.0, &p, ctrl.num_threads)?;
+        let pq = vec_inner(&p, &q);
+        if pq <= 0.0 {
+            return Err("CG breakdown: the matrix may not be positive-definite");
+        }
+        let alpha = rz / pq;
+        vec_update(x, alpha, &p)?;
+        vec_update(&mut r, -alpha, &q)?;
+        res = vec_norm(&r, Norm::Euc) / b_norm;
+        if res <= ctrl.tolerance {
+            return Ok(KrylovResult::new(it, res, ctrl.tolerance));
+        }
+        precond.apply(&mut z, &r, ctrl.transposed)?;
+        let rz_new = vec_inner(&r, &z);
+        let beta = rz_new / rz;
+        rz = rz_new;
+        vec_copy(&mut q, &p)?; // q is just a workspace here
+        vec_add(&mut p, 1.0, &z, beta, &q)?;
+    }
+    Ok(KrylovResult::new(ctrl.max_iterations, res, ctrl.tolerance))
+}
+
+/// Solves `A x = b` with the (right) preconditioned biconjugate gradient stabilized method
+///
+/// The initial guess is `x = 0`.
+pub(crate) fn krylov_bicgstab(
+    x: &mut Vector,
+    a: &CsrMatrix,
+    b: &Vector,
+    precond: &mut IterativePrecond,
+    ctrl: &KrylovControl,
+) -> Result<KrylovResult, StrError> {
+    let n = b.dim();
+    x.fill(0.0);
+    let b_norm = vec_norm(b, Norm::Euc);
+    if b_norm == 0.0 {
+        return Ok(KrylovResult::new(0, 0.0, ctrl.tolerance));
+    }
+    let mut r = b.clone();
+    let r_hat = b.clone();
+    let mut p = Vector::new(n);
+    let mut v = Vector::new(n);
+    let mut s = Vector::new(n);
+    let mut t = Vector::new(n);
+    let mut p_hat = Vector::new(n);
+    let mut s_hat = Vector::new(n);
+    let (mut rho, mut alpha, mut omega) = (1.0, 1.0, 1.0);
+    let mut res = 1.0;
+    for it in 1..=ctrl.max_iterations {
+        let rho_new = vec_inner(&r_hat, &r);
+        if rho_new == 0.0 {
+            return Err("BiCGStab breakdown: rho = 0");
+        }
+        if it == 1 {
+            vec_copy(&mut p, &r)?;
+        } else {
+            // p := r + beta (p - omega v)
+            let beta = (rho_new / rho) * (alpha / omega);
+            vec_update(&mut p, -omega, &v)?;
+            vec_copy(&mut t, &p)?; // t is just a workspace here
+            vec_add(&mut p, 1.0, &r, beta, &t)?;
+        }
+        rho = rho_new;
+        precond.apply(&mut p_hat, &p, ctrl.transposed)?;
+        a.mat_vec_mul_parallel(&mut v, 1.0, &p_hat, ctrl.num_threads)?;
+        let r_hat_v = vec_inner(&r_hat, &v);
+        if r_hat_v == 0.0 {
+            return Err("BiCGStab breakdown: (r̂, v) = 0");
+        }
+        alpha = rho / r_hat_v;
+        vec_add(&mut s, 1.0, &r, -alpha, &v)?;
+        res = vec_norm(&s, Norm::Euc) / b_norm;
+        if res <= ctrl.tolerance {
+            vec_update(x, alpha, &p_hat)?;
+            return Ok(KrylovResult::new(it, res, ctrl.tolerance));
+        }
+        precond.apply(&mut s_hat, &s, ctrl.transposed)?;
+        a.mat_vec_mul_parallel(&mut t, 1.0, &s_hat, ctrl.num_threads)?;
+        let tt = vec_inner(&t, &t);
+        omega = if tt > 0.0 { vec_inner(&t, &s) / tt } else { 0.0 };
+        vec_update(x, alpha, &p_hat)?;
+        vec_update(x, omega, &s_hat)?;
+        vec_add(&mut r, 1.0, &s, -omega, &t)?;
+        res = vec_norm(&r, Norm::Euc) / b_norm;
+        if res <= ctrl.tolerance {
+            return Ok(KrylovResult::new(it, res, ctrl.tolerance));
+        }
+        if omega == 0.0 {
+            return Err("BiCGStab breakdown: omega = 0");
+        }
+    }
+    Ok(KrylovResult::new(ctrl.max_iterations, res, ctrl.tolerance))
+}
+
+/// Solves `A x = b` with the (right) preconditioned restarted GMRES method
+///
+/// The initial guess is `x = 0`. The Arnoldi process uses the modified Gram-Schmidt
+/// orthogonalization and the least-squares problem is solved with Givens rotations.
+pub(crate) fn krylov_gmres(
+    x: &mut Vector,
+    a: &CsrMatrix,
+    b: &Vector,
+    precond: &mut IterativePrecond,
+    ctrl: &KrylovControl,
+) -> Result<KrylovResult, StrError> {
+    let n = b.dim();
+    let m = usize::max(1, ctrl.gmres_restart);
+    x.fill(0.0);
+    let b_norm = vec_norm(b, Norm::Euc);
+    if b_norm == 0.0 {
+        return Ok(KrylovResult::new(0, 0.0, ctrl.tolerance));
+    }
+    let mut basis: Vec<Vector> = (0..(m + 1)).map(|_| Vector::new(n)).collect();
+    let mut hh = vec![vec![0.0; m]; m + 1]; // Hessenberg matrix (row-major)
+    let mut cs = vec![0.0; m];
+    let mut sn = vec![0.0; m];
+    let mut g = vec![0.0; m + 1];
+    let mut y = vec![0.0; m];
+    let mut r = Vector::new(n);
+    let mut w = Vector::new(n);
+    let mut z = Vector::new(n);
+    let mut total = 0;
+    loop {
+        // r = b - A x
+        a.mat_vec_mul_parallel(&mut r, -1.0, x, ctrl.num_threads)?;
+        vec_update(&mut r, 1.0, b)?;
+        let beta = vec_norm(&r, Norm::Euc);
+        let mut res = beta / b_norm;
+        if res <= ctrl.tolerance || total >= ctrl.max_iterations {
+            return Ok(KrylovResult::new(total, res, ctrl.tolerance));
+        }
+        for i in 0..n {
+            basis[0][i] = r[i] / beta;
+        }
+        g.fill(0.0);
+        g[0] = beta;
+
+        // Arnoldi process
+        let mut k = 0;
+        while k < m && total < ctrl.max_iterations {
+            total += 1;
+            precond.apply(&mut z, &basis[k], ctrl.transposed)?;
+            a.mat_vec_mul_parallel(&mut w, 1.0, &z, ctrl.num_threads)?;
+            for i in 0..=k {
+                hh[i][k] = vec_inner(&w, &basis[i]);
+                vec_update(&mut w, -hh[i][k], &basis[i])?;
+            }
+            let h_next = vec_norm(&w, Norm::Euc);
+            hh[k + 1][k] = h_next;
+            if h_next > 0.0 {
+                for i in 0..n {
+                    basis[k + 1][i] = w[i] / h_next;
+                }
+            }
+            // apply the previous rotations to the new column
+            for i in 0..k {
+                let tmp = cs[i] * hh[i][k] + sn[i] * hh[i + 1][k];
+                hh[i + 1][k] = -sn[i] * hh[i][k] + cs[i] * hh[i + 1][k];
+                hh[i][k] = tmp;
+            }
+            // compute and apply the new rotation
+            let den = f64::hypot(hh[k][k], hh[k + 1][k]);
+            if den == 0.0 {
+                return Err("GMRES breakdown: the Hessenberg matrix is singular");
+            }
+            cs[k] = hh[k][k] / den;
+            sn[k] = hh[k + 1][k] / den;
+            hh[k][k] = den;
+            hh[k + 1][k] = 0.0;
+            g[k + 1] = -sn[k] * g[k];
+            g[k] = cs[k] * g[k];
+            k += 1;
+            res = f64::abs(g[k]) / b_norm;
+            if res <= ctrl.tolerance || h_next == 0.0 {
+                break;
+            }
+        }
+
+        // solve the upper triangular system H y = g and update x := x + M⁻¹ V y
+        for i in (0..k).rev() {
+            let mut sum = g[i];
+            for j in (i + 1)..k {
+                sum -= hh[i][j] * y[j];
+            }
+            y[i] = sum / hh[i][i];
+        }
+        w.fill(0.0);
+        for i in 0..k {
+            vec_update(&mut w, y[i], &basis[i])?;
+        }
+        precond.apply(&mut z, &w, ctrl.transposed)?;
+        vec_update(x, 1.0, &z)?;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#[cfg(test)]
+mod tests {
+    use super::{krylov_bicgstab, krylov_cg, krylov_gmres, KrylovControl};
+    use crate::{CooMatrix, CsrMatrix, IterativePrecond, PrecondIc0, PrecondIlu0, Samples, Sym};
+    use russell_lab::{vec_approx_eq, Vector};
+
+    fn control(gmres_restart: usize) -> KrylovControl {
+        KrylovControl {
+            tolerance: 1e-12,
+            max_iterations: 200,
+            gmres_restart,
+            transposed: false,
+            num_threads: 1,
+        }
+    }
+
+    /// Returns the 1D Laplacian (tridiagonal; symmetric positive-definite)
+    fn laplacian(n: usize, sym: Sym) -> CsrMatrix {
+        let mut coo = CooMatrix::new(n, n, 3 * n, sym).unwrap();
+        for i in 0..n {
+            coo.put(i, i, 2.0).unwrap();
+            if i > 0 {
+                coo.put(i, i - 1, -1.0).unwrap();
+                if sym != Sym::YesLower {
+                    coo.put(i - 1, i, -1.0).unwrap();
+                }
+            }
+        }
+        CsrMatrix::from_coo(&coo).unwrap()
+    }
+
+    #[test]
+    fn zero_rhs_gives_zero_solution() {
+        let csr = laplacian(4, Sym::YesFull);
+        let b = Vector::new(4);
+        let mut x = Vector::filled(4, 1.0);
+        for method in [krylov_cg, krylov_bicgstab, krylov_gmres] {
+            let res = method(&mut x, &csr, &b, &mut IterativePrecond::No, &control(10)).unwrap();
+            assert_eq!(res.iterations, 0);
+            assert!(res.converged);
+            assert_eq!(x.as_data(), &[0.0; 4]);
+        }
+    }
+
+    #[test]
+    fn cg_works() {
+        let n = 20;
+        let x_correct = Vector::initialized(n, |i| 1.0 + i as f64);
+        for sym in [Sym::YesFull, Sym::YesLower] {
+            let csr = laplacian(n, sym);
+            let mut b = Vector::new(n);
+            csr.mat_vec_mul(&mut b, 1.0, &x_correct).unwrap();
+            let mut x = Vector::new(n);
+            // no preconditioner: CG converges in n iterations at most (in exact arithmetic)
+            let res = krylov_cg(&mut x, &csr, &b, &mut IterativePrecond::No, &control(0)).unwrap();
+            assert!(res.converged);
+            assert!(res.iterations <= n + 2);
+            vec_approx_eq(&x, x_correct.as_data(), 1e-9);
+            // IC(0) is exact for tridiagonal matrices: converges in one iteration
+            let mut precond = IterativePrecond::Ic0(PrecondIc0::new(&csr).unwrap());
+            let res = krylov_cg(&mut x, &csr, &b, &mut precond, &control(0)).unwrap();
+            assert!(res.converged);
+            assert_eq!(res.iterations, 1);
+            vec_approx_eq(&x, x_correct.as_data(), 1e-10);
+        }
+        // not positive-definite
+        let mut coo = CooMatrix::new(2, 2, 2, Sym::YesFull).unwrap();
+        coo.put(0, 0, -1.0).unwrap();
+        coo.put(1, 1, -1.0).unwrap();
+        let csr = CsrMatrix::from_coo(&coo).unwrap();
+        let b = Vector::from(&[1.0, 1.0]);
+        let mut x = Vector::new(2);
+        assert_eq!(
+            krylov_cg(&mut x, &csr, &b, &mut IterativePrecond::No, &control(0)).err(),
+            Some("CG breakdown: the matrix may not be positive-definite")
+        );
+    }
+
+    #[test]
+    fn bicgstab_and_gmres_work() {
+        let (_, _, csr, _) = Samples::mkl_unsymmetric_5x5();
+        let b = Vector::from(&[-13.0, 8.0, 56.0, 30.0, -9.0]);
+        let x_correct = &[1.0, 2.0, 3.0, 4.0, 5.0];
+        let mut x = Vector::new(5);
+        for with_ilu in [false, true] {
+            let mut precond = if with_ilu {
+                IterativePrecond::Ilu0(PrecondIlu0::new(&csr).unwrap())
+            } else {
+                IterativePrecond::No
+            };
+            let res = krylov_bicgstab(&mut x, &csr, &b, &mut precond, &control(0)).unwrap();
+            assert!(res.converged);
+            vec_approx_eq(&x, x_correct, 1e-10);
+            for restart in [4, 5, 30] {
+                let res = krylov_gmres(&mut x, &csr, &b, &mut precond, &control(restart)).unwrap();
+                assert!(res.converged);
+                assert!(res.relative_residual <= 1e-12);
+                vec_approx_eq(&x, x_correct, 1e-10);
+            }
+        }
+        // full GMRES (without restarts) converges in n iterations at most
+        let res = krylov_gmres(&mut x, &csr, &b, &mut IterativePrecond::No, &control(5)).unwrap();
+        assert!(res.iterations <= 5);
+    }
+
+    #[test]
+    fn max_iterations_is_respected() {
+        let n = 50;
+        let csr = laplacian(n, Sym::YesFull);
+        let b = Vector::filled(n, 1.0);
+        let mut x = Vector::new(n);
+        let mut ctrl = control(5);
+        ctrl.max_iterations = 3;
+        for method in [krylov_cg, krylov_bicgstab, krylov_gmres] {
+            let res = method(&mut x, &csr, &b, &mut IterativePrecond::No, &ctrl).unwrap();
+            assert_eq!(res.iterations, 3);
+            assert!(!res.converged);
+            assert!(res.relative_residual > 0.0);
+        }
+    }
+}
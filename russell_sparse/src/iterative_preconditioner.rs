@@ -0,0 +1,418 @@
+use super::{CsrMatrix, LinSolver, Preconditioner, SparseMatrix, Sym};
+use crate::StrError;
+use russell_lab::Vector;
+
+/// Holds the data of the preconditioner used by the iterative solver
+///
+/// The preconditioner approximates the inverse of the coefficient matrix, i.e., `z = M⁻¹ r`.
+pub(crate) enum IterativePrecond {
+    /// Identity (no preconditioner)
+    No,
+
+    /// Holds the inverse of the diagonal entries
+    Jacobi(Vec<f64>),
+
+    /// Holds the ILU(0) factors
+    Ilu0(PrecondIlu0),
+
+    /// Holds the IC(0) factor
+    Ic0(PrecondIc0),
+
+    /// Holds a direct solver (already factorized) and the matrix used to compute the factorization
+    Direct(Box<(LinSolver<'static>, SparseMatrix)>),
+}
+
+impl IterativePrecond {
+    /// Returns a short name for the stats
+    pub(crate) fn kind(&self) -> Preconditioner {
+        match self {
+            IterativePrecond::No => Preconditioner::No,
+            IterativePrecond::Jacobi(_) => Preconditioner::Jacobi,
+            IterativePrecond::Ilu0(_) => Preconditioner::Ilu0,
+            IterativePrecond::Ic0(_) => Preconditioner::Ic0,
+            IterativePrecond::Direct(_) => Preconditioner::Direct,
+        }
+    }
+
+    /// Allocates the Jacobi preconditioner
+    pub(crate) fn new_jacobi(csr: &CsrMatrix) -> Result<Self, StrError> {
+        let mut inv_diag = vec![0.0; csr.nrow];
+        for i in 0..csr.nrow {
+            for p in csr.row_pointers[i]..csr.row_pointers[i + 1] {
+                if csr.col_indices[p as usize] as usize == i {
+                    inv_diag[i] += csr.values[p as usize];
+                }
+            }
+            if inv_diag[i] == 0.0 {
+                return Err("the Jacobi preconditioner requires non-zero diagonal entries");
+            }
+            inv_diag[i] = 1.0 / inv_diag[i];
+        }
+        Ok(IterativePrecond::Jacobi(inv_diag))
+    }
+
+    /// Computes `z = M⁻¹ r` (or `z = M⁻ᵀ r` if transposed)
+    pub(crate) fn apply(&mut self, z: &mut Vector, r: &Vector, transposed: bool) -> Result<(), StrError> {
+        match self {
+            IterativePrecond::No => z.as_mut_data().copy_from_slice(r.as_data()),
+            IterativePrecond::Jacobi(inv_diag) => {
+                for i in 0..inv_diag.len() {
+                    z[i] = inv_diag[i] * r[i];
+                }
+            }
+            IterativePrecond::Ilu0(ilu) => {
+                if transposed {
+                    ilu.solve_transposed(z, r)
+                } else {
+                    ilu.solve(z, r)
+                }
+            }
+            IterativePrecond::Ic0(ic) => ic.solve(z, r),
+            IterativePrecond::Direct(direct) => {
+                let (solver, mat) = direct.as_mut();
+                if transposed {
+                    solver.actual.solve_transposed(z, mat, r, false)?;
+                } else {
+                    solver.actual.solve(z, mat, r, false)?;
+                }
+            }
+        }
+        Ok(())
+    }
+}
+
+/// Holds the incomplete LU factorization with zero fill-in
+///
+/// The factors `L` (unit lower triangular) and `U` share the sparsity pattern of the CSR matrix.
+pub(crate) struct PrecondIlu0 {
+    row_pointers: Vec<usize>,
+    col_indices: Vec<usize>,
+    values: Vec<f64>,
+    diag: Vec<usize>, // position of the diagonal entry in each row
+}
+
+impl PrecondIlu0 {
+    /// Computes the ILU(0) factorization (IKJ variant)
+    pub(crate) fn new(csr: &CsrMatrix) -> Result<Self, StrError> {
+        if csr.symmetric.triangular() {
+            return Err("ILU(0) requires Sym::No or Sym::YesFull");
+        }
+        let n = csr.nrow;
+        let row_pointers: Vec<usize> = csr.row_pointers.iter().map(|&p| p as usize).collect();
+        let col_indices: Vec<usize> = csr.col_indices[..row_pointers[n]].iter().map(|&j| j as usize).collect();
+        let mut values = csr.values[..row_pointers[n]].to_vec();
+        let mut diag = vec![0; n];
+        for i in 0..n {
+            match (row_pointers[i]..row_pointers[i + 1]).find(|&p| col_indices[p] == i) {
+                Some(p) => diag[i] = p,
+                None => return Err("ILU(0) requires all diagonal entries to be present"),
+            }
+        }
+        let mut iw = vec![usize::MAX; n];
+        for i in 0..n {
+            let (start, end) = (row_pointers[i], row_pointers[i + 1]);
+            for p in start..end {
+                iw[col_indices[p]] = p;
+            }
+            for p in start..diag[i] {
+                let k = col_indices[p];
+                let lik = values[p] / values[diag[k]];
+                values[p] = lik;
+                for q in (diag[k] + 1)..row_pointers[k + 1] {
+                    let w = iw[col_indices[q]];
+                    if w != usize::MAX {
+                        values[w] -= lik * values[q];
+                    }
+                }
+            }
+            if values[diag[i]] == 0.0 {
+                return Err("ILU(0) found a zero pivot");
+            }
+            for p in start..end {
+                iw[col_indices[p]] = usize::MAX;
+            }
+        }
+        Ok(PrecondIlu0 {
+            row_pointers,
+            col_indices,
+            values,
+            diag,
+        })
+    }
+
+    /// Solves `L U z = r`
+    fn solve(&self, z: &mut Vector, r: &Vector) {
+        let n = self.diag.len();
+        for i in 0..n {
+            let mut sum = r[i];
+            for p in self.row_pointers[i]..self.diag[i] {
+                sum -= self.values[p] * z[self.col_indices[p]];
+            }
+            z[i] = sum;
+        }
+        for i in (0..n).rev() {
+            let mut sum = z[i];
+            for p in (self.diag[i] + 1)..self.row_pointers[i + 1] {
+                sum -= self.values[p] * z[self.col_indices[p]];
+            }
+            z[i] = sum / self.values[self.diag[i]];
+        }
+    }
+
+    /// Solves `(L U)ᵀ z = Uᵀ Lᵀ z = r`
+    fn solve_transposed(&self, z: &mut Vector, r: &Vector) {
+        let n = self.diag.len();
+        z.as_mut_data().copy_from_slice(r.as_data());
+        for i in 0..n {
+            z[i] /= self.values[self.diag[i]];
+            let zi = z[i];
+            for p in (self.diag[i] + 1)..self.row_pointers[i + 1] {
+                z[self.col_indices[p]] -= self.values[p] * zi;
+            }
+        }
+        for i in (0..n).rev() {
+            let zi = z[i];
+            for p in self.row_pointers[i]..self.diag[i] {
+                z[self.col_indices[p]] -= self.values[p] * zi;
+            }
+        }
+    }
+}
+
+/// Holds the incomplete Cholesky factorization with zero fill-in
+///
+/// The factor `L` has the sparsity pattern of the lower triangle of the CSR matrix.
+pub(crate) struct PrecondIc0 {
+    row_pointers: Vec<usize>,
+    col_indices: Vec<usize>, // the diagonal entry is the last one in each row
+    values: Vec<f64>,
+}
+
+impl PrecondIc0 {
+    /// Computes the IC(0) factorization (row-oriented)
+    pub(crate) fn new(csr: &CsrMatrix) -> Result<Self, StrError> {
+        if csr.symmetric != Sym::YesFull && csr.symmetric != Sym::YesLower {
+            return Err("IC(0) requires Sym::YesFull or Sym::YesLower");
+        }
+        let n = csr.nrow;
+        let mut row_pointers = vec![0; n + 1];
+        let mut col_indices = Vec::new();
+        let mut values = Vec::new();
+        for i in 0..n {
+            for p in csr.row_pointers[i]..csr.row_pointers[i + 1] {
+                let j = csr.col_indices[p as usize] as usize;
+                if j <= i {
+                    col_indices.push(j);
+                    values.push(csr.values[p as usize]);
+                }
+            }
+            row_pointers[i + 1] = col_indices.len();
+            if row_pointers[i + 1] == row_pointers[i] || col_indices[row_pointers[i + 1] - 1] != i {
+                return Err("IC(0) requires all diagonal entries to be present");
+            }
+        }
+        for i in 0..n {
+            for p in row_pointers[i]..row_pointers[i + 1] {
+                let j = col_indices[p];
+                // s = a_ij - Σ_{k<j} l_ik l_jk (over the common pattern of rows i and j)
+                let mut s = values[p];
+                let (mut a, mut b) = (row_pointers[i], row_pointers[j]);
+                let b_end = row_pointers[j + 1] - 1; // skip the diagonal of row j
+                while a < p && b < b_end {
+                    let (ka, kb) = (col_indices[a], col_indices[b]);
+                    if ka == kb {
+                        s -= values[a] * values[b];
+                        a += 1;
+                        b += 1;
+                    } else if ka < kb {
+                        a += 1;
+                    } else {
+                        b += 1;
+                    }
+                }
+                if j < i {
+                    values[p] = s / values[row_pointers[j + 1] - 1];
+                } else {
+                    if s <= 0.0 {
+                        return Err("IC(0) found a non-positive pivot");
+                    }
+                    values[p] = f64::sqrt(s);
+                }
+            }
+        }
+        Ok(PrecondIc0 {
+            row_pointers,
+            col_indices,
+            values,
+        })
+    }
+
+    /// Solves `L Lᵀ z = r`
+    fn solve(&self, z: &mut Vector, r: &Vector) {
+        let n = self.row_pointers.len() - 1;
+        for i in 0..n {
+            let d = self.row_pointers[i + 1] - 1;
+            let mut sum = r[i];
+            for p in self.row_pointers[i]..d {
+                sum -= self.values[p] * z[self.col_indices[p]];
+            }
+            z[i] = sum / self.values[d];
+        }
+        for i in (0..n).rev() {
+            let d = self.row_pointers[i + 1] - 1;
+            z[i] /= self.values[d];
+            let zi = z[i];
+            for p in self.row_pointers[i]..d {
+                z[self.col_indices[p]] -= self.values[p] * zi;
+            }
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#[cfg(test)]
+mod tests {
+    use super::{IterativePrecond, PrecondIc0, PrecondIlu0};
+    use crate::{CooMatrix, CsrMatrix, Preconditioner, Samples, Sym};
+    use russell_lab::{mat_vec_mul, vec_approx_eq, Matrix, Vector};
+
+    /// Returns the "product" of the factors as dense matrix (for checking)
+    fn ilu_product(ilu: &PrecondIlu0, n: usize) -> Matrix {
+        let mut l = Matrix::identity(n);
+        let mut u = Matrix::new(n, n);
+        for i in 0..n {
+            for p in ilu.row_pointers[i]..ilu.row_pointers[i + 1] {
+                let j = ilu.col_indices[p];
+                if j < i {
+                    l.set(i, j, ilu.values[p]);
+                } else {
+                    u.set(i, j, ilu.values[p]);
+                }
+            }
+        }
+        let mut lu = Matrix::new(n, n);
+        russell_lab::mat_mat_mul(&mut lu, 1.0, &l, &u, 0.0).unwrap();
+        lu
+    }
+
+    #[test]
+    fn jacobi_works() {
+        let (_, _, csr, _) = Samples::mkl_symmetric_5x5_lower(false, false);
+        let mut precond = IterativePrecond::new_jacobi(&csr).unwrap();
+        assert_eq!(precond.kind(), Preconditioner::Jacobi);
+        let r = Vector::from(&[9.0, 1.0, 1.0, 1.0, 1.0]);
+        let mut z = Vector::new(5);
+        precond.apply(&mut z, &r, false).unwrap();
+        let a = csr.as_dense();
+        for i in 0..5 {
+            assert_eq!(z[i], r[i] / a.get(i, i));
+        }
+        let mut coo = CooMatrix::new(2, 2, 1, Sym::No).unwrap();
+        coo.put(0, 0, 1.0).unwrap();
+        let csr = CsrMatrix::from_coo(&coo).unwrap();
+        assert_eq!(
+            IterativePrecond::new_jacobi(&csr).err(),
+            Some("the Jacobi preconditioner requires non-zero diagonal entries")
+        );
+    }
+
+    #[test]
+    fn ilu0_captures_errors() {
+        let (_, _, csr, _) = Samples::mkl_symmetric_5x5_lower(false, false);
+        assert_eq!(
+            PrecondIlu0::new(&csr).err(),
+            Some("ILU(0) requires Sym::No or Sym::YesFull")
+        );
+        let mut coo = CooMatrix::new(2, 2, 3, Sym::No).unwrap();
+        coo.put(0, 0, 1.0).unwrap();
+        coo.put(0, 1, 1.0).unwrap();
+        coo.put(1, 0, 1.0).unwrap();
+        let csr = CsrMatrix::from_coo(&coo).unwrap();
+        assert_eq!(
+            PrecondIlu0::new(&csr).err(),
+            Some("ILU(0) requires all diagonal entries to be present")
+        );
+        let mut coo = CooMatrix::new(2, 2, 4, Sym::No).unwrap();
+        coo.put(0, 0, 1.0).unwrap();
+        coo.put(0, 1, 1.0).unwrap();
+        coo.put(1, 0, 1.0).unwrap();
+        coo.put(1, 1, 1.0).unwrap();
+        let csr = CsrMatrix::from_coo(&coo).unwrap();
+        assert_eq!(PrecondIlu0::new(&csr).err(), Some("ILU(0) found a zero pivot"));
+    }
+
+    #[test]
+    fn ilu0_works() {
+        // the product L·U must match the matrix on its sparsity pattern (the fill-in is dropped)
+        let (_, _, csr, _) = Samples::mkl_unsymmetric_5x5();
+        let ilu = PrecondIlu0::new(&csr).unwrap();
+        let a = csr.as_dense();
+        let lu = ilu_product(&ilu, 5);
+        for i in 0..5 {
+            for p in csr.row_pointers[i]..csr.row_pointers[i + 1] {
+                let j = csr.col_indices[p as usize] as usize;
+                assert!(f64::abs(lu.get(i, j) - a.get(i, j)) < 1e-13);
+            }
+        }
+        // the solves must invert the product
+        let mut precond = IterativePrecond::Ilu0(ilu);
+        let r = Vector::from(&[1.0, -2.0, 3.0, -4.0, 5.0]);
+        let mut z = Vector::new(5);
+        let mut lu_z = Vector::new(5);
+        precond.apply(&mut z, &r, false).unwrap();
+        mat_vec_mul(&mut lu_z, 1.0, &lu, &z).unwrap();
+        vec_approx_eq(&lu_z, r.as_data(), 1e-12);
+        precond.apply(&mut z, &r, true).unwrap();
+        let mut lu_t = Matrix::new(5, 5);
+        for i in 0..5 {
+            for j in 0..5 {
+                lu_t.set(i, j, lu.get(j, i));
+            }
+        }
+        mat_vec_mul(&mut lu_z, 1.0, &lu_t, &z).unwrap();
+        vec_approx_eq(&lu_z, r.as_data(), 1e-12);
+    }
+
+    #[test]
+    fn ic0_captures_errors() {
+        let (_, _, csr, _) = Samples::umfpack_unsymmetric_5x5();
+        assert_eq!(
+            PrecondIc0::new(&csr).err(),
+            Some("IC(0) requires Sym::YesFull or Sym::YesLower")
+        );
+        let mut coo = CooMatrix::new(2, 2, 2, Sym::YesLower).unwrap();
+        coo.put(0, 0, 1.0).unwrap();
+        coo.put(1, 0, 1.0).unwrap();
+        let csr = CsrMatrix::from_coo(&coo).unwrap();
+        assert_eq!(
+            PrecondIc0::new(&csr).err(),
+            Some("IC(0) requires all diagonal entries to be present")
+        );
+        let mut coo = CooMatrix::new(2, 2, 3, Sym::YesLower).unwrap();
+        coo.put(0, 0, 1.0).unwrap();
+        coo.put(1, 0, 2.0).unwrap();
+        coo.put(1, 1, 1.0).unwrap();
+        let csr = CsrMatrix::from_coo(&coo).unwrap();
+        assert_eq!(PrecondIc0::new(&csr).err(), Some("IC(0) found a non-positive pivot"));
+    }
+
+    #[test]
+    fn ic0_works() {
+        // no fill-in => IC(0) is the exact Cholesky factorization
+        for (_, _, csr, _) in [
+            Samples::positive_definite_3x3_lower(),
+            Samples::positive_definite_3x3_full(),
+        ] {
+            let mut precond = IterativePrecond::Ic0(PrecondIc0::new(&csr).unwrap());
+            assert_eq!(precond.kind(), Preconditioner::Ic0);
+            let a = csr.as_dense();
+            let r = Vector::from(&[1.0, 2.0, 3.0]);
+            let mut z = Vector::new(3);
+            let mut az = Vector::new(3);
+            precond.apply(&mut z, &r, false).unwrap();
+            mat_vec_mul(&mut az, 1.0, &a, &z).unwrap();
+            vec_approx_eq(&az, r.as_data(), 1e-13);
+        }
+    }
+}
@@ -30,8 +30,12 @@
 //!
 //! Nonetheless, the implemented interface to the above linear solvers takes a [SparseMatrix] as input, which will automatically be converted from COO to CSC or COO to CSR, as appropriate.
 //!
+//! **Note:** The CSC and CSR matrices (thus, UMFPACK and KLU) use 32-bit indices; i.e., the number of non-zeros must not exceed `i32::MAX`. MUMPS takes the COO matrix directly with a 64-bit number of non-zeros; thus, only MUMPS can solve larger systems.
+//!
 //! The best way to use a COO matrix is to initialize it with the maximum possible number of non-zero values and repetitively call the [CooMatrix::put()] function to insert triples (i, j, aij) into the data structure. This procedure is computationally efficient. Later, we can create a Compressed Sparse Column (CSC) or a Compressed Sparse Row (CSC) matrix from the COO matrix. The CSC and CSR will sum up any duplicates in the COO matrix during the conversion process. To reinitialize the counter for "putting" entries into the triplet structure, we can call the [CooMatrix::reset()] function (e.g., to recreate the global stiffness matrix in FEM simulations).
 //!
+//! Element (dense) matrices may be inserted at once with [CooMatrix::put_block()]. Moreover, with [CooMatrix::put_parallel()], multiple threads fill disjoint slices ([NumCooSlice]) of the COO matrix without locking; thus, the assembly process may run concurrently.
+//!
 //! The three individual sparse matrix structures ([CooMatrix], [CscMatrix], and [CsrMatrix]) and the wrapping (unifying) structure SparseMatrix have functions to calculate the (sparse) matrix-vector product, which, albeit not computer optimized, are convenient for checking the solution to the linear problem A * x = b (see also the VerifyLinSys structure).
 //!
 //! We recommend using the [SparseMatrix] directly unless your computations need a more specialized interaction with the CSC or CSR formats. Also, the [SparseMatrix] returns "pointers" to the CSC and CSR structures (constant access and mutable access).
@@ -41,6 +45,16 @@
 //! * [SolverMUMPS] -- thin wrapper to the MUMPS solver
 //! * [SolverUMFPACK] -- thin wrapper to the UMFPACK solver
 //!
+//! Additionally, [SolverIterative] implements (in Rust) the preconditioned Krylov methods CG, GMRES, and BiCGStab with
+//! the Jacobi, ILU(0), IC(0), or "direct" (a factorization computed by one of the above solvers) preconditioners.
+//! The iterative solver requires no fill-in and is selected by [Genie::Iterative].
+//!
+//! With [Genie::Auto], [SolverAuto] selects KLU, UMFPACK, or MUMPS by inspecting the matrix (or by timing a trial
+//! factorization with each candidate) and caches the decision per sparsity pattern.
+//!
+//! The fill-reducing ordering computed by the symbolic analysis of UMFPACK, KLU, or MUMPS may be reused by other solvers
+//! factorizing matrices with the same sparsity pattern; see [SymbolicAnalysis] and [SymbolicCache].
+//!
 //! This library also provides a unifying Trait called [LinSolTrait], which the above structures implement. In addition, the [LinSolver] structure holds a "pointer" to one of the above structures and is a more convenient way to use the linear solvers in generic codes when we need to switch from solver to solver (e.g., for benchmarking). After allocating a [LinSolver], if needed, we can access the actual implementations (interfaces/thin wrappers) via the [LinSolver::actual] data member.
 //!
 //! The [LinSolTrait] has two main functions (that should be called in this order):
@@ -62,7 +76,7 @@
 //!
 //! The linear solvers have numerous configuration parameters; however, we can use the default parameters initially. The configuration parameters are collected in the [LinSolParams] structures, which is an input to the [LinSolTrait::factorize()]. The parameters include options such as [Ordering] and [Scaling].
 //!
-//! This library also provides functions to read and write Matrix Market files containing (huge) sparse matrices that can be used in performance benchmarking or other studies. The [read_matrix_market()] function reads a Matrix Market file and returns a [CooMatrix]. To write a Matrix Market file, we can use [CscMatrix::write_matrix_market()] (and similar), which automatically converts COO to CSC or COO to CSR, also performing the sum of duplicates. The `write_matrix_market` can also writs an SMAT file (almost like the Matrix Market format) without the header and with zero-based indices. The SMAT file can be given to the fantastic [Vismatrix](https://github.com/cpmech/vismatrix) tool to visualize the sparse matrix structure and values interactively; see the example below.
+//! This library also provides functions to read and write Matrix Market files containing (huge) sparse matrices that can be used in performance benchmarking or other studies. The [read_matrix_market()] function reads a Matrix Market file and returns a [CooMatrix]; [read_matrix_market_parallel()] does the same by parsing chunks of the file concurrently. A parsed matrix may be cached with [CooMatrix::write_binary()] and loaded back quickly with [CooMatrix::read_binary()]. To write a Matrix Market file, we can use [CscMatrix::write_matrix_market()] (and similar), which automatically converts COO to CSC or COO to CSR, also performing the sum of duplicates. The `write_matrix_market` can also writs an SMAT file (almost like the Matrix Market format) without the header and with zero-based indices. The SMAT file can be given to the fantastic [Vismatrix](https://github.com/cpmech/vismatrix) tool to visualize the sparse matrix structure and values interactively; see the example below.
 //!
 //! ![doc-example-vismatrix](https://raw.githubusercontent.com/cpmech/russell/main/russell_sparse/data/figures/doc-example-vismatrix.png)
 //!
@@ -246,20 +260,32 @@ mod complex_solver_klu;
 mod complex_solver_umfpack;
 mod constants;
 mod coo_matrix;
+mod coo_matrix_binary;
+mod coo_matrix_parallel;
+mod coo_slice;
 mod csc_matrix;
 mod csr_matrix;
+mod csr_matrix_parallel;
 mod enums;
+mod factorization_info;
+mod iterative_methods;
+mod iterative_preconditioner;
 mod lin_sol_params;
 mod lin_solver;
 mod numerical_jacobian;
+mod numerical_jacobian_colored;
 pub mod prelude;
 mod read_matrix_market;
 mod samples;
+mod solver_auto;
+mod solver_iterative;
 mod solver_klu;
 mod solver_umfpack;
 mod sparse_matrix;
 mod stats_lin_sol;
 mod stats_lin_sol_mumps;
+mod symbolic_analysis;
+mod symbolic_cache;
 mod verify_lin_sys;
 mod write_matrix_market;
 pub use crate::aliases::*;
@@ -268,19 +294,28 @@ pub use crate::complex_solver_klu::*;
 pub use crate::complex_solver_umfpack::*;
 use crate::constants::*;
 pub use crate::coo_matrix::*;
+pub use crate::coo_slice::*;
 pub use crate::csc_matrix::*;
 pub use crate::csr_matrix::*;
 pub use crate::enums::*;
+use crate::factorization_info::*;
+use crate::iterative_methods::*;
+use crate::iterative_preconditioner::*;
 pub use crate::lin_sol_params::*;
 pub use crate::lin_solver::*;
 pub use crate::numerical_jacobian::*;
+pub use crate::numerical_jacobian_colored::*;
 pub use crate::read_matrix_market::*;
 pub use crate::samples::*;
+pub use crate::solver_auto::*;
+pub use crate::solver_iterative::*;
 pub use crate::solver_klu::*;
 pub use crate::solver_umfpack::*;
 pub use crate::sparse_matrix::*;
 pub use crate::stats_lin_sol::*;
 pub use crate::stats_lin_sol_mumps::*;
+pub use crate::symbolic_analysis::*;
+pub use crate::symbolic_cache::*;
 pub use crate::verify_lin_sys::*;
 
 #[cfg(feature = "with_mumps")]
@@ -1,7 +1,19 @@
-use super::{Ordering, Scaling};
+use super::{Genie, IterativeMethod, Ordering, Preconditioner, Scaling};
+use crate::StrError;
+use std::fmt;
+
+/// Holds the special value of the Fortran communicator selecting MPI_COMM_WORLD (MUMPS with MPI only)
+pub const MUMPS_USE_COMM_WORLD: i32 = -987654;
+
+/// Holds the max number of bytes of the directory for the out-of-core files (MUMPS uses a char array of size 256)
+pub const MUMPS_OOC_TMPDIR_MAX_LEN: usize = 255;
+
+/// Holds the nul-terminated directory for the out-of-core files inline (an empty string means None)
+#[derive(Clone, Copy, PartialEq)]
+struct MumpsOocTmpdir([u8; MUMPS_OOC_TMPDIR_MAX_LEN + 1]);
 
 /// Defines the configuration parameters for the linear system solver
-#[derive(Clone, Copy, Debug, Eq, PartialEq)]
+#[derive(Clone, Copy, Debug, PartialEq)]
 pub struct LinSolParams {
     /// Defines the symmetric permutation (ordering)
     pub ordering: Ordering,
@@ -45,9 +57,106 @@ pub struct LinSolParams {
     /// Overrides the prevention of number-of-threads issue with OpenBLAS (not recommended)
     pub mumps_override_prevent_nt_issue_with_openblas: bool,
 
+    /// Enables the block low-rank (BLR) factorization, ICNTL(35) (MUMPS only)
+    ///
+    /// **Note:** BLR reduces the factorization flops and memory at the cost of an approximation
+    /// controlled by `mumps_blr_tolerance`
+    pub mumps_blr: bool,
+
+    /// Selects the UCFS variant of BLR (instead of the standard UFSC variant), ICNTL(36) (MUMPS only)
+    ///
+    /// **Note:** UCFS compresses earlier and thus achieves a higher compression, possibly at the cost of accuracy
+    pub mumps_blr_ucfs: bool,
+
+    /// Defines the dropping tolerance of the BLR compression, CNTL(7) (MUMPS only)
+    ///
+    /// **Note:** The default value of 0 means no approximation (i.e., small gains only)
+    pub mumps_blr_tolerance: f64,
+
+    /// Enables the out-of-core factorization, ICNTL(22) (MUMPS only)
+    ///
+    /// **Note:** The factors are written to disk, allowing the solution of problems larger than the
+    /// available memory at the cost of a slower factorization and solution.
+    pub mumps_out_of_core: bool,
+
+    /// Holds the directory for the out-of-core files, ooc_tmpdir (MUMPS only)
+    ///
+    /// **Note:** See [LinSolParams::set_mumps_ooc_tmpdir()].
+    mumps_ooc_tmpdir: MumpsOocTmpdir,
+
+    /// Defines the Fortran MPI communicator, comm_fortran (`with_mumps_mpi` only)
+    ///
+    /// **Note:** The default value selects MPI_COMM_WORLD. Other communicators must be converted with
+    /// `MPI_Comm_c2f`. MPI must be initialized (and finalized) by the caller.
+    pub mumps_comm_fortran: i32,
+
+    /// Enables the distributed assembled input, ICNTL(18) = 3 (`with_mumps_mpi` only)
+    ///
+    /// **Note:** Each process supplies its own (global-index) entries of the COO matrix; entries given by
+    /// more than one process are summed up. The right-hand side and the solution are centralized on the
+    /// host process (rank 0); the other processes must still call `factorize` and `solve`.
+    pub mumps_distributed_input: bool,
+
+    /// Enables the parallel analysis with ParMETIS or PT-Scotch, ICNTL(28) = 2 (`with_mumps_mpi` only)
+    ///
+    /// **Note:** The `ordering` option is ignored in this case.
+    pub mumps_parallel_analysis: bool,
+
     /// Enforces the unsymmetric strategy, even for symmetric matrices (not recommended; UMFPACK only)
     pub umfpack_enforce_unsymmetric_strategy: bool,
 
+    /// Reuses the pivot sequence of the previous factorization via klu_refactor (KLU only)
+    ///
+    /// **Note:** The first call to `factorize` always performs a full factorization. The subsequent
+    /// calls perform a refactorization, which skips the pivot search, and fall back to a full factorization
+    /// if the reciprocal pivot growth or the reciprocal condition number estimate become too small.
+    pub klu_use_refactor: bool,
+
+    /// Sets the min reciprocal pivot growth accepted after a refactorization (KLU only)
+    ///
+    /// **Note:** A small reciprocal pivot growth indicates that the previous pivots became numerically unstable
+    pub klu_refactor_min_rgrowth: f64,
+
+    /// Sets the min (cheap) reciprocal condition number estimate accepted after a refactorization (KLU only)
+    ///
+    /// **Note:** The estimate is computed by klu_rcond as min(abs(diag(U))) / max(abs(diag(U)))
+    pub klu_refactor_min_rcond: f64,
+
+    /// Selects the Krylov method (Iterative only)
+    pub iterative_method: IterativeMethod,
+
+    /// Selects the preconditioner (Iterative only)
+    pub iterative_preconditioner: Preconditioner,
+
+    /// Sets the tolerance for the relative residual norm ‖b - A x‖ / ‖b‖ (Iterative only)
+    pub iterative_tolerance: f64,
+
+    /// Sets the max number of iterations (Iterative only)
+    ///
+    /// **Note:** With GMRES, this is the total number of inner iterations (including all restarts)
+    pub iterative_max_iterations: usize,
+
+    /// Sets the number of inner iterations before GMRES restarts (Iterative only)
+    pub iterative_gmres_restart: usize,
+
+    /// Selects the direct solver computing the factorization used as preconditioner (Iterative with Direct only)
+    pub iterative_direct_genie: Genie,
+
+    /// Sets the number of calls to `factorize` for which the direct factorization is kept (Iterative with Direct only)
+    ///
+    /// **Note:** A value of 1 means that the direct factorization is computed in every call to `factorize`.
+    /// The default value of 0 means that the direct factorization is computed in the first call only.
+    pub iterative_direct_refresh: usize,
+
+    /// Defines the number of threads for the sparse matrix-vector products (Iterative only)
+    pub iterative_num_threads: usize,
+
+    /// Times a trial factorization with each candidate solver and selects the fastest (Auto only)
+    ///
+    /// **Note:** Otherwise, the solver is selected by inspecting the matrix (dimension, nnz per row,
+    /// symmetry, and the number of BTF blocks). The decision is cached per sparsity pattern.
+    pub auto_trial: bool,
+
     /// Show additional messages
     pub verbose: bool,
 }
@@ -66,18 +175,86 @@ impl LinSolParams {
             mumps_max_work_memory: 0,
             mumps_num_threads: 0,
             mumps_override_prevent_nt_issue_with_openblas: false,
+            mumps_blr: false,
+            mumps_blr_ucfs: false,
+            mumps_blr_tolerance: 0.0,
+            mumps_out_of_core: false,
+            mumps_ooc_tmpdir: MumpsOocTmpdir([0; MUMPS_OOC_TMPDIR_MAX_LEN + 1]),
+            mumps_comm_fortran: MUMPS_USE_COMM_WORLD,
+            mumps_distributed_input: false,
+            mumps_parallel_analysis: false,
             umfpack_enforce_unsymmetric_strategy: false,
+            klu_use_refactor: false,
+            klu_refactor_min_rgrowth: 1e-8,
+            klu_refactor_min_rcond: 1e-12,
+            iterative_method: IterativeMethod::Gmres,
+            iterative_preconditioner: Preconditioner::Ilu0,
+            iterative_tolerance: 1e-10,
+            iterative_max_iterations: 1000,
+            iterative_gmres_restart: 30,
+            iterative_direct_genie: Genie::Umfpack,
+            iterative_direct_refresh: 0,
+            iterative_num_threads: 1,
+            auto_trial: false,
             verbose: false,
         }
     }
+
+    /// Sets the directory for the out-of-core files, ooc_tmpdir (MUMPS only; max 255 bytes)
+    ///
+    /// **Note:** If None (default), MUMPS uses the `MUMPS_OOC_TMPDIR` environment variable or the default
+    /// temporary directory. The file prefix is given by the `MUMPS_OOC_PREFIX` environment variable.
+    /// The path is copied into a fixed-size array; thus, the parameters remain `Copy`.
+    pub fn set_mumps_ooc_tmpdir(&mut self, dir: Option<&str>) -> Result<(), StrError> {
+        let mut buffer = [0; MUMPS_OOC_TMPDIR_MAX_LEN + 1];
+        if let Some(d) = dir {
+            if d.len() > MUMPS_OOC_TMPDIR_MAX_LEN {
+                return Err("the out-of-core directory path must have at most 255 bytes");
+            }
+            if d.as_bytes().contains(&0) {
+                return Err("the out-of-core directory path must not contain nul characters");
+            }
+            buffer[..d.len()].copy_from_slice(d.as_bytes());
+        }
+        self.mumps_ooc_tmpdir = MumpsOocTmpdir(buffer);
+        Ok(())
+    }
+
+    /// Returns the directory for the out-of-core files, if any (MUMPS only)
+    pub fn get_mumps_ooc_tmpdir(&self) -> Option<&str> {
+        let bytes = &self.mumps_ooc_tmpdir.0;
+        let len = bytes.iter().position(|b| *b == 0).unwrap_or(bytes.len());
+        if len == 0 {
+            None
+        } else {
+            std::str::from_utf8(&bytes[..len]).ok()
+        }
+    }
+
+    /// Returns a pointer to the nul-terminated out-of-core directory or null if None (MUMPS only)
+    #[cfg(feature = "with_mumps")]
+    pub(crate) fn get_mumps_ooc_tmpdir_ptr(&self) -> *const std::ffi::c_char {
+        if self.mumps_ooc_tmpdir.0[0] == 0 {
+            std::ptr::null()
+        } else {
+            self.mumps_ooc_tmpdir.0.as_ptr() as *const std::ffi::c_char
+        }
+    }
+}
+
+impl fmt::Debug for MumpsOocTmpdir {
+    fn fmt(&self, f: &mut fmt::Formatter) -> fmt::Result {
+        let len = self.0.iter().position(|b| *b == 0).unwrap_or(self.0.len());
+        write!(f, "{:?}", String::from_utf8_lossy(&self.0[..len]))
+    }
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #[cfg(test)]
 mod tests {
-    use super::LinSolParams;
-    use crate::{Ordering, Scaling};
+    use super::{LinSolParams, MUMPS_USE_COMM_WORLD};
+    use crate::{Genie, IterativeMethod, Ordering, Preconditioner, Scaling};
 
     #[test]
     fn clone_copy_and_debug_work() {
@@ -98,6 +275,50 @@ mod tests {
         assert_eq!(params.mumps_pct_inc_workspace, 100);
         assert_eq!(params.mumps_max_work_memory, 0);
         assert_eq!(params.mumps_num_threads, 0);
+        assert!(!params.mumps_blr);
+        assert!(!params.mumps_blr_ucfs);
+        assert_eq!(params.mumps_blr_tolerance, 0.0);
+        assert_eq!(params.mumps_out_of_core, false);
+        assert_eq!(params.get_mumps_ooc_tmpdir(), None);
+        assert_eq!(params.mumps_comm_fortran, MUMPS_USE_COMM_WORLD);
+        assert!(!params.mumps_distributed_input);
+        assert!(!params.mumps_parallel_analysis);
         assert!(!params.umfpack_enforce_unsymmetric_strategy);
+        assert!(!params.klu_use_refactor);
+        assert_eq!(params.klu_refactor_min_rgrowth, 1e-8);
+        assert_eq!(params.klu_refactor_min_rcond, 1e-12);
+        assert_eq!(params.iterative_method, IterativeMethod::Gmres);
+        assert_eq!(params.iterative_preconditioner, Preconditioner::Ilu0);
+        assert_eq!(params.iterative_tolerance, 1e-10);
+        assert_eq!(params.iterative_max_iterations, 1000);
+        assert_eq!(params.iterative_gmres_restart, 30);
+        assert_eq!(params.iterative_direct_genie, Genie::Umfpack);
+        assert_eq!(params.iterative_direct_refresh, 0);
+        assert_eq!(params.iterative_num_threads, 1);
+        assert!(!params.auto_trial);
+    }
+
+    #[test]
+    fn set_mumps_ooc_tmpdir_works() {
+        let mut params = LinSolParams::new();
+        let long = "a".repeat(256);
+        assert_eq!(
+            params.set_mumps_ooc_tmpdir(Some(&long)).err(),
+            Some("the out-of-core directory path must have at most 255 bytes")
+        );
+        assert_eq!(
+            params.set_mumps_ooc_tmpdir(Some("/tmp\0x")).err(),
+            Some("the out-of-core directory path must not contain nul characters")
+        );
+        params.set_mumps_ooc_tmpdir(Some(&long[..255])).unwrap();
+        assert_eq!(params.get_mumps_ooc_tmpdir(), Some(&long[..255]));
+        params.set_mumps_ooc_tmpdir(Some("/tmp")).unwrap();
+        assert_eq!(params.get_mumps_ooc_tmpdir(), Some("/tmp"));
+        let copy = params;
+        assert_eq!(copy.get_mumps_ooc_tmpdir(), Some("/tmp"));
+        assert!(format!("{:?}", copy).contains("mumps_ooc_tmpdir: \"/tmp\""));
+        params.set_mumps_ooc_tmpdir(None).unwrap();
+        assert_eq!(params.get_mumps_ooc_tmpdir(), None);
+        assert_ne!(copy, params);
     }
 }
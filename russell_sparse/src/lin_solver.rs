@@ -1,10 +1,10 @@
 #[cfg(feature = "with_mumps")]
 use super::SolverMUMPS;
 
-use super::{Genie, LinSolParams, SparseMatrix, StatsLinSol};
-use super::{SolverKLU, SolverUMFPACK};
+use super::{Genie, LinSolParams, SparseMatrix, StatsLinSol, SymbolicAnalysis};
+use super::{SolverAuto, SolverIterative, SolverKLU, SolverUMFPACK};
 use crate::StrError;
-use russell_lab::Vector;
+use russell_lab::{Matrix, Vector};
 
 /// Defines a unified interface for linear system solvers
 pub trait LinSolTrait {
@@ -48,6 +48,63 @@ pub trait LinSolTrait {
     /// **Warning:** the matrix must be same one used in `factorize`.
     fn solve(&mut self, x: &mut Vector, mat: &SparseMatrix, rhs: &Vector, verbose: bool) -> Result<(), StrError>;
 
+    /// Computes the solution of the transposed linear system
+    ///
+    /// Solves the linear system:
+    ///
+    /// ```text
+    ///   Aᵀ  · x = rhs
+    /// (n,m)  (m)  (n)
+    /// ```
+    ///
+    /// # Output
+    ///
+    /// * `x` -- the vector of unknown values with dimension equal to mat.nrow
+    ///
+    /// # Input
+    ///
+    /// * `mat` -- the coefficient matrix A.
+    /// * `rhs` -- the right-hand side vector with know values an dimension equal to mat.ncol
+    /// * `verbose` -- shows messages
+    ///
+    /// **Note:** The factorization computed by `factorize` is reused (no new factorization is needed).
+    ///
+    /// **Warning:** the matrix must be same one used in `factorize`.
+    fn solve_transposed(
+        &mut self,
+        x: &mut Vector,
+        mat: &SparseMatrix,
+        rhs: &Vector,
+        verbose: bool,
+    ) -> Result<(), StrError>;
+
+    /// Computes the solution of the linear system with multiple right-hand sides
+    ///
+    /// Solves the linear system:
+    ///
+    /// ```text
+    ///   A   ·   X   =  RHS
+    /// (m,n)  (n,k)    (m,k)
+    /// ```
+    ///
+    /// # Output
+    ///
+    /// * `x` -- the matrix of unknown values with nrow equal to mat.ncol and ncol equal to the number of right-hand sides
+    ///
+    /// # Input
+    ///
+    /// * `mat` -- the coefficient matrix A.
+    /// * `rhs` -- the matrix of right-hand sides; each column corresponds to one right-hand side
+    /// * `verbose` -- shows messages
+    ///
+    /// # Notes
+    ///
+    /// 1. The (col-major) block of right-hand sides is passed to the solver in a single call.
+    /// 2. The MUMPS error analysis (if requested) is not performed with multiple right-hand sides.
+    ///
+    /// **Warning:** the matrix must be same one used in `factorize`.
+    fn solve_multi(&mut self, x: &mut Matrix, mat: &SparseMatrix, rhs: &Matrix, verbose: bool) -> Result<(), StrError>;
+
     /// Updates the stats structure (should be called after solve)
     fn update_stats(&self, stats: &mut StatsLinSol);
 
@@ -59,6 +116,48 @@ pub trait LinSolTrait {
 
     /// Returns the nanoseconds spent on solve
     fn get_ns_solve(&self) -> u128;
+
+    /// Returns the fill-reducing ordering computed by the symbolic analysis (after factorize)
+    ///
+    /// Returns None if the solver does not perform a symbolic analysis or has not been factorized yet.
+    fn get_symbolic_analysis(&self) -> Option<&SymbolicAnalysis> {
+        None
+    }
+
+    /// Sets the fill-reducing ordering to be used by the symbolic analysis (must be called before factorize)
+    ///
+    /// This skips the ordering step of the symbolic analysis. The analysis must have been computed by the
+    /// same kind of solver with a matrix with the same sparsity pattern (see [crate::SymbolicCache]).
+    fn set_symbolic_analysis(&mut self, _analysis: &SymbolicAnalysis) -> Result<(), StrError> {
+        Err("the symbolic analysis cannot be set for this solver")
+    }
+
+    /// Saves the factorization to files in a directory (after factorize)
+    ///
+    /// The directory is created if needed. The factorization may then be loaded by another solver
+    /// (e.g., in another process) via [LinSolTrait::load_factorization()].
+    fn save_factorization(&self, _full_path_dir: &str) -> Result<(), StrError> {
+        Err("saving the factorization is not available for this solver")
+    }
+
+    /// Loads the factorization saved by [LinSolTrait::save_factorization()] (instead of calling factorize)
+    ///
+    /// # Input
+    ///
+    /// * `mat` -- the coefficient matrix which has been factorized; its structure (nrow, ncol, nnz, sym) is
+    ///   checked and the matrix is converted to the format needed by `solve`, if necessary.
+    /// * `full_path_dir` -- the directory with the saved factorization
+    /// * `params` -- configuration parameters (e.g., the MPI communicator of MUMPS); None means use default values
+    ///
+    /// **Note:** This function must be called on a new solver; afterwards, `solve` may be called directly.
+    fn load_factorization(
+        &mut self,
+        _mat: &mut SparseMatrix,
+        _full_path_dir: &str,
+        _params: Option<LinSolParams>,
+    ) -> Result<(), StrError> {
+        Err("loading the factorization is not available for this solver")
+    }
 }
 
 /// Unifies the access to linear system solvers
@@ -79,16 +178,66 @@ impl<'a> LinSolver<'a> {
             Genie::Klu => Box::new(SolverKLU::new()?),
             Genie::Mumps => Box::new(SolverMUMPS::new()?),
             Genie::Umfpack => Box::new(SolverUMFPACK::new()?),
+            Genie::Iterative => Box::new(SolverIterative::new()?),
+            Genie::Auto => Box::new(SolverAuto::new()?),
         };
         #[cfg(not(feature = "with_mumps"))]
         let actual: Box<dyn Send + LinSolTrait> = match genie {
             Genie::Klu => Box::new(SolverKLU::new()?),
             Genie::Mumps => return Err("MUMPS solver is not available"),
             Genie::Umfpack => Box::new(SolverUMFPACK::new()?),
+            Genie::Iterative => Box::new(SolverIterative::new()?),
+            Genie::Auto => Box::new(SolverAuto::new()?),
         };
         Ok(LinSolver { actual })
     }
 
+    /// Allocates a new instance and loads a factorization saved by [LinSolTrait::save_factorization()]
+    ///
+    /// # Input
+    ///
+    /// * `genie` -- the actual implementation that computed the factorization (UMFPACK or MUMPS)
+    /// * `mat` -- the coefficient matrix which has been factorized (the values are not used)
+    /// * `full_path_dir` -- the directory with the saved factorization
+    /// * `params` -- configuration parameters; None means use default values
+    ///
+    /// # Examples
+    ///
+    /// ```
+    /// use russell_lab::{vec_approx_eq, Vector};
+    /// use russell_sparse::prelude::*;
+    /// use russell_sparse::StrError;
+    ///
+    /// fn main() -> Result<(), StrError> {
+    ///     // factorize and save (e.g., in a first job)
+    ///     let mut mat = SparseMatrix::new_coo(2, 2, 3, Sym::No)?;
+    ///     mat.put(0, 0, 2.0)?;
+    ///     mat.put(1, 0, 1.0)?;
+    ///     mat.put(1, 1, 4.0)?;
+    ///     let mut solver = LinSolver::new(Genie::Umfpack)?;
+    ///     solver.actual.factorize(&mut mat, None)?;
+    ///     solver.actual.save_factorization("/tmp/russell_sparse/doc_lin_solver_load")?;
+    ///
+    ///     // load and solve (e.g., in another job)
+    ///     let mut solver = LinSolver::load(Genie::Umfpack, &mut mat, "/tmp/russell_sparse/doc_lin_solver_load", None)?;
+    ///     let mut x = Vector::new(2);
+    ///     let rhs = Vector::from(&[2.0, 5.0]);
+    ///     solver.actual.solve(&mut x, &mat, &rhs, false)?;
+    ///     vec_approx_eq(&x, &[1.0, 1.0], 1e-15);
+    ///     Ok(())
+    /// }
+    /// ```
+    pub fn load(
+        genie: Genie,
+        mat: &mut SparseMatrix,
+        full_path_dir: &str,
+        params: Option<LinSolParams>,
+    ) -> Result<Self, StrError> {
+        let mut solver = LinSolver::new(genie)?;
+        solver.actual.load_factorization(mat, full_path_dir, params)?;
+        Ok(solver)
+    }
+
     /// Computes the solution of a linear system
     ///
     /// Solves the linear system:
@@ -217,4 +366,32 @@ mod tests {
         let x_correct = vec![-979.0 / 3.0, 983.0, 1961.0 / 12.0, 398.0, 123.0 / 2.0];
         vec_approx_eq(&x, &x_correct, 1e-10);
     }
+
+    #[test]
+    fn lin_solver_load_works() {
+        let (coo, _, _, _) = Samples::mkl_symmetric_5x5_full();
+        let mut mat = SparseMatrix::from_coo(coo);
+        let dir = "/tmp/russell_sparse/test_lin_solver_load";
+        let mut solver = LinSolver::new(Genie::Umfpack).unwrap();
+        solver.actual.factorize(&mut mat, None).unwrap();
+        solver.actual.save_factorization(dir).unwrap();
+        let mut loaded = LinSolver::load(Genie::Umfpack, &mut mat, dir, None).unwrap();
+        let mut x = Vector::new(5);
+        let rhs = Vector::from(&[1.0, 2.0, 3.0, 4.0, 5.0]);
+        loaded.actual.solve(&mut x, &mat, &rhs, false).unwrap();
+        let x_correct = vec![-979.0 / 3.0, 983.0, 1961.0 / 12.0, 398.0, 123.0 / 2.0];
+        vec_approx_eq(&x, &x_correct, 1e-10);
+
+        // KLU and the iterative solver do not save the factorization
+        let mut klu = LinSolver::new(Genie::Klu).unwrap();
+        klu.actual.factorize(&mut mat, None).unwrap();
+        assert_eq!(
+            klu.actual.save_factorization(dir).err(),
+            Some("saving the factorization is not available for this solver")
+        );
+        assert_eq!(
+            LinSolver::load(Genie::Iterative, &mut mat, dir, None).err(),
+            Some("loading the factorization is not available for this solver")
+        );
+    }
 }
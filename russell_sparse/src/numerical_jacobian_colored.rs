@@ -0,0 +1,571 @@
+use crate::CooMatrix;
+use crate::StrError;
+use russell_lab::Vector;
+
+/// Holds a Curtis-Powell-Reid (CPR) coloring of the columns of a sparse Jacobian matrix
+///
+/// Two columns are structurally orthogonal if they do not have non-zero values in the same row.
+/// Structurally orthogonal columns receive the same color and, thus, can be perturbed simultaneously
+/// when computing the Jacobian by finite differences (see [numerical_jacobian_colored()]).
+///
+/// The coloring is computed once, from the sparsity pattern, and can be reused in all subsequent
+/// evaluations of the Jacobian. The number of colors is at least the maximum number of non-zeros in
+/// a row; e.g., a tridiagonal matrix needs 3 colors, regardless of its dimension.
+///
+/// **Note:** The greedy coloring algorithm processes the columns in their natural order.
+///
+/// # Examples
+///
+/// ```
+/// use russell_sparse::prelude::*;
+/// use russell_sparse::StrError;
+///
+/// fn main() -> Result<(), StrError> {
+///     // tridiagonal pattern
+///     let ndim = 10;
+///     let mut pattern = CooMatrix::new(ndim, ndim, 3 * ndim - 2, Sym::No)?;
+///     for i in 0..ndim {
+///         if i > 0 {
+///             pattern.put(i, i - 1, 1.0)?;
+///         }
+///         pattern.put(i, i, 1.0)?;
+///         if i < ndim - 1 {
+///             pattern.put(i, i + 1, 1.0)?;
+///         }
+///     }
+///     let coloring = JacobianColoring::new(&pattern)?;
+///     assert_eq!(coloring.ncolor(), 3);
+///     assert_eq!(coloring.nnz(), 3 * ndim - 2);
+///     Ok(())
+/// }
+/// ```
+#[derive(Clone, Debug)]
+pub struct JacobianColoring {
+    /// Holds the dimension of the (square) Jacobian matrix
+    ndim: usize,
+
+    /// Holds the number of colors
+    ncolor: usize,
+
+    /// Holds the color of each column (len = ndim)
+    color: Vec<usize>,
+
+    /// Holds the pointers to the row indices of each column (len = ndim + 1)
+    col_pointers: Vec<usize>,
+
+    /// Holds the (unique) row indices of each column (len = nnz)
+    row_indices: Vec<usize>,
+
+    /// Holds the pointers to the columns of each color (len = ncolor + 1)
+    color_pointers: Vec<usize>,
+
+    /// Holds the columns of each color (len = ndim)
+    color_columns: Vec<usize>,
+
+    /// Holds the original values of the perturbed y components (workspace; len = ndim)
+    y_original: Vec<f64>,
+}
+
+impl JacobianColoring {
+    /// Computes the coloring from the sparsity pattern of the Jacobian matrix
+    ///
+    /// # Input
+    ///
+    /// * `pattern` -- a square matrix with (any) values at the locations of the non-zeros of the Jacobian.
+    ///   If the matrix is triangular (e.g., [crate::Sym::YesLower]), the other triangle is implied.
+    ///   Duplicate entries are allowed.
+    pub fn new(pattern: &CooMatrix) -> Result<Self, StrError> {
+        let (nrow, ncol, nnz, sym) = pattern.get_info();
+        if nrow != ncol {
+            return Err("the pattern matrix must be square");
+        }
+        let ndim = nrow;
+        let triangular = sym.triangular();
+
+        // rows of each column and columns of each row
+        let mut rows_of_col = vec![Vec::new(); ndim];
+        let mut cols_of_row = vec![Vec::new(); ndim];
+        let indices_i = pattern.get_row_indices();
+        let indices_j = pattern.get_col_indices();
+        for k in 0..nnz {
+            let i = indices_i[k] as usize;
+            let j = indices_j[k] as usize;
+            rows_of_col[j].push(i);
+            cols_of_row[i].push(j);
+            if triangular && i != j {
+                rows_of_col[i].push(j);
+                cols_of_row[j].push(i);
+            }
+        }
+        for list in rows_of_col.iter_mut().chain(cols_of_row.iter_mut()) {
+            list.sort_unstable();
+            list.dedup();
+        }
+
+        // greedy coloring: a column cannot share the color of any column with a non-zero in a common row
+        let mut color = vec![0; ndim];
+        let mut forbidden = vec![usize::MAX; ndim]; // forbidden[c] == j means that c is forbidden for column j
+        let mut ncolor = 0;
+        for j in 0..ndim {
+            for &i in &rows_of_col[j] {
+                for &k in &cols_of_row[i] {
+                    if k < j {
+                        forbidden[color[k]] = j;
+                    }
+                }
+            }
+            let mut c = 0;
+            while forbidden[c] == j {
+                c += 1;
+            }
+            color[j] = c;
+            ncolor = usize::max(ncolor, c + 1);
+        }
+
+        // columns of each color
+        let mut color_pointers = vec![0; ncolor + 1];
+        for j in 0..ndim {
+            color_pointers[color[j] + 1] += 1;
+        }
+        for c in 0..ncolor {
+            color_pointers[c + 1] += color_pointers[c];
+        }
+        let mut next = color_pointers.clone();
+        let mut color_columns = vec![0; ndim];
+        for j in 0..ndim {
+            color_columns[next[color[j]]] = j;
+            next[color[j]] += 1;
+        }
+
+        // compressed pattern
+        let mut col_pointers = vec![0; ndim + 1];
+        for j in 0..ndim {
+            col_pointers[j + 1] = col_pointers[j] + rows_of_col[j].len();
+        }
+        let row_indices = rows_of_col.concat();
+
+        Ok(JacobianColoring {
+            ndim,
+            ncolor,
+            color,
+            col_pointers,
+            row_indices,
+            color_pointers,
+            color_columns,
+            y_original: vec![0.0; ndim],
+        })
+    }
+
+    /// Returns the dimension of the Jacobian matrix
+    pub fn ndim(&self) -> usize {
+        self.ndim
+    }
+
+    /// Returns the number of colors (i.e., the number of function calls, minus one, to compute the Jacobian)
+    pub fn ncolor(&self) -> usize {
+        self.ncolor
+    }
+
+    /// Returns the number of (unique) non-zero values in the sparsity pattern, including both triangles
+    pub fn nnz(&self) -> usize {
+        self.row_indices.len()
+    }
+
+    /// Returns the color of each column
+    pub fn get_colors(&self) -> &[usize] {
+        &self.color
+    }
+}
+
+/// Computes a sparse Jacobian matrix using first-order finite differences and a column coloring
+///
+/// This function computes the same approximation as [crate::numerical_jacobian()]; however, all
+/// columns with the same color (see [JacobianColoring]) are perturbed simultaneously. Only the
+/// entries in the sparsity pattern are computed and stored.
+///
+/// **Note:** `function` will be called `1 + ncolor` times.
+///
+/// # Output
+///
+/// * `jj` -- Is the resulting numerical Jacobian matrix, which must be square with `nrow = ncol = ndim`
+///   and not triangular (i.e., [crate::Sym::No] or [crate::Sym::YesFull]). The condition
+///   `max_nnz ≥ coloring.nnz()` is required.
+///
+/// # Input
+///
+/// * `alpha` -- A coefficient to multiply all elements of the Jacobian
+/// * `x` -- The station (e.g., time) where the `f` function is called
+/// * `y` -- The vector `{y}` for which the `f` function is called.
+///   **Note:** Although this variable is mutable, the original values are restored on exit
+/// * `w1` -- A workspace vector with `len ≥ ndim`
+/// * `w2` -- A workspace vector with `len ≥ ndim`
+/// * `coloring` -- The column coloring computed from the sparsity pattern of the Jacobian
+/// * `function` -- The `f(f: &mut Vector, x: f64, y: &Vector, args: &mut A)` function
+/// * `args` -- Extra arguments for the `f` function
+///
+/// # Examples
+///
+/// ```
+/// use russell_lab::{mat_approx_eq, Vector};
+/// use russell_sparse::prelude::*;
+/// use russell_sparse::StrError;
+///
+/// fn main() -> Result<(), StrError> {
+///     // f(y) = discrete 1D Laplacian of y plus a non-linear term
+///     let ndim = 50;
+///     let mut n_function_calls = 0;
+///     let function = |f: &mut Vector, _x: f64, y: &Vector, count: &mut usize| {
+///         for i in 0..ndim {
+///             let left = if i > 0 { y[i - 1] } else { 0.0 };
+///             let right = if i < ndim - 1 { y[i + 1] } else { 0.0 };
+///             f[i] = left - 2.0 * y[i] + right + y[i] * y[i];
+///         }
+///         *count += 1;
+///         Ok(())
+///     };
+///
+///     // pattern
+///     let mut pattern = CooMatrix::new(ndim, ndim, 3 * ndim - 2, Sym::No)?;
+///     for i in 0..ndim {
+///         if i > 0 {
+///             pattern.put(i, i - 1, 1.0)?;
+///         }
+///         pattern.put(i, i, 1.0)?;
+///         if i < ndim - 1 {
+///             pattern.put(i, i + 1, 1.0)?;
+///         }
+///     }
+///     let mut coloring = JacobianColoring::new(&pattern)?;
+///
+///     // numerical Jacobian
+///     let mut y = Vector::linspace(0.0, 1.0, ndim)?;
+///     let mut w1 = Vector::new(ndim);
+///     let mut w2 = Vector::new(ndim);
+///     let mut jj = CooMatrix::new(ndim, ndim, coloring.nnz(), Sym::No)?;
+///     numerical_jacobian_colored(
+///         &mut jj, 1.0, 0.0, &mut y, &mut w1, &mut w2,
+///         &mut coloring, &mut n_function_calls, function,
+///     )?;
+///     assert_eq!(n_function_calls, 1 + 3);
+///
+///     // check
+///     let mut correct = CooMatrix::new(ndim, ndim, 3 * ndim - 2, Sym::No)?;
+///     for i in 0..ndim {
+///         if i > 0 {
+///             correct.put(i, i - 1, 1.0)?;
+///         }
+///         correct.put(i, i, -2.0 + 2.0 * y[i])?;
+///         if i < ndim - 1 {
+///             correct.put(i, i + 1, 1.0)?;
+///         }
+///     }
+///     mat_approx_eq(&jj.as_dense(), &correct.as_dense(), 1e-7);
+///     Ok(())
+/// }
+/// ```
+pub fn numerical_jacobian_colored<F, A>(
+    jj: &mut CooMatrix,
+    alpha: f64,
+    x: f64,
+    y: &mut Vector,
+    w1: &mut Vector,
+    w2: &mut Vector,
+    coloring: &mut JacobianColoring,
+    args: &mut A,
+    mut function: F,
+) -> Result<(), StrError>
+where
+    F: FnMut(&mut Vector, f64, &Vector, &mut A) -> Result<(), StrError>,
+{
+    if jj.nrow != jj.ncol {
+        return Err("the Jacobian matrix must be square");
+    }
+    let ndim = jj.nrow;
+    if ndim != coloring.ndim {
+        return Err("the Jacobian matrix is incompatible with the coloring");
+    }
+    if jj.symmetric.triangular() {
+        return Err("the numerical Jacobian matrix must not be triangular");
+    }
+    if jj.max_nnz < coloring.nnz() {
+        return Err(
+            "the max number of non-zero values in the numerical Jacobian matrix must be at least coloring.nnz()",
+        );
+    }
+    if y.dim() != ndim {
+        return Err("the y-vector must have dim = ndim");
+    }
+    if w1.dim() < ndim || w2.dim() < ndim {
+        return Err("the workspace vectors must have dim ≥ ndim");
+    }
+    const THRESHOLD: f64 = 1e-5;
+    function(w1, x, y, args)?; // w1 := f(x, y)
+    jj.reset();
+    for c in 0..coloring.ncolor {
+        let columns = &coloring.color_columns[coloring.color_pointers[c]..coloring.color_pointers[c + 1]];
+        for &j in columns {
+            coloring.y_original[j] = y[j];
+            let delta_yj = f64::sqrt(f64::EPSILON * f64::max(THRESHOLD, f64::abs(y[j])));
+            y[j] += delta_yj; // Yⱼ := yⱼ + Δyⱼ (for all j with color c)
+        }
+        function(w2, x, y, args)?; // F := f(x, y + Δy)
+        for &j in columns {
+            let delta_yj = y[j] - coloring.y_original[j]; // the actual (rounded) perturbation
+            for p in coloring.col_pointers[j]..coloring.col_pointers[j + 1] {
+                let i = coloring.row_indices[p];
+                let delta_fi = w2[i] - w1[i]; // Δfᵢ := Fᵢ - fᵢ
+                jj.put(i, j, alpha * delta_fi / delta_yj).unwrap(); // Δfᵢ/Δyⱼ
+            }
+            y[j] = coloring.y_original[j]; // restore yⱼ
+        }
+    }
+    Ok(())
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#[cfg(test)]
+mod tests {
+    use super::{numerical_jacobian_colored, JacobianColoring};
+    use crate::{numerical_jacobian, CooMatrix, Sym};
+    use russell_lab::{mat_approx_eq, Vector};
+
+    #[test]
+    fn new_captures_errors() {
+        let pattern = CooMatrix::new(2, 3, 1, Sym::No).unwrap();
+        assert_eq!(
+            JacobianColoring::new(&pattern).err(),
+            Some("the pattern matrix must be square")
+        );
+    }
+
+    #[test]
+    fn new_works() {
+        // diagonal
+        let mut pattern = CooMatrix::new(3, 3, 3, Sym::No).unwrap();
+        for i in 0..3 {
+            pattern.put(i, i, 1.0).unwrap();
+        }
+        let coloring = JacobianColoring::new(&pattern).unwrap();
+        assert_eq!(coloring.ndim(), 3);
+        assert_eq!(coloring.ncolor(), 1);
+        assert_eq!(coloring.nnz(), 3);
+        assert_eq!(coloring.get_colors(), &[0, 0, 0]);
+
+        // arrow (lower triangle only; with a duplicate)
+        //  x x x x
+        //  x x . .
+        //  x . x .
+        //  x . . x
+        let mut pattern = CooMatrix::new(4, 4, 8, Sym::YesLower).unwrap();
+        for i in 0..4 {
+            pattern.put(i, i, 1.0).unwrap();
+            if i > 0 {
+                pattern.put(i, 0, 1.0).unwrap();
+            }
+        }
+        pattern.put(3, 0, 1.0).unwrap();
+        let coloring = JacobianColoring::new(&pattern).unwrap();
+        assert_eq!(coloring.ncolor(), 4);
+        assert_eq!(coloring.nnz(), 10);
+        assert_eq!(coloring.get_colors(), &[0, 1, 2, 3]);
+
+        // two independent 2x2 blocks
+        //  x x . .
+        //  x x . .
+        //  . . x x
+        //  . . x x
+        let mut pattern = CooMatrix::new(4, 4, 8, Sym::No).unwrap();
+        for (a, b) in [(0, 1), (2, 3)] {
+            pattern.put(a, a, 1.0).unwrap();
+            pattern.put(a, b, 1.0).unwrap();
+            pattern.put(b, a, 1.0).unwrap();
+            pattern.put(b, b, 1.0).unwrap();
+        }
+        let coloring = JacobianColoring::new(&pattern).unwrap();
+        assert_eq!(coloring.ncolor(), 2);
+        assert_eq!(coloring.get_colors(), &[0, 1, 0, 1]);
+    }
+
+    #[test]
+    fn numerical_jacobian_colored_captures_errors() {
+        struct Args {}
+        let mut args = Args {};
+        let pattern = CooMatrix::new(2, 2, 1, Sym::No).unwrap();
+        let mut coloring = JacobianColoring::new(&pattern).unwrap();
+        let mut y = Vector::new(2);
+        let mut w1 = Vector::new(2);
+        let mut w2 = Vector::new(2);
+        let function = |_f: &mut Vector, _x: f64, _y: &Vector, _args: &mut Args| Ok(());
+        let mut jj = CooMatrix::new(2, 3, 1, Sym::No).unwrap();
+        assert_eq!(
+            numerical_jacobian_colored(
+                &mut jj,
+                1.0,
+                0.0,
+                &mut y,
+                &mut w1,
+                &mut w2,
+                &mut coloring,
+                &mut args,
+                function
+            )
+            .err(),
+            Some("the Jacobian matrix must be square")
+        );
+        let mut jj = CooMatrix::new(3, 3, 1, Sym::No).unwrap();
+        assert_eq!(
+            numerical_jacobian_colored(
+                &mut jj,
+                1.0,
+                0.0,
+                &mut y,
+                &mut w1,
+                &mut w2,
+                &mut coloring,
+                &mut args,
+                function
+            )
+            .err(),
+            Some("the Jacobian matrix is incompatible with the coloring")
+        );
+        let mut jj = CooMatrix::new(2, 2, 2, Sym::YesLower).unwrap();
+        assert_eq!(
+            numerical_jacobian_colored(
+                &mut jj,
+                1.0,
+                0.0,
+                &mut y,
+                &mut w1,
+                &mut w2,
+                &mut coloring,
+                &mut args,
+                function
+            )
+            .err(),
+            Some("the numerical Jacobian matrix must not be triangular")
+        );
+        let mut pattern = CooMatrix::new(2, 2, 2, Sym::No).unwrap();
+        pattern.put(0, 0, 1.0).unwrap();
+        pattern.put(1, 1, 1.0).unwrap();
+        let mut coloring = JacobianColoring::new(&pattern).unwrap();
+        let mut jj = CooMatrix::new(2, 2, 1, Sym::No).unwrap();
+        assert_eq!(
+            numerical_jacobian_colored(
+                &mut jj,
+                1.0,
+                0.0,
+                &mut y,
+                &mut w1,
+                &mut w2,
+                &mut coloring,
+                &mut args,
+                function
+            )
+            .err(),
+            Some("the max number of non-zero values in the numerical Jacobian matrix must be at least coloring.nnz()")
+        );
+        let mut jj = CooMatrix::new(2, 2, 2, Sym::No).unwrap();
+        let mut y = Vector::new(3);
+        assert_eq!(
+            numerical_jacobian_colored(
+                &mut jj,
+                1.0,
+                0.0,
+                &mut y,
+                &mut w1,
+                &mut w2,
+                &mut coloring,
+                &mut args,
+                function
+            )
+            .err(),
+            Some("the y-vector must have dim = ndim")
+        );
+        let mut y = Vector::new(2);
+        let mut w1 = Vector::new(1);
+        assert_eq!(
+            numerical_jacobian_colored(
+                &mut jj,
+                1.0,
+                0.0,
+                &mut y,
+                &mut w1,
+                &mut w2,
+                &mut coloring,
+                &mut args,
+                function
+            )
+            .err(),
+            Some("the workspace vectors must have dim ≥ ndim")
+        );
+    }
+
+    #[test]
+    fn numerical_jacobian_colored_works() {
+        struct Args {
+            n_function_calls: usize,
+        }
+        let mut args = Args { n_function_calls: 0 };
+
+        // same function as in the numerical_jacobian test (the pattern has 10 non-zeros)
+        let function = |f: &mut Vector, _x: f64, y: &Vector, args: &mut Args| {
+            f[0] = 2.0 * y[0] + 3.0 * y[1] * y[2] - 4.0 * f64::cos(y[3]);
+            f[1] = -3.0 * y[1] - 4.0 * f64::exp(y[3] / (1.0 + y[1]));
+            f[2] = y[2] * y[2];
+            f[3] = -y[0] + 5.0 * (1.0 - y[0] * y[0]) * y[1] - 6.0 * y[2];
+            args.n_function_calls += 1;
+            Ok(())
+        };
+        let nonzeros = [
+            (0, 0),
+            (0, 1),
+            (0, 2),
+            (0, 3),
+            (1, 1),
+            (1, 3),
+            (2, 2),
+            (3, 0),
+            (3, 1),
+            (3, 2),
+        ];
+
+        let ndim = 4;
+        let mut pattern = CooMatrix::new(ndim, ndim, nonzeros.len(), Sym::No).unwrap();
+        for (i, j) in nonzeros {
+            pattern.put(i, j, 1.0).unwrap();
+        }
+        let mut coloring = JacobianColoring::new(&pattern).unwrap();
+
+        let x = 1.0;
+        let mut y = Vector::from(&[1.0, 2.0, 3.0, 4.0]);
+        let y_copy = y.clone();
+        let alpha = 0.5;
+
+        let mut jj_ref = CooMatrix::new(ndim, ndim, ndim * ndim, Sym::No).unwrap();
+        let mut w1 = Vector::new(ndim);
+        let mut w2 = Vector::new(ndim);
+        numerical_jacobian(&mut jj_ref, alpha, x, &mut y, &mut w1, &mut w2, &mut args, function).unwrap();
+
+        args.n_function_calls = 0;
+        let mut jj = CooMatrix::new(ndim, ndim, coloring.nnz(), Sym::No).unwrap();
+        for _ in 0..2 {
+            // the coloring is reused
+            numerical_jacobian_colored(
+                &mut jj,
+                alpha,
+                x,
+                &mut y,
+                &mut w1,
+                &mut w2,
+                &mut coloring,
+                &mut args,
+                function,
+            )
+            .unwrap();
+            mat_approx_eq(&jj.as_dense(), &jj_ref.as_dense(), 1e-6);
+            assert_eq!(y.as_data(), y_copy.as_data());
+        }
+        assert_eq!(args.n_function_calls, 2 * (1 + coloring.ncolor()));
+    }
+}
@@ -7,17 +7,21 @@ pub use crate::aliases::*;
 pub use crate::complex_lin_solver::*;
 pub use crate::complex_solver_umfpack::ComplexSolverUMFPACK;
 pub use crate::coo_matrix::NumCooMatrix;
+pub use crate::coo_slice::NumCooSlice;
 pub use crate::csc_matrix::NumCscMatrix;
 pub use crate::csr_matrix::NumCsrMatrix;
 pub use crate::enums::*;
 pub use crate::lin_sol_params::LinSolParams;
 pub use crate::lin_solver::*;
 pub use crate::numerical_jacobian::numerical_jacobian;
-pub use crate::read_matrix_market;
+pub use crate::numerical_jacobian_colored::{numerical_jacobian_colored, JacobianColoring};
 pub use crate::solver_umfpack::SolverUMFPACK;
 pub use crate::sparse_matrix::NumSparseMatrix;
 pub use crate::stats_lin_sol::StatsLinSol;
+pub use crate::symbolic_analysis::SymbolicAnalysis;
+pub use crate::symbolic_cache::SymbolicCache;
 pub use crate::verify_lin_sys::VerifyLinSys;
+pub use crate::{read_matrix_market, read_matrix_market_parallel};
 
 #[cfg(feature = "with_mumps")]
 pub use crate::complex_solver_mumps::ComplexSolverMUMPS;
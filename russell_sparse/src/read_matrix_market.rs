@@ -2,9 +2,10 @@ use super::{CooMatrix, MMsym, Sym};
 use crate::{ComplexCooMatrix, StrError};
 use russell_lab::{cpx, Complex64};
 use std::ffi::OsStr;
-use std::fs::File;
+use std::fs::{self, File};
 use std::io::{BufRead, BufReader};
 use std::path::Path;
+use std::thread;
 
 struct MatrixMarketData {
     // header
@@ -124,6 +125,27 @@ impl MatrixMarketData {
         Ok(true) // returns true == parsed
     }
 
+    /// Returns the symmetry option and the max number of entries in the COO matrix
+    fn symmetry_and_max_nnz(&self, symmetric_handling: MMsym) -> Result<(Sym, i32), StrError> {
+        let sym = if self.symmetric {
+            if self.m != self.n {
+                return Err("MatrixMarket data is invalid: the number of rows must equal the number of columns for symmetric matrices");
+            }
+            match symmetric_handling {
+                MMsym::LeaveAsLower => Sym::YesLower,
+                MMsym::SwapToUpper => Sym::YesUpper,
+                MMsym::MakeItFull => Sym::YesFull,
+            }
+        } else {
+            Sym::No
+        };
+        let mut max = self.nnz;
+        if self.symmetric && symmetric_handling == MMsym::MakeItFull {
+            max = 2 * self.nnz;
+        }
+        Ok((sym, max))
+    }
+
     #[inline]
     fn parse_values(&mut self, line: &str) -> Result<bool, StrError> {
         let maybe_data = line.trim_start().trim_end_matches("\n");
@@ -365,25 +387,8 @@ where
         }
     }
 
-    // symmetry option
-    let sym = if data.symmetric {
-        if data.m != data.n {
-            return Err("MatrixMarket data is invalid: the number of rows must equal the number of columns for symmetric matrices");
-        }
-        match symmetric_handling {
-            MMsym::LeaveAsLower => Sym::YesLower,
-            MMsym::SwapToUpper => Sym::YesUpper,
-            MMsym::MakeItFull => Sym::YesFull,
-        }
-    } else {
-        Sym::No
-    };
-
-    // set max number of entries
-    let mut max = data.nnz;
-    if data.symmetric && symmetric_handling == MMsym::MakeItFull {
-        max = 2 * data.nnz;
-    }
+    // symmetry option and max number of entries
+    let (sym, max) = data.symmetry_and_max_nnz(symmetric_handling)?;
 
     // read and parse values
     if data.complex {
@@ -462,11 +467,263 @@ where
     }
 }
 
+/// Holds the triplets parsed from a chunk of data lines
+struct ParsedChunk {
+    indices_i: Vec<i32>,
+    indices_j: Vec<i32>,
+    real: Vec<f64>,
+    imag: Vec<f64>,
+    nline: usize, // number of data lines (may differ from the number of triplets if MakeItFull)
+}
+
+/// Returns the next line (including the newline character) and advances the start position
+fn next_line<'a>(bytes: &'a [u8], start: &mut usize) -> Result<Option<&'a str>, StrError> {
+    if *start >= bytes.len() {
+        return Ok(None);
+    }
+    let end = match bytes[*start..].iter().position(|&b| b == b'\n') {
+        Some(k) => *start + k + 1,
+        None => bytes.len(),
+    };
+    let line = std::str::from_utf8(&bytes[*start..end]).map_err(|_| "the file contains invalid UTF-8 characters")?;
+    *start = end;
+    Ok(Some(line))
+}
+
+/// Splits the data lines into (at most) `nchunk` chunks on line boundaries
+fn split_on_lines(body: &[u8], nchunk: usize) -> Vec<&[u8]> {
+    let mut chunks = Vec::with_capacity(nchunk);
+    let mut begin = 0;
+    for k in 1..=nchunk {
+        if begin >= body.len() {
+            break;
+        }
+        let mut end = usize::max(begin, k * body.len() / nchunk);
+        if k == nchunk {
+            end = body.len();
+        } else if end < body.len() {
+            end = match body[end..].iter().position(|&b| b == b'\n') {
+                Some(p) => end + p + 1,
+                None => body.len(),
+            };
+        }
+        if end > begin {
+            chunks.push(&body[begin..end]);
+        }
+        begin = end;
+    }
+    chunks
+}
+
+/// Parses a chunk of data lines
+fn parse_chunk(chunk: &[u8], header: &MatrixMarketData, symmetric_handling: MMsym) -> Result<ParsedChunk, StrError> {
+    let text = std::str::from_utf8(chunk).map_err(|_| "the file contains invalid UTF-8 characters")?;
+    let mut data = MatrixMarketData::new();
+    data.complex = header.complex;
+    data.symmetric = header.symmetric;
+    data.m = header.m;
+    data.n = header.n;
+    data.nnz = i32::MAX; // the total number of values is checked after joining the chunks
+    let capacity = chunk.len() / 16;
+    let mut res = ParsedChunk {
+        indices_i: Vec::with_capacity(capacity),
+        indices_j: Vec::with_capacity(capacity),
+        real: Vec::with_capacity(capacity),
+        imag: if data.complex {
+            Vec::with_capacity(capacity)
+        } else {
+            Vec::new()
+        },
+        nline: 0,
+    };
+    let mut push = |i: i32, j: i32, data: &MatrixMarketData| {
+        res.indices_i.push(i);
+        res.indices_j.push(j);
+        res.real.push(data.aij);
+        if data.complex {
+            res.imag.push(data.bij);
+        }
+    };
+    for line in text.lines() {
+        if data.parse_values(line)? {
+            if data.symmetric {
+                match symmetric_handling {
+                    MMsym::LeaveAsLower => {
+                        if data.j > data.i {
+                            return Err("found an upper triangular entry in a symmetric matrix");
+                        }
+                        push(data.i, data.j, &data);
+                    }
+                    MMsym::SwapToUpper => {
+                        if data.j > data.i {
+                            return Err("found an upper triangular entry in a symmetric matrix");
+                        }
+                        push(data.j, data.i, &data);
+                    }
+                    MMsym::MakeItFull => {
+                        push(data.i, data.j, &data);
+                        if data.i != data.j {
+                            push(data.j, data.i, &data);
+                        }
+                    }
+                }
+            } else {
+                push(data.i, data.j, &data);
+            }
+        }
+    }
+    res.nline = data.pos as usize;
+    Ok(res)
+}
+
+/// Reads a MatrixMarket file into a CooMatrix using multiple threads to parse the data lines
+///
+/// This function produces the same result as [read_matrix_market()], including the order of the entries;
+/// however, the whole file is loaded into memory with a single read, the data lines are split into
+/// chunks on line boundaries, and the chunks are parsed concurrently (using scoped threads).
+/// Afterwards, the triplets are copied into the preallocated COO storage.
+///
+/// **Note:** This function is convenient for large files (e.g., in benchmarks). In addition,
+/// [crate::CooMatrix::write_binary()] and [crate::CooMatrix::read_binary()] may be used to
+/// skip the text parsing entirely in subsequent runs.
+///
+/// # Input
+///
+/// * `full_path` -- may be a String, &str, or Path
+/// * `symmetric_handling` -- Options to handle symmetric matrices
+/// * `nthread` -- the number of threads (0 or 1 means that the data lines are parsed by the current thread)
+///
+/// # Output
+///
+/// * If the matrix is real, returns `(Some(CooMatrix), None)`
+/// * If the matrix is complex, returns `(None, Some(ComplexCooMatrix))`
+///
+/// # Examples
+///
+/// ```
+/// use russell_sparse::prelude::*;
+/// use russell_sparse::StrError;
+///
+/// fn main() -> Result<(), StrError> {
+///     let name = "./data/matrix_market/ok_simple_symmetric.mtx";
+///     let (coo_real, _) = read_matrix_market_parallel(name, MMsym::MakeItFull, 4)?;
+///     let coo = coo_real.unwrap();
+///     let (nrow, ncol, nnz, sym) = coo.get_info();
+///     assert_eq!((nrow, ncol, nnz, sym), (3, 3, 6, Sym::YesFull));
+///     let a = coo.as_dense();
+///     let correct = "┌       ┐\n\
+///                    │ 1 2 0 │\n\
+///                    │ 2 3 4 │\n\
+///                    │ 0 4 0 │\n\
+///                    └       ┘";
+///     assert_eq!(format!("{}", a), correct);
+///     Ok(())
+/// }
+/// ```
+pub fn read_matrix_market_parallel<P>(
+    full_path: &P,
+    symmetric_handling: MMsym,
+    nthread: usize,
+) -> Result<(Option<CooMatrix>, Option<ComplexCooMatrix>), StrError>
+where
+    P: AsRef<OsStr> + ?Sized,
+{
+    let path = Path::new(full_path).to_path_buf();
+    let bytes = fs::read(path).map_err(|_| "cannot open file")?;
+    let mut start = 0;
+
+    // auxiliary data structure
+    let mut data = MatrixMarketData::new();
+
+    // read and parse header
+    match next_line(&bytes, &mut start)? {
+        Some(header) => data.parse_header(header)?,
+        None => return Err("the file is empty"),
+    }
+
+    // read and parse dimensions
+    loop {
+        match next_line(&bytes, &mut start)? {
+            Some(line) => {
+                if data.parse_dimensions(line)? {
+                    break;
+                }
+            }
+            None => return Err("cannot find the dimensions line"),
+        }
+    }
+
+    // symmetry option and max number of entries
+    let (sym, max) = data.symmetry_and_max_nnz(symmetric_handling)?;
+
+    // parse the chunks concurrently
+    let chunks = split_on_lines(&bytes[start..], usize::max(1, nthread));
+    let results: Vec<Result<ParsedChunk, StrError>> = if chunks.len() < 2 {
+        chunks
+            .iter()
+            .map(|c| parse_chunk(c, &data, symmetric_handling))
+            .collect()
+    } else {
+        thread::scope(|scope| {
+            let handles: Vec<_> = chunks
+                .iter()
+                .map(|c| scope.spawn(|| parse_chunk(c, &data, symmetric_handling)))
+                .collect();
+            handles
+                .into_iter()
+                .map(|h| {
+                    h.join()
+                        .unwrap_or(Err("a thread parsing the MatrixMarket file panicked"))
+                })
+                .collect()
+        })
+    };
+    let mut parsed = Vec::with_capacity(results.len());
+    for res in results {
+        parsed.push(res?);
+    }
+
+    // check the number of values
+    let nline: usize = parsed.iter().map(|p| p.nline).sum();
+    if nline > data.nnz as usize {
+        return Err("there are more values than specified");
+    }
+    if nline < data.nnz as usize {
+        return Err("not all values have been found");
+    }
+
+    // copy the triplets into the COO storage
+    let (nrow, ncol, max_nnz) = (data.m as usize, data.n as usize, max as usize);
+    if data.complex {
+        let mut coo = ComplexCooMatrix::new(nrow, ncol, max_nnz, sym).unwrap();
+        for p in &parsed {
+            let (a, b) = (coo.nnz, coo.nnz + p.indices_i.len());
+            coo.indices_i[a..b].copy_from_slice(&p.indices_i);
+            coo.indices_j[a..b].copy_from_slice(&p.indices_j);
+            for k in 0..p.real.len() {
+                coo.values[a + k] = cpx!(p.real[k], p.imag[k]);
+            }
+            coo.nnz = b;
+        }
+        Ok((None, Some(coo)))
+    } else {
+        let mut coo = CooMatrix::new(nrow, ncol, max_nnz, sym).unwrap();
+        for p in &parsed {
+            let (a, b) = (coo.nnz, coo.nnz + p.indices_i.len());
+            coo.indices_i[a..b].copy_from_slice(&p.indices_i);
+            coo.indices_j[a..b].copy_from_slice(&p.indices_j);
+            coo.values[a..b].copy_from_slice(&p.real);
+            coo.nnz = b;
+        }
+        Ok((Some(coo), None))
+    }
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #[cfg(test)]
 mod tests {
-    use super::{read_matrix_market, MatrixMarketData};
+    use super::{read_matrix_market, read_matrix_market_parallel, split_on_lines, MatrixMarketData};
     use crate::{MMsym, Sym};
     use russell_lab::{cpx, Complex64, Matrix};
 
@@ -823,4 +1080,107 @@ mod tests {
             ]
         );
     }
+
+    #[test]
+    fn split_on_lines_works() {
+        let body = b"1 1 1.0\n2 2 2.0\n3 3 3.0\n";
+        for nchunk in [1, 2, 3, 4, 100] {
+            let chunks = split_on_lines(body, nchunk);
+            assert!(chunks.len() <= nchunk);
+            assert_eq!(chunks.concat(), body);
+            for chunk in &chunks {
+                assert_eq!(chunk.last(), Some(&b'\n'));
+            }
+        }
+        assert_eq!(split_on_lines(b"", 3).len(), 0);
+        assert_eq!(split_on_lines(b"1 1 1.0", 3), &[b"1 1 1.0"]);
+    }
+
+    #[test]
+    fn read_matrix_market_parallel_handle_wrong_files() {
+        let h = MMsym::LeaveAsLower;
+        assert_eq!(
+            read_matrix_market_parallel("__wrong__", h, 2).err(),
+            Some("cannot open file")
+        );
+        for name in [
+            "bad_empty_file.mtx",
+            "bad_wrong_header.mtx",
+            "bad_wrong_dims.mtx",
+            "bad_wrong_dims_complex.mtx",
+            "bad_missing_data.mtx",
+            "bad_missing_data_complex.mtx",
+            "bad_many_lines.mtx",
+            "bad_many_lines_complex.mtx",
+            "bad_symmetric_rectangular.mtx",
+            "bad_symmetric_rectangular_complex.mtx",
+        ] {
+            let filepath = format!("./data/matrix_market/{}", name);
+            let correct = read_matrix_market(&filepath, h).err();
+            for nthread in [1, 3] {
+                assert_eq!(read_matrix_market_parallel(&filepath, h, nthread).err(), correct);
+            }
+        }
+    }
+
+    #[test]
+    fn read_matrix_market_parallel_works() {
+        for name in [
+            "bfwb62.mtx",
+            "ok_complex_general.mtx",
+            "ok_complex_symmetric_small.mtx",
+            "ok_general.mtx",
+            "ok_simple_complex_general.mtx",
+            "ok_simple_general.mtx",
+            "ok_simple_symmetric.mtx",
+            "ok_symmetric.mtx",
+            "ok_symmetric_small.mtx",
+            "umfpack_di_demo.mtx",
+        ] {
+            let filepath = format!("./data/matrix_market/{}", name);
+            for h in [MMsym::LeaveAsLower, MMsym::SwapToUpper, MMsym::MakeItFull] {
+                let (real, cpx) = read_matrix_market(&filepath, h).unwrap();
+                for nthread in [0, 1, 3, 8] {
+                    let (par_real, par_cpx) = read_matrix_market_parallel(&filepath, h, nthread).unwrap();
+                    if let Some(coo) = &real {
+                        let par = par_real.as_ref().unwrap();
+                        assert_eq!(par.get_info(), coo.get_info());
+                        assert_eq!(par.max_nnz, coo.max_nnz);
+                        assert_eq!(par.get_row_indices(), coo.get_row_indices());
+                        assert_eq!(par.get_col_indices(), coo.get_col_indices());
+                        assert_eq!(par.get_values(), coo.get_values());
+                        assert!(par_cpx.is_none());
+                    }
+                    if let Some(coo) = &cpx {
+                        let par = par_cpx.as_ref().unwrap();
+                        assert_eq!(par.get_info(), coo.get_info());
+                        assert_eq!(par.max_nnz, coo.max_nnz);
+                        assert_eq!(par.get_row_indices(), coo.get_row_indices());
+                        assert_eq!(par.get_col_indices(), coo.get_col_indices());
+                        assert_eq!(par.get_values(), coo.get_values());
+                        assert!(par_real.is_none());
+                    }
+                }
+            }
+        }
+    }
+
+    #[test]
+    fn read_matrix_market_parallel_captures_upper_entries() {
+        let path = "/tmp/russell_sparse/test_read_matrix_market_parallel_upper.mtx";
+        std::fs::create_dir_all("/tmp/russell_sparse").unwrap();
+        std::fs::write(
+            path,
+            "%%MatrixMarket matrix coordinate real symmetric\n2 2 2\n1 1 1.0\n1 2 2.0\n",
+        )
+        .unwrap();
+        for h in [MMsym::LeaveAsLower, MMsym::SwapToUpper] {
+            assert_eq!(
+                read_matrix_market_parallel(path, h, 2).err(),
+                Some("found an upper triangular entry in a symmetric matrix")
+            );
+        }
+        let (coo, _) = read_matrix_market_parallel(path, MMsym::MakeItFull, 2).unwrap();
+        assert_eq!(coo.unwrap().get_info(), (2, 2, 3, Sym::YesFull));
+    }
 }
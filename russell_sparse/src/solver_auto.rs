@@ -0,0 +1,484 @@
+use super::{klu_btf_probe, Genie, LinSolParams, LinSolTrait, LinSolver, SparseMatrix, StatsLinSol, Sym};
+use super::{SymbolicAnalysis, SymbolicCache};
+use crate::StrError;
+use russell_lab::{Matrix, Stopwatch, Vector};
+use std::collections::HashMap;
+use std::sync::Mutex;
+
+/// Defines the dimension below which KLU is selected (the analysis overhead of the other solvers dominates)
+pub const AUTO_SMALL_NDIM: usize = 1_000;
+
+/// Defines the max number of non-zeros per row for which the BTF form is probed (KLU is best for very sparse matrices)
+pub const AUTO_KLU_MAX_NNZ_PER_ROW: f64 = 8.0;
+
+/// Defines the max size of the largest BTF block, relative to the dimension, for which KLU is selected
+pub const AUTO_KLU_MAX_BLOCK_FRACTION: f64 = 0.75;
+
+/// Defines the min dimension for which MUMPS is selected (if available)
+pub const AUTO_MUMPS_MIN_NDIM: usize = 100_000;
+
+/// Defines the min number of non-zeros per row for which MUMPS is selected (e.g., 3D problems)
+pub const AUTO_MUMPS_MIN_NNZ_PER_ROW: f64 = 20.0;
+
+/// Holds the decisions (selected solver and whether it came from a trial) per sparsity pattern
+static AUTO_DECISIONS: Mutex<Option<HashMap<u64, (Genie, bool)>>> = Mutex::new(None);
+
+/// Selects the direct solver (KLU, UMFPACK, or MUMPS) automatically
+///
+/// The first call to `factorize` inspects the matrix (dimension, non-zeros per row, symmetry, and, for very
+/// sparse matrices, the block triangular form computed by klu_analyze) and selects one of the candidate
+/// solvers; see [AUTO_SMALL_NDIM] and the other constants. Alternatively, if [LinSolParams::auto_trial]
+/// is true, each candidate factorizes the matrix once and the fastest is kept.
+///
+/// The candidates depend on the symmetry: `Sym::No` allows all solvers; `Sym::YesFull` allows KLU and
+/// UMFPACK; `Sym::YesLower` allows MUMPS only. MUMPS is only considered if the COO matrix is available.
+///
+/// The decisions are cached (for the whole process) per sparsity pattern; thus, another solver
+/// allocated for a matrix with the same pattern skips the inspection (or trial).
+///
+/// **Note:** All the other calls are forwarded to the selected solver.
+pub struct SolverAuto {
+    /// Holds the selected solver (after the first factorize)
+    selected: Option<LinSolver<'static>>,
+
+    /// Holds the selected genie
+    genie: Option<Genie>,
+
+    /// Indicates that the decision has been found in the cache
+    from_cache: bool,
+
+    /// Stopwatch to measure computation times
+    stopwatch: Stopwatch,
+
+    /// Time spent on the selection (probe or trial factorizations) in nanoseconds
+    time_select_ns: u128,
+}
+
+impl SolverAuto {
+    /// Allocates a new instance
+    pub fn new() -> Result<Self, StrError> {
+        Ok(SolverAuto {
+            selected: None,
+            genie: None,
+            from_cache: false,
+            stopwatch: Stopwatch::new(),
+            time_select_ns: 0,
+        })
+    }
+
+    /// Returns the selected solver (after factorize)
+    pub fn get_genie(&self) -> Option<Genie> {
+        self.genie
+    }
+
+    /// Indicates whether the decision has been found in the cache (after factorize)
+    pub fn selected_from_cache(&self) -> bool {
+        self.from_cache
+    }
+
+    /// Clears the cache of decisions
+    pub fn clear_cache() {
+        if let Ok(mut decisions) = AUTO_DECISIONS.lock() {
+            *decisions = None;
+        }
+    }
+
+    /// Returns the candidate solvers for the matrix
+    fn candidates(mat: &SparseMatrix) -> Result<Vec<Genie>, StrError> {
+        let (nrow, ncol, _, sym) = mat.get_info();
+        if nrow != ncol {
+            return Err("the matrix must be square");
+        }
+        let mumps = cfg!(feature = "with_mumps") && mat.get_coo().is_ok();
+        let candidates = match sym {
+            Sym::No if mumps => vec![Genie::Klu, Genie::Umfpack, Genie::Mumps],
+            Sym::No | Sym::YesFull => vec![Genie::Klu, Genie::Umfpack],
+            Sym::YesLower if mumps => vec![Genie::Mumps],
+            Sym::YesLower => return Err("the lower triangular representation requires MUMPS (with COO)"),
+            Sym::YesUpper => return Err("the upper triangular representation is not supported by any solver"),
+        };
+        Ok(candidates)
+    }
+
+    /// Selects the solver by inspecting the matrix
+    fn inspect(mat: &mut SparseMatrix, candidates: &[Genie]) -> Result<Genie, StrError> {
+        let (ndim, _, nnz, _) = mat.get_info();
+        let nnz_per_row = nnz as f64 / ndim as f64;
+        let btf =
+            if candidates.contains(&Genie::Klu) && ndim >= AUTO_SMALL_NDIM && nnz_per_row <= AUTO_KLU_MAX_NNZ_PER_ROW {
+                Some(klu_btf_probe(mat.get_csc_or_from_coo()?)?)
+            } else {
+                None
+            };
+        Ok(select_genie(ndim, nnz, candidates, btf))
+    }
+
+    /// Factorizes the matrix with each candidate and returns the fastest (factorized) solver
+    fn trial(
+        mat: &mut SparseMatrix,
+        params: Option<LinSolParams>,
+        candidates: &[Genie],
+    ) -> Result<(Genie, LinSolver<'static>), StrError> {
+        let mut best: Option<(u128, Genie, LinSolver<'static>)> = None;
+        let mut first_error = None;
+        for genie in candidates {
+            let mut solver = match LinSolver::new(*genie) {
+                Ok(s) => s,
+                Err(e) => {
+                    first_error.get_or_insert(e);
+                    continue;
+                }
+            };
+            let mut stopwatch = Stopwatch::new();
+            match solver.actual.factorize(mat, params) {
+                Ok(()) => {
+                    let ns = stopwatch.stop();
+                    if best.as_ref().map_or(true, |(fastest, _, _)| ns < *fastest) {
+                        best = Some((ns, *genie, solver));
+                    }
+                }
+                Err(e) => {
+                    first_error.get_or_insert(e);
+                }
+            }
+        }
+        match best {
+            Some((_, genie, solver)) => Ok((genie, solver)),
+            None => Err(first_error.unwrap_or("no candidate solver is available")),
+        }
+    }
+
+    /// Returns the selected solver or an error if factorize has not been called yet
+    fn actual(&mut self) -> Result<&mut LinSolver<'static>, StrError> {
+        self.selected
+            .as_mut()
+            .ok_or("the function factorize must be called before solve")
+    }
+}
+
+/// Selects the solver given the matrix properties
+///
+/// # Input
+///
+/// * `ndim` -- the dimension of the (square) matrix
+/// * `nnz` -- the number of non-zeros
+/// * `candidates` -- the solvers suitable for the matrix (see [SolverAuto]); must not be empty
+/// * `btf` -- the number of BTF blocks and the size of the largest block (if probed)
+pub fn select_genie(ndim: usize, nnz: usize, candidates: &[Genie], btf: Option<(usize, usize)>) -> Genie {
+    if candidates.len() == 1 {
+        return candidates[0];
+    }
+    let nnz_per_row = nnz as f64 / ndim as f64;
+    let klu = candidates.contains(&Genie::Klu);
+    if klu && ndim < AUTO_SMALL_NDIM {
+        return Genie::Klu;
+    }
+    if let Some((num_blocks, max_block_size)) = btf {
+        if klu && num_blocks > 1 && (max_block_size as f64) <= AUTO_KLU_MAX_BLOCK_FRACTION * (ndim as f64) {
+            return Genie::Klu;
+        }
+    }
+    if candidates.contains(&Genie::Mumps) && ndim >= AUTO_MUMPS_MIN_NDIM && nnz_per_row >= AUTO_MUMPS_MIN_NNZ_PER_ROW {
+        return Genie::Mumps;
+    }
+    if candidates.contains(&Genie::Umfpack) {
+        Genie::Umfpack
+    } else {
+        candidates[0]
+    }
+}
+
+impl LinSolTrait for SolverAuto {
+    /// Performs the factorization (and selects the solver in the first call)
+    fn factorize(&mut self, mat: &mut SparseMatrix, params: Option<LinSolParams>) -> Result<(), StrError> {
+        if let Some(solver) = self.selected.as_mut() {
+            return solver.actual.factorize(mat, params);
+        }
+        self.stopwatch.reset();
+        let trial = params.map_or(false, |p| p.auto_trial);
+        let candidates = SolverAuto::candidates(mat)?;
+
+        // look up the cache (a decision by inspection is not reused if a trial is requested)
+        let key = if candidates.len() > 1 {
+            SymbolicCache::pattern_key(Genie::Klu, mat)?
+        } else {
+            None
+        };
+        let cached = match (key, AUTO_DECISIONS.lock()) {
+            (Some(k), Ok(decisions)) => decisions.as_ref().and_then(|d| d.get(&k).copied()),
+            _ => None,
+        };
+        let cached = cached.filter(|(genie, from_trial)| candidates.contains(genie) && (*from_trial || !trial));
+
+        // select the solver
+        let (genie, solver) = match cached {
+            Some((genie, _)) => {
+                self.from_cache = true;
+                (genie, None)
+            }
+            None if trial && candidates.len() > 1 => {
+                let (genie, solver) = SolverAuto::trial(mat, params, &candidates)?;
+                (genie, Some(solver))
+            }
+            None => (SolverAuto::inspect(mat, &candidates)?, None),
+        };
+        if let (Some(k), None, Ok(mut decisions)) = (key, cached, AUTO_DECISIONS.lock()) {
+            decisions
+                .get_or_insert_with(HashMap::new)
+                .insert(k, (genie, solver.is_some()));
+        }
+        self.time_select_ns = self.stopwatch.stop();
+        self.genie = Some(genie);
+
+        // factorize (unless already done by the trial)
+        let solver = match solver {
+            Some(s) => s,
+            None => {
+                let mut s = LinSolver::new(genie)?;
+                s.actual.factorize(mat, params)?;
+                s
+            }
+        };
+        self.selected = Some(solver);
+        Ok(())
+    }
+
+    /// Computes the solution of the linear system
+    fn solve(&mut self, x: &mut Vector, mat: &SparseMatrix, rhs: &Vector, verbose: bool) -> Result<(), StrError> {
+        self.actual()?.actual.solve(x, mat, rhs, verbose)
+    }
+
+    /// Computes the solution of the transposed linear system
+    fn solve_transposed(
+        &mut self,
+        x: &mut Vector,
+        mat: &SparseMatrix,
+        rhs: &Vector,
+        verbose: bool,
+    ) -> Result<(), StrError> {
+        self.actual()?.actual.solve_transposed(x, mat, rhs, verbose)
+    }
+
+    /// Computes the solution of the linear system with multiple right-hand sides
+    fn solve_multi(&mut self, x: &mut Matrix, mat: &SparseMatrix, rhs: &Matrix, verbose: bool) -> Result<(), StrError> {
+        self.actual()?.actual.solve_multi(x, mat, rhs, verbose)
+    }
+
+    /// Updates the stats structure (should be called after solve)
+    ///
+    /// **Note:** The time spent on the selection is added to the initialization time.
+    fn update_stats(&self, stats: &mut StatsLinSol) {
+        if let Some(solver) = self.selected.as_ref() {
+            solver.actual.update_stats(stats);
+            stats.main.solver = format!("Auto-{}", stats.main.solver);
+            stats.time_nanoseconds.initialize += self.time_select_ns;
+        } else {
+            stats.main.solver = "Auto".to_string();
+        }
+    }
+
+    /// Returns the nanoseconds spent on initialize (including the selection)
+    fn get_ns_init(&self) -> u128 {
+        self.time_select_ns + self.selected.as_ref().map_or(0, |s| s.actual.get_ns_init())
+    }
+
+    /// Returns the nanoseconds spent on factorize
+    fn get_ns_fact(&self) -> u128 {
+        self.selected.as_ref().map_or(0, |s| s.actual.get_ns_fact())
+    }
+
+    /// Returns the nanoseconds spent on solve
+    fn get_ns_solve(&self) -> u128 {
+        self.selected.as_ref().map_or(0, |s| s.actual.get_ns_solve())
+    }
+
+    /// Returns the fill-reducing ordering computed by the selected solver
+    fn get_symbolic_analysis(&self) -> Option<&SymbolicAnalysis> {
+        self.selected.as_ref().and_then(|s| s.actual.get_symbolic_analysis())
+    }
+
+    /// Saves the factorization computed by the selected solver
+    ///
+    /// **Note:** The factorization must be loaded with the selected genie (see [SolverAuto::get_genie()]).
+    fn save_factorization(&self, full_path_dir: &str) -> Result<(), StrError> {
+        match self.selected.as_ref() {
+            Some(s) => s.actual.save_factorization(full_path_dir),
+            None => Err("cannot save the factorization before factorize"),
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#[cfg(test)]
+mod tests {
+    use super::{select_genie, SolverAuto, AUTO_MUMPS_MIN_NDIM, AUTO_SMALL_NDIM};
+    use crate::{ComplexLinSolver, CooMatrix, Genie, LinSolParams, LinSolTrait, LinSolver};
+    use crate::{Samples, SparseMatrix, StatsLinSol, Sym};
+    use russell_lab::{vec_approx_eq, Vector};
+
+    #[test]
+    fn select_genie_works() {
+        let all = &[Genie::Klu, Genie::Umfpack, Genie::Mumps];
+        let no_mumps = &[Genie::Klu, Genie::Umfpack];
+        let n = AUTO_SMALL_NDIM;
+        // single candidate
+        assert_eq!(select_genie(10, 30, &[Genie::Mumps], None), Genie::Mumps);
+        // small matrix
+        assert_eq!(select_genie(10, 30, all, None), Genie::Klu);
+        // very sparse with many blocks
+        assert_eq!(select_genie(n, 3 * n, no_mumps, Some((n / 2, 2))), Genie::Klu);
+        // very sparse but irreducible
+        assert_eq!(select_genie(n, 3 * n, no_mumps, Some((1, n))), Genie::Umfpack);
+        assert_eq!(select_genie(n, 3 * n, no_mumps, Some((2, n - 1))), Genie::Umfpack);
+        // large and dense rows
+        let m = AUTO_MUMPS_MIN_NDIM;
+        assert_eq!(select_genie(m, 30 * m, all, None), Genie::Mumps);
+        assert_eq!(select_genie(m, 30 * m, no_mumps, None), Genie::Umfpack);
+        assert_eq!(select_genie(m, 10 * m, all, None), Genie::Umfpack);
+    }
+
+    #[test]
+    fn new_and_errors_work() {
+        let mut solver = SolverAuto::new().unwrap();
+        assert_eq!(solver.get_genie(), None);
+        assert_eq!(solver.get_ns_init(), 0);
+        let (coo, _, _, _) = Samples::umfpack_unsymmetric_5x5();
+        let mat = SparseMatrix::from_coo(coo);
+        let mut x = Vector::new(5);
+        let rhs = Vector::new(5);
+        assert_eq!(
+            solver.solve(&mut x, &mat, &rhs, false).err(),
+            Some("the function factorize must be called before solve")
+        );
+        assert_eq!(
+            solver.save_factorization("/tmp/russell_sparse/auto").err(),
+            Some("cannot save the factorization before factorize")
+        );
+        let mut stats = StatsLinSol::new();
+        solver.update_stats(&mut stats);
+        assert_eq!(stats.main.solver, "Auto");
+
+        let (coo, _, _, _) = Samples::rectangular_3x4();
+        let mut mat = SparseMatrix::from_coo(coo);
+        assert_eq!(
+            solver.factorize(&mut mat, None).err(),
+            Some("the matrix must be square")
+        );
+        let (coo, _, _, _) = Samples::mkl_symmetric_5x5_upper(false, false);
+        let mut mat = SparseMatrix::from_coo(coo);
+        assert_eq!(
+            solver.factorize(&mut mat, None).err(),
+            Some("the upper triangular representation is not supported by any solver")
+        );
+        #[cfg(not(feature = "with_mumps"))]
+        {
+            let (coo, _, _, _) = Samples::mkl_symmetric_5x5_lower(false, false);
+            let mut mat = SparseMatrix::from_coo(coo);
+            assert_eq!(
+                solver.factorize(&mut mat, None).err(),
+                Some("the lower triangular representation requires MUMPS (with COO)")
+            );
+        }
+        assert_eq!(
+            ComplexLinSolver::new(Genie::Auto).err(),
+            Some("the automatic selection is not available for complex matrices")
+        );
+    }
+
+    #[test]
+    fn solve_works() {
+        let mut solver = LinSolver::new(Genie::Auto).unwrap();
+        let (coo, _, _, _) = Samples::umfpack_unsymmetric_5x5();
+        let mut mat = SparseMatrix::from_coo(coo);
+        let mut x = Vector::new(5);
+        let rhs = Vector::from(&[8.0, 45.0, -3.0, 3.0, 19.0]);
+        let x_correct = &[1.0, 2.0, 3.0, 4.0, 5.0];
+        solver.actual.factorize(&mut mat, None).unwrap();
+        solver.actual.solve(&mut x, &mat, &rhs, false).unwrap();
+        vec_approx_eq(&x, x_correct, 1e-14);
+
+        // factorize again reuses the selected solver
+        solver.actual.factorize(&mut mat, None).unwrap();
+        solver.actual.solve(&mut x, &mat, &rhs, false).unwrap();
+        vec_approx_eq(&x, x_correct, 1e-14);
+
+        let mut stats = StatsLinSol::new();
+        solver.actual.update_stats(&mut stats);
+        assert!(stats.main.solver.starts_with("Auto-KLU"));
+
+        // symmetric (full) matrix
+        let mut solver = SolverAuto::new().unwrap();
+        let (coo, _, _, _) = Samples::mkl_symmetric_5x5_full();
+        let mut mat = SparseMatrix::from_coo(coo);
+        let rhs = Vector::from(&[1.0, 2.0, 3.0, 4.0, 5.0]);
+        let x_correct = &[-979.0 / 3.0, 983.0, 1961.0 / 12.0, 398.0, 123.0 / 2.0];
+        solver.factorize(&mut mat, None).unwrap();
+        assert_eq!(solver.get_genie(), Some(Genie::Klu));
+        solver.solve(&mut x, &mat, &rhs, false).unwrap();
+        vec_approx_eq(&x, x_correct, 1e-10);
+    }
+
+    /// Returns a tridiagonal matrix with a pattern not used by other tests (for the cache tests)
+    fn tridiagonal(ndim: usize) -> SparseMatrix {
+        let mut coo = CooMatrix::new(ndim, ndim, 3 * ndim, Sym::No).unwrap();
+        for i in 0..ndim {
+            coo.put(i, i, 4.0).unwrap();
+            if i > 0 {
+                coo.put(i, i - 1, -1.0).unwrap();
+            }
+            if i < ndim - 1 {
+                coo.put(i, i + 1, -2.0).unwrap();
+            }
+        }
+        SparseMatrix::from_coo(coo)
+    }
+
+    #[test]
+    fn trial_and_cache_work() {
+        // inspection
+        let mut mat = tridiagonal(11);
+        let mut solver = SolverAuto::new().unwrap();
+        solver.factorize(&mut mat, None).unwrap();
+        assert!(!solver.selected_from_cache());
+        assert_eq!(solver.get_genie(), Some(Genie::Klu));
+
+        // same pattern (the values do not matter)
+        let mut solver = SolverAuto::new().unwrap();
+        solver.factorize(&mut mat, None).unwrap();
+        assert!(solver.selected_from_cache());
+
+        // a trial is performed even if a decision by inspection exists
+        let mut params = LinSolParams::new();
+        params.auto_trial = true;
+        let mut solver = SolverAuto::new().unwrap();
+        solver.factorize(&mut mat, Some(params)).unwrap();
+        assert!(!solver.selected_from_cache());
+        let selected = solver.get_genie().unwrap();
+        assert!(selected == Genie::Klu || selected == Genie::Umfpack || selected == Genie::Mumps);
+        let ndim = 11;
+        let x_correct = Vector::filled(ndim, 1.0);
+        let mut rhs = Vector::new(ndim);
+        mat.get_coo().unwrap().mat_vec_mul(&mut rhs, 1.0, &x_correct).unwrap();
+        let mut x = Vector::new(ndim);
+        solver.solve(&mut x, &mat, &rhs, false).unwrap();
+        vec_approx_eq(&x, &x_correct, 1e-14);
+
+        // the trial decision is reused by both modes
+        let mut solver = SolverAuto::new().unwrap();
+        solver.factorize(&mut mat, Some(params)).unwrap();
+        assert!(solver.selected_from_cache());
+        assert_eq!(solver.get_genie(), Some(selected));
+        let mut solver = SolverAuto::new().unwrap();
+        solver.factorize(&mut mat, None).unwrap();
+        assert!(solver.selected_from_cache());
+        assert_eq!(solver.get_genie(), Some(selected));
+
+        // clear the cache
+        SolverAuto::clear_cache();
+        let mut mat = tridiagonal(13);
+        let mut solver = SolverAuto::new().unwrap();
+        solver.factorize(&mut mat, None).unwrap();
+        assert!(!solver.selected_from_cache());
+    }
+}
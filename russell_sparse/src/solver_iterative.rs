@@ -0,0 +1,697 @@
+use super::{krylov_bicgstab, krylov_cg, krylov_gmres, IterativePrecond, KrylovControl, KrylovResult};
+use super::{CsrMatrix, IterativeMethod, LinSolParams, LinSolTrait, LinSolver, Preconditioner};
+use super::{PrecondIc0, PrecondIlu0, SparseMatrix, StatsLinSol, Sym};
+use crate::StrError;
+use russell_lab::{Matrix, Stopwatch, Vector};
+
+/// Implements the preconditioned Krylov iterative solvers (CG, GMRES, BiCGStab)
+///
+/// The iterative solver only requires the matrix in CSR format and the preconditioner; thus, the memory
+/// usage is O(nnz) (with no fill-in), as opposed to the direct solvers. The method and the preconditioner
+/// are selected by [LinSolParams::iterative_method] and [LinSolParams::iterative_preconditioner].
+///
+/// With [Preconditioner::Direct], a direct factorization (e.g., computed in an earlier Newton step) is
+/// used as preconditioner and kept for [LinSolParams::iterative_direct_refresh] calls to `factorize`.
+///
+/// **Note:** `factorize` computes the preconditioner, whereas `solve` runs the Krylov method starting
+/// from `x = 0`. An error is returned if the tolerance is not reached within the max number of iterations.
+pub struct SolverIterative {
+    /// Indicates whether the solver has been initialized or not (just once)
+    initialized: bool,
+
+    /// Indicates whether the sparse matrix has been factorized or not
+    factorized: bool,
+
+    /// Holds the symmetric flag saved in initialize
+    initialized_sym: Sym,
+
+    /// Holds the matrix dimension saved in initialize
+    initialized_ndim: usize,
+
+    /// Holds the number of non-zeros saved in initialize
+    initialized_nnz: usize,
+
+    /// Holds the parameters given to factorize
+    params: LinSolParams,
+
+    /// Holds the preconditioner
+    precond: IterativePrecond,
+
+    /// Holds the transposed CSR matrix (allocated by solve_transposed if the matrix is unsymmetric)
+    csr_transposed: Option<CsrMatrix>,
+
+    /// Holds the number of calls to factorize
+    nfactorize: usize,
+
+    /// Holds the results of the last solve
+    last: KrylovResult,
+
+    /// Holds the number of iterations of all solves
+    total_iterations: usize,
+
+    /// Stopwatch to measure computation times
+    stopwatch: Stopwatch,
+
+    /// Time spent on initialize in nanoseconds
+    time_initialize_ns: u128,
+
+    /// Time spent on factorize in nanoseconds
+    time_factorize_ns: u128,
+
+    /// Time spent on solve in nanoseconds
+    time_solve_ns: u128,
+}
+
+impl SolverIterative {
+    /// Allocates a new instance
+    pub fn new() -> Result<Self, StrError> {
+        Ok(SolverIterative {
+            initialized: false,
+            factorized: false,
+            initialized_sym: Sym::No,
+            initialized_ndim: 0,
+            initialized_nnz: 0,
+            params: LinSolParams::new(),
+            precond: IterativePrecond::No,
+            csr_transposed: None,
+            nfactorize: 0,
+            last: KrylovResult {
+                iterations: 0,
+                relative_residual: 0.0,
+                converged: false,
+            },
+            total_iterations: 0,
+            stopwatch: Stopwatch::new(),
+            time_initialize_ns: 0,
+            time_factorize_ns: 0,
+            time_solve_ns: 0,
+        })
+    }
+
+    /// Returns the number of iterations of the last solve
+    pub fn get_iterations(&self) -> usize {
+        self.last.iterations
+    }
+
+    /// Returns the relative residual norm ‖b - A x‖ / ‖b‖ of the last solve
+    pub fn get_relative_residual(&self) -> f64 {
+        self.last.relative_residual
+    }
+
+    /// Checks the matrix given to solve
+    fn check_matrix<'a>(&self, mat: &'a SparseMatrix) -> Result<&'a CsrMatrix, StrError> {
+        if !self.factorized {
+            return Err("the function factorize must be called before solve");
+        }
+        let csr = mat.get_csr()?;
+        let (nrow, ncol, nnz, sym) = csr.get_info();
+        if sym != self.initialized_sym {
+            return Err("solve must use the same matrix (symmetric differs)");
+        }
+        if nrow != self.initialized_ndim || ncol != self.initialized_ndim {
+            return Err("solve must use the same matrix (ndim differs)");
+        }
+        if nnz != self.initialized_nnz {
+            return Err("solve must use the same matrix (nnz differs)");
+        }
+        Ok(csr)
+    }
+
+    /// Computes the solution of the linear system or of the transposed system
+    fn solve_system(
+        &mut self,
+        x: &mut Vector,
+        mat: &SparseMatrix,
+        rhs: &Vector,
+        transposed: bool,
+        verbose: bool,
+    ) -> Result<(), StrError> {
+        // check
+        let csr = self.check_matrix(mat)?;
+        if x.dim() != self.initialized_ndim {
+            return Err("the dimension of the vector of unknown values x is incorrect");
+        }
+        if rhs.dim() != self.initialized_ndim {
+            return Err("the dimension of the right-hand side vector is incorrect");
+        }
+
+        // the transpose is only needed for unsymmetric matrices
+        let a = if transposed && self.initialized_sym == Sym::No {
+            if self.csr_transposed.is_none() {
+                self.csr_transposed = Some(transpose_csr(csr)?);
+            }
+            self.csr_transposed.as_ref().unwrap()
+        } else {
+            csr
+        };
+
+        // run the Krylov method
+        let ctrl = KrylovControl {
+            tolerance: self.params.iterative_tolerance,
+            max_iterations: self.params.iterative_max_iterations,
+            gmres_restart: self.params.iterative_gmres_restart,
+            transposed,
+            num_threads: self.params.iterative_num_threads,
+        };
+        self.stopwatch.reset();
+        let res = match self.params.iterative_method {
+            IterativeMethod::Cg => krylov_cg(x, a, rhs, &mut self.precond, &ctrl)?,
+            IterativeMethod::Gmres => krylov_gmres(x, a, rhs, &mut self.precond, &ctrl)?,
+            IterativeMethod::BiCgStab => krylov_bicgstab(x, a, rhs, &mut self.precond, &ctrl)?,
+        };
+        self.time_solve_ns = self.stopwatch.stop();
+        self.last = res;
+        self.total_iterations += res.iterations;
+        if verbose {
+            println!(
+                "{:?} with {:?}: {} iterations; relative residual = {:e}",
+                self.params.iterative_method,
+                self.precond.kind(),
+                res.iterations,
+                res.relative_residual
+            );
+        }
+
+        // done
+        if !res.converged {
+            return Err("the iterative solver did not converge");
+        }
+        Ok(())
+    }
+}
+
+impl LinSolTrait for SolverIterative {
+    /// Computes the preconditioner (and checks the matrix)
+    ///
+    /// # Input
+    ///
+    /// * `mat` -- the coefficient matrix A (**COO** or **CSR**, but not CSC).
+    ///   Also, the matrix must be square (`nrow = ncol`). If symmetric, ILU(0) requires [Sym::YesFull]
+    ///   and IC(0) requires [Sym::YesFull] or [Sym::YesLower].
+    /// * `params` -- configuration parameters; None => use default
+    ///
+    /// # Notes
+    ///
+    /// 1. The structure of the matrix (nrow, ncol, nnz, sym) must be
+    ///    exactly the same among multiple calls to `factorize`. The values may differ
+    ///    from call to call, nonetheless.
+    /// 2. The first call to `factorize` will define the structure which must be
+    ///    kept the same for the next calls.
+    /// 3. If the structure of the matrix needs to be changed, the solver must
+    ///    be "dropped" and a new solver allocated.
+    /// 4. With [Preconditioner::Direct], the matrix is copied and factorized by the direct solver
+    ///    selected by [LinSolParams::iterative_direct_genie] (thus, its requirements apply).
+    fn factorize(&mut self, mat: &mut SparseMatrix, params: Option<LinSolParams>) -> Result<(), StrError> {
+        // parameters
+        let par = if let Some(p) = params { p } else { LinSolParams::new() };
+
+        // copy the matrix for the direct solver (before converting to CSR)
+        let refresh_direct = par.iterative_preconditioner == Preconditioner::Direct
+            && (self.precond.kind() != Preconditioner::Direct
+                || (par.iterative_direct_refresh > 0 && self.nfactorize % par.iterative_direct_refresh == 0));
+        let mut direct_mat = if refresh_direct {
+            Some(match mat.get_coo() {
+                Ok(coo) => SparseMatrix::from_coo(coo.clone()),
+                Err(_) => SparseMatrix::from_csr(mat.get_csr()?.clone()),
+            })
+        } else {
+            None
+        };
+
+        // get CSR matrix
+        // (or convert from COO if CSR is not available and COO is available)
+        self.stopwatch.reset();
+        let csr = mat.get_csr_or_from_coo()?;
+        if self.initialized {
+            if csr.symmetric != self.initialized_sym {
+                return Err("subsequent factorizations must use the same matrix (symmetric differs)");
+            }
+            if csr.nrow != self.initialized_ndim {
+                return Err("subsequent factorizations must use the same matrix (ndim differs)");
+            }
+            if (csr.row_pointers[csr.nrow] as usize) != self.initialized_nnz {
+                return Err("subsequent factorizations must use the same matrix (nnz differs)");
+            }
+        } else {
+            if csr.nrow != csr.ncol {
+                return Err("the matrix must be square");
+            }
+            self.initialized_sym = csr.symmetric;
+            self.initialized_ndim = csr.nrow;
+            self.initialized_nnz = csr.row_pointers[csr.nrow] as usize;
+            self.time_initialize_ns = self.stopwatch.stop();
+            self.initialized = true;
+        }
+
+        // compute the preconditioner
+        self.stopwatch.reset();
+        self.precond = match par.iterative_preconditioner {
+            Preconditioner::No => IterativePrecond::No,
+            Preconditioner::Jacobi => IterativePrecond::new_jacobi(csr)?,
+            Preconditioner::Ilu0 => IterativePrecond::Ilu0(PrecondIlu0::new(csr)?),
+            Preconditioner::Ic0 => IterativePrecond::Ic0(PrecondIc0::new(csr)?),
+            Preconditioner::Direct => match direct_mat.as_mut() {
+                Some(dm) => {
+                    let mut solver = LinSolver::new(par.iterative_direct_genie)?;
+                    solver.actual.factorize(dm, Some(par))?;
+                    IterativePrecond::Direct(Box::new((solver, direct_mat.take().unwrap())))
+                }
+                None => std::mem::replace(&mut self.precond, IterativePrecond::No), // keep the previous one
+            },
+        };
+        self.time_factorize_ns = self.stopwatch.stop();
+
+        // done
+        self.csr_transposed = None; // the values may have changed
+        self.params = par;
+        self.nfactorize += 1;
+        self.factorized = true;
+        Ok(())
+    }
+
+    /// Computes the solution of the linear system
+    ///
+    /// Solves the linear system:
+    ///
+    /// ```text
+    ///   A   · x = rhs
+    /// (m,m)  (m)  (m)
+    /// ```
+    ///
+    /// # Output
+    ///
+    /// * `x` -- the vector of unknown values with dimension equal to mat.nrow
+    ///
+    /// # Input
+    ///
+    /// * `mat` -- the coefficient matrix A; must be square.
+    /// * `rhs` -- the right-hand side vector with know values an dimension equal to mat.nrow
+    /// * `verbose` -- shows the number of iterations and the final residual
+    ///
+    /// **Warning:** the matrix must be same one used in `factorize`.
+    fn solve(&mut self, x: &mut Vector, mat: &SparseMatrix, rhs: &Vector, verbose: bool) -> Result<(), StrError> {
+        self.solve_system(x, mat, rhs, false, verbose)
+    }
+
+    /// Computes the solution of the transposed linear system
+    ///
+    /// Solves the linear system:
+    ///
+    /// ```text
+    ///   Aᵀ  · x = rhs
+    /// (m,m)  (m)  (m)
+    /// ```
+    ///
+    /// # Output
+    ///
+    /// * `x` -- the vector of unknown values with dimension equal to mat.nrow
+    ///
+    /// # Input
+    ///
+    /// * `mat` -- the coefficient matrix A; must be square.
+    /// * `rhs` -- the right-hand side vector with know values an dimension equal to mat.nrow
+    /// * `verbose` -- shows the number of iterations and the final residual
+    ///
+    /// **Note:** The preconditioner computed by `factorize` is reused (transposed).
+    /// If the matrix is unsymmetric, the transposed CSR matrix is computed (once) by this function.
+    ///
+    /// **Warning:** the matrix must be same one used in `factorize`.
+    fn solve_transposed(
+        &mut self,
+        x: &mut Vector,
+        mat: &SparseMatrix,
+        rhs: &Vector,
+        verbose: bool,
+    ) -> Result<(), StrError> {
+        self.solve_system(x, mat, rhs, true, verbose)
+    }
+
+    /// Computes the solution of the linear system with multiple right-hand sides
+    ///
+    /// Solves the linear system:
+    ///
+    /// ```text
+    ///   A   ·   X   =  RHS
+    /// (m,m)  (m,k)    (m,k)
+    /// ```
+    ///
+    /// # Output
+    ///
+    /// * `x` -- the matrix of unknown values with nrow equal to mat.nrow and ncol equal to the number of right-hand sides
+    ///
+    /// # Input
+    ///
+    /// * `mat` -- the coefficient matrix A; must be square.
+    /// * `rhs` -- the matrix of right-hand sides; each column corresponds to one right-hand side
+    /// * `verbose` -- shows the number of iterations and the final residual
+    ///
+    /// **Note:** The Krylov method is run for each right-hand side; the stats refer to the last one.
+    ///
+    /// **Warning:** the matrix must be same one used in `factorize`.
+    fn solve_multi(&mut self, x: &mut Matrix, mat: &SparseMatrix, rhs: &Matrix, verbose: bool) -> Result<(), StrError> {
+        // check matrices
+        self.check_matrix(mat)?;
+        if x.nrow() != self.initialized_ndim {
+            return Err("the number of rows of the matrix of unknown values x is incorrect");
+        }
+        if rhs.nrow() != self.initialized_ndim {
+            return Err("the number of rows of the right-hand side matrix is incorrect");
+        }
+        if rhs.ncol() != x.ncol() {
+            return Err("the number of columns of x and rhs must be the same");
+        }
+
+        // solve for each right-hand side
+        let n = self.initialized_ndim;
+        let mut xk = Vector::new(n);
+        let mut ns = 0;
+        for k in 0..rhs.ncol() {
+            let rk = Vector::from(&&rhs.as_data()[(k * n)..((k + 1) * n)]);
+            self.solve_system(&mut xk, mat, &rk, false, verbose)?;
+            x.as_mut_data()[(k * n)..((k + 1) * n)].copy_from_slice(xk.as_data());
+            ns += self.time_solve_ns;
+        }
+        self.time_solve_ns = ns;
+        Ok(())
+    }
+
+    /// Updates the stats structure (should be called after solve)
+    fn update_stats(&self, stats: &mut StatsLinSol) {
+        stats.main.solver = "Iterative".to_string();
+        stats.iterative.method = format!("{:?}", self.params.iterative_method);
+        stats.iterative.preconditioner = format!("{:?}", self.precond.kind());
+        stats.iterative.iterations = self.last.iterations;
+        stats.iterative.total_iterations = self.total_iterations;
+        stats.iterative.relative_residual = self.last.relative_residual;
+        stats.iterative.converged = self.last.converged;
+        stats.time_nanoseconds.initialize = self.time_initialize_ns;
+        stats.time_nanoseconds.factorize = self.time_factorize_ns;
+        stats.time_nanoseconds.solve = self.time_solve_ns;
+    }
+
+    /// Returns the nanoseconds spent on initialize
+    fn get_ns_init(&self) -> u128 {
+        self.time_initialize_ns
+    }
+
+    /// Returns the nanoseconds spent on factorize
+    fn get_ns_fact(&self) -> u128 {
+        self.time_factorize_ns
+    }
+
+    /// Returns the nanoseconds spent on solve
+    fn get_ns_solve(&self) -> u128 {
+        self.time_solve_ns
+    }
+}
+
+/// Computes the transpose of a CSR matrix (the column indices of the result are sorted)
+fn transpose_csr(csr: &CsrMatrix) -> Result<CsrMatrix, StrError> {
+    let (nrow, ncol, nnz, sym) = csr.get_info();
+    let mut row_pointers = vec![0_i32; ncol + 1];
+    for p in 0..nnz {
+        row_pointers[csr.col_indices[p] as usize + 1] += 1;
+    }
+    for j in 0..ncol {
+        row_pointers[j + 1] += row_pointers[j];
+    }
+    let mut next: Vec<usize> = row_pointers[..ncol].iter().map(|&p| p as usize).collect();
+    let mut col_indices = vec![0_i32; nnz];
+    let mut values = vec![0.0; nnz];
+    for i in 0..nrow {
+        for p in csr.row_pointers[i]..csr.row_pointers[i + 1] {
+            let j = csr.col_indices[p as usize] as usize;
+            col_indices[next[j]] = i as i32;
+            values[next[j]] = csr.values[p as usize];
+            next[j] += 1;
+        }
+    }
+    CsrMatrix::new(ncol, nrow, row_pointers, col_indices, values, sym)
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#[cfg(test)]
+mod tests {
+    use super::{transpose_csr, SolverIterative};
+    use crate::{CooMatrix, IterativeMethod, LinSolParams, LinSolTrait, LinSolver, Preconditioner};
+    use crate::{Genie, Samples, SparseMatrix, StatsLinSol, Sym};
+    use russell_lab::{mat_approx_eq, vec_approx_eq, Matrix, Vector};
+
+    /// Returns the 2D Laplacian on a (m x m) grid (symmetric positive-definite if diagonal ≥ 4)
+    fn laplacian_2d(m: usize, sym: Sym, diagonal: f64) -> SparseMatrix {
+        let n = m * m;
+        let mut coo = CooMatrix::new(n, n, 5 * n, sym).unwrap();
+        for r in 0..m {
+            for c in 0..m {
+                let i = r * m + c;
+                coo.put(i, i, diagonal).unwrap();
+                let mut neighbor = |j: usize| {
+                    if sym != Sym::YesLower || j < i {
+                        coo.put(i, j, -1.0).unwrap();
+                    }
+                };
+                if r > 0 {
+                    neighbor(i - m);
+                }
+                if r + 1 < m {
+                    neighbor(i + m);
+                }
+                if c > 0 {
+                    neighbor(i - 1);
+                }
+                if c + 1 < m {
+                    neighbor(i + 1);
+                }
+            }
+        }
+        SparseMatrix::from_coo(coo)
+    }
+
+    #[test]
+    fn transpose_csr_works() {
+        let (_, _, csr, _) = Samples::rectangular_3x4();
+        let csr_t = transpose_csr(&csr).unwrap();
+        assert_eq!(csr_t.get_info(), (4, 3, csr.get_info().2, Sym::No));
+        let a = csr.as_dense();
+        let at = csr_t.as_dense();
+        for i in 0..3 {
+            for j in 0..4 {
+                assert_eq!(at.get(j, i), a.get(i, j));
+            }
+        }
+    }
+
+    #[test]
+    fn factorize_captures_errors() {
+        let mut solver = SolverIterative::new().unwrap();
+        let (coo, _, _, _) = Samples::rectangular_3x4();
+        let mut mat = SparseMatrix::from_coo(coo);
+        assert_eq!(
+            solver.factorize(&mut mat, None).err(),
+            Some("the matrix must be square")
+        );
+        let (coo, _, _, _) = Samples::mkl_symmetric_5x5_lower(false, false);
+        let mut mat = SparseMatrix::from_coo(coo);
+        assert_eq!(
+            solver.factorize(&mut mat, None).err(),
+            Some("ILU(0) requires Sym::No or Sym::YesFull")
+        );
+        let mut solver = SolverIterative::new().unwrap();
+        let (coo, _, _, _) = Samples::mkl_unsymmetric_5x5();
+        let mut mat = SparseMatrix::from_coo(coo);
+        solver.factorize(&mut mat, None).unwrap();
+        let (coo, _, _, _) = Samples::umfpack_unsymmetric_5x5();
+        let mut mat = SparseMatrix::from_coo(coo);
+        assert_eq!(
+            solver.factorize(&mut mat, None).err(),
+            Some("subsequent factorizations must use the same matrix (nnz differs)")
+        );
+    }
+
+    #[test]
+    fn solve_captures_errors() {
+        let mut solver = SolverIterative::new().unwrap();
+        let (coo, _, _, _) = Samples::mkl_unsymmetric_5x5();
+        let mut mat = SparseMatrix::from_coo(coo);
+        let mut x = Vector::new(5);
+        let rhs = Vector::new(5);
+        assert_eq!(
+            solver.solve(&mut x, &mat, &rhs, false).err(),
+            Some("the function factorize must be called before solve")
+        );
+        solver.factorize(&mut mat, None).unwrap();
+        let mut x_wrong = Vector::new(4);
+        let rhs_wrong = Vector::new(4);
+        assert_eq!(
+            solver.solve(&mut x_wrong, &mat, &rhs, false).err(),
+            Some("the dimension of the vector of unknown values x is incorrect")
+        );
+        assert_eq!(
+            solver.solve(&mut x, &mat, &rhs_wrong, false).err(),
+            Some("the dimension of the right-hand side vector is incorrect")
+        );
+        let (coo, _, _, _) = Samples::umfpack_unsymmetric_5x5();
+        let mut other = SparseMatrix::from_coo(coo);
+        other.get_csr_or_from_coo().unwrap();
+        assert_eq!(
+            solver.solve(&mut x, &other, &rhs, false).err(),
+            Some("solve must use the same matrix (nnz differs)")
+        );
+        // no convergence
+        let mut params = LinSolParams::new();
+        params.iterative_preconditioner = Preconditioner::No;
+        params.iterative_max_iterations = 1;
+        solver.factorize(&mut mat, Some(params)).unwrap();
+        let rhs = Vector::from(&[-13.0, 8.0, 56.0, 30.0, -9.0]);
+        assert_eq!(
+            solver.solve(&mut x, &mat, &rhs, false).err(),
+            Some("the iterative solver did not converge")
+        );
+        assert_eq!(solver.get_iterations(), 1);
+        assert!(solver.get_relative_residual() > 1e-10);
+    }
+
+    #[test]
+    fn solve_works() {
+        let (coo, _, _, _) = Samples::mkl_unsymmetric_5x5();
+        let mut mat = SparseMatrix::from_coo(coo);
+        let rhs = Vector::from(&[-13.0, 8.0, 56.0, 30.0, -9.0]);
+        let x_correct = &[1.0, 2.0, 3.0, 4.0, 5.0];
+        let mut x = Vector::new(5);
+        for method in [IterativeMethod::Gmres, IterativeMethod::BiCgStab] {
+            for preconditioner in [
+                Preconditioner::No,
+                Preconditioner::Jacobi,
+                Preconditioner::Ilu0,
+                Preconditioner::Direct,
+            ] {
+                let mut params = LinSolParams::new();
+                params.iterative_method = method;
+                params.iterative_preconditioner = preconditioner;
+                params.iterative_num_threads = 2;
+                let mut solver = SolverIterative::new().unwrap();
+                solver.factorize(&mut mat, Some(params)).unwrap();
+                solver.solve(&mut x, &mat, &rhs, false).unwrap();
+                vec_approx_eq(&x, x_correct, 1e-9);
+                // transposed
+                let mut rhs_t = Vector::new(5);
+                let csr = mat.get_csr().unwrap();
+                let mut coo_t = CooMatrix::new(5, 5, csr.get_info().2, Sym::No).unwrap();
+                let a = csr.as_dense();
+                for i in 0..5 {
+                    for j in 0..5 {
+                        if a.get(i, j) != 0.0 {
+                            coo_t.put(j, i, a.get(i, j)).unwrap();
+                        }
+                    }
+                }
+                coo_t.mat_vec_mul(&mut rhs_t, 1.0, &Vector::from(x_correct)).unwrap();
+                solver.solve_transposed(&mut x, &mat, &rhs_t, false).unwrap();
+                vec_approx_eq(&x, x_correct, 1e-9);
+            }
+        }
+    }
+
+    #[test]
+    fn solve_symmetric_works() {
+        let m = 8;
+        let n = m * m;
+        let x_correct = Vector::initialized(n, |i| 1.0 + 0.1 * (i as f64));
+        for (sym, preconditioner) in [
+            (Sym::YesFull, Preconditioner::Ic0),
+            (Sym::YesLower, Preconditioner::Ic0),
+            (Sym::YesLower, Preconditioner::Jacobi),
+            (Sym::YesFull, Preconditioner::Ilu0),
+        ] {
+            let mut mat = laplacian_2d(m, sym, 4.0);
+            let mut rhs = Vector::new(n);
+            mat.mat_vec_mul(&mut rhs, 1.0, &x_correct).unwrap();
+            let mut iterations = Vec::new();
+            for method in [IterativeMethod::Cg, IterativeMethod::Gmres, IterativeMethod::BiCgStab] {
+                let mut params = LinSolParams::new();
+                params.iterative_method = method;
+                params.iterative_preconditioner = preconditioner;
+                let mut solver = SolverIterative::new().unwrap();
+                solver.factorize(&mut mat, Some(params)).unwrap();
+                let mut x = Vector::new(n);
+                solver.solve(&mut x, &mat, &rhs, false).unwrap();
+                vec_approx_eq(&x, x_correct.as_data(), 1e-8);
+                iterations.push(solver.get_iterations());
+            }
+            // the preconditioned methods need much fewer iterations than n
+            assert!(iterations.iter().all(|&it| it < n / 2));
+        }
+    }
+
+    #[test]
+    fn direct_preconditioner_is_reused() {
+        let m = 6;
+        let n = m * m;
+        let mut mat = laplacian_2d(m, Sym::YesFull, 4.0);
+        let rhs = Vector::filled(n, 1.0);
+        let mut params = LinSolParams::new();
+        params.iterative_preconditioner = Preconditioner::Direct;
+        params.iterative_direct_genie = Genie::Umfpack;
+        params.iterative_direct_refresh = 0; // keep the first factorization
+        let mut solver = SolverIterative::new().unwrap();
+        solver.factorize(&mut mat, Some(params)).unwrap();
+        let mut x = Vector::new(n);
+        solver.solve(&mut x, &mat, &rhs, false).unwrap();
+        assert_eq!(solver.get_iterations(), 1); // exact preconditioner
+
+        // change the values (e.g., next Newton iteration) but keep the structure
+        let mut mat = laplacian_2d(m, Sym::YesFull, 4.5);
+        solver.factorize(&mut mat, Some(params)).unwrap();
+        let mut x_new = Vector::new(n);
+        solver.solve(&mut x_new, &mat, &rhs, false).unwrap();
+        assert!(solver.get_iterations() > 1); // outdated preconditioner
+        let mut ax = Vector::new(n);
+        mat.mat_vec_mul(&mut ax, 1.0, &x_new).unwrap();
+        vec_approx_eq(&ax, rhs.as_data(), 1e-9);
+
+        // refresh in every call
+        params.iterative_direct_refresh = 1;
+        solver.factorize(&mut mat, Some(params)).unwrap();
+        solver.solve(&mut x_new, &mat, &rhs, false).unwrap();
+        assert_eq!(solver.get_iterations(), 1);
+    }
+
+    #[test]
+    fn solve_multi_works() {
+        let (coo, _, _, _) = Samples::mkl_unsymmetric_5x5();
+        let mut mat = SparseMatrix::from_coo(coo);
+        let mut solver = LinSolver::new(Genie::Iterative).unwrap();
+        solver.actual.factorize(&mut mat, None).unwrap();
+        let mut x = Matrix::new(5, 2);
+        let rhs = Matrix::from(&[
+            [-13.0, -3.0], //
+            [8.0, 3.0],    //
+            [56.0, 14.0],  //
+            [30.0, 5.0],   //
+            [-9.0, 3.0],   //
+        ]);
+        let x_correct = Matrix::from(&[
+            [1.0, 1.0], //
+            [2.0, 1.0], //
+            [3.0, 1.0], //
+            [4.0, 1.0], //
+            [5.0, 1.0], //
+        ]);
+        solver.actual.solve_multi(&mut x, &mat, &rhs, false).unwrap();
+        mat_approx_eq(&x, &x_correct, 1e-9);
+        let mut wrong = Matrix::new(5, 3);
+        assert_eq!(
+            solver.actual.solve_multi(&mut wrong, &mat, &rhs, false).err(),
+            Some("the number of columns of x and rhs must be the same")
+        );
+        let mut stats = StatsLinSol::new();
+        solver.actual.update_stats(&mut stats);
+        assert_eq!(stats.main.solver, "Iterative");
+        assert_eq!(stats.iterative.method, "Gmres");
+        assert_eq!(stats.iterative.preconditioner, "Ilu0");
+        assert!(stats.iterative.converged);
+        assert!(stats.iterative.iterations > 0);
+        assert!(stats.iterative.total_iterations >= stats.iterative.iterations);
+    }
+}
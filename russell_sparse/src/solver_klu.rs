@@ -1,7 +1,10 @@
-use super::{LinSolParams, LinSolTrait, Ordering, Scaling, SparseMatrix, StatsLinSol, Sym};
+use super::{
+    CscMatrix, Genie, LinSolParams, LinSolTrait, Ordering, Scaling, SparseMatrix, StatsLinSol, StatsLinSolFactors, Sym,
+    SymbolicAnalysis,
+};
 use crate::constants::*;
 use crate::StrError;
-use russell_lab::{vec_copy, Stopwatch, Vector};
+use russell_lab::{mat_copy, vec_copy, Matrix, Stopwatch, Vector};
 
 /// Opaque struct holding a C-pointer to InterfaceKLU
 ///
@@ -29,21 +32,47 @@ extern "C" {
         solver: *mut InterfaceKLU,
         ordering: i32,
         scaling: i32,
+        row_permutation: *const i32,
+        col_permutation: *const i32,
         ndim: i32,
         col_pointers: *const i32,
         row_indices: *const i32,
     ) -> i32;
+    fn solver_klu_get_ordering(
+        solver: *mut InterfaceKLU,
+        ndim: i32,
+        row_permutation: *mut i32,
+        col_permutation: *mut i32,
+    ) -> i32;
     fn solver_klu_factorize(
         solver: *mut InterfaceKLU,
         effective_ordering: *mut i32,
         effective_scaling: *mut i32,
         cond_estimate: *mut f64,
         compute_cond: CcBool,
+        refactorized: *mut CcBool,
+        use_refactor: CcBool,
+        refactor_min_rgrowth: f64,
+        refactor_min_rcond: f64,
         col_pointers: *const i32,
         row_indices: *const i32,
         values: *const f64,
     ) -> i32;
-    fn solver_klu_solve(solver: *mut InterfaceKLU, ndim: i32, in_rhs_out_x: *mut f64) -> i32;
+    fn solver_klu_get_factors_info(solver: *mut InterfaceKLU, factors_info: *mut StatsLinSolFactors) -> i32;
+    fn solver_klu_btf_probe(
+        num_blocks: *mut i32,
+        max_block_size: *mut i32,
+        ndim: i32,
+        col_pointers: *const i32,
+        row_indices: *const i32,
+    ) -> i32;
+    fn solver_klu_solve(
+        solver: *mut InterfaceKLU,
+        ndim: i32,
+        nrhs: i32,
+        transposed: CcBool,
+        in_rhs_out_x: *mut f64,
+    ) -> i32;
 }
 
 /// Wraps the KLU solver for sparse linear systems
@@ -77,6 +106,18 @@ pub struct SolverKLU {
     /// Holds the 1-norm condition number estimate (after factorize)
     cond_estimate: f64,
 
+    /// Indicates whether the last factorization has reused the previous pivot sequence (klu_refactor)
+    refactorized: CcBool,
+
+    /// Holds the ordering computed by (or given to) the symbolic analysis
+    symbolic_analysis: Option<SymbolicAnalysis>,
+
+    /// Holds the fill-in, flop count, and memory usage of the last factorization
+    factors_info: StatsLinSolFactors,
+
+    /// Time spent on the COO to CSC conversion (in factorize)
+    time_convert_ns: u128,
+
     /// Stopwatch to measure computation times
     stopwatch: Stopwatch,
 
@@ -117,6 +158,10 @@ impl SolverKLU {
                 effective_ordering: -1,
                 effective_scaling: -1,
                 cond_estimate: 0.0,
+                refactorized: 0,
+                symbolic_analysis: None,
+                factors_info: StatsLinSolFactors::default(),
+                time_convert_ns: 0,
                 stopwatch: Stopwatch::new(),
                 time_initialize_ns: 0,
                 time_factorize_ns: 0,
@@ -124,6 +169,61 @@ impl SolverKLU {
             })
         }
     }
+
+    /// Computes the solution of the linear system or of the transposed system
+    fn solve_system(
+        &mut self,
+        x: &mut Vector,
+        mat: &SparseMatrix,
+        rhs: &Vector,
+        transposed: bool,
+        _verbose: bool,
+    ) -> Result<(), StrError> {
+        // check
+        if !self.factorized {
+            return Err("the function factorize must be called before solve");
+        }
+
+        // access CSC matrix
+        // (possibly already converted from COO, because factorize was (should have been) called)
+        let csc = mat.get_csc()?;
+
+        // check already factorized data
+        let (nrow, ncol, nnz, sym) = csc.get_info();
+        if sym != self.initialized_sym {
+            return Err("solve must use the same matrix (symmetric differs)");
+        }
+        if nrow != self.initialized_ndim || ncol != self.initialized_ndim {
+            return Err("solve must use the same matrix (ndim differs)");
+        }
+        if nnz != self.initialized_nnz {
+            return Err("solve must use the same matrix (nnz differs)");
+        }
+
+        // check vectors
+        if x.dim() != self.initialized_ndim {
+            return Err("the dimension of the vector of unknown values x is incorrect");
+        }
+        if rhs.dim() != self.initialized_ndim {
+            return Err("the dimension of the right-hand side vector is incorrect");
+        }
+
+        // call KLU solve
+        let ndim = to_i32(self.initialized_ndim);
+        let trans = if transposed { 1 } else { 0 };
+        vec_copy(x, rhs).unwrap();
+        self.stopwatch.reset();
+        unsafe {
+            let status = solver_klu_solve(self.solver, ndim, 1, trans, x.as_mut_data().as_mut_ptr());
+            if status != SUCCESSFUL_EXIT {
+                return Err(handle_klu_error_code(status));
+            }
+        }
+        self.time_solve_ns = self.stopwatch.stop();
+
+        // done
+        Ok(())
+    }
 }
 
 impl LinSolTrait for SolverKLU {
@@ -146,10 +246,15 @@ impl LinSolTrait for SolverKLU {
     /// 3. If the structure of the matrix needs to be changed, the solver must
     ///    be "dropped" and a new solver allocated.
     /// 4. For symmetric matrices, `KLU` requires [Sym::YesFull]
+    /// 5. If [LinSolParams::klu_use_refactor] is set, the subsequent calls to `factorize` will
+    ///    reuse the previous pivot sequence (klu_refactor) unless the pivot growth or condition
+    ///    number checks fail, in which case a full factorization is performed.
     fn factorize(&mut self, mat: &mut SparseMatrix, params: Option<LinSolParams>) -> Result<(), StrError> {
         // get CSC matrix
         // (or convert from COO if CSC is not available and COO is available)
+        self.stopwatch.reset();
         let csc = mat.get_csc_or_from_coo()?;
+        self.time_convert_ns = self.stopwatch.stop();
 
         // check
         if self.initialized {
@@ -183,18 +288,28 @@ impl LinSolTrait for SolverKLU {
 
         // requests
         let compute_cond = if par.compute_condition_numbers { 1 } else { 0 };
+        let use_refactor = if par.klu_use_refactor { 1 } else { 0 };
 
         // matrix config
         let ndim = to_i32(csc.nrow);
 
         // call initialize just once
         if !self.initialized {
+            let (row_perm, col_perm) = match &self.symbolic_analysis {
+                Some(analysis) => {
+                    analysis.validate(Genie::Klu, csc.nrow, self.initialized_nnz, csc.symmetric)?;
+                    (analysis.row_permutation.as_ptr(), analysis.col_permutation.as_ptr())
+                }
+                None => (std::ptr::null(), std::ptr::null()),
+            };
             self.stopwatch.reset();
             unsafe {
                 let status = solver_klu_initialize(
                     self.solver,
                     ordering,
                     scaling,
+                    row_perm,
+                    col_perm,
                     ndim,
                     csc.col_pointers.as_ptr(),
                     csc.row_indices.as_ptr(),
@@ -205,6 +320,29 @@ impl LinSolTrait for SolverKLU {
             }
             self.time_initialize_ns = self.stopwatch.stop();
             self.initialized = true;
+            if self.symbolic_analysis.is_none() {
+                let mut row_permutation = vec![0; csc.nrow];
+                let mut col_permutation = vec![0; csc.nrow];
+                unsafe {
+                    let status = solver_klu_get_ordering(
+                        self.solver,
+                        ndim,
+                        row_permutation.as_mut_ptr(),
+                        col_permutation.as_mut_ptr(),
+                    );
+                    if status != SUCCESSFUL_EXIT {
+                        return Err(handle_klu_error_code(status));
+                    }
+                }
+                self.symbolic_analysis = Some(SymbolicAnalysis {
+                    genie: Genie::Klu,
+                    symmetric: csc.symmetric,
+                    ndim: csc.nrow,
+                    nnz: self.initialized_nnz,
+                    row_permutation,
+                    col_permutation,
+                });
+            }
         }
 
         // call factorize
@@ -216,6 +354,10 @@ impl LinSolTrait for SolverKLU {
                 &mut self.effective_scaling,
                 &mut self.cond_estimate,
                 compute_cond,
+                &mut self.refactorized,
+                use_refactor,
+                par.klu_refactor_min_rgrowth,
+                par.klu_refactor_min_rcond,
                 csc.col_pointers.as_ptr(),
                 csc.row_indices.as_ptr(),
                 csc.values.as_ptr(),
@@ -226,6 +368,14 @@ impl LinSolTrait for SolverKLU {
         }
         self.time_factorize_ns = self.stopwatch.stop();
 
+        // get the fill-in, flop count, and memory usage
+        unsafe {
+            let status = solver_klu_get_factors_info(self.solver, &mut self.factors_info);
+            if status != SUCCESSFUL_EXIT {
+                return Err(handle_klu_error_code(status));
+            }
+        }
+
         // done
         self.factorized = true;
         Ok(())
@@ -251,7 +401,73 @@ impl LinSolTrait for SolverKLU {
     /// * `verbose` -- NOT AVAILABLE
     ///
     /// **Warning:** the matrix must be same one used in `factorize`.
-    fn solve(&mut self, x: &mut Vector, mat: &SparseMatrix, rhs: &Vector, _verbose: bool) -> Result<(), StrError> {
+    fn solve(&mut self, x: &mut Vector, mat: &SparseMatrix, rhs: &Vector, verbose: bool) -> Result<(), StrError> {
+        self.solve_system(x, mat, rhs, false, verbose)
+    }
+
+    /// Computes the solution of the transposed linear system
+    ///
+    /// Solves the linear system:
+    ///
+    /// ```text
+    ///   Aᵀ  · x = rhs
+    /// (m,m)  (m)  (m)
+    /// ```
+    ///
+    /// # Output
+    ///
+    /// * `x` -- the vector of unknown values with dimension equal to mat.nrow
+    ///
+    /// # Input
+    ///
+    /// * `mat` -- the coefficient matrix A; must be square and, if symmetric, [Sym::YesFull].
+    /// * `rhs` -- the right-hand side vector with know values an dimension equal to mat.nrow
+    /// * `verbose` -- NOT AVAILABLE
+    ///
+    /// **Note:** The factorization computed by `factorize` is reused (no new factorization is needed).
+    ///
+    /// **Warning:** the matrix must be same one used in `factorize`.
+    fn solve_transposed(
+        &mut self,
+        x: &mut Vector,
+        mat: &SparseMatrix,
+        rhs: &Vector,
+        verbose: bool,
+    ) -> Result<(), StrError> {
+        self.solve_system(x, mat, rhs, true, verbose)
+    }
+
+    /// Computes the solution of the linear system with multiple right-hand sides
+    ///
+    /// Solves the linear system:
+    ///
+    /// ```text
+    ///   A   ·   X   =  RHS
+    /// (m,m)  (m,k)    (m,k)
+    /// ```
+    ///
+    /// # Output
+    ///
+    /// * `x` -- the (col-major) matrix of unknown values with nrow equal to mat.nrow and ncol equal to the number of right-hand sides
+    ///
+    /// # Input
+    ///
+    /// * `mat` -- the coefficient matrix A; must be square and, if symmetric, [Sym::YesFull].
+    /// * `rhs` -- the matrix of right-hand sides; each column corresponds to one right-hand side
+    /// * `verbose` -- NOT AVAILABLE
+    ///
+    /// # Notes
+    ///
+    /// 1. All right-hand sides are passed to KLU in a single call (nrhs = rhs.ncol).
+    ///
+    /// **Warning:** the matrix must be same one used in `factorize`.
+    fn solve_multi(
+        &mut self,
+        x: &mut Matrix,
+        mat: &SparseMatrix,
+        rhs: &Matrix,
+        _verbose: bool,
+    ) -> Result<(), StrError> {
         // check
         if !self.factorized {
             return Err("the function factorize must be called before solve");
@@ -273,20 +489,24 @@ impl LinSolTrait for SolverKLU {
             return Err("solve must use the same matrix (nnz differs)");
         }
 
-        // check vectors
-        if x.dim() != self.initialized_ndim {
-            return Err("the dimension of the vector of unknown values x is incorrect");
+        // check matrices
+        if x.nrow() != self.initialized_ndim {
+            return Err("the number of rows of the matrix of unknown values x is incorrect");
         }
-        if rhs.dim() != self.initialized_ndim {
-            return Err("the dimension of the right-hand side vector is incorrect");
+        if rhs.nrow() != self.initialized_ndim {
+            return Err("the number of rows of the right-hand side matrix is incorrect");
+        }
+        if rhs.ncol() != x.ncol() {
+            return Err("the number of columns of x and rhs must be the same");
         }
 
         // call KLU solve
         let ndim = to_i32(self.initialized_ndim);
-        vec_copy(x, rhs).unwrap();
+        let nrhs = to_i32(rhs.ncol());
+        mat_copy(x, rhs).unwrap();
         self.stopwatch.reset();
         unsafe {
-            let status = solver_klu_solve(self.solver, ndim, x.as_mut_data().as_mut_ptr());
+            let status = solver_klu_solve(self.solver, ndim, nrhs, 0, x.as_mut_data().as_mut_ptr());
             if status != SUCCESSFUL_EXIT {
                 return Err(handle_klu_error_code(status));
             }
@@ -319,6 +539,8 @@ impl LinSolTrait for SolverKLU {
         stats.time_nanoseconds.initialize = self.time_initialize_ns;
         stats.time_nanoseconds.factorize = self.time_factorize_ns;
         stats.time_nanoseconds.solve = self.time_solve_ns;
+        stats.time_nanoseconds.convert_matrix = self.time_convert_ns;
+        stats.factors = self.factors_info;
     }
 
     /// Returns the nanoseconds spent on initialize
@@ -335,6 +557,23 @@ impl LinSolTrait for SolverKLU {
     fn get_ns_solve(&self) -> u128 {
         self.time_solve_ns
     }
+
+    /// Returns the row and column permutations computed by (or given to) the symbolic analysis
+    fn get_symbolic_analysis(&self) -> Option<&SymbolicAnalysis> {
+        self.symbolic_analysis.as_ref()
+    }
+
+    /// Sets the row and column permutations to be given to `klu_analyze_given` (must be called before factorize)
+    fn set_symbolic_analysis(&mut self, analysis: &SymbolicAnalysis) -> Result<(), StrError> {
+        if self.initialized {
+            return Err("the symbolic analysis must be set before the first factorization");
+        }
+        if analysis.genie != Genie::Klu {
+            return Err("the symbolic analysis has been computed by another solver");
+        }
+        self.symbolic_analysis = Some(analysis.clone());
+        Ok(())
+    }
 }
 
 pub(crate) const KLU_ORDERING_AUTO: i32 = -10; // (code defined here) use defaults
@@ -378,6 +617,30 @@ pub(crate) fn klu_scaling(scaling: Scaling) -> i32 {
     }
 }
 
+/// Computes the number of diagonal blocks and the largest block size of the block triangular form (BTF)
+///
+/// **Note:** This function calls klu_analyze only; i.e., the matrix is not factorized.
+pub(crate) fn klu_btf_probe(csc: &CscMatrix) -> Result<(usize, usize), StrError> {
+    if csc.nrow != csc.ncol {
+        return Err("the matrix must be square");
+    }
+    let mut num_blocks: i32 = 0;
+    let mut max_block_size: i32 = 0;
+    unsafe {
+        let status = solver_klu_btf_probe(
+            &mut num_blocks,
+            &mut max_block_size,
+            to_i32(csc.nrow),
+            csc.col_pointers.as_ptr(),
+            csc.row_indices.as_ptr(),
+        );
+        if status != SUCCESSFUL_EXIT {
+            return Err(handle_klu_error_code(status));
+        }
+    }
+    Ok((num_blocks as usize, max_block_size as usize))
+}
+
 /// Handles KLU error code
 pub(crate) fn handle_klu_error_code(err: i32) -> StrError {
     match err {
@@ -401,7 +664,7 @@ pub(crate) fn handle_klu_error_code(err: i32) -> StrError {
 mod tests {
     use super::*;
     use crate::{CooMatrix, Samples};
-    use russell_lab::vec_approx_eq;
+    use russell_lab::{mat_approx_eq, vec_approx_eq};
 
     #[test]
     fn new_and_drop_work() {
@@ -491,6 +754,46 @@ mod tests {
         solver.factorize(&mut mat, Some(params)).unwrap();
     }
 
+    #[test]
+    fn factorize_with_refactor_works() {
+        let mut solver = SolverKLU::new().unwrap();
+        let mut mat = SparseMatrix::new_coo(2, 2, 3, Sym::No).unwrap();
+        mat.put(0, 0, 2.0).unwrap();
+        mat.put(0, 1, 1.0).unwrap();
+        mat.put(1, 1, 4.0).unwrap();
+        let mut params = LinSolParams::new();
+        params.klu_use_refactor = true;
+
+        // the first call performs the full factorization
+        solver.factorize(&mut mat, Some(params)).unwrap();
+        assert_eq!(solver.refactorized, 0);
+
+        // the subsequent calls reuse the pivot sequence
+        mat.reset().unwrap();
+        mat.put(0, 0, 4.0).unwrap();
+        mat.put(0, 1, 2.0).unwrap();
+        mat.put(1, 1, 5.0).unwrap();
+        solver.factorize(&mut mat, Some(params)).unwrap();
+        assert_eq!(solver.refactorized, 1);
+        let mut x = Vector::new(2);
+        let rhs = Vector::from(&[8.0, 10.0]);
+        solver.solve(&mut x, &mat, &rhs, false).unwrap();
+        vec_approx_eq(&x, &[1.0, 2.0], 1e-15);
+
+        // the checks fail and the full factorization is performed
+        params.klu_refactor_min_rcond = 2.0; // rcond ≤ 1
+        solver.factorize(&mut mat, Some(params)).unwrap();
+        assert_eq!(solver.refactorized, 0);
+        solver.solve(&mut x, &mat, &rhs, false).unwrap();
+        vec_approx_eq(&x, &[1.0, 2.0], 1e-15);
+
+        // refactor is disabled
+        params.klu_use_refactor = false;
+        params.klu_refactor_min_rcond = 0.0;
+        solver.factorize(&mut mat, Some(params)).unwrap();
+        assert_eq!(solver.refactorized, 0);
+    }
+
     #[test]
     fn factorize_fails_on_singular_matrix() {
         let mut solver = SolverKLU::new().unwrap();
@@ -587,6 +890,73 @@ mod tests {
         solver.update_stats(&mut stats);
         assert_eq!(stats.output.effective_ordering, "Amd");
         assert_eq!(stats.output.effective_scaling, "Max");
+        let (_, _, nnz, _) = mat.get_csc().unwrap().get_info();
+        assert_eq!(stats.factors.nnz_a, nnz as i64);
+        assert_eq!(stats.factors.nnz_factors, stats.factors.nnz_l + stats.factors.nnz_u);
+        assert!(stats.factors.nnz_factors > 0);
+        assert!(stats.factors.fill_in_ratio > 0.0);
+        assert!(stats.factors.flops_elimination > 0.0);
+        assert!(stats.factors.memory_peak_mb > 0.0);
+    }
+
+    #[test]
+    fn solve_multi_works() {
+        let mut solver = SolverKLU::new().unwrap();
+        let (coo, _, _, _) = Samples::umfpack_unsymmetric_5x5();
+        let mut mat = SparseMatrix::from_coo(coo);
+        let mut x = Matrix::new(5, 2);
+        let rhs = Matrix::from(&[
+            [8.0, 5.0],   //
+            [45.0, 13.0], //
+            [-3.0, -2.0], //
+            [3.0, 1.0],   //
+            [19.0, 7.0],  //
+        ]);
+        let x_correct = &[
+            [1.0, 1.0], //
+            [2.0, 1.0], //
+            [3.0, 1.0], //
+            [4.0, 1.0], //
+            [5.0, 1.0], //
+        ];
+        solver.factorize(&mut mat, None).unwrap();
+        solver.solve_multi(&mut x, &mat, &rhs, false).unwrap();
+        mat_approx_eq(&x, x_correct, 1e-14);
+
+        // errors
+        let mut x_wrong = Matrix::new(4, 2);
+        assert_eq!(
+            solver.solve_multi(&mut x_wrong, &mat, &rhs, false).err(),
+            Some("the number of rows of the matrix of unknown values x is incorrect")
+        );
+        let rhs_wrong = Matrix::new(4, 2);
+        assert_eq!(
+            solver.solve_multi(&mut x, &mat, &rhs_wrong, false).err(),
+            Some("the number of rows of the right-hand side matrix is incorrect")
+        );
+        let rhs_wrong = Matrix::new(5, 3);
+        assert_eq!(
+            solver.solve_multi(&mut x, &mat, &rhs_wrong, false).err(),
+            Some("the number of columns of x and rhs must be the same")
+        );
+    }
+
+    #[test]
+    fn solve_transposed_works() {
+        let mut solver = SolverKLU::new().unwrap();
+        let (coo, _, _, _) = Samples::umfpack_unsymmetric_5x5();
+        let mut mat = SparseMatrix::from_coo(coo);
+        let mut x = Vector::new(5);
+        let rhs = Vector::from(&[8.0, 20.0, 13.0, 6.0, 17.0]);
+        let x_correct = &[1.0, 2.0, 3.0, 4.0, 5.0];
+        solver.factorize(&mut mat, None).unwrap();
+        solver.solve_transposed(&mut x, &mat, &rhs, false).unwrap();
+        vec_approx_eq(&x, x_correct, 1e-14);
+
+        // the same factorization still solves the original system
+        let rhs = Vector::from(&[8.0, 45.0, -3.0, 3.0, 19.0]);
+        solver.solve(&mut x, &mat, &rhs, false).unwrap();
+        vec_approx_eq(&x, x_correct, 1e-14);
     }
 
     #[test]
@@ -643,6 +1013,16 @@ mod tests {
         assert_eq!(klu_scaling(Scaling::Sum), KLU_SCALE_SUM);
     }
 
+    #[test]
+    fn klu_btf_probe_works() {
+        let (_, csc, _, _) = Samples::umfpack_unsymmetric_5x5();
+        let (num_blocks, max_block_size) = klu_btf_probe(&csc).unwrap();
+        assert!(num_blocks >= 1 && num_blocks <= 5);
+        assert!(max_block_size >= 1 && max_block_size <= 5);
+        let (_, csc, _, _) = Samples::rectangular_3x4();
+        assert_eq!(klu_btf_probe(&csc).err(), Some("the matrix must be square"));
+    }
+
     #[test]
     fn handle_klu_error_code_works() {
         let default = "Error: unknown error returned by c-code (KLU)";
@@ -1,7 +1,10 @@
-use super::{LinSolParams, LinSolTrait, Ordering, Scaling, SparseMatrix, StatsLinSol, Sym};
+use super::{FactorizationInfo, Genie, LinSolParams, LinSolTrait, Ordering, Scaling, SparseMatrix};
+use super::{StatsLinSol, StatsLinSolFactors, Sym, SymbolicAnalysis};
 use crate::constants::*;
 use crate::StrError;
-use russell_lab::{using_intel_mkl, vec_copy, Stopwatch, Vector};
+use russell_lab::{mat_copy, using_intel_mkl, vec_copy, Matrix, Stopwatch, Vector};
+use std::ffi::{c_char, CString};
+use std::sync::Mutex;
 
 /// Opaque struct holding a C-pointer to InterfaceMUMPS
 ///
@@ -22,6 +25,12 @@ unsafe impl Send for InterfaceMUMPS {}
 /// <https://stackoverflow.com/questions/50258359/can-a-struct-containing-a-raw-pointer-implement-send-and-be-ffi-safe>
 unsafe impl Send for SolverMUMPS {}
 
+/// Serializes the calls involving the global state of MUMPS (initialization/analysis and termination)
+///
+/// This lock is shared by the real and complex solvers.
+/// Since the lock does not protect any data, a poisoned lock (a panic while holding it) is recovered.
+pub(crate) static MUMPS_GLOBAL_LOCK: Mutex<()> = Mutex::new(());
+
 extern "C" {
     fn solver_mumps_new() -> *mut InterfaceMUMPS;
     fn solver_mumps_drop(solver: *mut InterfaceMUMPS);
@@ -32,36 +41,84 @@ extern "C" {
         pct_inc_workspace: i32,
         max_work_memory: i32,
         openmp_num_threads: i32,
+        blr: CcBool,
+        blr_ucfs: CcBool,
+        blr_tolerance: f64,
+        out_of_core: CcBool,
+        ooc_tmpdir: *const c_char,
+        comm_fortran: i32,
+        distributed: CcBool,
+        parallel_analysis: CcBool,
         verbose: CcBool,
         general_symmetric: CcBool,
         positive_definite: CcBool,
+        user_ordering: *const i32,
         ndim: i32,
-        nnz: i32,
+        nnz: i64,
         indices_i: *const i32,
         indices_j: *const i32,
         values_aij: *const f64,
     ) -> i32;
+    fn solver_mumps_get_ordering(solver: *mut InterfaceMUMPS, ndim: i32, ordering: *mut i32) -> i32;
+    fn solver_mumps_save(solver: *mut InterfaceMUMPS, save_dir: *const c_char, save_prefix: *const c_char) -> i32;
+    fn solver_mumps_restore(
+        solver: *mut InterfaceMUMPS,
+        comm_fortran: i32,
+        general_symmetric: CcBool,
+        positive_definite: CcBool,
+        save_dir: *const c_char,
+        save_prefix: *const c_char,
+    ) -> i32;
     fn solver_mumps_factorize(
         solver: *mut InterfaceMUMPS,
         effective_ordering: *mut i32,
         effective_scaling: *mut i32,
         determinant_coefficient: *mut f64,
         determinant_exponent: *mut f64,
+        factors_entries: *mut i64,
+        factors_entries_blr: *mut i64,
+        ooc_estimated_memory_mb: *mut i64,
+        effective_memory_mb: *mut i64,
+        ooc_disk_mb: *mut f64,
         compute_determinant: CcBool,
         verbose: CcBool,
     ) -> i32;
+    fn solver_mumps_get_factors_info(solver: *mut InterfaceMUMPS, factors_info: *mut StatsLinSolFactors) -> i32;
     fn solver_mumps_solve(
         solver: *mut InterfaceMUMPS,
         rhs: *mut f64,
+        nrhs: i32,
+        transposed: CcBool,
         error_analysis_array_len_8: *mut f64,
         error_analysis_option: i32,
         verbose: CcBool,
     ) -> i32;
+    fn solver_mumps_solve_sparse_rhs(
+        solver: *mut InterfaceMUMPS,
+        x: *mut f64,
+        nz_rhs: i32,
+        irhs_sparse: *mut i32,
+        rhs_sparse: *mut f64,
+        irhs_ptr: *mut i32,
+        verbose: CcBool,
+    ) -> i32;
+    fn solver_mumps_inverse_entries(
+        solver: *mut InterfaceMUMPS,
+        nz_rhs: i32,
+        irhs_sparse: *mut i32,
+        rhs_sparse: *mut f64,
+        irhs_ptr: *mut i32,
+        verbose: CcBool,
+    ) -> i32;
 }
 
 /// Wraps the MUMPS solver for (very large) sparse linear systems
 ///
-/// **Warning:** This solver is **not** thread-safe, thus use only use in single-thread applications.
+/// **Warning:** The MUMPS library is **not** guaranteed to be thread-safe, thus use only use in single-thread
+/// applications. Nonetheless, the calls involving the global state of MUMPS (initialization/analysis and
+/// termination) are serialized by a lock shared by the real and complex solvers. Thus, if MUMPS has been
+/// compiled thread-safe (e.g., with OpenMP and recursive Fortran procedures), two distinct instances
+/// may be factorized and solved concurrently (e.g., the real and complex systems of Radau5).
 pub struct SolverMUMPS {
     /// Holds a pointer to the C interface to MUMPS
     solver: *mut InterfaceMUMPS,
@@ -81,6 +138,9 @@ pub struct SolverMUMPS {
     /// Holds the number of non-zeros saved in initialize
     initialized_nnz: usize,
 
+    /// Holds the positive-definite flag saved in initialize
+    initialized_positive_definite: bool,
+
     /// Holds the used ordering (after factorize)
     effective_ordering: i32,
 
@@ -100,6 +160,21 @@ pub struct SolverMUMPS {
     /// det = coefficient * pow(2, exponent)
     determinant_exponent: f64,
 
+    /// Holds the effective number of entries in the factors, INFOG(29) (after factorize)
+    factors_entries: i64,
+
+    /// Holds the effective number of entries in the factors after the BLR compression, INFOG(35) (after factorize)
+    factors_entries_blr: i64,
+
+    /// Holds the estimated memory in MB for the out-of-core factorization, INFOG(27)
+    ooc_estimated_memory_mb: i64,
+
+    /// Holds the effective memory in MB used by the factorization, INFOG(22)
+    effective_memory_mb: i64,
+
+    /// Holds the disk space in MB used by the out-of-core files, RINFOG(16)
+    ooc_disk_mb: f64,
+
     /// MUMPS code for error analysis (after solve)
     ///
     /// ICNTL(11): 0 (nothing), 1 (all; slow), 2 (just errors)
@@ -108,6 +183,12 @@ pub struct SolverMUMPS {
     /// Holds the error analysis "stat" results
     error_analysis_array_len_8: Vec<f64>,
 
+    /// Holds the ordering computed by (or given to) the analysis
+    symbolic_analysis: Option<SymbolicAnalysis>,
+
+    /// Holds the fill-in, flop count, and memory usage of the last factorization
+    factors_info: StatsLinSolFactors,
+
     /// Stopwatch to measure computation times
     stopwatch: Stopwatch,
 
@@ -130,6 +211,7 @@ pub struct SolverMUMPS {
 impl Drop for SolverMUMPS {
     /// Tells the c-code to release memory
     fn drop(&mut self) {
+        let _guard = MUMPS_GLOBAL_LOCK.lock().unwrap_or_else(|e| e.into_inner());
         unsafe {
             solver_mumps_drop(self.solver);
         }
@@ -151,13 +233,21 @@ impl SolverMUMPS {
                 initialized_sym: Sym::No,
                 initialized_ndim: 0,
                 initialized_nnz: 0,
+                initialized_positive_definite: false,
                 effective_ordering: -1,
                 effective_scaling: -1,
                 effective_num_threads: 0,
                 determinant_coefficient: 0.0,
                 determinant_exponent: 0.0,
+                factors_entries: 0,
+                factors_entries_blr: 0,
+                ooc_estimated_memory_mb: 0,
+                effective_memory_mb: 0,
+                ooc_disk_mb: 0.0,
                 error_analysis_option: 0,
                 error_analysis_array_len_8: vec![0.0; 8],
+                symbolic_analysis: None,
+                factors_info: StatsLinSolFactors::default(),
                 stopwatch: Stopwatch::new(),
                 time_initialize_ns: 0,
                 time_factorize_ns: 0,
@@ -167,6 +257,267 @@ impl SolverMUMPS {
             })
         }
     }
+
+    /// Computes the solution of the linear system or of the transposed system
+    fn solve_system(
+        &mut self,
+        x: &mut Vector,
+        mat: &SparseMatrix,
+        rhs: &Vector,
+        transposed: bool,
+        verbose: bool,
+    ) -> Result<(), StrError> {
+        // check
+        if !self.factorized {
+            return Err("the function factorize must be called before solve");
+        }
+
+        // access COO matrix
+        let coo = mat.get_coo()?;
+
+        // check already factorized data
+        let (nrow, ncol, nnz, sym) = coo.get_info();
+        if sym != self.initialized_sym {
+            return Err("solve must use the same matrix (symmetric differs)");
+        }
+        if nrow != self.initialized_ndim || ncol != self.initialized_ndim {
+            return Err("solve must use the same matrix (ndim differs)");
+        }
+        if nnz != self.initialized_nnz {
+            return Err("solve must use the same matrix (nnz differs)");
+        }
+
+        // check vectors
+        if x.dim() != self.initialized_ndim {
+            return Err("the dimension of the vector of unknown values x is incorrect");
+        }
+        if rhs.dim() != self.initialized_ndim {
+            return Err("the dimension of the right-hand side vector is incorrect");
+        }
+
+        // call MUMPS solve
+        vec_copy(x, rhs).unwrap();
+        let trans = if transposed { 1 } else { 0 };
+        let verb = if verbose { 1 } else { 0 };
+        self.stopwatch.reset();
+        unsafe {
+            let status = solver_mumps_solve(
+                self.solver,
+                x.as_mut_data().as_mut_ptr(),
+                1,
+                trans,
+                self.error_analysis_array_len_8.as_mut_ptr(),
+                self.error_analysis_option,
+                verb,
+            );
+            if status != SUCCESSFUL_EXIT {
+                return Err(handle_mumps_error_code(status));
+            }
+        }
+        self.time_solve_ns = self.stopwatch.stop();
+
+        // done
+        Ok(())
+    }
+
+    /// Computes the solution of the linear system with a sparse right-hand side
+    ///
+    /// Solves the linear system:
+    ///
+    /// ```text
+    ///   A   · x = rhs
+    /// (m,m)  (m)  (m)
+    /// ```
+    ///
+    /// where the right-hand side is given by the non-zero values `rhs_values` at the rows `rhs_indices`.
+    /// MUMPS exploits the sparsity of the right-hand side by pruning the elimination tree (ICNTL(20)),
+    /// which is much faster than a dense solve if the right-hand side has only a few non-zero values.
+    ///
+    /// # Input
+    ///
+    /// * `x` -- the vector of unknown values with dimension equal to mat.nrow
+    /// * `mat` -- the coefficient matrix A; must be square and, if symmetric, [crate::Sym::YesLower].
+    /// * `rhs_indices` -- the (zero-based) row indices of the non-zero values of the right-hand side
+    /// * `rhs_values` -- the non-zero values of the right-hand side (same length as `rhs_indices`)
+    /// * `verbose` -- shows messages
+    ///
+    /// **Warning:** the matrix must be same one used in `factorize`.
+    ///
+    /// **Note:** The error analysis (ICNTL(11)) is not performed with a sparse right-hand side.
+    pub fn solve_sparse_rhs(
+        &mut self,
+        x: &mut Vector,
+        mat: &SparseMatrix,
+        rhs_indices: &[usize],
+        rhs_values: &[f64],
+        verbose: bool,
+    ) -> Result<(), StrError> {
+        // check
+        if !self.factorized {
+            return Err("the function factorize must be called before solve");
+        }
+
+        // access COO matrix
+        let coo = mat.get_coo()?;
+
+        // check already factorized data
+        let (nrow, ncol, nnz, sym) = coo.get_info();
+        if sym != self.initialized_sym {
+            return Err("solve must use the same matrix (symmetric differs)");
+        }
+        if nrow != self.initialized_ndim || ncol != self.initialized_ndim {
+            return Err("solve must use the same matrix (ndim differs)");
+        }
+        if nnz != self.initialized_nnz {
+            return Err("solve must use the same matrix (nnz differs)");
+        }
+
+        // check vectors
+        if x.dim() != self.initialized_ndim {
+            return Err("the dimension of the vector of unknown values x is incorrect");
+        }
+        if rhs_indices.len() != rhs_values.len() {
+            return Err("the lengths of rhs_indices and rhs_values must be the same");
+        }
+        if rhs_indices.len() < 1 {
+            return Err("the sparse right-hand side must have at least one non-zero value");
+        }
+
+        // convert indices to Fortran
+        let mut irhs_sparse = vec![0; rhs_indices.len()];
+        for k in 0..rhs_indices.len() {
+            if rhs_indices[k] >= self.initialized_ndim {
+                return Err("the row index of the sparse right-hand side is out of range");
+            }
+            irhs_sparse[k] = to_i32(rhs_indices[k] + 1);
+        }
+        let mut rhs_sparse = rhs_values.to_vec();
+        let nz_rhs = to_i32(rhs_indices.len());
+        let mut irhs_ptr = vec![1, nz_rhs + 1];
+
+        // call MUMPS solve
+        let verb = if verbose { 1 } else { 0 };
+        self.stopwatch.reset();
+        unsafe {
+            let status = solver_mumps_solve_sparse_rhs(
+                self.solver,
+                x.as_mut_data().as_mut_ptr(),
+                nz_rhs,
+                irhs_sparse.as_mut_ptr(),
+                rhs_sparse.as_mut_ptr(),
+                irhs_ptr.as_mut_ptr(),
+                verb,
+            );
+            if status != SUCCESSFUL_EXIT {
+                return Err(handle_mumps_error_code(status));
+            }
+        }
+        self.time_solve_ns = self.stopwatch.stop();
+
+        // done
+        Ok(())
+    }
+
+    /// Computes selected entries of the inverse of the coefficient matrix
+    ///
+    /// Computes `values[k] = inv(A)[rows[k], cols[k]]` without computing the whole inverse. For example,
+    /// the diagonal of the inverse is obtained with `rows = cols = [0, 1, .., m-1]`. MUMPS only computes
+    /// the requested entries by pruning the elimination tree (ICNTL(30)).
+    ///
+    /// # Input
+    ///
+    /// * `values` -- the vector of computed entries with dimension equal to the number of requested entries
+    /// * `mat` -- the coefficient matrix A; must be square and, if symmetric, [crate::Sym::YesLower].
+    /// * `rows` -- the (zero-based) row indices of the requested entries
+    /// * `cols` -- the (zero-based) column indices of the requested entries (same length as `rows`)
+    /// * `verbose` -- shows messages
+    ///
+    /// **Warning:** the matrix must be same one used in `factorize`.
+    pub fn compute_inverse_entries(
+        &mut self,
+        values: &mut Vector,
+        mat: &SparseMatrix,
+        rows: &[usize],
+        cols: &[usize],
+        verbose: bool,
+    ) -> Result<(), StrError> {
+        // check
+        if !self.factorized {
+            return Err("the function factorize must be called before compute_inverse_entries");
+        }
+
+        // access COO matrix
+        let coo = mat.get_coo()?;
+
+        // check already factorized data
+        let (nrow, ncol, nnz, sym) = coo.get_info();
+        if sym != self.initialized_sym {
+            return Err("compute_inverse_entries must use the same matrix (symmetric differs)");
+        }
+        if nrow != self.initialized_ndim || ncol != self.initialized_ndim {
+            return Err("compute_inverse_entries must use the same matrix (ndim differs)");
+        }
+        if nnz != self.initialized_nnz {
+            return Err("compute_inverse_entries must use the same matrix (nnz differs)");
+        }
+
+        // check indices
+        let nz_rhs = rows.len();
+        if cols.len() != nz_rhs {
+            return Err("the lengths of rows and cols must be the same");
+        }
+        if nz_rhs < 1 {
+            return Err("at least one entry of the inverse must be requested");
+        }
+        if values.dim() != nz_rhs {
+            return Err("the dimension of the vector of values is incorrect");
+        }
+        let ndim = self.initialized_ndim;
+        for k in 0..nz_rhs {
+            if rows[k] >= ndim || cols[k] >= ndim {
+                return Err("the index of the requested entry of the inverse is out of range");
+            }
+        }
+
+        // sort the requested entries by column (compressed column format with Fortran indices)
+        let mut order: Vec<usize> = (0..nz_rhs).collect();
+        order.sort_by_key(|&k| cols[k]);
+        let mut irhs_sparse = vec![0; nz_rhs];
+        let mut irhs_ptr = vec![0; ndim + 1];
+        for (p, &k) in order.iter().enumerate() {
+            irhs_sparse[p] = to_i32(rows[k] + 1);
+            irhs_ptr[cols[k] + 1] += 1;
+        }
+        irhs_ptr[0] = 1;
+        for j in 0..ndim {
+            irhs_ptr[j + 1] += irhs_ptr[j];
+        }
+        let mut rhs_sparse = vec![0.0; nz_rhs];
+
+        // call MUMPS solve
+        let verb = if verbose { 1 } else { 0 };
+        self.stopwatch.reset();
+        unsafe {
+            let status = solver_mumps_inverse_entries(
+                self.solver,
+                to_i32(nz_rhs),
+                irhs_sparse.as_mut_ptr(),
+                rhs_sparse.as_mut_ptr(),
+                irhs_ptr.as_mut_ptr(),
+                verb,
+            );
+            if status != SUCCESSFUL_EXIT {
+                return Err(handle_mumps_error_code(status));
+            }
+        }
+        self.time_solve_ns = self.stopwatch.stop();
+
+        // map the results back to the requested order
+        for (p, &k) in order.iter().enumerate() {
+            values[k] = rhs_sparse[p];
+        }
+        Ok(())
+    }
 }
 
 impl LinSolTrait for SolverMUMPS {
@@ -252,17 +603,34 @@ impl LinSolTrait for SolverMUMPS {
 
         // requests
         let compute_determinant = if par.compute_determinant { 1 } else { 0 };
+        let blr = if par.mumps_blr { 1 } else { 0 };
+        let blr_ucfs = if par.mumps_blr_ucfs { 1 } else { 0 };
+        let out_of_core = if par.mumps_out_of_core { 1 } else { 0 };
+        let distributed = if par.mumps_distributed_input { 1 } else { 0 };
+        let parallel_analysis = if par.mumps_parallel_analysis { 1 } else { 0 };
+        if !cfg!(feature = "with_mumps_mpi") && (par.mumps_distributed_input || par.mumps_parallel_analysis) {
+            return Err("the distributed input and the parallel analysis require the with_mumps_mpi feature");
+        }
         let verbose = if par.verbose { 1 } else { 0 };
 
         // matrix config
         let general_symmetric = if coo.symmetric == Sym::YesLower { 1 } else { 0 };
         let positive_definite = if par.positive_definite { 1 } else { 0 };
         let ndim = to_i32(coo.nrow);
-        let nnz = to_i32(coo.nnz);
+        let nnz = to_i64(coo.nnz); // MUMPS takes a 64-bit nnz
 
         // call initialize just once
         if !self.initialized {
+            // MUMPS takes the (one-based) position of each variable in the pivot order
+            let user_ordering: Option<Vec<i32>> = match &self.symbolic_analysis {
+                Some(analysis) => {
+                    analysis.validate(Genie::Mumps, coo.nrow, coo.nnz, coo.symmetric)?;
+                    Some(analysis.col_permutation.iter().map(|k| k + 1).collect())
+                }
+                None => None,
+            };
             self.stopwatch.reset();
+            let _guard = MUMPS_GLOBAL_LOCK.lock().unwrap_or_else(|e| e.into_inner());
             unsafe {
                 let status = solver_mumps_initialize(
                     self.solver,
@@ -271,9 +639,21 @@ impl LinSolTrait for SolverMUMPS {
                     pct_inc_workspace,
                     max_work_memory,
                     self.effective_num_threads,
+                    blr,
+                    blr_ucfs,
+                    par.mumps_blr_tolerance,
+                    out_of_core,
+                    par.get_mumps_ooc_tmpdir_ptr(),
+                    par.mumps_comm_fortran,
+                    distributed,
+                    parallel_analysis,
                     verbose,
                     general_symmetric,
                     positive_definite,
+                    match &user_ordering {
+                        Some(perm) => perm.as_ptr(),
+                        None => std::ptr::null(),
+                    },
                     ndim,
                     nnz,
                     self.fortran_indices_i.as_ptr(),
@@ -286,6 +666,23 @@ impl LinSolTrait for SolverMUMPS {
             }
             self.time_initialize_ns = self.stopwatch.stop();
             self.initialized = true;
+            self.initialized_positive_definite = par.positive_definite;
+            if self.symbolic_analysis.is_none() {
+                let mut ordering = vec![0; coo.nrow];
+                unsafe {
+                    // the pivot order is only available on the host
+                    if solver_mumps_get_ordering(self.solver, ndim, ordering.as_mut_ptr()) == SUCCESSFUL_EXIT {
+                        self.symbolic_analysis = Some(SymbolicAnalysis {
+                            genie: Genie::Mumps,
+                            symmetric: coo.symmetric,
+                            ndim: coo.nrow,
+                            nnz: coo.nnz,
+                            row_permutation: Vec::new(),
+                            col_permutation: ordering.iter().map(|k| k - 1).collect(),
+                        });
+                    }
+                }
+            }
         }
 
         // call factorize
@@ -297,6 +694,11 @@ impl LinSolTrait for SolverMUMPS {
                 &mut self.effective_scaling,
                 &mut self.determinant_coefficient,
                 &mut self.determinant_exponent,
+                &mut self.factors_entries,
+                &mut self.factors_entries_blr,
+                &mut self.ooc_estimated_memory_mb,
+                &mut self.effective_memory_mb,
+                &mut self.ooc_disk_mb,
                 compute_determinant,
                 verbose,
             );
@@ -306,6 +708,14 @@ impl LinSolTrait for SolverMUMPS {
         }
         self.time_factorize_ns = self.stopwatch.stop();
 
+        // get the fill-in, flop count, and memory usage
+        unsafe {
+            let status = solver_mumps_get_factors_info(self.solver, &mut self.factors_info);
+            if status != SUCCESSFUL_EXIT {
+                return Err(handle_mumps_error_code(status));
+            }
+        }
+
         // done
         self.factorized = true;
         Ok(())
@@ -332,6 +742,67 @@ impl LinSolTrait for SolverMUMPS {
     ///
     /// **Warning:** the matrix must be same one used in `factorize`.
     fn solve(&mut self, x: &mut Vector, mat: &SparseMatrix, rhs: &Vector, verbose: bool) -> Result<(), StrError> {
+        self.solve_system(x, mat, rhs, false, verbose)
+    }
+
+    /// Computes the solution of the transposed linear system
+    ///
+    /// Solves the linear system:
+    ///
+    /// ```text
+    ///   Aᵀ  · x = rhs
+    /// (m,m)  (m)  (m)
+    /// ```
+    ///
+    /// # Output
+    ///
+    /// * `x` -- the vector of unknown values with dimension equal to mat.nrow
+    ///
+    /// # Input
+    ///
+    /// * `mat` -- the coefficient matrix A; must be square and, if symmetric, [Sym::YesLower].
+    /// * `rhs` -- the right-hand side vector with know values an dimension equal to mat.nrow
+    /// * `verbose` -- shows messages
+    ///
+    /// **Note:** The factorization computed by `factorize` is reused (no new factorization is needed).
+    ///
+    /// **Warning:** the matrix must be same one used in `factorize`.
+    fn solve_transposed(
+        &mut self,
+        x: &mut Vector,
+        mat: &SparseMatrix,
+        rhs: &Vector,
+        verbose: bool,
+    ) -> Result<(), StrError> {
+        self.solve_system(x, mat, rhs, true, verbose)
+    }
+
+    /// Computes the solution of the linear system with multiple right-hand sides
+    ///
+    /// Solves the linear system:
+    ///
+    /// ```text
+    ///   A   ·   X   =  RHS
+    /// (m,m)  (m,k)    (m,k)
+    /// ```
+    ///
+    /// # Output
+    ///
+    /// * `x` -- the (col-major) matrix of unknown values with nrow equal to mat.nrow and ncol equal to the number of right-hand sides
+    ///
+    /// # Input
+    ///
+    /// * `mat` -- the coefficient matrix A; must be square and, if symmetric, [Sym::YesLower].
+    /// * `rhs` -- the matrix of right-hand sides; each column corresponds to one right-hand side
+    /// * `verbose` -- shows messages
+    ///
+    /// # Notes
+    ///
+    /// 1. All right-hand sides are passed to MUMPS in a single call (NRHS = rhs.ncol and LRHS = mat.nrow).
+    /// 2. The error analysis (ICNTL(11)) is not performed with multiple right-hand sides.
+    ///
+    /// **Warning:** the matrix must be same one used in `factorize`.
+    fn solve_multi(&mut self, x: &mut Matrix, mat: &SparseMatrix, rhs: &Matrix, verbose: bool) -> Result<(), StrError> {
         // check
         if !self.factorized {
             return Err("the function factorize must be called before solve");
@@ -352,24 +823,31 @@ impl LinSolTrait for SolverMUMPS {
             return Err("solve must use the same matrix (nnz differs)");
         }
 
-        // check vectors
-        if x.dim() != self.initialized_ndim {
-            return Err("the dimension of the vector of unknown values x is incorrect");
+        // check matrices
+        if x.nrow() != self.initialized_ndim {
+            return Err("the number of rows of the matrix of unknown values x is incorrect");
         }
-        if rhs.dim() != self.initialized_ndim {
-            return Err("the dimension of the right-hand side vector is incorrect");
+        if rhs.nrow() != self.initialized_ndim {
+            return Err("the number of rows of the right-hand side matrix is incorrect");
+        }
+        if rhs.ncol() != x.ncol() {
+            return Err("the number of columns of x and rhs must be the same");
         }
 
         // call MUMPS solve
-        vec_copy(x, rhs).unwrap();
+        let nrhs = to_i32(rhs.ncol());
+        let error_analysis_option = if nrhs == 1 { self.error_analysis_option } else { 0 };
+        mat_copy(x, rhs).unwrap();
         let verb = if verbose { 1 } else { 0 };
         self.stopwatch.reset();
         unsafe {
             let status = solver_mumps_solve(
                 self.solver,
                 x.as_mut_data().as_mut_ptr(),
+                nrhs,
+                0,
                 self.error_analysis_array_len_8.as_mut_ptr(),
-                self.error_analysis_option,
+                error_analysis_option,
                 verb,
             );
             if status != SUCCESSFUL_EXIT {
@@ -419,9 +897,15 @@ impl LinSolTrait for SolverMUMPS {
         stats.mumps_stats.normalized_delta_x = self.error_analysis_array_len_8[5];
         stats.mumps_stats.condition_number1 = self.error_analysis_array_len_8[6];
         stats.mumps_stats.condition_number2 = self.error_analysis_array_len_8[7];
+        stats.mumps_stats.factors_entries = self.factors_entries;
+        stats.mumps_stats.factors_entries_blr = self.factors_entries_blr;
+        stats.mumps_stats.ooc_estimated_memory_mb = self.ooc_estimated_memory_mb;
+        stats.mumps_stats.effective_memory_mb = self.effective_memory_mb;
+        stats.mumps_stats.ooc_disk_mb = self.ooc_disk_mb;
         stats.time_nanoseconds.initialize = self.time_initialize_ns;
         stats.time_nanoseconds.factorize = self.time_factorize_ns;
         stats.time_nanoseconds.solve = self.time_solve_ns;
+        stats.factors = self.factors_info;
     }
 
     /// Returns the nanoseconds spent on initialize
@@ -438,8 +922,114 @@ impl LinSolTrait for SolverMUMPS {
     fn get_ns_solve(&self) -> u128 {
         self.time_solve_ns
     }
+
+    /// Returns the pivot order computed by (or given to) the analysis
+    fn get_symbolic_analysis(&self) -> Option<&SymbolicAnalysis> {
+        self.symbolic_analysis.as_ref()
+    }
+
+    /// Sets the pivot order to be given to MUMPS with ICNTL(7) = 1 (must be called before factorize)
+    fn set_symbolic_analysis(&mut self, analysis: &SymbolicAnalysis) -> Result<(), StrError> {
+        if self.initialized {
+            return Err("the symbolic analysis must be set before the first factorization");
+        }
+        if analysis.genie != Genie::Mumps {
+            return Err("the symbolic analysis has been computed by another solver");
+        }
+        self.symbolic_analysis = Some(analysis.clone());
+        Ok(())
+    }
+
+    /// Saves the factorization (via the MUMPS save feature, JOB=7)
+    fn save_factorization(&self, full_path_dir: &str) -> Result<(), StrError> {
+        if !self.factorized {
+            return Err("the function factorize must be called before save_factorization");
+        }
+        let info = FactorizationInfo {
+            genie: Genie::Mumps,
+            symmetric: self.initialized_sym,
+            ndim: self.initialized_ndim,
+            nnz: self.initialized_nnz,
+            positive_definite: self.initialized_positive_definite,
+            effective_strategy: -1,
+            effective_ordering: self.effective_ordering,
+            effective_scaling: self.effective_scaling,
+            rcond_estimate: 0.0,
+            determinant_coefficient: self.determinant_coefficient,
+            determinant_exponent: self.determinant_exponent,
+        };
+        info.write(full_path_dir)?;
+        let save_dir = CString::new(full_path_dir).map_err(|_| "the path of the factorization file is invalid")?;
+        let save_prefix = CString::new(MUMPS_SAVE_PREFIX).unwrap();
+        unsafe {
+            let status = solver_mumps_save(self.solver, save_dir.as_ptr(), save_prefix.as_ptr());
+            if status != SUCCESSFUL_EXIT {
+                return Err(handle_mumps_error_code(status));
+            }
+        }
+        Ok(())
+    }
+
+    /// Loads the factorization (via the MUMPS restore feature, JOB=8)
+    ///
+    /// Only the MPI communicator (`mumps_comm_fortran`) is taken from the parameters; the other
+    /// options have been fixed by the saved analysis and factorization.
+    ///
+    /// **Note:** The error analysis (ICNTL(11)) is not available after loading the factorization.
+    fn load_factorization(
+        &mut self,
+        mat: &mut SparseMatrix,
+        full_path_dir: &str,
+        params: Option<LinSolParams>,
+    ) -> Result<(), StrError> {
+        if self.initialized {
+            return Err("the factorization must be loaded by a new solver");
+        }
+        let info = FactorizationInfo::read(full_path_dir, Genie::Mumps)?;
+        let (nrow, ncol, nnz, sym) = mat.get_coo()?.get_info();
+        if nrow != info.ndim || ncol != info.ndim || nnz != info.nnz || sym != info.symmetric {
+            return Err("the matrix does not correspond to the saved factorization");
+        }
+        let save_dir = CString::new(full_path_dir).map_err(|_| "the path of the factorization file is invalid")?;
+        let save_prefix = CString::new(MUMPS_SAVE_PREFIX).unwrap();
+        let general_symmetric = if info.symmetric == Sym::YesLower { 1 } else { 0 };
+        let positive_definite = if info.positive_definite { 1 } else { 0 };
+        let par = if let Some(p) = params { p } else { LinSolParams::new() };
+        self.stopwatch.reset();
+        let _guard = MUMPS_GLOBAL_LOCK.lock().unwrap_or_else(|e| e.into_inner());
+        unsafe {
+            let status = solver_mumps_restore(
+                self.solver,
+                par.mumps_comm_fortran,
+                general_symmetric,
+                positive_definite,
+                save_dir.as_ptr(),
+                save_prefix.as_ptr(),
+            );
+            if status != SUCCESSFUL_EXIT {
+                return Err(handle_mumps_error_code(status));
+            }
+        }
+        self.time_initialize_ns = 0;
+        self.time_factorize_ns = self.stopwatch.stop();
+        self.initialized_sym = info.symmetric;
+        self.initialized_ndim = info.ndim;
+        self.initialized_nnz = info.nnz;
+        self.initialized_positive_definite = info.positive_definite;
+        self.effective_ordering = info.effective_ordering;
+        self.effective_scaling = info.effective_scaling;
+        self.determinant_coefficient = info.determinant_coefficient;
+        self.determinant_exponent = info.determinant_exponent;
+        self.error_analysis_option = 0; // the matrix is not restored
+        self.initialized = true;
+        self.factorized = true;
+        Ok(())
+    }
 }
 
+/// Defines the prefix of the files saved by MUMPS (JOB=7)
+const MUMPS_SAVE_PREFIX: &str = "mumps";
+
 pub(crate) const MUMPS_ORDERING_AMD: i32 = 0; // Amd (page 35)
 pub(crate) const MUMPS_ORDERING_AMF: i32 = 2; // Amf (page 35)
 pub(crate) const MUMPS_ORDERING_AUTO: i32 = 7; // Auto (page 36)
@@ -568,6 +1158,7 @@ pub(crate) fn handle_mumps_error_code(err: i32) -> StrError {
         ERROR_NEED_INITIALIZATION => "MUMPS failed because INITIALIZATION is needed",
         ERROR_NEED_FACTORIZATION => "MUMPS failed because FACTORIZATION is needed",
         ERROR_ALREADY_INITIALIZED => "MUMPS failed because INITIALIZATION has been completed already",
+        ERROR_PATH_TOO_LONG => "MUMPS failed because a path (directory or prefix) is too long",
         _ => "Error: unknown error returned by c-code (MUMPS)",
     }
 }
@@ -578,7 +1169,7 @@ pub(crate) fn handle_mumps_error_code(err: i32) -> StrError {
 mod tests {
     use super::*;
     use crate::{CooMatrix, Samples};
-    use russell_lab::{approx_eq, vec_approx_eq};
+    use russell_lab::{approx_eq, mat_approx_eq, mat_inverse, vec_approx_eq};
     use serial_test::serial;
 
     // IMPORTANT:
@@ -790,6 +1381,68 @@ mod tests {
         vec_approx_eq(&x, x_correct, 1e-10);
     }
 
+    #[test]
+    #[serial]
+    fn solve_multi_works() {
+        let mut solver = SolverMUMPS::new().unwrap();
+        let (coo, _, _, _) = Samples::umfpack_unsymmetric_5x5();
+        let mut mat = SparseMatrix::from_coo(coo);
+        let mut x = Matrix::new(5, 2);
+        let rhs = Matrix::from(&[
+            [8.0, 5.0],   //
+            [45.0, 13.0], //
+            [-3.0, -2.0], //
+            [3.0, 1.0],   //
+            [19.0, 7.0],  //
+        ]);
+        let x_correct = &[
+            [1.0, 1.0], //
+            [2.0, 1.0], //
+            [3.0, 1.0], //
+            [4.0, 1.0], //
+            [5.0, 1.0], //
+        ];
+        solver.factorize(&mut mat, None).unwrap();
+        solver.solve_multi(&mut x, &mat, &rhs, false).unwrap();
+        mat_approx_eq(&x, x_correct, 1e-14);
+
+        // errors
+        let mut x_wrong = Matrix::new(4, 2);
+        assert_eq!(
+            solver.solve_multi(&mut x_wrong, &mat, &rhs, false).err(),
+            Some("the number of rows of the matrix of unknown values x is incorrect")
+        );
+        let rhs_wrong = Matrix::new(4, 2);
+        assert_eq!(
+            solver.solve_multi(&mut x, &mat, &rhs_wrong, false).err(),
+            Some("the number of rows of the right-hand side matrix is incorrect")
+        );
+        let rhs_wrong = Matrix::new(5, 3);
+        assert_eq!(
+            solver.solve_multi(&mut x, &mat, &rhs_wrong, false).err(),
+            Some("the number of columns of x and rhs must be the same")
+        );
+    }
+
+    #[test]
+    #[serial]
+    fn solve_transposed_works() {
+        let mut solver = SolverMUMPS::new().unwrap();
+        let (coo, _, _, _) = Samples::umfpack_unsymmetric_5x5();
+        let mut mat = SparseMatrix::from_coo(coo);
+        let mut x = Vector::new(5);
+        let rhs = Vector::from(&[8.0, 20.0, 13.0, 6.0, 17.0]);
+        let x_correct = &[1.0, 2.0, 3.0, 4.0, 5.0];
+        solver.factorize(&mut mat, None).unwrap();
+        solver.solve_transposed(&mut x, &mat, &rhs, false).unwrap();
+        vec_approx_eq(&x, x_correct, 1e-14);
+
+        // the same factorization still solves the original system
+        let rhs = Vector::from(&[8.0, 45.0, -3.0, 3.0, 19.0]);
+        solver.solve(&mut x, &mat, &rhs, false).unwrap();
+        vec_approx_eq(&x, x_correct, 1e-14);
+    }
+
     #[test]
     #[serial]
     fn solve_works_symmetric() {
@@ -820,6 +1473,181 @@ mod tests {
         vec_approx_eq(&x_again, x_correct, 1e-11);
     }
 
+    #[test]
+    #[serial]
+    fn solve_sparse_rhs_works() {
+        let mut solver = SolverMUMPS::new().unwrap();
+        let (coo, _, _, _) = Samples::umfpack_unsymmetric_5x5();
+        let mut mat = SparseMatrix::from_coo(coo);
+        let mut x = Vector::new(5);
+        assert_eq!(
+            solver.solve_sparse_rhs(&mut x, &mat, &[0], &[1.0], false).err(),
+            Some("the function factorize must be called before solve")
+        );
+        solver.factorize(&mut mat, None).unwrap();
+        assert_eq!(
+            solver.solve_sparse_rhs(&mut x, &mat, &[0, 1], &[1.0], false).err(),
+            Some("the lengths of rhs_indices and rhs_values must be the same")
+        );
+        assert_eq!(
+            solver.solve_sparse_rhs(&mut x, &mat, &[5], &[1.0], false).err(),
+            Some("the row index of the sparse right-hand side is out of range")
+        );
+
+        // compare with the dense solve
+        let rhs = Vector::from(&[0.0, 2.0, 0.0, 0.0, -1.0]);
+        let mut x_dense = Vector::new(5);
+        solver.solve(&mut x_dense, &mat, &rhs, false).unwrap();
+        solver
+            .solve_sparse_rhs(&mut x, &mat, &[4, 1], &[-1.0, 2.0], false)
+            .unwrap();
+        vec_approx_eq(&x, &x_dense, 1e-14);
+
+        // the dense solve still works
+        let rhs = Vector::from(&[8.0, 45.0, -3.0, 3.0, 19.0]);
+        solver.solve(&mut x, &mat, &rhs, false).unwrap();
+        vec_approx_eq(&x, &[1.0, 2.0, 3.0, 4.0, 5.0], 1e-14);
+    }
+
+    #[test]
+    #[serial]
+    fn compute_inverse_entries_works() {
+        let mut solver = SolverMUMPS::new().unwrap();
+        let (coo, _, _, _) = Samples::umfpack_unsymmetric_5x5();
+        let dense = coo.as_dense();
+        let mut mat = SparseMatrix::from_coo(coo);
+        let mut values = Vector::new(5);
+        let diag = &[0, 1, 2, 3, 4];
+        assert_eq!(
+            solver
+                .compute_inverse_entries(&mut values, &mat, diag, diag, false)
+                .err(),
+            Some("the function factorize must be called before compute_inverse_entries")
+        );
+        solver.factorize(&mut mat, None).unwrap();
+        assert_eq!(
+            solver
+                .compute_inverse_entries(&mut values, &mat, &[0], diag, false)
+                .err(),
+            Some("the lengths of rows and cols must be the same")
+        );
+        assert_eq!(
+            solver
+                .compute_inverse_entries(&mut values, &mat, &[0], &[0], false)
+                .err(),
+            Some("the dimension of the vector of values is incorrect")
+        );
+
+        // reference inverse
+        let mut inverse = Matrix::new(5, 5);
+        mat_inverse(&mut inverse, &dense).unwrap();
+
+        // diagonal
+        solver
+            .compute_inverse_entries(&mut values, &mat, diag, diag, false)
+            .unwrap();
+        for k in 0..5 {
+            approx_eq(values[k], inverse.get(k, k), 1e-14);
+        }
+
+        // off-diagonal entries in arbitrary order
+        let rows = &[4, 0, 2];
+        let cols = &[1, 3, 0];
+        let mut values = Vector::new(3);
+        solver
+            .compute_inverse_entries(&mut values, &mat, rows, cols, false)
+            .unwrap();
+        for k in 0..3 {
+            approx_eq(values[k], inverse.get(rows[k], cols[k]), 1e-14);
+        }
+    }
+
+    #[test]
+    #[serial]
+    fn factorize_with_blr_works() {
+        let (coo, _, _, _) = Samples::umfpack_unsymmetric_5x5();
+        let mut mat = SparseMatrix::from_coo(coo);
+        let mut solver = SolverMUMPS::new().unwrap();
+        let mut params = LinSolParams::new();
+        params.mumps_blr = true;
+        params.mumps_blr_ucfs = true;
+        params.mumps_blr_tolerance = 1e-14;
+        solver.factorize(&mut mat, Some(params)).unwrap();
+        let mut x = Vector::new(5);
+        let rhs = Vector::from(&[8.0, 45.0, -3.0, 3.0, 19.0]);
+        solver.solve(&mut x, &mat, &rhs, false).unwrap();
+        vec_approx_eq(&x, &[1.0, 2.0, 3.0, 4.0, 5.0], 1e-10);
+        let mut stats = StatsLinSol::new();
+        solver.update_stats(&mut stats);
+        assert!(stats.mumps_stats.factors_entries > 0);
+        assert!(stats.mumps_stats.factors_entries_blr > 0);
+        assert!(stats.mumps_stats.factors_entries_blr <= stats.mumps_stats.factors_entries);
+    }
+
+    #[test]
+    #[serial]
+    fn factorize_out_of_core_works() {
+        let (coo, _, _, _) = Samples::umfpack_unsymmetric_5x5();
+        let mut mat = SparseMatrix::from_coo(coo);
+        let mut solver = SolverMUMPS::new().unwrap();
+        let mut params = LinSolParams::new();
+        params.mumps_out_of_core = true;
+        params.set_mumps_ooc_tmpdir(Some("/tmp")).unwrap();
+        solver.factorize(&mut mat, Some(params)).unwrap();
+        let mut x = Vector::new(5);
+        let rhs = Vector::from(&[8.0, 45.0, -3.0, 3.0, 19.0]);
+        solver.solve(&mut x, &mat, &rhs, false).unwrap();
+        vec_approx_eq(&x, &[1.0, 2.0, 3.0, 4.0, 5.0], 1e-10);
+        let mut stats = StatsLinSol::new();
+        solver.update_stats(&mut stats);
+        assert!(stats.mumps_stats.ooc_estimated_memory_mb >= 0);
+        assert!(stats.mumps_stats.ooc_disk_mb >= 0.0);
+    }
+
+    #[test]
+    #[serial]
+    fn save_and_load_factorization_work() {
+        let (coo, _, _, _) = Samples::umfpack_unsymmetric_5x5();
+        let mut mat = SparseMatrix::from_coo(coo);
+        let dir = "/tmp/russell_sparse/test_mumps_save_and_load";
+        let mut solver = SolverMUMPS::new().unwrap();
+        solver.factorize(&mut mat, None).unwrap();
+        solver.save_factorization(dir).unwrap();
+        let mut loaded = SolverMUMPS::new().unwrap();
+        loaded.load_factorization(&mut mat, dir, None).unwrap();
+        let mut x = Vector::new(5);
+        let rhs = Vector::from(&[8.0, 45.0, -3.0, 3.0, 19.0]);
+        loaded.solve(&mut x, &mat, &rhs, false).unwrap();
+        vec_approx_eq(&x, &[1.0, 2.0, 3.0, 4.0, 5.0], 1e-10);
+
+        // the directory does not fit into the MUMPS structure (it is not truncated)
+        let long_dir = format!("/tmp/russell_sparse/test_mumps_long{}", "/abcdefghi".repeat(110));
+        assert_eq!(
+            solver.save_factorization(&long_dir).err(),
+            Some("MUMPS failed because a path (directory or prefix) is too long")
+        );
+    }
+
+    #[test]
+    #[cfg(not(feature = "with_mumps_mpi"))]
+    fn factorize_distributed_requires_mpi() {
+        let (coo, _, _, _) = Samples::umfpack_unsymmetric_5x5();
+        let mut mat = SparseMatrix::from_coo(coo);
+        let mut solver = SolverMUMPS::new().unwrap();
+        let mut params = LinSolParams::new();
+        params.mumps_distributed_input = true;
+        assert_eq!(
+            solver.factorize(&mut mat, Some(params)).err(),
+            Some("the distributed input and the parallel analysis require the with_mumps_mpi feature")
+        );
+        params.mumps_distributed_input = false;
+        params.mumps_parallel_analysis = true;
+        assert_eq!(
+            solver.factorize(&mut mat, Some(params)).err(),
+            Some("the distributed input and the parallel analysis require the with_mumps_mpi feature")
+        );
+    }
+
     #[test]
     fn ordering_and_scaling_works() {
         assert_eq!(mumps_ordering(Ordering::Amd), MUMPS_ORDERING_AMD);
@@ -888,6 +1716,10 @@ mod tests {
             handle_mumps_error_code(ERROR_ALREADY_INITIALIZED),
             "MUMPS failed because INITIALIZATION has been completed already"
         );
+        assert_eq!(
+            handle_mumps_error_code(ERROR_PATH_TOO_LONG),
+            "MUMPS failed because a path (directory or prefix) is too long"
+        );
         assert_eq!(handle_mumps_error_code(123), default);
     }
 }
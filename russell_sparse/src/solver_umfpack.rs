@@ -1,7 +1,9 @@
-use super::{LinSolParams, LinSolTrait, Ordering, Scaling, SparseMatrix, StatsLinSol, Sym};
+use super::{FactorizationInfo, Genie, LinSolParams, LinSolTrait, Ordering, Scaling, SparseMatrix};
+use super::{StatsLinSol, StatsLinSolFactors, Sym, SymbolicAnalysis};
 use crate::constants::*;
 use crate::StrError;
-use russell_lab::{Stopwatch, Vector};
+use russell_lab::{Matrix, Stopwatch, Vector};
+use std::ffi::c_char;
 
 /// Opaque struct holding a C-pointer to InterfaceUMFPACK
 ///
@@ -31,6 +33,7 @@ extern "C" {
         scaling: i32,
         verbose: CcBool,
         enforce_unsymmetric_strategy: CcBool,
+        col_permutation: *const i32,
         ndim: i32,
         col_pointers: *const i32,
         row_indices: *const i32,
@@ -50,10 +53,25 @@ extern "C" {
         row_indices: *const i32,
         values: *const f64,
     ) -> i32;
+    fn solver_umfpack_get_ordering(solver: *mut InterfaceUMFPACK, col_permutation: *mut i32) -> i32;
+    fn solver_umfpack_save(
+        solver: *mut InterfaceUMFPACK,
+        symbolic_path: *const c_char,
+        numeric_path: *const c_char,
+    ) -> i32;
+    fn solver_umfpack_load(
+        solver: *mut InterfaceUMFPACK,
+        symbolic_path: *const c_char,
+        numeric_path: *const c_char,
+    ) -> i32;
+    fn solver_umfpack_get_factors_info(solver: *mut InterfaceUMFPACK, factors_info: *mut StatsLinSolFactors) -> i32;
     fn solver_umfpack_solve(
         solver: *mut InterfaceUMFPACK,
         x: *mut f64,
         rhs: *const f64,
+        ndim: i32,
+        nrhs: i32,
+        transposed: CcBool,
         col_pointers: *const i32,
         row_indices: *const i32,
         values: *const f64,
@@ -105,6 +123,15 @@ pub struct SolverUMFPACK {
     /// det = coefficient * pow(10, exponent)
     determinant_exponent: f64,
 
+    /// Holds the ordering computed by (or given to) the symbolic analysis
+    symbolic_analysis: Option<SymbolicAnalysis>,
+
+    /// Holds the fill-in, flop count, and memory usage of the last factorization
+    factors_info: StatsLinSolFactors,
+
+    /// Time spent on the COO to CSC conversion (in factorize)
+    time_convert_ns: u128,
+
     /// Stopwatch to measure computation times
     stopwatch: Stopwatch,
 
@@ -148,6 +175,9 @@ impl SolverUMFPACK {
                 rcond_estimate: 0.0,
                 determinant_coefficient: 0.0,
                 determinant_exponent: 0.0,
+                symbolic_analysis: None,
+                factors_info: StatsLinSolFactors::default(),
+                time_convert_ns: 0,
                 stopwatch: Stopwatch::new(),
                 time_initialize_ns: 0,
                 time_factorize_ns: 0,
@@ -155,6 +185,71 @@ impl SolverUMFPACK {
             })
         }
     }
+
+    /// Computes the solution of the linear system or of the transposed system
+    fn solve_system(
+        &mut self,
+        x: &mut Vector,
+        mat: &SparseMatrix,
+        rhs: &Vector,
+        transposed: bool,
+        verbose: bool,
+    ) -> Result<(), StrError> {
+        // check
+        if !self.factorized {
+            return Err("the function factorize must be called before solve");
+        }
+
+        // access CSC matrix
+        // (possibly already converted from COO, because factorize was (should have been) called)
+        let csc = mat.get_csc()?;
+
+        // check already factorized data
+        let (nrow, ncol, nnz, sym) = csc.get_info();
+        if sym != self.initialized_sym {
+            return Err("solve must use the same matrix (symmetric differs)");
+        }
+        if nrow != self.initialized_ndim || ncol != self.initialized_ndim {
+            return Err("solve must use the same matrix (ndim differs)");
+        }
+        if nnz != self.initialized_nnz {
+            return Err("solve must use the same matrix (nnz differs)");
+        }
+
+        // check vectors
+        if x.dim() != self.initialized_ndim {
+            return Err("the dimension of the vector of unknown values x is incorrect");
+        }
+        if rhs.dim() != self.initialized_ndim {
+            return Err("the dimension of the right-hand side vector is incorrect");
+        }
+
+        // call UMFPACK solve
+        let trans = if transposed { 1 } else { 0 };
+        let verb = if verbose { 1 } else { 0 };
+        self.stopwatch.reset();
+        unsafe {
+            let status = solver_umfpack_solve(
+                self.solver,
+                x.as_mut_data().as_mut_ptr(),
+                rhs.as_data().as_ptr(),
+                to_i32(self.initialized_ndim),
+                1,
+                trans,
+                csc.col_pointers.as_ptr(),
+                csc.row_indices.as_ptr(),
+                csc.values.as_ptr(),
+                verb,
+            );
+            if status != SUCCESSFUL_EXIT {
+                return Err(handle_umfpack_error_code(status));
+            }
+        }
+        self.time_solve_ns = self.stopwatch.stop();
+
+        // done
+        Ok(())
+    }
 }
 
 impl LinSolTrait for SolverUMFPACK {
@@ -180,7 +275,9 @@ impl LinSolTrait for SolverUMFPACK {
     fn factorize(&mut self, mat: &mut SparseMatrix, params: Option<LinSolParams>) -> Result<(), StrError> {
         // get CSC matrix
         // (or convert from COO if CSC is not available and COO is available)
+        self.stopwatch.reset();
         let csc = mat.get_csc_or_from_coo()?;
+        self.time_convert_ns = self.stopwatch.stop();
 
         // check
         if self.initialized {
@@ -222,6 +319,13 @@ impl LinSolTrait for SolverUMFPACK {
 
         // call initialize just once
         if !self.initialized {
+            let col_perm = match &self.symbolic_analysis {
+                Some(analysis) => {
+                    analysis.validate(Genie::Umfpack, csc.nrow, self.initialized_nnz, csc.symmetric)?;
+                    analysis.col_permutation.as_ptr()
+                }
+                None => std::ptr::null(),
+            };
             self.stopwatch.reset();
             unsafe {
                 let status = solver_umfpack_initialize(
@@ -230,6 +334,7 @@ impl LinSolTrait for SolverUMFPACK {
                     scaling,
                     verbose,
                     enforce_unsym,
+                    col_perm,
                     ndim,
                     csc.col_pointers.as_ptr(),
                     csc.row_indices.as_ptr(),
@@ -266,6 +371,33 @@ impl LinSolTrait for SolverUMFPACK {
         }
         self.time_factorize_ns = self.stopwatch.stop();
 
+        // get the fill-in, flop count, and memory usage
+        unsafe {
+            let status = solver_umfpack_get_factors_info(self.solver, &mut self.factors_info);
+            if status != SUCCESSFUL_EXIT {
+                return Err(handle_umfpack_error_code(status));
+            }
+        }
+
+        // save the column ordering (just once) for other solvers
+        if self.symbolic_analysis.is_none() {
+            let mut col_permutation = vec![0; csc.nrow];
+            unsafe {
+                let status = solver_umfpack_get_ordering(self.solver, col_permutation.as_mut_ptr());
+                if status != SUCCESSFUL_EXIT {
+                    return Err(handle_umfpack_error_code(status));
+                }
+            }
+            self.symbolic_analysis = Some(SymbolicAnalysis {
+                genie: Genie::Umfpack,
+                symmetric: csc.symmetric,
+                ndim: csc.nrow,
+                nnz: self.initialized_nnz,
+                row_permutation: Vec::new(),
+                col_permutation,
+            });
+        }
+
         // done
         self.factorized = true;
         Ok(())
@@ -292,6 +424,66 @@ impl LinSolTrait for SolverUMFPACK {
     ///
     /// **Warning:** the matrix must be same one used in `factorize`.
     fn solve(&mut self, x: &mut Vector, mat: &SparseMatrix, rhs: &Vector, verbose: bool) -> Result<(), StrError> {
+        self.solve_system(x, mat, rhs, false, verbose)
+    }
+
+    /// Computes the solution of the transposed linear system
+    ///
+    /// Solves the linear system:
+    ///
+    /// ```text
+    ///   Aᵀ  · x = rhs
+    /// (m,m)  (m)  (m)
+    /// ```
+    ///
+    /// # Output
+    ///
+    /// * `x` -- the vector of unknown values with dimension equal to mat.nrow
+    ///
+    /// # Input
+    ///
+    /// * `mat` -- the coefficient matrix A; must be square and, if symmetric, [Sym::YesFull].
+    /// * `rhs` -- the right-hand side vector with know values an dimension equal to mat.nrow
+    /// * `verbose` -- shows messages
+    ///
+    /// **Note:** The factorization computed by `factorize` is reused (no new factorization is needed).
+    ///
+    /// **Warning:** the matrix must be same one used in `factorize`.
+    fn solve_transposed(
+        &mut self,
+        x: &mut Vector,
+        mat: &SparseMatrix,
+        rhs: &Vector,
+        verbose: bool,
+    ) -> Result<(), StrError> {
+        self.solve_system(x, mat, rhs, true, verbose)
+    }
+
+    /// Computes the solution of the linear system with multiple right-hand sides
+    ///
+    /// Solves the linear system:
+    ///
+    /// ```text
+    ///   A   ·   X   =  RHS
+    /// (m,m)  (m,k)    (m,k)
+    /// ```
+    ///
+    /// # Output
+    ///
+    /// * `x` -- the (col-major) matrix of unknown values with nrow equal to mat.nrow and ncol equal to the number of right-hand sides
+    ///
+    /// # Input
+    ///
+    /// * `mat` -- the coefficient matrix A; must be square and, if symmetric, [Sym::YesFull].
+    /// * `rhs` -- the matrix of right-hand sides; each column corresponds to one right-hand side
+    /// * `verbose` -- shows messages
+    ///
+    /// # Notes
+    ///
+    /// 1. UMFPACK solves one right-hand side at a time; thus, the loop over the columns is carried out by the C code (single call).
+    ///
+    /// **Warning:** the matrix must be same one used in `factorize`.
+    fn solve_multi(&mut self, x: &mut Matrix, mat: &SparseMatrix, rhs: &Matrix, verbose: bool) -> Result<(), StrError> {
         // check
         if !self.factorized {
             return Err("the function factorize must be called before solve");
@@ -313,12 +505,15 @@ impl LinSolTrait for SolverUMFPACK {
             return Err("solve must use the same matrix (nnz differs)");
         }
 
-        // check vectors
-        if x.dim() != self.initialized_ndim {
-            return Err("the dimension of the vector of unknown values x is incorrect");
+        // check matrices
+        if x.nrow() != self.initialized_ndim {
+            return Err("the number of rows of the matrix of unknown values x is incorrect");
         }
-        if rhs.dim() != self.initialized_ndim {
-            return Err("the dimension of the right-hand side vector is incorrect");
+        if rhs.nrow() != self.initialized_ndim {
+            return Err("the number of rows of the right-hand side matrix is incorrect");
+        }
+        if rhs.ncol() != x.ncol() {
+            return Err("the number of columns of x and rhs must be the same");
         }
 
         // call UMFPACK solve
@@ -329,6 +524,9 @@ impl LinSolTrait for SolverUMFPACK {
                 self.solver,
                 x.as_mut_data().as_mut_ptr(),
                 rhs.as_data().as_ptr(),
+                to_i32(self.initialized_ndim),
+                to_i32(rhs.ncol()),
+                0,
                 csc.col_pointers.as_ptr(),
                 csc.row_indices.as_ptr(),
                 csc.values.as_ptr(),
@@ -379,6 +577,8 @@ impl LinSolTrait for SolverUMFPACK {
         stats.time_nanoseconds.initialize = self.time_initialize_ns;
         stats.time_nanoseconds.factorize = self.time_factorize_ns;
         stats.time_nanoseconds.solve = self.time_solve_ns;
+        stats.time_nanoseconds.convert_matrix = self.time_convert_ns;
+        stats.factors = self.factors_info;
     }
 
     /// Returns the nanoseconds spent on initialize
@@ -395,8 +595,104 @@ impl LinSolTrait for SolverUMFPACK {
     fn get_ns_solve(&self) -> u128 {
         self.time_solve_ns
     }
+
+    /// Returns the column ordering used by (or given to) the factorization
+    fn get_symbolic_analysis(&self) -> Option<&SymbolicAnalysis> {
+        self.symbolic_analysis.as_ref()
+    }
+
+    /// Sets the column pre-ordering to be given to `umfpack_di_qsymbolic` (must be called before factorize)
+    fn set_symbolic_analysis(&mut self, analysis: &SymbolicAnalysis) -> Result<(), StrError> {
+        if self.initialized {
+            return Err("the symbolic analysis must be set before the first factorization");
+        }
+        if analysis.genie != Genie::Umfpack {
+            return Err("the symbolic analysis has been computed by another solver");
+        }
+        self.symbolic_analysis = Some(analysis.clone());
+        Ok(())
+    }
+
+    /// Saves the factorization (via umfpack_di_save_symbolic and umfpack_di_save_numeric)
+    fn save_factorization(&self, full_path_dir: &str) -> Result<(), StrError> {
+        if !self.factorized {
+            return Err("the function factorize must be called before save_factorization");
+        }
+        let info = FactorizationInfo {
+            genie: Genie::Umfpack,
+            symmetric: self.initialized_sym,
+            ndim: self.initialized_ndim,
+            nnz: self.initialized_nnz,
+            positive_definite: false,
+            effective_strategy: self.effective_strategy,
+            effective_ordering: self.effective_ordering,
+            effective_scaling: self.effective_scaling,
+            rcond_estimate: self.rcond_estimate,
+            determinant_coefficient: self.determinant_coefficient,
+            determinant_exponent: self.determinant_exponent,
+        };
+        info.write(full_path_dir)?;
+        let symbolic_path = FactorizationInfo::c_path(full_path_dir, UMFPACK_SYMBOLIC_FILENAME)?;
+        let numeric_path = FactorizationInfo::c_path(full_path_dir, UMFPACK_NUMERIC_FILENAME)?;
+        unsafe {
+            let status = solver_umfpack_save(self.solver, symbolic_path.as_ptr(), numeric_path.as_ptr());
+            if status != SUCCESSFUL_EXIT {
+                return Err(handle_umfpack_error_code(status));
+            }
+        }
+        Ok(())
+    }
+
+    /// Loads the factorization (via umfpack_di_load_symbolic and umfpack_di_load_numeric)
+    ///
+    /// The matrix is converted to CSC, if needed (UMFPACK uses the matrix in `solve` for iterative refinement).
+    fn load_factorization(
+        &mut self,
+        mat: &mut SparseMatrix,
+        full_path_dir: &str,
+        _params: Option<LinSolParams>,
+    ) -> Result<(), StrError> {
+        if self.initialized {
+            return Err("the factorization must be loaded by a new solver");
+        }
+        let info = FactorizationInfo::read(full_path_dir, Genie::Umfpack)?;
+        let csc = mat.get_csc_or_from_coo()?;
+        let (nrow, ncol, nnz, sym) = csc.get_info();
+        if nrow != info.ndim || ncol != info.ndim || nnz != info.nnz || sym != info.symmetric {
+            return Err("the matrix does not correspond to the saved factorization");
+        }
+        let symbolic_path = FactorizationInfo::c_path(full_path_dir, UMFPACK_SYMBOLIC_FILENAME)?;
+        let numeric_path = FactorizationInfo::c_path(full_path_dir, UMFPACK_NUMERIC_FILENAME)?;
+        self.stopwatch.reset();
+        unsafe {
+            let status = solver_umfpack_load(self.solver, symbolic_path.as_ptr(), numeric_path.as_ptr());
+            if status != SUCCESSFUL_EXIT {
+                return Err(handle_umfpack_error_code(status));
+            }
+        }
+        self.time_initialize_ns = 0;
+        self.time_factorize_ns = self.stopwatch.stop();
+        self.initialized_sym = info.symmetric;
+        self.initialized_ndim = info.ndim;
+        self.initialized_nnz = info.nnz;
+        self.effective_strategy = info.effective_strategy;
+        self.effective_ordering = info.effective_ordering;
+        self.effective_scaling = info.effective_scaling;
+        self.rcond_estimate = info.rcond_estimate;
+        self.determinant_coefficient = info.determinant_coefficient;
+        self.determinant_exponent = info.determinant_exponent;
+        self.initialized = true;
+        self.factorized = true;
+        Ok(())
+    }
 }
 
+/// Defines the name of the file with the saved symbolic factorization
+const UMFPACK_SYMBOLIC_FILENAME: &str = "umfpack_symbolic.umf";
+
+/// Defines the name of the file with the saved numeric factorization
+const UMFPACK_NUMERIC_FILENAME: &str = "umfpack_numeric.umf";
+
 pub(crate) const UMFPACK_STRATEGY_AUTO: i32 = 0; // use symmetric or unsymmetric strategy
 pub(crate) const UMFPACK_STRATEGY_UNSYMMETRIC: i32 = 1; // COLAMD(A), col-tree post-order, do not prefer diag
 pub(crate) const UMFPACK_STRATEGY_SYMMETRIC: i32 = 3; // AMD(A+A'), no col-tree post-order, prefer diagonal
@@ -480,7 +776,7 @@ pub(crate) fn handle_umfpack_error_code(err: i32) -> StrError {
 mod tests {
     use super::*;
     use crate::{CooMatrix, Samples};
-    use russell_lab::{approx_eq, vec_approx_eq};
+    use russell_lab::{approx_eq, mat_approx_eq, vec_approx_eq};
 
     #[test]
     fn new_and_drop_work() {
@@ -668,6 +964,73 @@ mod tests {
         solver.update_stats(&mut stats);
         assert_eq!(stats.output.effective_ordering, "Amd");
         assert_eq!(stats.output.effective_scaling, "Sum");
+        let (_, _, nnz, _) = mat.get_csc().unwrap().get_info();
+        assert_eq!(stats.factors.nnz_a, nnz as i64);
+        assert_eq!(stats.factors.nnz_factors, stats.factors.nnz_l + stats.factors.nnz_u);
+        assert!(stats.factors.nnz_factors > 0);
+        assert!(stats.factors.fill_in_ratio > 0.0);
+        assert!(stats.factors.flops_elimination > 0.0);
+        assert!(stats.factors.memory_peak_mb > 0.0);
+    }
+
+    #[test]
+    fn solve_multi_works() {
+        let mut solver = SolverUMFPACK::new().unwrap();
+        let (coo, _, _, _) = Samples::umfpack_unsymmetric_5x5();
+        let mut mat = SparseMatrix::from_coo(coo);
+        let mut x = Matrix::new(5, 2);
+        let rhs = Matrix::from(&[
+            [8.0, 5.0],   //
+            [45.0, 13.0], //
+            [-3.0, -2.0], //
+            [3.0, 1.0],   //
+            [19.0, 7.0],  //
+        ]);
+        let x_correct = &[
+            [1.0, 1.0], //
+            [2.0, 1.0], //
+            [3.0, 1.0], //
+            [4.0, 1.0], //
+            [5.0, 1.0], //
+        ];
+        solver.factorize(&mut mat, None).unwrap();
+        solver.solve_multi(&mut x, &mat, &rhs, false).unwrap();
+        mat_approx_eq(&x, x_correct, 1e-14);
+
+        // errors
+        let mut x_wrong = Matrix::new(4, 2);
+        assert_eq!(
+            solver.solve_multi(&mut x_wrong, &mat, &rhs, false).err(),
+            Some("the number of rows of the matrix of unknown values x is incorrect")
+        );
+        let rhs_wrong = Matrix::new(4, 2);
+        assert_eq!(
+            solver.solve_multi(&mut x, &mat, &rhs_wrong, false).err(),
+            Some("the number of rows of the right-hand side matrix is incorrect")
+        );
+        let rhs_wrong = Matrix::new(5, 3);
+        assert_eq!(
+            solver.solve_multi(&mut x, &mat, &rhs_wrong, false).err(),
+            Some("the number of columns of x and rhs must be the same")
+        );
+    }
+
+    #[test]
+    fn solve_transposed_works() {
+        let mut solver = SolverUMFPACK::new().unwrap();
+        let (coo, _, _, _) = Samples::umfpack_unsymmetric_5x5();
+        let mut mat = SparseMatrix::from_coo(coo);
+        let mut x = Vector::new(5);
+        let rhs = Vector::from(&[8.0, 20.0, 13.0, 6.0, 17.0]);
+        let x_correct = &[1.0, 2.0, 3.0, 4.0, 5.0];
+        solver.factorize(&mut mat, None).unwrap();
+        solver.solve_transposed(&mut x, &mat, &rhs, false).unwrap();
+        vec_approx_eq(&x, x_correct, 1e-14);
+
+        // the same factorization still solves the original system
+        let rhs = Vector::from(&[8.0, 45.0, -3.0, 3.0, 19.0]);
+        solver.solve(&mut x, &mat, &rhs, false).unwrap();
+        vec_approx_eq(&x, x_correct, 1e-14);
     }
 
     #[test]
@@ -694,6 +1057,55 @@ mod tests {
         assert_eq!(stats.output.effective_scaling, "Sum");
     }
 
+    #[test]
+    fn save_and_load_factorization_work() {
+        let (coo, _, _, _) = Samples::umfpack_unsymmetric_5x5();
+        let mut mat = SparseMatrix::from_coo(coo);
+        let dir = "/tmp/russell_sparse/test_umfpack_save_and_load";
+        let mut solver = SolverUMFPACK::new().unwrap();
+        assert_eq!(
+            solver.save_factorization(dir).err(),
+            Some("the function factorize must be called before save_factorization")
+        );
+        let mut params = LinSolParams::new();
+        params.compute_determinant = true;
+        solver.factorize(&mut mat, Some(params)).unwrap();
+        solver.save_factorization(dir).unwrap();
+
+        // load into a new solver (with a COO matrix which is converted to CSC)
+        let (coo, _, _, _) = Samples::umfpack_unsymmetric_5x5();
+        let mut mat_new = SparseMatrix::from_coo(coo);
+        let mut loaded = SolverUMFPACK::new().unwrap();
+        loaded.load_factorization(&mut mat_new, dir, None).unwrap();
+        let mut x = Vector::new(5);
+        let rhs = Vector::from(&[8.0, 45.0, -3.0, 3.0, 19.0]);
+        loaded.solve(&mut x, &mat_new, &rhs, false).unwrap();
+        vec_approx_eq(&x, &[1.0, 2.0, 3.0, 4.0, 5.0], 1e-14);
+        let mut stats = StatsLinSol::new();
+        loaded.update_stats(&mut stats);
+        let det = stats.determinant.mantissa_real * f64::powf(10.0, stats.determinant.exponent);
+        approx_eq(det, 114.0, 1e-13);
+        assert_eq!(
+            loaded.load_factorization(&mut mat_new, dir, None).err(),
+            Some("the factorization must be loaded by a new solver")
+        );
+
+        // errors
+        let mut other = SolverUMFPACK::new().unwrap();
+        let (coo, _, _, _) = Samples::mkl_unsymmetric_5x5();
+        let mut mat_wrong = SparseMatrix::from_coo(coo);
+        assert_eq!(
+            other.load_factorization(&mut mat_wrong, dir, None).err(),
+            Some("the matrix does not correspond to the saved factorization")
+        );
+        assert_eq!(
+            other
+                .load_factorization(&mut mat_new, "/tmp/russell_sparse/__not_a_dir__", None)
+                .err(),
+            Some("cannot open the factorization file")
+        );
+    }
+
     #[test]
     fn ordering_and_scaling_works() {
         assert_eq!(umfpack_ordering(Ordering::Amd), UMFPACK_ORDERING_AMD);
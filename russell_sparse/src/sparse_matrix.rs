@@ -57,7 +57,7 @@ where
     /// * `nrow` -- (≥ 1) Is the number of rows of the sparse matrix (must be fit i32)
     /// * `ncol` -- (≥ 1) Is the number of columns of the sparse matrix (must be fit i32)
     /// * `max_nnz` -- (≥ 1) Maximum number of entries ≥ nnz (number of non-zeros),
-    ///   including entries with repeated indices. (must be fit i32)
+    ///   including entries with repeated indices. (must fit i32, or i64 if used with MUMPS only)
     /// * `symmetric` -- indicates whether the matrix is symmetric or not.
     ///   If symmetric, indicates the representation too.
     pub fn new_coo(nrow: usize, ncol: usize, max_nnz: usize, symmetric: Sym) -> Result<Self, StrError> {
@@ -437,6 +437,43 @@ where
     }
 }
 
+impl<T> NumSparseMatrix<T>
+where
+    T: AddAssign + MulAssign + Num + NumCast + Copy + DeserializeOwned + Serialize + Send + Sync,
+{
+    /// Performs the matrix-vector multiplication using multiple threads
+    ///
+    /// ```text
+    ///  v  :=  α ⋅  a   ⋅  u
+    /// (m)        (m,n)   (n)
+    /// ```
+    ///
+    /// # Input
+    ///
+    /// * `u` -- Vector with dimension equal to the number of columns of the matrix
+    /// * `nthread` -- the number of threads
+    ///
+    /// # Output
+    ///
+    /// * `v` -- Vector with dimension equal to the number of rows of the matrix
+    ///
+    /// **Note:** Only the CSR matrix is processed in parallel (see [NumCsrMatrix::mat_vec_mul_parallel()]).
+    /// If the CSR matrix is not available, this function falls back to [NumSparseMatrix::mat_vec_mul()].
+    /// Use [NumSparseMatrix::get_csr_or_from_coo()] beforehand to make the CSR matrix available.
+    pub fn mat_vec_mul_parallel(
+        &self,
+        v: &mut NumVector<T>,
+        alpha: T,
+        u: &NumVector<T>,
+        nthread: usize,
+    ) -> Result<(), StrError> {
+        match &self.csr {
+            Some(csr) => csr.mat_vec_mul_parallel(v, alpha, u, nthread),
+            None => self.mat_vec_mul(v, alpha, u),
+        }
+    }
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #[cfg(test)]
@@ -500,6 +537,8 @@ mod tests {
         for mat in [&coo_mat, &csc_mat, &csr_mat] {
             mat.mat_vec_mul(&mut ax, 2.0, &x).unwrap();
             vec_approx_eq(&ax, &[80.0], 1e-15);
+            mat.mat_vec_mul_parallel(&mut ax, 2.0, &x, 2).unwrap();
+            vec_approx_eq(&ax, &[80.0], 1e-15);
             assert_eq!(
                 mat.mat_vec_mul(&mut wrong, 1.0, &x).err(),
                 Some("v vector is incompatible")
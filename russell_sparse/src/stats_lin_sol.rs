@@ -45,6 +45,43 @@ pub struct StatsLinSolOutput {
     pub umfpack_rcond_estimate: f64, // reciprocal condition number estimate
 }
 
+/// Holds information about the iterative solver
+#[derive(Clone, Debug, Default, Deserialize, Serialize)]
+pub struct StatsLinSolIterative {
+    pub method: String,
+    pub preconditioner: String,
+    pub iterations: usize,       // number of iterations of the last solve
+    pub total_iterations: usize, // number of iterations of all solves
+    pub relative_residual: f64,  // ‖b - A x‖ / ‖b‖ of the last solve
+    pub converged: bool,         // the last solve has converged
+}
+
+/// Holds the fill-in, flop count, and memory usage of the factorization
+///
+/// The values are given by the C interfaces; thus, the layout must match `struct FactorsInfo` in `constants.h`.
+/// The values not reported by a solver are zero; e.g., MUMPS does not report `nnz_l` and `nnz_u` and
+/// KLU does not report `memory_estimate_mb`.
+///
+/// * UMFPACK -- `Info[UMFPACK_LNZ]`, `Info[UMFPACK_UNZ]`, `Info[UMFPACK_FLOPS]`, `Info[UMFPACK_PEAK_MEMORY]`, ...
+/// * KLU -- `Numeric->lnz`, `Numeric->unz`, `Common.flops` (from `klu_flops`), `Common.mempeak`, `Common.nrealloc`, ...
+/// * MUMPS -- `INFOG(9)`, `INFOG(17)`, `INFOG(19)`, `INFOG(20)`, and `RINFOG(1..3)`
+#[repr(C)]
+#[derive(Clone, Copy, Debug, Default, Deserialize, Serialize)]
+pub struct StatsLinSolFactors {
+    pub nnz_a: i64,                // number of non-zeros of the factorized matrix
+    pub nnz_l: i64,                // number of entries in L (UMFPACK and KLU)
+    pub nnz_u: i64,                // number of entries in U (UMFPACK and KLU)
+    pub nnz_factors: i64,          // number of entries in the factors
+    pub nnz_factors_estimate: i64, // number of entries in the factors estimated by the analysis
+    pub num_reallocations: i64,    // number of reallocations during the factorization (UMFPACK and KLU)
+    pub fill_in_ratio: f64,        // nnz_factors / nnz_a
+    pub flops_estimate: f64,       // floating-point operations estimated by the analysis
+    pub flops_assembly: f64,       // floating-point operations of the assembly (MUMPS)
+    pub flops_elimination: f64,    // floating-point operations of the elimination (factorization)
+    pub memory_estimate_mb: f64,   // memory estimated by the analysis in MB
+    pub memory_peak_mb: f64,       // peak memory used by the factorization in MB
+}
+
 /// Holds the determinant of the coefficient matrix (if requested)
 #[derive(Clone, Debug, Deserialize, Serialize)]
 pub struct StatsLinSolDeterminant {
@@ -61,6 +98,8 @@ pub struct StatsLinSolDeterminant {
 #[derive(Clone, Debug, Deserialize, Serialize)]
 pub struct StatsLinSolTimeHuman {
     pub read_matrix: String,
+    #[serde(default)]
+    pub convert_matrix: String, // COO to CSC (or CSR) conversion (not included in total_ifs)
     pub initialize: String,
     pub factorize: String,
     pub solve: String,
@@ -72,6 +111,8 @@ pub struct StatsLinSolTimeHuman {
 #[derive(Clone, Debug, Deserialize, Serialize)]
 pub struct StatsLinSolTimeNanoseconds {
     pub read_matrix: u128,
+    #[serde(default)]
+    pub convert_matrix: u128, // COO to CSC (or CSR) conversion (not included in total_ifs)
     pub initialize: u128,
     pub factorize: u128,
     pub solve: u128,
@@ -91,6 +132,10 @@ pub struct StatsLinSol {
     pub time_human: StatsLinSolTimeHuman,
     pub time_nanoseconds: StatsLinSolTimeNanoseconds,
     pub mumps_stats: StatsLinSolMUMPS,
+    #[serde(default)]
+    pub iterative: StatsLinSolIterative,
+    #[serde(default)]
+    pub factors: StatsLinSolFactors,
 }
 
 impl StatsLinSol {
@@ -142,6 +187,7 @@ impl StatsLinSol {
             },
             time_human: StatsLinSolTimeHuman {
                 read_matrix: String::new(),
+                convert_matrix: String::new(),
                 initialize: String::new(),
                 factorize: String::new(),
                 solve: String::new(),
@@ -150,6 +196,7 @@ impl StatsLinSol {
             },
             time_nanoseconds: StatsLinSolTimeNanoseconds {
                 read_matrix: 0,
+                convert_matrix: 0,
                 initialize: 0,
                 factorize: 0,
                 solve: 0,
@@ -165,7 +212,21 @@ impl StatsLinSol {
                 normalized_delta_x: 0.0,
                 condition_number1: 0.0,
                 condition_number2: 0.0,
+                factors_entries: 0,
+                factors_entries_blr: 0,
+                ooc_estimated_memory_mb: 0,
+                effective_memory_mb: 0,
+                ooc_disk_mb: 0.0,
+            },
+            iterative: StatsLinSolIterative {
+                method: unknown.clone(),
+                preconditioner: unknown.clone(),
+                iterations: 0,
+                total_iterations: 0,
+                relative_residual: 0.0,
+                converged: false,
             },
+            factors: StatsLinSolFactors::default(),
         }
     }
 
@@ -227,6 +288,7 @@ impl StatsLinSol {
         self.time_nanoseconds.total_ifs =
             self.time_nanoseconds.initialize + self.time_nanoseconds.factorize + self.time_nanoseconds.solve;
         self.time_human.read_matrix = format_nanoseconds(self.time_nanoseconds.read_matrix);
+        self.time_human.convert_matrix = format_nanoseconds(self.time_nanoseconds.convert_matrix);
         self.time_human.initialize = format_nanoseconds(self.time_nanoseconds.initialize);
         self.time_human.factorize = format_nanoseconds(self.time_nanoseconds.factorize);
         self.time_human.solve = format_nanoseconds(self.time_nanoseconds.solve);
@@ -278,6 +340,7 @@ mod tests {
         let mut stats = StatsLinSol::new();
         const ONE_SECOND: u128 = 1000000000;
         stats.time_nanoseconds.read_matrix = ONE_SECOND;
+        stats.time_nanoseconds.convert_matrix = ONE_SECOND * 5;
         stats.time_nanoseconds.initialize = ONE_SECOND;
         stats.time_nanoseconds.factorize = ONE_SECOND * 2;
         stats.time_nanoseconds.solve = ONE_SECOND * 3;
@@ -286,6 +349,7 @@ mod tests {
         assert!(stats.output.openmp_num_threads > 0);
         assert_eq!(stats.time_nanoseconds.total_ifs, ONE_SECOND * 6);
         assert_eq!(stats.time_human.read_matrix, "1s");
+        assert_eq!(stats.time_human.convert_matrix, "5s");
         assert_eq!(stats.time_human.initialize, "1s");
         assert_eq!(stats.time_human.factorize, "2s");
         assert_eq!(stats.time_human.solve, "3s");
@@ -301,6 +365,8 @@ mod tests {
         assert_eq!(stats.matrix.name, "pre2");
         assert_eq!(stats.matrix.complex, false);
         assert_eq!(stats.matrix.symmetric, "No");
+        assert_eq!(stats.factors.nnz_factors, 0); // not available in older files
+        assert_eq!(stats.time_nanoseconds.convert_matrix, 0);
     }
 
     #[test]
@@ -308,6 +374,7 @@ mod tests {
         let mut stats = StatsLinSol::new();
         const ONE_SECOND: u128 = 1000000000;
         stats.time_nanoseconds.read_matrix = ONE_SECOND;
+        stats.time_nanoseconds.convert_matrix = ONE_SECOND * 5;
         stats.time_nanoseconds.initialize = ONE_SECOND;
         stats.time_nanoseconds.factorize = ONE_SECOND * 2;
         stats.time_nanoseconds.solve = ONE_SECOND * 3;
@@ -1,6 +1,6 @@
 use serde::{Deserialize, Serialize};
 
-/// Holds the results of MUMPS error analysis ("stats")
+/// Holds the results of MUMPS error analysis ("stats") and the size of the factors
 ///
 /// See page 40 of MUMPS User's guide
 ///
@@ -48,4 +48,30 @@ pub struct StatsLinSolMUMPS {
     ///
     /// Requires the full "stat" analysis.
     pub condition_number2: f64,
+
+    /// Holds the effective number of entries in the factors, INFOG(29)
+    #[serde(default)]
+    pub factors_entries: i64,
+
+    /// Holds the effective number of entries in the factors considering the BLR compression, INFOG(35)
+    ///
+    /// Equals `factors_entries` if BLR is not enabled.
+    #[serde(default)]
+    pub factors_entries_blr: i64,
+
+    /// Holds the estimated total memory in MB required by the out-of-core factorization, INFOG(27)
+    #[serde(default)]
+    pub ooc_estimated_memory_mb: i64,
+
+    /// Holds the total memory in MB effectively used by the factorization, INFOG(22)
+    ///
+    /// With the out-of-core mode, this is the in-core part only.
+    #[serde(default)]
+    pub effective_memory_mb: i64,
+
+    /// Holds the disk space in MB used by the out-of-core files storing the factors, RINFOG(16)
+    ///
+    /// Equals zero if the out-of-core mode is not enabled.
+    #[serde(default)]
+    pub ooc_disk_mb: f64,
 }
@@ -0,0 +1,182 @@
+use super::{CooMatrix, CscMatrix, Genie, Sym};
+use crate::StrError;
+use serde::{Deserialize, Serialize};
+use std::collections::hash_map::DefaultHasher;
+use std::hash::{Hash, Hasher};
+
+/// Holds the fill-reducing ordering computed by the symbolic analysis of a direct solver
+///
+/// The ordering (e.g., AMD or METIS) depends on the sparsity pattern only; thus, it may be computed once
+/// and given to other solvers (of the same kind) dealing with matrices with the same sparsity pattern.
+/// This skips the ordering step of the symbolic analysis (the most expensive part of the analysis).
+///
+/// The permutations are given as follows:
+///
+/// * UMFPACK -- the column pre-ordering (given to `umfpack_di_qsymbolic`); no row permutation
+/// * KLU -- the row and column permutations (given to `klu_analyze_given`)
+/// * MUMPS -- the pivot order (given as `perm_in` with `ICNTL(7) = 1`); no row permutation
+///
+/// **Note:** Use [SymbolicAnalysis::pattern_key_coo()] or [SymbolicAnalysis::pattern_key_csc()] to
+/// identify the sparsity pattern (see also [crate::SymbolicCache]).
+#[derive(Clone, Debug, PartialEq, Deserialize, Serialize)]
+pub struct SymbolicAnalysis {
+    /// Holds the solver that computed the ordering
+    pub(crate) genie: Genie,
+
+    /// Holds the symmetric flag of the analyzed matrix
+    pub(crate) symmetric: Sym,
+
+    /// Holds the dimension of the analyzed matrix
+    pub(crate) ndim: usize,
+
+    /// Holds the number of non-zeros of the analyzed matrix
+    pub(crate) nnz: usize,
+
+    /// Holds the (zero-based) row permutation (may be empty)
+    pub(crate) row_permutation: Vec<i32>,
+
+    /// Holds the (zero-based) column permutation or pivot order
+    pub(crate) col_permutation: Vec<i32>,
+}
+
+impl SymbolicAnalysis {
+    /// Returns the solver that computed the ordering
+    pub fn genie(&self) -> Genie {
+        self.genie
+    }
+
+    /// Returns the (nrow = ncol, nnz, sym) information of the analyzed matrix
+    pub fn get_info(&self) -> (usize, usize, Sym) {
+        (self.ndim, self.nnz, self.symmetric)
+    }
+
+    /// Returns the (zero-based) row permutation (may be empty)
+    pub fn get_row_permutation(&self) -> &[i32] {
+        &self.row_permutation
+    }
+
+    /// Returns the (zero-based) column permutation or pivot order
+    pub fn get_col_permutation(&self) -> &[i32] {
+        &self.col_permutation
+    }
+
+    /// Computes a key (hash) identifying the sparsity pattern of a COO matrix
+    ///
+    /// **Note:** The key depends on the order of the triples; thus, the matrices must be assembled in the same way.
+    pub fn pattern_key_coo(coo: &CooMatrix) -> u64 {
+        let mut hasher = DefaultHasher::new();
+        (coo.nrow, coo.ncol, coo.symmetric, coo.nnz).hash(&mut hasher);
+        coo.indices_i[..coo.nnz].hash(&mut hasher);
+        coo.indices_j[..coo.nnz].hash(&mut hasher);
+        hasher.finish()
+    }
+
+    /// Computes a key (hash) identifying the sparsity pattern of a CSC matrix
+    pub fn pattern_key_csc(csc: &CscMatrix) -> u64 {
+        let nnz = csc.col_pointers[csc.ncol] as usize;
+        let mut hasher = DefaultHasher::new();
+        (csc.nrow, csc.ncol, csc.symmetric).hash(&mut hasher);
+        csc.col_pointers.hash(&mut hasher);
+        csc.row_indices[..nnz].hash(&mut hasher);
+        hasher.finish()
+    }
+
+    /// Checks whether the ordering can be used by a solver with the given matrix data
+    pub(crate) fn validate(&self, genie: Genie, ndim: usize, nnz: usize, symmetric: Sym) -> Result<(), StrError> {
+        if self.genie != genie {
+            return Err("the symbolic analysis has been computed by another solver");
+        }
+        if self.ndim != ndim || self.nnz != nnz || self.symmetric != symmetric {
+            return Err("the symbolic analysis corresponds to another matrix (ndim, nnz, or sym differs)");
+        }
+        let n = ndim as i32;
+        let valid = |perm: &[i32]| perm.iter().all(|&k| k >= 0 && k < n);
+        if self.col_permutation.len() != ndim || !valid(&self.col_permutation) {
+            return Err("the column permutation of the symbolic analysis is invalid");
+        }
+        if self.row_permutation.len() != 0 && (self.row_permutation.len() != ndim || !valid(&self.row_permutation)) {
+            return Err("the row permutation of the symbolic analysis is invalid");
+        }
+        Ok(())
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#[cfg(test)]
+mod tests {
+    use super::SymbolicAnalysis;
+    use crate::{Genie, Samples, Sym};
+
+    #[test]
+    fn pattern_keys_work() {
+        let (coo_a, csc_a, _, _) = Samples::umfpack_unsymmetric_5x5();
+        let (mut coo_b, mut csc_b, _, _) = Samples::umfpack_unsymmetric_5x5();
+        assert_eq!(
+            SymbolicAnalysis::pattern_key_coo(&coo_a),
+            SymbolicAnalysis::pattern_key_coo(&coo_b)
+        );
+        assert_eq!(
+            SymbolicAnalysis::pattern_key_csc(&csc_a),
+            SymbolicAnalysis::pattern_key_csc(&csc_b)
+        );
+        // the values do not matter
+        coo_b.get_values_mut().iter_mut().for_each(|v| *v *= 2.0);
+        csc_b.get_values_mut().iter_mut().for_each(|v| *v *= 2.0);
+        assert_eq!(
+            SymbolicAnalysis::pattern_key_coo(&coo_a),
+            SymbolicAnalysis::pattern_key_coo(&coo_b)
+        );
+        assert_eq!(
+            SymbolicAnalysis::pattern_key_csc(&csc_a),
+            SymbolicAnalysis::pattern_key_csc(&csc_b)
+        );
+        // the pattern matters
+        let (coo_c, csc_c, _, _) = Samples::mkl_unsymmetric_5x5();
+        assert_ne!(
+            SymbolicAnalysis::pattern_key_coo(&coo_a),
+            SymbolicAnalysis::pattern_key_coo(&coo_c)
+        );
+        assert_ne!(
+            SymbolicAnalysis::pattern_key_csc(&csc_a),
+            SymbolicAnalysis::pattern_key_csc(&csc_c)
+        );
+    }
+
+    #[test]
+    fn validate_works() {
+        let analysis = SymbolicAnalysis {
+            genie: Genie::Klu,
+            symmetric: Sym::No,
+            ndim: 3,
+            nnz: 5,
+            row_permutation: vec![2, 1, 0],
+            col_permutation: vec![0, 2, 1],
+        };
+        assert_eq!(analysis.genie(), Genie::Klu);
+        assert_eq!(analysis.get_info(), (3, 5, Sym::No));
+        assert_eq!(analysis.get_row_permutation(), &[2, 1, 0]);
+        assert_eq!(analysis.get_col_permutation(), &[0, 2, 1]);
+        assert_eq!(analysis.validate(Genie::Klu, 3, 5, Sym::No), Ok(()));
+        assert_eq!(
+            analysis.validate(Genie::Umfpack, 3, 5, Sym::No).err(),
+            Some("the symbolic analysis has been computed by another solver")
+        );
+        assert_eq!(
+            analysis.validate(Genie::Klu, 3, 6, Sym::No).err(),
+            Some("the symbolic analysis corresponds to another matrix (ndim, nnz, or sym differs)")
+        );
+        let mut wrong = analysis.clone();
+        wrong.col_permutation = vec![0, 3, 1];
+        assert_eq!(
+            wrong.validate(Genie::Klu, 3, 5, Sym::No).err(),
+            Some("the column permutation of the symbolic analysis is invalid")
+        );
+        let mut wrong = analysis.clone();
+        wrong.row_permutation = vec![0, 1];
+        assert_eq!(
+            wrong.validate(Genie::Klu, 3, 5, Sym::No).err(),
+            Some("the row permutation of the symbolic analysis is invalid")
+        );
+    }
+}
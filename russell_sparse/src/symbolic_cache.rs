@@ -0,0 +1,255 @@
+use super::{Genie, LinSolParams, LinSolver, SparseMatrix, SymbolicAnalysis};
+use crate::StrError;
+use std::collections::HashMap;
+
+/// Holds the fill-reducing orderings of the direct solvers keyed by the sparsity pattern of the matrix
+///
+/// This cache is useful when many (short-lived) solvers are allocated to factorize matrices sharing the same
+/// sparsity pattern (e.g., one per subdomain or one per parameter of a sweep). The first solver of each
+/// pattern computes the ordering (e.g., AMD or METIS); the next solvers reuse it, skipping the ordering step.
+///
+/// The key is computed from the CSC matrix (UMFPACK and KLU) or the COO matrix (MUMPS); see
+/// [SymbolicAnalysis::pattern_key_csc()] and [SymbolicAnalysis::pattern_key_coo()].
+///
+/// # Examples
+///
+/// ```
+/// use russell_lab::{vec_approx_eq, Vector};
+/// use russell_sparse::prelude::*;
+/// use russell_sparse::StrError;
+///
+/// fn main() -> Result<(), StrError> {
+///     let mut cache = SymbolicCache::new();
+///     let rhs = Vector::from(&[1.0, 2.0]);
+///     let mut x = Vector::new(2);
+///     for k in 1..4 {
+///         // same sparsity pattern; different values
+///         let mut mat = SparseMatrix::new_coo(2, 2, 3, Sym::No)?;
+///         mat.put(0, 0, k as f64)?;
+///         mat.put(1, 0, 1.0)?;
+///         mat.put(1, 1, 1.0)?;
+///         let mut solver = cache.factorize(Genie::Umfpack, &mut mat, None)?;
+///         solver.actual.solve(&mut x, &mat, &rhs, false)?;
+///         vec_approx_eq(&x, &[1.0 / (k as f64), 2.0 - 1.0 / (k as f64)], 1e-15);
+///     }
+///     assert_eq!(cache.len(), 1);
+///     assert_eq!(cache.get_hits_and_misses(), (2, 1));
+///     Ok(())
+/// }
+/// ```
+pub struct SymbolicCache {
+    /// Holds the orderings keyed by (genie, pattern key)
+    analyses: HashMap<(Genie, u64), SymbolicAnalysis>,
+
+    /// Holds the number of times an ordering has been reused
+    hits: usize,
+
+    /// Holds the number of times an ordering had to be computed
+    misses: usize,
+}
+
+impl SymbolicCache {
+    /// Allocates a new (empty) instance
+    pub fn new() -> Self {
+        SymbolicCache {
+            analyses: HashMap::new(),
+            hits: 0,
+            misses: 0,
+        }
+    }
+
+    /// Returns the number of cached orderings
+    pub fn len(&self) -> usize {
+        self.analyses.len()
+    }
+
+    /// Returns the number of reused orderings (hits) and computed orderings (misses)
+    pub fn get_hits_and_misses(&self) -> (usize, usize) {
+        (self.hits, self.misses)
+    }
+
+    /// Removes all cached orderings and resets the numbers of hits and misses
+    pub fn clear(&mut self) {
+        self.analyses.clear();
+        self.hits = 0;
+        self.misses = 0;
+    }
+
+    /// Returns the cached ordering, if any
+    pub fn get(&self, genie: Genie, pattern_key: u64) -> Option<&SymbolicAnalysis> {
+        self.analyses.get(&(genie, pattern_key))
+    }
+
+    /// Inserts an ordering into the cache (e.g., computed by another cache or loaded from a file)
+    pub fn insert(&mut self, pattern_key: u64, analysis: SymbolicAnalysis) {
+        self.analyses.insert((analysis.genie, pattern_key), analysis);
+    }
+
+    /// Computes the key identifying the sparsity pattern of the matrix as seen by the solver
+    ///
+    /// Returns None if the solver does not perform a symbolic analysis (e.g., the iterative solver).
+    pub fn pattern_key(genie: Genie, mat: &mut SparseMatrix) -> Result<Option<u64>, StrError> {
+        match genie {
+            Genie::Klu | Genie::Umfpack => Ok(Some(SymbolicAnalysis::pattern_key_csc(mat.get_csc_or_from_coo()?))),
+            Genie::Mumps => Ok(Some(SymbolicAnalysis::pattern_key_coo(mat.get_coo()?))),
+            Genie::Iterative | Genie::Auto => Ok(None),
+        }
+    }
+
+    /// Allocates a new solver and performs the factorization, reusing the cached ordering if available
+    ///
+    /// # Input
+    ///
+    /// * `genie` -- the actual implementation
+    /// * `mat` -- the coefficient matrix (see [crate::LinSolTrait::factorize()])
+    /// * `params` -- configuration parameters; None => use default
+    ///
+    /// # Output
+    ///
+    /// Returns the factorized solver. If the ordering was not in the cache, the ordering computed
+    /// by the solver is cached.
+    pub fn factorize(
+        &mut self,
+        genie: Genie,
+        mat: &mut SparseMatrix,
+        params: Option<LinSolParams>,
+    ) -> Result<LinSolver<'static>, StrError> {
+        let mut solver = LinSolver::new(genie)?;
+        let key = match SymbolicCache::pattern_key(genie, mat)? {
+            Some(k) => k,
+            None => {
+                solver.actual.factorize(mat, params)?;
+                return Ok(solver);
+            }
+        };
+        match self.analyses.get(&(genie, key)) {
+            Some(analysis) => {
+                solver.actual.set_symbolic_analysis(analysis)?;
+                solver.actual.factorize(mat, params)?;
+                self.hits += 1;
+            }
+            None => {
+                solver.actual.factorize(mat, params)?;
+                if let Some(analysis) = solver.actual.get_symbolic_analysis() {
+                    self.analyses.insert((genie, key), analysis.clone());
+                }
+                self.misses += 1;
+            }
+        }
+        Ok(solver)
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#[cfg(test)]
+mod tests {
+    use super::SymbolicCache;
+    use crate::{Genie, LinSolParams, LinSolver, Ordering, Samples, SparseMatrix, StatsLinSol, SymbolicAnalysis};
+    use russell_lab::{vec_approx_eq, Vector};
+
+    #[test]
+    fn factorize_reuses_the_ordering() {
+        let rhs = Vector::from(&[8.0, 45.0, -3.0, 3.0, 19.0]);
+        let x_correct = &[1.0, 2.0, 3.0, 4.0, 5.0];
+        let mut x = Vector::new(5);
+        for genie in [Genie::Umfpack, Genie::Klu] {
+            let mut params = LinSolParams::new();
+            params.ordering = Ordering::Amd;
+            let mut cache = SymbolicCache::new();
+            for _ in 0..3 {
+                let (coo, _, _, _) = Samples::umfpack_unsymmetric_5x5();
+                let mut mat = SparseMatrix::from_coo(coo);
+                let mut solver = cache.factorize(genie, &mut mat, Some(params)).unwrap();
+                solver.actual.solve(&mut x, &mat, &rhs, false).unwrap();
+                vec_approx_eq(&x, x_correct, 1e-14);
+                let analysis = solver.actual.get_symbolic_analysis().unwrap();
+                assert_eq!(analysis.genie(), genie);
+                assert_eq!(analysis.get_col_permutation().len(), 5);
+            }
+            assert_eq!(cache.len(), 1);
+            assert_eq!(cache.get_hits_and_misses(), (2, 1));
+
+            // another pattern
+            let (coo, _, _, _) = Samples::mkl_unsymmetric_5x5();
+            let mut mat = SparseMatrix::from_coo(coo);
+            cache.factorize(genie, &mut mat, None).unwrap();
+            assert_eq!(cache.len(), 2);
+            assert_eq!(cache.get_hits_and_misses(), (2, 2));
+            cache.clear();
+            assert_eq!(cache.len(), 0);
+            assert_eq!(cache.get_hits_and_misses(), (0, 0));
+        }
+    }
+
+    #[test]
+    fn get_and_insert_work() {
+        let (coo, _, _, _) = Samples::umfpack_unsymmetric_5x5();
+        let mut mat = SparseMatrix::from_coo(coo);
+        let key = SymbolicCache::pattern_key(Genie::Klu, &mut mat).unwrap().unwrap();
+        assert_eq!(
+            key,
+            SymbolicAnalysis::pattern_key_csc(&Samples::umfpack_unsymmetric_5x5().1)
+        );
+        assert_eq!(SymbolicCache::pattern_key(Genie::Iterative, &mut mat).unwrap(), None);
+        assert_eq!(SymbolicCache::pattern_key(Genie::Auto, &mut mat).unwrap(), None);
+
+        // compute
+        let mut solver = LinSolver::new(Genie::Klu).unwrap();
+        solver.actual.factorize(&mut mat, None).unwrap();
+        let analysis = solver.actual.get_symbolic_analysis().unwrap().clone();
+
+        // insert into another cache
+        let mut cache = SymbolicCache::new();
+        assert_eq!(cache.get(Genie::Klu, key), None);
+        cache.insert(key, analysis.clone());
+        assert_eq!(cache.get(Genie::Klu, key), Some(&analysis));
+        assert_eq!(cache.get(Genie::Umfpack, key), None);
+        let solver = cache.factorize(Genie::Klu, &mut mat, None).unwrap();
+        assert_eq!(solver.actual.get_symbolic_analysis(), Some(&analysis));
+        assert_eq!(cache.get_hits_and_misses(), (1, 0));
+
+        // the iterative solver is not cached
+        let mut solver = cache.factorize(Genie::Iterative, &mut mat, None);
+        assert!(solver.is_err()); // the UMFPACK sample has zero diagonal entries (ILU(0) fails)
+        let (coo, _, _, _) = Samples::mkl_unsymmetric_5x5();
+        let mut mat = SparseMatrix::from_coo(coo);
+        solver = cache.factorize(Genie::Iterative, &mut mat, None);
+        let mut stats = StatsLinSol::new();
+        solver.unwrap().actual.update_stats(&mut stats);
+        assert_eq!(stats.main.solver, "Iterative");
+        assert_eq!(cache.len(), 1);
+    }
+
+    #[test]
+    fn set_symbolic_analysis_captures_errors() {
+        let (coo, _, _, _) = Samples::umfpack_unsymmetric_5x5();
+        let mut mat = SparseMatrix::from_coo(coo);
+        let mut klu = LinSolver::new(Genie::Klu).unwrap();
+        klu.actual.factorize(&mut mat, None).unwrap();
+        let analysis = klu.actual.get_symbolic_analysis().unwrap().clone();
+        assert_eq!(
+            klu.actual.set_symbolic_analysis(&analysis).err(),
+            Some("the symbolic analysis must be set before the first factorization")
+        );
+        let mut umfpack = LinSolver::new(Genie::Umfpack).unwrap();
+        assert_eq!(
+            umfpack.actual.set_symbolic_analysis(&analysis).err(),
+            Some("the symbolic analysis has been computed by another solver")
+        );
+        let mut iterative = LinSolver::new(Genie::Iterative).unwrap();
+        assert_eq!(
+            iterative.actual.set_symbolic_analysis(&analysis).err(),
+            Some("the symbolic analysis cannot be set for this solver")
+        );
+        // wrong matrix
+        let mut klu = LinSolver::new(Genie::Klu).unwrap();
+        klu.actual.set_symbolic_analysis(&analysis).unwrap();
+        let (coo, _, _, _) = Samples::mkl_unsymmetric_5x5();
+        let mut other = SparseMatrix::from_coo(coo);
+        assert_eq!(
+            klu.actual.factorize(&mut other, None).err(),
+            Some("the symbolic analysis corresponds to another matrix (ndim, nnz, or sym differs)")
+        );
+    }
+}
@@ -1,4 +1,4 @@
-use crate::{ProbabilityDistribution, StrError};
+use crate::{fill_open_01, ProbabilityDistribution, StrError};
 use rand::Rng;
 use rand_distr::{Distribution, Frechet};
 use russell_lab::math::gamma;
@@ -154,6 +154,15 @@ impl ProbabilityDistribution for DistributionFrechet {
     fn sample<R: Rng + ?Sized>(&self, rng: &mut R) -> f64 {
         self.sampler.sample(rng)
     }
+
+    /// Fills a slice with pseudo-random numbers belonging to this probability distribution
+    fn sample_into<R: Rng + ?Sized>(&self, out: &mut [f64], rng: &mut R) {
+        fill_open_01(out, rng);
+        let p = -1.0 / self.shape;
+        for v in out.iter_mut() {
+            *v = self.location + self.scale * f64::powf(-f64::ln(*v), p);
+        }
+    }
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
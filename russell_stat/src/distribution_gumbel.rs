@@ -1,4 +1,4 @@
-use crate::{ProbabilityDistribution, StrError};
+use crate::{fill_open_01, ProbabilityDistribution, StrError};
 use rand::Rng;
 use rand_distr::{Distribution, Gumbel};
 use russell_lab::math::{EULER, PI, SQRT_6};
@@ -152,6 +152,14 @@ impl ProbabilityDistribution for DistributionGumbel {
     fn sample<R: Rng + ?Sized>(&self, rng: &mut R) -> f64 {
         self.sampler.sample(rng)
     }
+
+    /// Fills a slice with pseudo-random numbers belonging to this probability distribution
+    fn sample_into<R: Rng + ?Sized>(&self, out: &mut [f64], rng: &mut R) {
+        fill_open_01(out, rng);
+        for v in out.iter_mut() {
+            *v = self.location - self.scale * f64::ln(-f64::ln(*v));
+        }
+    }
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
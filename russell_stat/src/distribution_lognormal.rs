@@ -1,4 +1,4 @@
-use crate::{ProbabilityDistribution, StrError};
+use crate::{fill_standard_normal, ProbabilityDistribution, StrError};
 use rand::Rng;
 use rand_distr::{Distribution, LogNormal};
 use russell_lab::math::{erf, SQRT_2, SQRT_PI};
@@ -160,6 +160,14 @@ impl ProbabilityDistribution for DistributionLognormal {
     fn sample<R: Rng + ?Sized>(&self, rng: &mut R) -> f64 {
         self.sampler.sample(rng)
     }
+
+    /// Fills a slice with pseudo-random numbers belonging to this probability distribution
+    fn sample_into<R: Rng + ?Sized>(&self, out: &mut [f64], rng: &mut R) {
+        fill_standard_normal(out, rng);
+        for v in out.iter_mut() {
+            *v = f64::exp(self.mu_logx + self.sig_logx * *v);
+        }
+    }
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
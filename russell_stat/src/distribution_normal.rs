@@ -1,4 +1,4 @@
-use crate::{ProbabilityDistribution, StrError};
+use crate::{fill_standard_normal, ProbabilityDistribution, StrError};
 use rand::Rng;
 use rand_distr::{Distribution, Normal};
 use russell_lab::math::{erf, SQRT_2, SQRT_PI};
@@ -123,6 +123,14 @@ impl ProbabilityDistribution for DistributionNormal {
     fn sample<R: Rng + ?Sized>(&self, rng: &mut R) -> f64 {
         self.sampler.sample(rng)
     }
+
+    /// Fills a slice with pseudo-random numbers belonging to this probability distribution
+    fn sample_into<R: Rng + ?Sized>(&self, out: &mut [f64], rng: &mut R) {
+        fill_standard_normal(out, rng);
+        for v in out.iter_mut() {
+            *v = self.mu + self.sig * *v;
+        }
+    }
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1,4 +1,4 @@
-use crate::{ProbabilityDistribution, StrError};
+use crate::{fill_open_01, ProbabilityDistribution, StrError};
 use rand::Rng;
 use rand_distr::{Distribution, Uniform};
 
@@ -131,6 +131,15 @@ impl ProbabilityDistribution for DistributionUniform {
     fn sample<R: Rng + ?Sized>(&self, rng: &mut R) -> f64 {
         self.sampler.sample(rng)
     }
+
+    /// Fills a slice with pseudo-random numbers belonging to this probability distribution
+    fn sample_into<R: Rng + ?Sized>(&self, out: &mut [f64], rng: &mut R) {
+        fill_open_01(out, rng);
+        let delta = self.xmax - self.xmin;
+        for v in out.iter_mut() {
+            *v = self.xmin + delta * *v;
+        }
+    }
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -97,6 +97,20 @@ where
         }
     }
 
+    /// Adds the counts of another histogram (with the same stations) to this one
+    ///
+    /// This function is useful to combine the histograms computed in parallel (e.g., one per thread).
+    pub fn merge(&mut self, other: &Histogram<T>) -> Result<(), StrError> {
+        if other.stations.len() != self.stations.len() || other.stations.iter().zip(&self.stations).any(|(a, b)| a != b)
+        {
+            return Err("histograms must have the same stations");
+        }
+        for (c, o) in self.counts.iter_mut().zip(&other.counts) {
+            *c += *o;
+        }
+        Ok(())
+    }
+
     /// Erase all counts
     pub fn reset(&mut self) {
         for i in 0..self.counts.len() {
@@ -104,6 +118,11 @@ where
         }
     }
 
+    /// Returns a read-only access to the stations
+    pub fn get_stations(&self) -> &Vec<T> {
+        &self.stations
+    }
+
     /// Returns a read-only access to the counts (frequencies)
     pub fn get_counts(&self) -> &Vec<usize> {
         &self.counts
@@ -370,4 +389,20 @@ mod tests {
              \x20\x20\x20sum = 20\n"
         );
     }
+
+    #[test]
+    fn merge_works() {
+        let stations = [0.0, 1.0, 2.0, 3.0];
+        let mut a = Histogram::new(&stations).unwrap();
+        let mut b = Histogram::new(&stations).unwrap();
+        a.count(&[0.5, 1.5, 2.5, 2.6]);
+        b.count(&[0.1, 2.9, 3.5]);
+        a.merge(&b).unwrap();
+        assert_eq!(a.get_counts(), &[2, 1, 3]);
+        assert_eq!(a.get_stations(), &stations);
+        let c = Histogram::new(&[0.0, 1.0, 2.0, 4.0]).unwrap();
+        assert_eq!(a.merge(&c).err(), Some("histograms must have the same stations"));
+        let d = Histogram::new(&[0.0, 1.0]).unwrap();
+        assert_eq!(a.merge(&d).err(), Some("histograms must have the same stations"));
+    }
 }
@@ -29,6 +29,7 @@ mod distribution_normal;
 mod distribution_uniform;
 mod histogram;
 mod probability_distribution;
+mod sampling;
 mod statistics;
 pub use crate::distribution_frechet::*;
 pub use crate::distribution_gumbel::*;
@@ -37,6 +38,7 @@ pub use crate::distribution_normal::*;
 pub use crate::distribution_uniform::*;
 pub use crate::histogram::*;
 pub use crate::probability_distribution::*;
+pub use crate::sampling::*;
 pub use crate::statistics::*;
 
 // run code from README file
@@ -66,4 +66,17 @@ pub trait ProbabilityDistribution {
 
     /// Generates a pseudo-random number belonging to this probability distribution
     fn sample<R: Rng + ?Sized>(&self, rng: &mut R) -> f64;
+
+    /// Fills a slice with pseudo-random numbers belonging to this probability distribution
+    ///
+    /// The default implementation calls [ProbabilityDistribution::sample()] for each entry. The distributions
+    /// may override this method to generate the uniform numbers first and then apply the transform in a
+    /// separate (branch-free) pass over the slice.
+    ///
+    /// **Note:** The sequence of numbers may differ from the one obtained by calling `sample` repeatedly.
+    fn sample_into<R: Rng + ?Sized>(&self, out: &mut [f64], rng: &mut R) {
+        for v in out.iter_mut() {
+            *v = self.sample(rng);
+        }
+    }
 }
@@ -0,0 +1,313 @@
+use crate::{Histogram, ProbabilityDistribution, StatisticsAccumulator, StrError};
+use rand::rngs::StdRng;
+use rand::{Rng, SeedableRng};
+use russell_lab::math::PI;
+use std::sync::Mutex;
+use std::thread;
+
+/// Defines the number of samples generated with the same random number stream
+///
+/// The samples are split into chunks of this size and the i-th chunk is always generated with the
+/// stream `get_rng_stream(seed, i)`; thus, the results do not depend on the number of threads.
+pub const SAMPLING_CHUNK_SIZE: usize = 65536;
+
+/// Implements the SplitMix64 mixing function (used to derive seeds)
+fn split_mix_64(x: u64) -> u64 {
+    let mut z = x.wrapping_add(0x9E3779B97F4A7C15);
+    z = (z ^ (z >> 30)).wrapping_mul(0xBF58476D1CE4E5B9);
+    z = (z ^ (z >> 27)).wrapping_mul(0x94D049BB133111EB);
+    z ^ (z >> 31)
+}
+
+/// Returns a reproducible random number generator for a given seed and stream index
+///
+/// Different stream indices yield (statistically) independent sequences; thus, each thread or
+/// chunk of work may use its own stream while the whole computation remains reproducible.
+///
+/// # Examples
+///
+/// ```
+/// use russell_stat::*;
+/// use rand::Rng;
+///
+/// let mut rng_a = get_rng_stream(1234, 0);
+/// let mut rng_b = get_rng_stream(1234, 0);
+/// assert_eq!(rng_a.gen::<u64>(), rng_b.gen::<u64>());
+/// ```
+pub fn get_rng_stream(seed: u64, stream: u64) -> StdRng {
+    StdRng::seed_from_u64(split_mix_64(seed ^ split_mix_64(stream)))
+}
+
+/// Returns a uniformly distributed pseudo-random number in the open interval (0, 1)
+#[inline]
+pub(crate) fn sample_open_01<R: Rng + ?Sized>(rng: &mut R) -> f64 {
+    const SCALE: f64 = 1.0 / ((1_u64 << 53) as f64);
+    ((rng.gen::<u64>() >> 11) as f64 + 0.5) * SCALE
+}
+
+/// Fills a slice with uniformly distributed pseudo-random numbers in the open interval (0, 1)
+pub(crate) fn fill_open_01<R: Rng + ?Sized>(out: &mut [f64], rng: &mut R) {
+    for v in out.iter_mut() {
+        *v = sample_open_01(rng);
+    }
+}
+
+/// Fills a slice with standard normal pseudo-random numbers (Box-Muller transform)
+///
+/// The uniform numbers are generated first (in `out`); then, the transform is applied in a separate pass.
+pub(crate) fn fill_standard_normal<R: Rng + ?Sized>(out: &mut [f64], rng: &mut R) {
+    fill_open_01(out, rng);
+    let mut pairs = out.chunks_exact_mut(2);
+    for p in &mut pairs {
+        let r = f64::sqrt(-2.0 * f64::ln(p[0]));
+        let (s, c) = f64::sin_cos(2.0 * PI * p[1]);
+        p[0] = r * c;
+        p[1] = r * s;
+    }
+    for v in pairs.into_remainder() {
+        let r = f64::sqrt(-2.0 * f64::ln(*v));
+        *v = r * f64::cos(2.0 * PI * sample_open_01(rng));
+    }
+}
+
+/// Runs `task(chunk_index, chunk)` over the chunks of `out` using a number of threads
+fn run_chunks<T>(out: &mut [f64], n_thread: usize, task: T)
+where
+    T: Fn(usize, &mut [f64]) + Sync,
+{
+    let queue = Mutex::new(out.chunks_mut(SAMPLING_CHUNK_SIZE).enumerate());
+    thread::scope(|scope| {
+        for _ in 0..usize::max(1, n_thread) {
+            scope.spawn(|| loop {
+                let next = queue.lock().unwrap().next();
+                match next {
+                    Some((index, chunk)) => task(index, chunk),
+                    None => break,
+                }
+            });
+        }
+    });
+}
+
+/// Fills a slice with samples of a probability distribution using a number of threads
+///
+/// The results are reproducible and independent of `n_thread` (see [SAMPLING_CHUNK_SIZE]).
+///
+/// # Examples
+///
+/// ```
+/// use russell_stat::*;
+///
+/// fn main() -> Result<(), StrError> {
+///     let dist = DistributionNormal::new(1.0, 0.5)?;
+///     let mut a = vec![0.0; 100_000];
+///     let mut b = vec![0.0; 100_000];
+///     sample_parallel(&mut a, &dist, 1234, 1);
+///     sample_parallel(&mut b, &dist, 1234, 4);
+///     assert_eq!(a, b);
+///     Ok(())
+/// }
+/// ```
+pub fn sample_parallel<D>(out: &mut [f64], dist: &D, seed: u64, n_thread: usize)
+where
+    D: ProbabilityDistribution + Sync,
+{
+    run_chunks(out, n_thread, |index, chunk| {
+        let mut rng = get_rng_stream(seed, index as u64);
+        dist.sample_into(chunk, &mut rng);
+    });
+}
+
+/// Generates samples of a probability distribution and accumulates their statistics (and histogram)
+///
+/// The samples are generated in chunks (see [SAMPLING_CHUNK_SIZE]) by a number of threads and are
+/// never stored all at once; thus, very large Monte Carlo simulations can be carried out with bounded memory.
+/// The statistics of the chunks are merged in order; thus, the results do not depend on `n_thread`.
+///
+/// # Input
+///
+/// * `dist` -- the probability distribution
+/// * `n_sample` -- the total number of samples
+/// * `seed` -- the seed of the random number streams
+/// * `n_thread` -- the number of threads
+/// * `histogram` -- (optional) a histogram to count the samples (the counts are added to the current ones)
+///
+/// # Examples
+///
+/// ```
+/// use russell_lab::approx_eq;
+/// use russell_stat::*;
+///
+/// fn main() -> Result<(), StrError> {
+///     let dist = DistributionUniform::new(0.0, 2.0)?;
+///     let mut hist = Histogram::new(&[0.0, 0.5, 1.0, 1.5, 2.0])?;
+///     let acc = sample_accumulate(&dist, 1_000_000, 1234, 4, Some(&mut hist))?;
+///     let stat = acc.get_statistics();
+///     approx_eq(stat.mean, 1.0, 1e-2);
+///     assert_eq!(hist.get_counts().iter().sum::<usize>(), 1_000_000);
+///     Ok(())
+/// }
+/// ```
+pub fn sample_accumulate<D>(
+    dist: &D,
+    n_sample: usize,
+    seed: u64,
+    n_thread: usize,
+    histogram: Option<&mut Histogram<f64>>,
+) -> Result<StatisticsAccumulator, StrError>
+where
+    D: ProbabilityDistribution + Sync,
+{
+    let n_chunk = (n_sample + SAMPLING_CHUNK_SIZE - 1) / SAMPLING_CHUNK_SIZE;
+    let accumulators = Mutex::new(vec![StatisticsAccumulator::new(); n_chunk]);
+    let stations = histogram.as_ref().map(|h| h.get_stations().to_vec());
+    let hist_total = match &stations {
+        Some(s) => Some(Mutex::new(Histogram::new(s)?)),
+        None => None,
+    };
+    let queue = Mutex::new(0..n_chunk);
+    thread::scope(|scope| {
+        for _ in 0..usize::max(1, n_thread) {
+            scope.spawn(|| {
+                let mut buffer = vec![0.0; SAMPLING_CHUNK_SIZE];
+                let mut hist_local = stations.as_ref().map(|s| Histogram::new(s).unwrap());
+                loop {
+                    let next = queue.lock().unwrap().next();
+                    let index = match next {
+                        Some(i) => i,
+                        None => break,
+                    };
+                    let len = usize::min(SAMPLING_CHUNK_SIZE, n_sample - index * SAMPLING_CHUNK_SIZE);
+                    let chunk = &mut buffer[..len];
+                    let mut rng = get_rng_stream(seed, index as u64);
+                    dist.sample_into(chunk, &mut rng);
+                    let mut acc = StatisticsAccumulator::new();
+                    acc.push_slice(chunk);
+                    accumulators.lock().unwrap()[index] = acc;
+                    if let Some(h) = hist_local.as_mut() {
+                        h.count(chunk);
+                    }
+                }
+                if let (Some(total), Some(h)) = (hist_total.as_ref(), hist_local.as_ref()) {
+                    total.lock().unwrap().merge(h).unwrap();
+                }
+            });
+        }
+    });
+    let mut result = StatisticsAccumulator::new();
+    for acc in accumulators.into_inner().unwrap().iter() {
+        result.merge(acc);
+    }
+    if let (Some(h), Some(total)) = (histogram, hist_total) {
+        h.merge(&total.into_inner().unwrap())?;
+    }
+    Ok(result)
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#[cfg(test)]
+mod tests {
+    use super::SAMPLING_CHUNK_SIZE;
+    use super::{fill_open_01, fill_standard_normal, get_rng_stream, sample_accumulate, sample_parallel};
+    use crate::{statistics, DistributionFrechet, DistributionGumbel, DistributionLognormal};
+    use crate::{DistributionNormal, DistributionUniform, Histogram, ProbabilityDistribution};
+    use rand::Rng;
+    use russell_lab::approx_eq;
+
+    #[test]
+    fn get_rng_stream_works() {
+        let mut a = get_rng_stream(1, 0);
+        let mut b = get_rng_stream(1, 0);
+        let mut c = get_rng_stream(1, 1);
+        let mut d = get_rng_stream(2, 0);
+        let (va, vb, vc, vd) = (a.gen::<u64>(), b.gen::<u64>(), c.gen::<u64>(), d.gen::<u64>());
+        assert_eq!(va, vb);
+        assert_ne!(va, vc);
+        assert_ne!(va, vd);
+    }
+
+    #[test]
+    fn fill_functions_work() {
+        let mut rng = get_rng_stream(1234, 0);
+        let mut u = vec![0.0; 10_001];
+        fill_open_01(&mut u, &mut rng);
+        assert!(u.iter().all(|v| *v > 0.0 && *v < 1.0));
+        let stat = statistics(&u);
+        approx_eq(stat.mean, 0.5, 1e-2);
+        fill_standard_normal(&mut u, &mut rng);
+        assert!(u.iter().all(|v| v.is_finite()));
+        let stat = statistics(&u);
+        approx_eq(stat.mean, 0.0, 3e-2);
+        approx_eq(stat.std_dev, 1.0, 3e-2);
+    }
+
+    /// Checks the mean and standard deviation of the samples generated by sample_into
+    fn check_sample_into<D: ProbabilityDistribution>(dist: &D) {
+        let mut rng = get_rng_stream(1234, 0);
+        let mut x = vec![0.0; 200_001]; // odd length (see fill_standard_normal)
+        dist.sample_into(&mut x, &mut rng);
+        let stat = statistics(&x);
+        approx_eq(stat.mean, dist.mean(), 2e-2);
+        approx_eq(stat.std_dev, f64::sqrt(dist.variance()), 2e-2);
+    }
+
+    #[test]
+    fn sample_into_works() {
+        check_sample_into(&DistributionUniform::new(1.0, 3.0).unwrap());
+        check_sample_into(&DistributionNormal::new(1.0, 2.0).unwrap());
+        check_sample_into(&DistributionLognormal::new(0.5, 0.25).unwrap());
+        check_sample_into(&DistributionGumbel::new(1.0, 2.0).unwrap());
+        check_sample_into(&DistributionFrechet::new(1.0, 2.0, 5.0).unwrap());
+    }
+
+    #[test]
+    fn sample_parallel_is_reproducible() {
+        let dist = DistributionGumbel::new(1.0, 2.0).unwrap();
+        let n = 2 * SAMPLING_CHUNK_SIZE + 123;
+        let mut a = vec![0.0; n];
+        let mut b = vec![0.0; n];
+        sample_parallel(&mut a, &dist, 7, 1);
+        sample_parallel(&mut b, &dist, 7, 3);
+        assert_eq!(a, b);
+        sample_parallel(&mut b, &dist, 8, 3);
+        assert_ne!(a, b);
+    }
+
+    #[test]
+    fn sample_accumulate_works() {
+        let dist = DistributionNormal::new(1.0, 0.5).unwrap();
+        let n = 3 * SAMPLING_CHUNK_SIZE + 17;
+
+        // reference: all samples stored
+        let mut all = vec![0.0; n];
+        sample_parallel(&mut all, &dist, 99, 2);
+        let reference = statistics(&all);
+        let stations = [-1.0, 0.0, 1.0, 2.0, 3.0];
+        let mut hist_ref = Histogram::new(&stations).unwrap();
+        hist_ref.count(&all);
+
+        // streaming
+        for n_thread in [1, 4] {
+            let mut hist = Histogram::new(&stations).unwrap();
+            let acc = sample_accumulate(&dist, n, 99, n_thread, Some(&mut hist)).unwrap();
+            assert_eq!(acc.count(), n);
+            let stat = acc.get_statistics();
+            assert_eq!(stat.min, reference.min);
+            assert_eq!(stat.max, reference.max);
+            approx_eq(stat.mean, reference.mean, 1e-14);
+            approx_eq(stat.std_dev, reference.std_dev, 1e-14);
+            assert_eq!(hist.get_counts(), hist_ref.get_counts());
+        }
+
+        // the results do not depend on the number of threads
+        let a = sample_accumulate(&dist, n, 99, 1, None).unwrap().get_statistics();
+        let b = sample_accumulate(&dist, n, 99, 3, None).unwrap().get_statistics();
+        assert_eq!(a.mean, b.mean);
+        assert_eq!(a.std_dev, b.std_dev);
+
+        // zero samples
+        let acc = sample_accumulate(&dist, 0, 99, 2, None).unwrap();
+        assert_eq!(acc.count(), 0);
+    }
+}
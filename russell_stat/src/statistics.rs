@@ -97,6 +97,151 @@ where
     }
 }
 
+/// Accumulates basic statistics of a stream of data in a single pass (mergeable)
+///
+/// The mean and the sum of squared deviations are updated with Welford's algorithm, and two accumulators
+/// are merged with the formula of Chan et al.; thus, the statistics of very large datasets may be
+/// computed in parallel (e.g., one accumulator per thread) without storing the data.
+///
+/// # Examples
+///
+/// ```
+/// use russell_lab::approx_eq;
+/// use russell_stat::StatisticsAccumulator;
+///
+/// let mut a = StatisticsAccumulator::new();
+/// let mut b = StatisticsAccumulator::new();
+/// a.push_slice(&[2, 4, 4, 4]);
+/// b.push_slice(&[5, 5, 7, 9]);
+/// a.merge(&b);
+/// let res = a.get_statistics();
+/// assert_eq!(res.min, 2.0);
+/// assert_eq!(res.max, 9.0);
+/// assert_eq!(res.mean, 5.0);
+/// approx_eq(res.std_dev, f64::sqrt(32.0 / 7.0), 1e-15);
+/// ```
+#[derive(Clone, Copy, Debug)]
+pub struct StatisticsAccumulator {
+    /// Number of values
+    count: usize,
+
+    /// Arithmetic mean
+    mean: f64,
+
+    /// Sum of squared deviations from the mean
+    m2: f64,
+
+    /// Minimum value
+    min: f64,
+
+    /// Maximum value
+    max: f64,
+}
+
+impl StatisticsAccumulator {
+    /// Allocates a new (empty) instance
+    pub fn new() -> Self {
+        StatisticsAccumulator {
+            count: 0,
+            mean: 0.0,
+            m2: 0.0,
+            min: f64::INFINITY,
+            max: f64::NEG_INFINITY,
+        }
+    }
+
+    /// Adds a value
+    pub fn push(&mut self, x: f64) {
+        self.count += 1;
+        let delta = x - self.mean;
+        self.mean += delta / (self.count as f64);
+        self.m2 += delta * (x - self.mean);
+        self.min = f64::min(self.min, x);
+        self.max = f64::max(self.max, x);
+    }
+
+    /// Adds all values of a slice
+    ///
+    /// The slice is processed with the (more accurate) two-pass algorithm and then merged.
+    pub fn push_slice<T>(&mut self, x: &[T])
+    where
+        T: Into<f64> + Copy,
+    {
+        if x.len() == 0 {
+            return;
+        }
+        let n = x.len() as f64;
+        let mean = x.iter().fold(0.0, |acc, &curr| acc + curr.into()) / n;
+        let mut min = f64::INFINITY;
+        let mut max = f64::NEG_INFINITY;
+        let mut corrector = 0.0;
+        let mut m2 = 0.0;
+        for &val in x {
+            let v = val.into();
+            min = f64::min(min, v);
+            max = f64::max(max, v);
+            let diff = v - mean;
+            corrector += diff;
+            m2 += diff * diff;
+        }
+        self.merge(&StatisticsAccumulator {
+            count: x.len(),
+            mean,
+            m2: m2 - corrector * corrector / n,
+            min,
+            max,
+        });
+    }
+
+    /// Merges the data of another accumulator into this one
+    pub fn merge(&mut self, other: &StatisticsAccumulator) {
+        if other.count == 0 {
+            return;
+        }
+        if self.count == 0 {
+            *self = *other;
+            return;
+        }
+        let (na, nb) = (self.count as f64, other.count as f64);
+        let n = na + nb;
+        let delta = other.mean - self.mean;
+        self.mean += delta * nb / n;
+        self.m2 += other.m2 + delta * delta * na * nb / n;
+        self.count += other.count;
+        self.min = f64::min(self.min, other.min);
+        self.max = f64::max(self.max, other.max);
+    }
+
+    /// Returns the number of values
+    pub fn count(&self) -> usize {
+        self.count
+    }
+
+    /// Returns the statistics (the same as the [statistics()] function would return)
+    pub fn get_statistics(&self) -> Statistics {
+        match self.count {
+            0 => Statistics {
+                min: 0.0,
+                max: 0.0,
+                mean: 0.0,
+                std_dev: 0.0,
+            },
+            1 => Statistics {
+                min: self.min,
+                max: self.max,
+                mean: self.mean,
+                std_dev: 0.0,
+            },
+            _ => Statistics {
+                min: self.min,
+                max: self.max,
+                mean: self.mean,
+                std_dev: f64::sqrt(self.m2 / ((self.count - 1) as f64)),
+            },
+        }
+    }
+}
+
 impl fmt::Display for Statistics {
     /// Prints statistics
     fn fmt(&self, f: &mut fmt::Formatter<'_>) -> fmt::Result {
@@ -122,7 +267,7 @@ impl fmt::Display for Statistics {
 
 #[cfg(test)]
 mod tests {
-    use super::statistics;
+    use super::{statistics, StatisticsAccumulator};
     use russell_lab::approx_eq;
 
     #[test]
@@ -181,4 +326,54 @@ mod tests {
              std_dev = 0\n"
         );
     }
+
+    #[test]
+    fn accumulator_handles_small_data() {
+        let acc = StatisticsAccumulator::new();
+        let res = acc.get_statistics();
+        assert_eq!(acc.count(), 0);
+        assert_eq!((res.min, res.max, res.mean, res.std_dev), (0.0, 0.0, 0.0, 0.0));
+
+        let mut acc = StatisticsAccumulator::new();
+        acc.push(1.23);
+        acc.push_slice::<f64>(&[]);
+        acc.merge(&StatisticsAccumulator::new());
+        let res = acc.get_statistics();
+        assert_eq!(acc.count(), 1);
+        assert_eq!((res.min, res.max, res.mean, res.std_dev), (1.23, 1.23, 1.23, 0.0));
+    }
+
+    #[test]
+    fn accumulator_works() {
+        let x = [9, 2, 5, 4, 12, 7, 8, 11, 9, 3, 7, 4, 12, 5, 4, 10, 9, 6, 9, 4];
+        let reference = statistics(&x);
+
+        // push one by one
+        let mut acc = StatisticsAccumulator::new();
+        for v in x {
+            acc.push(v as f64);
+        }
+        let res = acc.get_statistics();
+        assert_eq!(acc.count(), x.len());
+        assert_eq!(res.min, reference.min);
+        assert_eq!(res.max, reference.max);
+        approx_eq(res.mean, reference.mean, 1e-15);
+        approx_eq(res.std_dev, reference.std_dev, 1e-15);
+
+        // push slices and merge
+        let mut a = StatisticsAccumulator::new();
+        let mut b = StatisticsAccumulator::new();
+        let mut c = StatisticsAccumulator::new();
+        a.push_slice(&x[0..3]);
+        b.push_slice(&x[3..11]);
+        c.push_slice(&x[11..]);
+        b.merge(&c);
+        a.merge(&b);
+        let res = a.get_statistics();
+        assert_eq!(a.count(), x.len());
+        assert_eq!(res.min, 2.0);
+        assert_eq!(res.max, 12.0);
+        approx_eq(res.mean, 7.0, 1e-15);
+        approx_eq(res.std_dev, f64::sqrt(178.0 / 19.0), 1e-15);
+    }
 }
@@ -7,6 +7,10 @@
 //! This library implements structures and functions for tensor analysis and calculus. The library focuses on applications in engineering and [Continuum Mechanics](Continuum Mechanics). The essential functionality for the targeted applications includes second-order and fourth-order tensors, scalar "invariants," and derivatives.
 //!
 //! This library implements derivatives for scalar functions with respect to tensors, tensor functions with respect to tensors, and others. A convenient basis representation known as Mandel basis (similar to Voigt notation) is considered by this library internally. The user may also use the Mandel basis to perform simpler matrix-vector operations directly.
+//!
+//! For hot loops (e.g., constitutive updates at many material points), the stack-allocated [Tensor2Fixed] and [Tensor4Fixed] (with the Mandel dimension given at compile time) and the corresponding `*_fixed` operations (e.g., [t4_ddot_t2_fixed()]) avoid heap allocations and runtime dimension checks.
+//!
+//! To evaluate the same operation over many material points at once, [Tensor2Batch] stores the tensors in structure-of-arrays layout and the batched operations (e.g., [t4_ddot_t2_batch()] and [LinElasticity::calc_stress_batch()]) loop over the points in the innermost (vectorizable) loop, optionally using multiple threads.
 
 /// Defines the error output as a static string
 pub type StrError = &'static str;
@@ -18,11 +22,16 @@ mod derivatives_t4;
 mod enums;
 mod lin_elasticity;
 mod operations;
+mod operations_batch;
+mod operations_fixed;
 mod samples_tensor2;
 mod samples_tensor4;
 mod spectral2;
 mod tensor2;
+mod tensor2_batch;
+mod tensor2_fixed;
 mod tensor4;
+mod tensor4_fixed;
 pub use crate::as_matrix_3x3::*;
 pub use crate::constants::*;
 pub use crate::derivatives_t2::*;
@@ -30,11 +39,16 @@ pub use crate::derivatives_t4::*;
 pub use crate::enums::*;
 pub use crate::lin_elasticity::*;
 pub use crate::operations::*;
+pub use crate::operations_batch::*;
+pub use crate::operations_fixed::*;
 pub use crate::samples_tensor2::*;
 pub use crate::samples_tensor4::*;
 pub use crate::spectral2::*;
 pub use crate::tensor2::*;
+pub use crate::tensor2_batch::*;
+pub use crate::tensor2_fixed::*;
 pub use crate::tensor4::*;
+pub use crate::tensor4_fixed::*;
 
 // run code from README file
 #[doc = include_str!("../README.md")]
@@ -1,4 +1,4 @@
-use crate::{t4_ddot_t2, Mandel, StrError, Tensor2, Tensor4};
+use crate::{t4_ddot_t2, t4_ddot_t2_batch, Mandel, StrError, Tensor2, Tensor2Batch, Tensor4};
 
 /// Implements the linear elasticity equations for small-strain problems
 pub struct LinElasticity {
@@ -291,6 +291,26 @@ impl LinElasticity {
         t4_ddot_t2(stress, 1.0, &self.dd, strain)
     }
 
+    /// Calculates the stresses at many points given the strains (batched version of [LinElasticity::calc_stress()])
+    ///
+    /// ```text
+    /// σ[p] = D : ε[p]
+    /// ```
+    ///
+    /// # Input
+    ///
+    /// * `stress` -- the stress tensors σ (same Mandel representation as the modulus)
+    /// * `strain` -- the strain tensors ε (same Mandel representation as the modulus)
+    /// * `nthread` -- number of threads (0 or 1 means serial); see [crate::t4_ddot_t2_batch()]
+    pub fn calc_stress_batch(
+        &self,
+        stress: &mut Tensor2Batch,
+        strain: &Tensor2Batch,
+        nthread: usize,
+    ) -> Result<(), StrError> {
+        t4_ddot_t2_batch(stress, 1.0, &self.dd, strain, nthread)
+    }
+
     /// Calculates and sets the out-of-plane strain in the Plane-Stress case
     ///
     /// # Input
@@ -365,8 +385,8 @@ impl LinElasticity {
 #[cfg(test)]
 mod tests {
     use super::LinElasticity;
-    use crate::{Mandel, Tensor2};
-    use russell_lab::approx_eq;
+    use crate::{Mandel, Tensor2, Tensor2Batch};
+    use russell_lab::{approx_eq, array_approx_eq};
 
     #[test]
     fn new_works() {
@@ -559,4 +579,29 @@ mod tests {
         let eps_zz = ela.out_of_plane_strain(&stress).unwrap();
         approx_eq(eps_zz, 0.0050847, 1e-4);
     }
+
+    #[test]
+    fn calc_stress_batch_works() {
+        let ela = LinElasticity::new(3000.0, 0.2, true, false);
+        let npoint = 4;
+        let mut strain = Tensor2Batch::new(Mandel::Symmetric2D, npoint);
+        let mut stress = Tensor2Batch::new(Mandel::Symmetric2D, npoint);
+        let mut strain_p = Tensor2::new(Mandel::Symmetric2D);
+        let mut stress_p = Tensor2::new(Mandel::Symmetric2D);
+        let mut correct = Tensor2::new(Mandel::Symmetric2D);
+        for p in 0..npoint {
+            let e = 1e-3 * (p + 1) as f64;
+            strain_p.sym_set(0, 0, -e);
+            strain_p.sym_set(1, 1, 2.0 * e);
+            strain_p.sym_set(0, 1, 0.5 * e);
+            strain.set_tensor(p, &strain_p).unwrap();
+        }
+        ela.calc_stress_batch(&mut stress, &strain, 2).unwrap();
+        for p in 0..npoint {
+            strain.get_tensor(&mut strain_p, p).unwrap();
+            stress.get_tensor(&mut stress_p, p).unwrap();
+            ela.calc_stress(&mut correct, &strain_p).unwrap();
+            array_approx_eq(stress_p.vec.as_data(), correct.vec.as_data(), 1e-14);
+        }
+    }
 }
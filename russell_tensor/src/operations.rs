@@ -82,7 +82,6 @@ pub fn t2_ddot_t2(a: &Tensor2, b: &Tensor2) -> f64 {
 ///     Ok(())
 /// }
 /// ```
-#[rustfmt::skip]
 pub fn t2_dot_t2(cc: &mut Tensor2, aa: &Tensor2, bb: &Tensor2) -> Result<(), StrError> {
     let dim = aa.vec.dim();
     if cc.vec.dim() != 9 {
@@ -91,9 +90,16 @@ pub fn t2_dot_t2(cc: &mut Tensor2, aa: &Tensor2, bb: &Tensor2) -> Result<(), Str
     if bb.vec.dim() != dim {
         return Err("A and B tensors must be compatible");
     }
-    let a = &aa.vec;
-    let b = &bb.vec;
-    let c = &mut cc.vec;
+    t2_dot_t2_mandel(cc.vec.as_mut_data(), aa.vec.as_data(), bb.vec.as_data());
+    Ok(())
+}
+
+/// Performs the single dot operation between two Tensor2 given by their Mandel components
+///
+/// The dimension of `a` and `b` (4, 6, or 9) defines the representation and `c` must have dimension 9.
+#[rustfmt::skip]
+pub(crate) fn t2_dot_t2_mandel(c: &mut [f64], a: &[f64], b: &[f64]) {
+    let dim = a.len();
     let tsq2 = 2.0 * SQRT_2;
     if dim == 4 {
         c[0] = a[0] * b[0] + (a[3] * b[3]) / 2.0;
@@ -126,7 +132,6 @@ pub fn t2_dot_t2(cc: &mut Tensor2, aa: &Tensor2, bb: &Tensor2) -> Result<(), Str
         c[7] = (-2.0 * (a[4] - a[7]) * b[1] + 2.0 * (a[4] + a[7]) * b[2] - SQRT_2 * (a[5] - a[8]) * (b[3] + b[6]) - 2.0 * a[2] * (b[4] - b[7]) + 2.0 * a[1] * (b[4] + b[7]) + SQRT_2 * (a[3] - a[6]) * (b[5] + b[8])) / 4.0;
         c[8] = (-2.0 * (a[5] - a[8]) * b[0] + 2.0 * (a[5] + a[8]) * b[2] - SQRT_2 * (a[4] - a[7]) * (b[3] - b[6]) + SQRT_2 * (a[3] + a[6]) * (b[4] + b[7]) - 2.0 * a[2] * (b[5] - b[8]) + 2.0 * a[0] * (b[5] + b[8])) / 4.0;
     }
-    Ok(())
 }
 
 /// Performs the single dot operation between a Tensor2 and a vector
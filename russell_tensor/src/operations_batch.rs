@@ -0,0 +1,225 @@
+use super::{Tensor2Batch, Tensor4};
+use crate::StrError;
+use std::thread;
+
+/// Performs the double-dot (ddot) operation between two batches of Tensor2 (inner product at each point)
+///
+/// ```text
+/// s[p] = a[p] : b[p]
+/// ```
+///
+/// See also: [crate::t2_ddot_t2()]
+///
+/// # Examples
+///
+/// ```
+/// use russell_tensor::{t2_ddot_t2_batch, Mandel, StrError, Tensor2Batch};
+///
+/// fn main() -> Result<(), StrError> {
+///     let mut a = Tensor2Batch::new(Mandel::Symmetric2D, 2);
+///     let mut b = Tensor2Batch::new(Mandel::Symmetric2D, 2);
+///     a.as_mut_data().copy_from_slice(&[1.0, 2.0,  1.0, 2.0,  1.0, 2.0,  0.0, 0.0]);
+///     b.as_mut_data().copy_from_slice(&[1.0, 1.0,  2.0, 2.0,  3.0, 3.0,  1.0, 1.0]);
+///     let mut s = vec![0.0; 2];
+///     t2_ddot_t2_batch(&mut s, &a, &b)?;
+///     assert_eq!(s, &[6.0, 12.0]);
+///     Ok(())
+/// }
+/// ```
+pub fn t2_ddot_t2_batch(s: &mut [f64], a: &Tensor2Batch, b: &Tensor2Batch) -> Result<(), StrError> {
+    let npoint = a.npoint();
+    if b.npoint() != npoint || b.mandel() != a.mandel() {
+        return Err("batches are incompatible");
+    }
+    if s.len() != npoint {
+        return Err("the output array must have length equal to npoint");
+    }
+    s.fill(0.0);
+    for m in 0..a.mandel().dim() {
+        let am = a.component(m);
+        let bm = b.component(m);
+        for p in 0..npoint {
+            s[p] += am[p] * bm[p];
+        }
+    }
+    Ok(())
+}
+
+/// Performs the double-dot (ddot) operation between a Tensor4 and a batch of Tensor2
+///
+/// ```text
+/// b[p] = α D : a[p]
+/// ```
+///
+/// The same `D` (e.g., the elastic modulus of a material) is applied to all points.
+///
+/// See also: [crate::t4_ddot_t2()]
+///
+/// # Input
+///
+/// * `nthread` -- number of threads; the points are split into contiguous ranges processed by
+///   scoped threads (0 or 1 means serial)
+///
+/// # Examples
+///
+/// ```
+/// use russell_tensor::{t4_ddot_t2_batch, Mandel, StrError, Tensor2Batch, Tensor4};
+///
+/// fn main() -> Result<(), StrError> {
+///     let dd = Tensor4::constant_pp_symdev(true);
+///     let mut a = Tensor2Batch::new(Mandel::Symmetric, 2);
+///     a.component_mut(0).copy_from_slice(&[3.0, 6.0]);
+///     let mut b = Tensor2Batch::new(Mandel::Symmetric, 2);
+///     t4_ddot_t2_batch(&mut b, 1.0, &dd, &a, 2)?;
+///     assert_eq!(b.component(0), &[2.0, 4.0]);
+///     assert_eq!(b.component(1), &[-1.0, -2.0]);
+///     assert_eq!(b.component(2), &[-1.0, -2.0]);
+///     Ok(())
+/// }
+/// ```
+pub fn t4_ddot_t2_batch(
+    b: &mut Tensor2Batch,
+    alpha: f64,
+    dd: &Tensor4,
+    a: &Tensor2Batch,
+    nthread: usize,
+) -> Result<(), StrError> {
+    let npoint = a.npoint();
+    if b.npoint() != npoint || b.mandel() != a.mandel() {
+        return Err("batches are incompatible");
+    }
+    if dd.mat.nrow() != a.mandel().dim() {
+        return Err("the Tensor4 is incompatible with the batches");
+    }
+    if npoint == 0 {
+        return Ok(());
+    }
+    if nthread <= 1 {
+        let mut rows: Vec<&mut [f64]> = b.as_mut_data().chunks_mut(npoint).collect();
+        t4_ddot_t2_batch_kernel(&mut rows, alpha, dd, a, 0);
+        return Ok(());
+    }
+    let chunk = (npoint + nthread - 1) / nthread;
+    let mut parts: Vec<Vec<&mut [f64]>> = (0..nthread).map(|_| Vec::new()).collect();
+    for row in b.as_mut_data().chunks_mut(npoint) {
+        for (i, range) in row.chunks_mut(chunk).enumerate() {
+            parts[i].push(range);
+        }
+    }
+    thread::scope(|scope| {
+        for (i, mut rows) in parts.into_iter().enumerate() {
+            if !rows.is_empty() {
+                scope.spawn(move || t4_ddot_t2_batch_kernel(&mut rows, alpha, dd, a, i * chunk));
+            }
+        }
+    });
+    Ok(())
+}
+
+/// Computes b[p] = α D : a[p] for the points p0..p0+len(rows[0])
+///
+/// `rows` holds the (mutable) ranges of each Mandel component of `b`
+fn t4_ddot_t2_batch_kernel(rows: &mut [&mut [f64]], alpha: f64, dd: &Tensor4, a: &Tensor2Batch, p0: usize) {
+    let len = rows[0].len();
+    for (m, bm) in rows.iter_mut().enumerate() {
+        bm.fill(0.0);
+        for n in 0..dd.mat.ncol() {
+            let d = alpha * dd.mat.get(m, n);
+            if d == 0.0 {
+                continue;
+            }
+            let an = &a.component(n)[p0..(p0 + len)];
+            for p in 0..len {
+                bm[p] += d * an[p];
+            }
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#[cfg(test)]
+mod tests {
+    use super::{t2_ddot_t2_batch, t4_ddot_t2_batch};
+    use crate::{t2_ddot_t2, t4_ddot_t2, Mandel, SamplesTensor4, Tensor2, Tensor2Batch, Tensor4};
+    use russell_lab::{approx_eq, array_approx_eq};
+
+    fn sample_batch(mandel: Mandel, npoint: usize, shift: f64) -> Tensor2Batch {
+        let mut batch = Tensor2Batch::new(mandel, npoint);
+        for m in 0..mandel.dim() {
+            for p in 0..npoint {
+                batch.component_mut(m)[p] = shift + (m + 1) as f64 + 0.1 * (p as f64);
+            }
+        }
+        batch
+    }
+
+    #[test]
+    fn t2_ddot_t2_batch_captures_errors() {
+        let a = Tensor2Batch::new(Mandel::Symmetric, 2);
+        let b = Tensor2Batch::new(Mandel::Symmetric, 3);
+        let c = Tensor2Batch::new(Mandel::General, 2);
+        let mut s = vec![0.0; 2];
+        assert_eq!(t2_ddot_t2_batch(&mut s, &a, &b).err(), Some("batches are incompatible"));
+        assert_eq!(t2_ddot_t2_batch(&mut s, &a, &c).err(), Some("batches are incompatible"));
+        let mut s = vec![0.0; 3];
+        assert_eq!(
+            t2_ddot_t2_batch(&mut s, &a, &a).err(),
+            Some("the output array must have length equal to npoint")
+        );
+    }
+
+    #[test]
+    fn t2_ddot_t2_batch_works() {
+        let npoint = 5;
+        let a = sample_batch(Mandel::General, npoint, 0.0);
+        let b = sample_batch(Mandel::General, npoint, -3.0);
+        let mut s = vec![0.0; npoint];
+        t2_ddot_t2_batch(&mut s, &a, &b).unwrap();
+        let mut ap = Tensor2::new(Mandel::General);
+        let mut bp = Tensor2::new(Mandel::General);
+        for p in 0..npoint {
+            a.get_tensor(&mut ap, p).unwrap();
+            b.get_tensor(&mut bp, p).unwrap();
+            approx_eq(s[p], t2_ddot_t2(&ap, &bp), 1e-13);
+        }
+    }
+
+    #[test]
+    fn t4_ddot_t2_batch_captures_errors() {
+        let dd = Tensor4::new(Mandel::Symmetric);
+        let a = Tensor2Batch::new(Mandel::Symmetric, 2);
+        let mut b = Tensor2Batch::new(Mandel::Symmetric, 3);
+        assert_eq!(
+            t4_ddot_t2_batch(&mut b, 1.0, &dd, &a, 1).err(),
+            Some("batches are incompatible")
+        );
+        let dd = Tensor4::new(Mandel::General);
+        let mut b = Tensor2Batch::new(Mandel::Symmetric, 2);
+        assert_eq!(
+            t4_ddot_t2_batch(&mut b, 1.0, &dd, &a, 1).err(),
+            Some("the Tensor4 is incompatible with the batches")
+        );
+    }
+
+    #[test]
+    fn t4_ddot_t2_batch_works() {
+        let dd = Tensor4::from_matrix(&SamplesTensor4::SYM_SAMPLE1_STD_MATRIX, Mandel::Symmetric).unwrap();
+        for npoint in [0, 1, 7, 20] {
+            let a = sample_batch(Mandel::Symmetric, npoint, 1.0);
+            let mut ap = Tensor2::new(Mandel::Symmetric);
+            let mut bp = Tensor2::new(Mandel::Symmetric);
+            let mut bp_correct = Tensor2::new(Mandel::Symmetric);
+            for nthread in [1, 3, 8, 30] {
+                let mut b = Tensor2Batch::new(Mandel::Symmetric, npoint);
+                t4_ddot_t2_batch(&mut b, 2.0, &dd, &a, nthread).unwrap();
+                for p in 0..npoint {
+                    a.get_tensor(&mut ap, p).unwrap();
+                    b.get_tensor(&mut bp, p).unwrap();
+                    t4_ddot_t2(&mut bp_correct, 2.0, &dd, &ap).unwrap();
+                    array_approx_eq(bp.vec.as_data(), bp_correct.vec.as_data(), 1e-10);
+                }
+            }
+        }
+    }
+}
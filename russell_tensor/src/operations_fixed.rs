@@ -0,0 +1,280 @@
+use super::{Tensor2Fixed, Tensor4Fixed};
+use crate::operations::t2_dot_t2_mandel;
+
+/// Performs the double-dot (ddot) operation between two stack-allocated Tensor2 (inner product)
+///
+/// ```text
+/// s = a : b
+/// ```
+///
+/// See also: [crate::t2_ddot_t2()]
+///
+/// # Examples
+///
+/// ```
+/// use russell_lab::approx_eq;
+/// use russell_tensor::{t2_ddot_t2_fixed, Tensor2Sym};
+///
+/// let mut a = Tensor2Sym::new();
+/// let mut b = Tensor2Sym::new();
+/// a.sym_set(0, 0, 1.0);
+/// a.sym_set(0, 1, 2.0);
+/// b.sym_set(0, 0, 3.0);
+/// b.sym_set(0, 1, 4.0);
+/// approx_eq(t2_ddot_t2_fixed(&a, &b), 3.0 + 2.0 * 8.0, 1e-14);
+/// ```
+#[inline]
+pub fn t2_ddot_t2_fixed<const M: usize>(a: &Tensor2Fixed<M>, b: &Tensor2Fixed<M>) -> f64 {
+    let mut s = 0.0;
+    for m in 0..M {
+        s += a.vec[m] * b.vec[m];
+    }
+    s
+}
+
+/// Performs the single dot operation between two stack-allocated Tensor2 (matrix multiplication)
+///
+/// ```text
+/// C = A · B
+/// ```
+///
+/// Even if `A` and `B` are symmetric, the result `C` may not be symmetric. Thus, `C` is General.
+///
+/// See also: [crate::t2_dot_t2()]
+#[inline]
+pub fn t2_dot_t2_fixed<const M: usize>(cc: &mut Tensor2Fixed<9>, aa: &Tensor2Fixed<M>, bb: &Tensor2Fixed<M>) {
+    t2_dot_t2_mandel(&mut cc.vec, &aa.vec, &bb.vec);
+}
+
+/// Performs the dyadic product between two stack-allocated Tensor2 resulting in a Tensor4
+///
+/// ```text
+/// D = α a ⊗ b
+/// ```
+///
+/// See also: [crate::t2_dyad_t2()]
+#[inline]
+pub fn t2_dyad_t2_fixed<const M: usize>(
+    dd: &mut Tensor4Fixed<M>,
+    alpha: f64,
+    a: &Tensor2Fixed<M>,
+    b: &Tensor2Fixed<M>,
+) {
+    for m in 0..M {
+        for n in 0..M {
+            dd.mat[m][n] = alpha * a.vec[m] * b.vec[n];
+        }
+    }
+}
+
+/// Performs the double-dot (ddot) operation between a stack-allocated Tensor4 and a Tensor2
+///
+/// ```text
+/// b = α D : a
+/// ```
+///
+/// See also: [crate::t4_ddot_t2()]
+///
+/// # Examples
+///
+/// ```
+/// use russell_lab::array_approx_eq;
+/// use russell_tensor::{t4_ddot_t2_fixed, Tensor2, Tensor2Sym, Tensor4, Tensor4Sym};
+///
+/// fn main() {
+///     // linear elasticity (Lamé parameters: λ = 1 and μ = 2)
+///     let (lambda, mu) = (1.0, 2.0);
+///     let mut dd = Tensor4Sym::from_tensor4(&Tensor4::constant_pp_sym(true)).unwrap();
+///     for m in 0..6 {
+///         for n in 0..6 {
+///             dd.mat[m][n] *= 2.0 * mu;
+///         }
+///     }
+///     for m in 0..3 {
+///         for n in 0..3 {
+///             dd.mat[m][n] += lambda;
+///         }
+///     }
+///
+///     // stress = D : strain
+///     let strain = Tensor2Sym::identity();
+///     let mut stress = Tensor2Sym::new();
+///     t4_ddot_t2_fixed(&mut stress, 1.0, &dd, &strain);
+///     array_approx_eq(&stress.vec, &[7.0, 7.0, 7.0, 0.0, 0.0, 0.0], 1e-15);
+/// }
+/// ```
+#[inline]
+pub fn t4_ddot_t2_fixed<const M: usize>(
+    b: &mut Tensor2Fixed<M>,
+    alpha: f64,
+    dd: &Tensor4Fixed<M>,
+    a: &Tensor2Fixed<M>,
+) {
+    for m in 0..M {
+        let mut s = 0.0;
+        for n in 0..M {
+            s += dd.mat[m][n] * a.vec[n];
+        }
+        b.vec[m] = alpha * s;
+    }
+}
+
+/// Performs the double-dot (ddot) operation between a stack-allocated Tensor4 and a Tensor2 with update
+///
+/// ```text
+/// b = α D : a + β b
+/// ```
+///
+/// See also: [crate::t4_ddot_t2_update()]
+#[inline]
+pub fn t4_ddot_t2_update_fixed<const M: usize>(
+    b: &mut Tensor2Fixed<M>,
+    alpha: f64,
+    dd: &Tensor4Fixed<M>,
+    a: &Tensor2Fixed<M>,
+    beta: f64,
+) {
+    for m in 0..M {
+        let mut s = 0.0;
+        for n in 0..M {
+            s += dd.mat[m][n] * a.vec[n];
+        }
+        b.vec[m] = alpha * s + beta * b.vec[m];
+    }
+}
+
+/// Performs the double-dot (ddot) operation between a stack-allocated Tensor2 and a Tensor4
+///
+/// ```text
+/// b = α a : D
+/// ```
+///
+/// See also: [crate::t2_ddot_t4()]
+#[inline]
+pub fn t2_ddot_t4_fixed<const M: usize>(
+    b: &mut Tensor2Fixed<M>,
+    alpha: f64,
+    a: &Tensor2Fixed<M>,
+    dd: &Tensor4Fixed<M>,
+) {
+    b.vec = [0.0; M];
+    for m in 0..M {
+        let am = alpha * a.vec[m];
+        for n in 0..M {
+            b.vec[n] += am * dd.mat[m][n];
+        }
+    }
+}
+
+/// Performs the double-dot (ddot) operation between two stack-allocated Tensor4
+///
+/// ```text
+/// E = α C : D
+/// ```
+///
+/// See also: [crate::t4_ddot_t4()]
+#[inline]
+pub fn t4_ddot_t4_fixed<const M: usize>(
+    ee: &mut Tensor4Fixed<M>,
+    alpha: f64,
+    cc: &Tensor4Fixed<M>,
+    dd: &Tensor4Fixed<M>,
+) {
+    ee.mat = [[0.0; M]; M];
+    for m in 0..M {
+        for k in 0..M {
+            let c = alpha * cc.mat[m][k];
+            for n in 0..M {
+                ee.mat[m][n] += c * dd.mat[k][n];
+            }
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use crate::{t2_ddot_t2, t2_ddot_t4, t2_dot_t2, t2_dyad_t2, t4_ddot_t2, t4_ddot_t2_update, t4_ddot_t4};
+    use crate::{Mandel, SamplesTensor2, SamplesTensor4, Tensor2, Tensor4};
+    use russell_lab::{approx_eq, array_approx_eq};
+
+    fn check_t2_operations<const M: usize>(mandel: Mandel, sample_a: &[[f64; 3]; 3], sample_b: &[[f64; 3]; 3]) {
+        let a = Tensor2::from_matrix(sample_a, mandel).unwrap();
+        let b = Tensor2::from_matrix(sample_b, mandel).unwrap();
+        let af = Tensor2Fixed::<M>::from_tensor2(&a).unwrap();
+        let bf = Tensor2Fixed::<M>::from_tensor2(&b).unwrap();
+
+        // ddot
+        approx_eq(t2_ddot_t2_fixed(&af, &bf), t2_ddot_t2(&a, &b), 1e-13);
+
+        // dot
+        let mut c = Tensor2::new(Mandel::General);
+        let mut cf = Tensor2Fixed::<9>::new();
+        t2_dot_t2(&mut c, &a, &b).unwrap();
+        t2_dot_t2_fixed(&mut cf, &af, &bf);
+        array_approx_eq(&cf.vec, c.vec.as_data(), 1e-13);
+
+        // dyad
+        let mut dd = Tensor4::new(mandel);
+        let mut ddf = Tensor4Fixed::<M>::new();
+        t2_dyad_t2(&mut dd, 2.0, &a, &b).unwrap();
+        t2_dyad_t2_fixed(&mut ddf, 2.0, &af, &bf);
+        array_approx_eq(ddf.to_tensor4().mat.as_data(), dd.mat.as_data(), 1e-13);
+    }
+
+    #[test]
+    fn t2_operations_work() {
+        let x = &SamplesTensor2::TENSOR_X.matrix;
+        let y = &SamplesTensor2::TENSOR_Y.matrix;
+        let r = &SamplesTensor2::TENSOR_R.matrix;
+        let t = &SamplesTensor2::TENSOR_T.matrix;
+        let s = &SamplesTensor2::TENSOR_S.matrix;
+        let u = &SamplesTensor2::TENSOR_U.matrix;
+        check_t2_operations::<9>(Mandel::General, r, t);
+        check_t2_operations::<6>(Mandel::Symmetric, s, u);
+        check_t2_operations::<4>(Mandel::Symmetric2D, x, y);
+    }
+
+    fn check_t4_operations<const M: usize>(mandel: Mandel, sample_a: &[[f64; 3]; 3], sample_dd: &[[f64; 9]; 9]) {
+        let a = Tensor2::from_matrix(sample_a, mandel).unwrap();
+        let dd = Tensor4::from_matrix(sample_dd, mandel).unwrap();
+        let af = Tensor2Fixed::<M>::from_tensor2(&a).unwrap();
+        let ddf = Tensor4Fixed::<M>::from_tensor4(&dd).unwrap();
+
+        // D : a
+        let mut b = Tensor2::new(mandel);
+        let mut bf = Tensor2Fixed::<M>::new();
+        t4_ddot_t2(&mut b, 2.0, &dd, &a).unwrap();
+        t4_ddot_t2_fixed(&mut bf, 2.0, &ddf, &af);
+        array_approx_eq(&bf.vec, b.vec.as_data(), 1e-10);
+
+        // D : a + β b
+        t4_ddot_t2_update(&mut b, 2.0, &dd, &a, 3.0).unwrap();
+        t4_ddot_t2_update_fixed(&mut bf, 2.0, &ddf, &af, 3.0);
+        array_approx_eq(&bf.vec, b.vec.as_data(), 1e-10);
+
+        // a : D
+        t2_ddot_t4(&mut b, 2.0, &a, &dd).unwrap();
+        t2_ddot_t4_fixed(&mut bf, 2.0, &af, &ddf);
+        array_approx_eq(&bf.vec, b.vec.as_data(), 1e-10);
+
+        // D : D
+        let mut ee = Tensor4::new(mandel);
+        let mut eef = Tensor4Fixed::<M>::new();
+        t4_ddot_t4(&mut ee, 2.0, &dd, &dd).unwrap();
+        t4_ddot_t4_fixed(&mut eef, 2.0, &ddf, &ddf);
+        array_approx_eq(eef.to_tensor4().mat.as_data(), ee.mat.as_data(), 1e-6);
+    }
+
+    #[test]
+    fn t4_operations_work() {
+        let t = &SamplesTensor2::TENSOR_T.matrix;
+        let s = &SamplesTensor2::TENSOR_S.matrix;
+        let x = &SamplesTensor2::TENSOR_X.matrix;
+        check_t4_operations::<9>(Mandel::General, t, &SamplesTensor4::SAMPLE1_STD_MATRIX);
+        check_t4_operations::<6>(Mandel::Symmetric, s, &SamplesTensor4::SYM_SAMPLE1_STD_MATRIX);
+        check_t4_operations::<4>(Mandel::Symmetric2D, x, &SamplesTensor4::SYM_2D_SAMPLE1_STD_MATRIX);
+    }
+}
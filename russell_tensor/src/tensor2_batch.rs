@@ -0,0 +1,252 @@
+use crate::{Mandel, StrError, Tensor2};
+
+/// Holds many second-order tensors (e.g., the stresses at all material points) in structure-of-arrays layout
+///
+/// The Mandel components of all tensors are stored component-wise, i.e., the values of the
+/// m-th component of all points are contiguous:
+///
+/// ```text
+/// data = [ T₀(p=0), T₀(p=1), …, T₀(p=np-1),  T₁(p=0), T₁(p=1), …,  …, Tₘ(p=np-1) ]
+/// index(m, p) = m * npoint + p
+/// ```
+///
+/// With this layout, the batched operations (e.g., [crate::t4_ddot_t2_batch()]) loop over the
+/// points in the innermost loop, which the compiler can vectorize with SIMD instructions.
+///
+/// # Examples
+///
+/// ```
+/// use russell_tensor::{Mandel, StrError, Tensor2, Tensor2Batch};
+///
+/// fn main() -> Result<(), StrError> {
+///     let mut batch = Tensor2Batch::new(Mandel::Symmetric2D, 3);
+///     let a = Tensor2::from_matrix(&[
+///         [1.0, 4.0, 0.0],
+///         [4.0, 2.0, 0.0],
+///         [0.0, 0.0, 3.0],
+///     ], Mandel::Symmetric2D)?;
+///     batch.set_tensor(1, &a)?;
+///
+///     let mut tr = vec![0.0; 3];
+///     batch.trace(&mut tr)?;
+///     assert_eq!(tr, &[0.0, 6.0, 0.0]);
+///     assert_eq!(batch.component(0), &[0.0, 1.0, 0.0]);
+///     Ok(())
+/// }
+/// ```
+#[derive(Clone, Debug)]
+pub struct Tensor2Batch {
+    /// Holds the Mandel representation of all tensors
+    mandel: Mandel,
+
+    /// Holds the number of tensors (points)
+    npoint: usize,
+
+    /// Holds the Mandel components of all tensors (len = mandel.dim() * npoint)
+    data: Vec<f64>,
+}
+
+impl Tensor2Batch {
+    /// Allocates a new (zeroed) batch of tensors
+    ///
+    /// # Input
+    ///
+    /// * `mandel` -- the [Mandel] representation of all tensors
+    /// * `npoint` -- the number of tensors (points)
+    pub fn new(mandel: Mandel, npoint: usize) -> Self {
+        Tensor2Batch {
+            mandel,
+            npoint,
+            data: vec![0.0; mandel.dim() * npoint],
+        }
+    }
+
+    /// Returns the Mandel representation of all tensors
+    #[inline]
+    pub fn mandel(&self) -> Mandel {
+        self.mandel
+    }
+
+    /// Returns the number of tensors (points)
+    #[inline]
+    pub fn npoint(&self) -> usize {
+        self.npoint
+    }
+
+    /// Returns an access to the m-th Mandel component of all tensors
+    ///
+    /// # Panics
+    ///
+    /// A panic will occur if `m` is out of range
+    #[inline]
+    pub fn component(&self, m: usize) -> &[f64] {
+        &self.data[m * self.npoint..(m + 1) * self.npoint]
+    }
+
+    /// Returns a mutable access to the m-th Mandel component of all tensors
+    ///
+    /// # Panics
+    ///
+    /// A panic will occur if `m` is out of range
+    #[inline]
+    pub fn component_mut(&mut self, m: usize) -> &mut [f64] {
+        &mut self.data[m * self.npoint..(m + 1) * self.npoint]
+    }
+
+    /// Returns an access to the underlying data (component-major)
+    #[inline]
+    pub fn as_data(&self) -> &[f64] {
+        &self.data
+    }
+
+    /// Returns a mutable access to the underlying data (component-major)
+    #[inline]
+    pub fn as_mut_data(&mut self) -> &mut [f64] {
+        &mut self.data
+    }
+
+    /// Set all values to zero
+    #[inline]
+    pub fn clear(&mut self) {
+        self.data.fill(0.0);
+    }
+
+    /// Copies the components of a Tensor2 into the p-th position
+    pub fn set_tensor(&mut self, p: usize, tt: &Tensor2) -> Result<(), StrError> {
+        if p >= self.npoint {
+            return Err("the point index is out of range");
+        }
+        if tt.vec.dim() != self.mandel.dim() {
+            return Err("the Mandel representation of the Tensor2 is incompatible");
+        }
+        for m in 0..self.mandel.dim() {
+            self.data[m * self.npoint + p] = tt.vec[m];
+        }
+        Ok(())
+    }
+
+    /// Copies the components at the p-th position into a Tensor2
+    pub fn get_tensor(&self, tt: &mut Tensor2, p: usize) -> Result<(), StrError> {
+        if p >= self.npoint {
+            return Err("the point index is out of range");
+        }
+        if tt.vec.dim() != self.mandel.dim() {
+            return Err("the Mandel representation of the Tensor2 is incompatible");
+        }
+        for m in 0..self.mandel.dim() {
+            tt.vec[m] = self.data[m * self.npoint + p];
+        }
+        Ok(())
+    }
+
+    /// Calculates the trace of all tensors
+    ///
+    /// # Output
+    ///
+    /// * `tr` -- the traces (len = npoint)
+    pub fn trace(&self, tr: &mut [f64]) -> Result<(), StrError> {
+        if tr.len() != self.npoint {
+            return Err("the output array must have length equal to npoint");
+        }
+        let (t0, t1, t2) = (self.component(0), self.component(1), self.component(2));
+        for p in 0..self.npoint {
+            tr[p] = t0[p] + t1[p] + t2[p];
+        }
+        Ok(())
+    }
+
+    /// Calculates the Euclidean norm of all tensors
+    ///
+    /// # Output
+    ///
+    /// * `norm` -- the norms (len = npoint)
+    pub fn norm(&self, norm: &mut [f64]) -> Result<(), StrError> {
+        if norm.len() != self.npoint {
+            return Err("the output array must have length equal to npoint");
+        }
+        norm.fill(0.0);
+        for m in 0..self.mandel.dim() {
+            let t = self.component(m);
+            for p in 0..self.npoint {
+                norm[p] += t[p] * t[p];
+            }
+        }
+        for p in 0..self.npoint {
+            norm[p] = f64::sqrt(norm[p]);
+        }
+        Ok(())
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#[cfg(test)]
+mod tests {
+    use super::Tensor2Batch;
+    use crate::{Mandel, SamplesTensor2, Tensor2};
+    use russell_lab::array_approx_eq;
+
+    #[test]
+    fn new_and_accessors_work() {
+        let mut batch = Tensor2Batch::new(Mandel::Symmetric, 2);
+        assert_eq!(batch.mandel(), Mandel::Symmetric);
+        assert_eq!(batch.npoint(), 2);
+        assert_eq!(batch.as_data().len(), 12);
+        batch.component_mut(5)[1] = 3.0;
+        assert_eq!(batch.component(5), &[0.0, 3.0]);
+        assert_eq!(batch.as_data()[11], 3.0);
+        batch.as_mut_data()[0] = 1.0;
+        assert_eq!(batch.component(0), &[1.0, 0.0]);
+        batch.clear();
+        assert_eq!(batch.as_data(), &[0.0; 12]);
+    }
+
+    #[test]
+    fn set_and_get_tensor_capture_errors() {
+        let mut batch = Tensor2Batch::new(Mandel::Symmetric, 2);
+        let mut a = Tensor2::new(Mandel::Symmetric);
+        let mut b = Tensor2::new(Mandel::General);
+        assert_eq!(batch.set_tensor(2, &a).err(), Some("the point index is out of range"));
+        assert_eq!(
+            batch.get_tensor(&mut a, 2).err(),
+            Some("the point index is out of range")
+        );
+        assert_eq!(
+            batch.set_tensor(0, &b).err(),
+            Some("the Mandel representation of the Tensor2 is incompatible")
+        );
+        assert_eq!(
+            batch.get_tensor(&mut b, 0).err(),
+            Some("the Mandel representation of the Tensor2 is incompatible")
+        );
+        let mut wrong = vec![0.0; 3];
+        assert_eq!(
+            batch.trace(&mut wrong).err(),
+            Some("the output array must have length equal to npoint")
+        );
+        assert_eq!(
+            batch.norm(&mut wrong).err(),
+            Some("the output array must have length equal to npoint")
+        );
+    }
+
+    #[test]
+    fn set_get_trace_and_norm_work() {
+        let a = Tensor2::from_matrix(&SamplesTensor2::TENSOR_R.matrix, Mandel::General).unwrap();
+        let b = Tensor2::from_matrix(&SamplesTensor2::TENSOR_T.matrix, Mandel::General).unwrap();
+        let mut batch = Tensor2Batch::new(Mandel::General, 3);
+        batch.set_tensor(0, &a).unwrap();
+        batch.set_tensor(2, &b).unwrap();
+        let mut c = Tensor2::new(Mandel::General);
+        batch.get_tensor(&mut c, 2).unwrap();
+        assert_eq!(c.vec.as_data(), b.vec.as_data());
+        batch.get_tensor(&mut c, 1).unwrap();
+        assert_eq!(c.vec.as_data(), &[0.0; 9]);
+        let mut tr = vec![0.0; 3];
+        let mut norm = vec![0.0; 3];
+        batch.trace(&mut tr).unwrap();
+        batch.norm(&mut norm).unwrap();
+        array_approx_eq(&tr, &[a.trace(), 0.0, b.trace()], 1e-15);
+        array_approx_eq(&norm, &[a.norm(), 0.0, b.norm()], 1e-14);
+    }
+}
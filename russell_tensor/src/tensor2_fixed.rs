@@ -0,0 +1,310 @@
+use crate::{Mandel, StrError, Tensor2};
+use crate::{IJ_TO_M, IJ_TO_M_SYM, SQRT_2};
+
+/// Implements a stack-allocated second-order tensor with the Mandel dimension known at compile time
+///
+/// The components are stored in the Mandel basis exactly as in [Tensor2]; however, they are held
+/// by a fixed-size array instead of a heap-allocated vector. Thus, the creation of temporaries
+/// does not allocate memory and the loops in the operations (e.g., [crate::t4_ddot_t2_fixed()])
+/// have compile-time bounds.
+///
+/// The const parameter `M` is the dimension of the Mandel vector:
+///
+/// * `M = 9` -- General (see [Tensor2Gen])
+/// * `M = 6` -- Symmetric in 3D (see [Tensor2Sym])
+/// * `M = 4` -- Symmetric in 2D (see [Tensor2Sym2D])
+///
+/// Any other value of `M` results in a compile-time error.
+///
+/// # Notes
+///
+/// * You may perform operations on `vec` directly because it is isomorphic with the tensor itself
+/// * Use [Tensor2Fixed::from_tensor2()] and [Tensor2Fixed::to_tensor2()] to convert from/to [Tensor2]
+///
+/// # Examples
+///
+/// ```
+/// use russell_lab::approx_eq;
+/// use russell_tensor::{Mandel, Tensor2, Tensor2Sym, StrError};
+///
+/// fn main() -> Result<(), StrError> {
+///     let a = Tensor2::from_matrix(&[
+///         [1.0, 4.0, 0.0],
+///         [4.0, 2.0, 0.0],
+///         [0.0, 0.0, 3.0],
+///     ], Mandel::Symmetric)?;
+///
+///     let b = Tensor2Sym::from_tensor2(&a)?;
+///     assert_eq!(b.mandel(), Mandel::Symmetric);
+///     approx_eq(b.get(0, 1), 4.0, 1e-15);
+///     approx_eq(b.trace(), 6.0, 1e-15);
+///     Ok(())
+/// }
+/// ```
+#[derive(Clone, Copy, Debug, PartialEq)]
+pub struct Tensor2Fixed<const M: usize> {
+    /// Holds the components in Mandel basis
+    pub vec: [f64; M],
+}
+
+/// Defines a stack-allocated General Tensor2 (9D Mandel vector)
+pub type Tensor2Gen = Tensor2Fixed<9>;
+
+/// Defines a stack-allocated Symmetric Tensor2 in 3D (6D Mandel vector)
+pub type Tensor2Sym = Tensor2Fixed<6>;
+
+/// Defines a stack-allocated Symmetric Tensor2 in 2D (4D Mandel vector)
+pub type Tensor2Sym2D = Tensor2Fixed<4>;
+
+impl<const M: usize> Tensor2Fixed<M> {
+    /// Checks (at compile time) the dimension of the Mandel vector
+    const VALID_DIM: () = assert!(M == 4 || M == 6 || M == 9, "the Mandel dimension must be 4, 6, or 9");
+
+    /// Creates a new (zeroed) tensor
+    #[inline]
+    pub fn new() -> Self {
+        let () = Self::VALID_DIM;
+        Tensor2Fixed { vec: [0.0; M] }
+    }
+
+    /// Creates a new identity tensor
+    #[inline]
+    pub fn identity() -> Self {
+        let mut res = Self::new();
+        res.vec[0] = 1.0;
+        res.vec[1] = 1.0;
+        res.vec[2] = 1.0;
+        res
+    }
+
+    /// Creates a new tensor from a (heap-allocated) Tensor2
+    ///
+    /// Returns an error if the Mandel representation of `other` does not correspond to `M`
+    pub fn from_tensor2(other: &Tensor2) -> Result<Self, StrError> {
+        if other.vec.dim() != M {
+            return Err("the Mandel dimension of the Tensor2 is incompatible");
+        }
+        let mut res = Self::new();
+        res.vec.copy_from_slice(other.vec.as_data());
+        Ok(res)
+    }
+
+    /// Returns a new (heap-allocated) Tensor2 with the same components
+    pub fn to_tensor2(&self) -> Tensor2 {
+        let mut res = Tensor2::new(self.mandel());
+        res.vec.as_mut_data().copy_from_slice(&self.vec);
+        res
+    }
+
+    /// Returns the Mandel representation associated with this tensor
+    #[inline]
+    pub fn mandel(&self) -> Mandel {
+        Mandel::new(M)
+    }
+
+    /// Returns the (i,j) component (standard; not Mandel)
+    pub fn get(&self, i: usize, j: usize) -> f64 {
+        match M {
+            4 => {
+                let m = IJ_TO_M_SYM[i][j];
+                if m > 3 {
+                    0.0
+                } else if i == j {
+                    self.vec[m]
+                } else {
+                    self.vec[m] / SQRT_2
+                }
+            }
+            6 => {
+                let m = IJ_TO_M_SYM[i][j];
+                if i == j {
+                    self.vec[m]
+                } else {
+                    self.vec[m] / SQRT_2
+                }
+            }
+            _ => {
+                let m = IJ_TO_M[i][j];
+                if i == j {
+                    self.vec[m]
+                } else if i < j {
+                    let n = IJ_TO_M[j][i];
+                    (self.vec[m] + self.vec[n]) / SQRT_2
+                } else {
+                    let n = IJ_TO_M[j][i];
+                    (self.vec[n] - self.vec[m]) / SQRT_2
+                }
+            }
+        }
+    }
+
+    /// Sets the (i,j) component of a symmetric tensor
+    ///
+    /// **Note:** Only the diagonal and upper-diagonal components need to be set.
+    ///
+    /// # Panics
+    ///
+    /// The tensor must be symmetric and (i,j) must correspond to the possible
+    /// combination due to the space dimension, otherwise a panic may occur.
+    pub fn sym_set(&mut self, i: usize, j: usize, value: f64) {
+        assert!(M != 9);
+        let m = IJ_TO_M_SYM[i][j];
+        if i == j {
+            self.vec[m] = value;
+        } else {
+            self.vec[m] = value * SQRT_2;
+        }
+    }
+
+    /// Set all values to zero
+    #[inline]
+    pub fn clear(&mut self) {
+        self.vec = [0.0; M];
+    }
+
+    /// Adds another tensor to this one
+    ///
+    /// ```text
+    /// self += α other
+    /// ```
+    #[inline]
+    pub fn add(&mut self, alpha: f64, other: &Self) {
+        for m in 0..M {
+            self.vec[m] += alpha * other.vec[m];
+        }
+    }
+
+    /// Calculates the trace
+    #[inline]
+    pub fn trace(&self) -> f64 {
+        self.vec[0] + self.vec[1] + self.vec[2]
+    }
+
+    /// Calculates the Euclidean norm
+    ///
+    /// ```text
+    /// norm(σ) = √(σ:σ)
+    /// ```
+    #[inline]
+    pub fn norm(&self) -> f64 {
+        let mut sm = 0.0;
+        for m in 0..M {
+            sm += self.vec[m] * self.vec[m];
+        }
+        f64::sqrt(sm)
+    }
+
+    /// Returns the deviator tensor
+    ///
+    /// ```text
+    /// dev(σ) = σ - ⅓ tr(σ) I
+    /// ```
+    #[inline]
+    pub fn deviator(&self) -> Self {
+        let m = self.trace() / 3.0;
+        let mut dev = *self;
+        dev.vec[0] -= m;
+        dev.vec[1] -= m;
+        dev.vec[2] -= m;
+        dev
+    }
+
+    /// Calculates the norm of the deviator tensor
+    ///
+    /// ```text
+    /// norm(dev(σ)) = ‖s‖ = ‖ σ - ⅓ tr(σ) I ‖
+    /// ```
+    #[inline]
+    pub fn deviator_norm(&self) -> f64 {
+        self.deviator().norm()
+    }
+}
+
+impl<const M: usize> Default for Tensor2Fixed<M> {
+    fn default() -> Self {
+        Self::new()
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#[cfg(test)]
+mod tests {
+    use super::{Tensor2Gen, Tensor2Sym, Tensor2Sym2D};
+    use crate::{Mandel, SamplesTensor2, Tensor2, SQRT_2};
+    use russell_lab::{approx_eq, array_approx_eq};
+
+    #[test]
+    fn new_and_identity_work() {
+        let a = Tensor2Gen::new();
+        assert_eq!(a.vec, [0.0; 9]);
+        assert_eq!(a.mandel(), Mandel::General);
+        let b = Tensor2Sym::default();
+        assert_eq!(b.vec, [0.0; 6]);
+        assert_eq!(b.mandel(), Mandel::Symmetric);
+        let c = Tensor2Sym2D::identity();
+        assert_eq!(c.vec, [1.0, 1.0, 1.0, 0.0]);
+        assert_eq!(c.mandel(), Mandel::Symmetric2D);
+    }
+
+    #[test]
+    fn from_tensor2_captures_errors() {
+        let a = Tensor2::new(Mandel::Symmetric);
+        assert_eq!(
+            Tensor2Gen::from_tensor2(&a).err(),
+            Some("the Mandel dimension of the Tensor2 is incompatible")
+        );
+    }
+
+    #[test]
+    fn conversion_and_get_work() {
+        let a = Tensor2::from_matrix(&SamplesTensor2::TENSOR_T.matrix, Mandel::General).unwrap();
+        let b = Tensor2Gen::from_tensor2(&a).unwrap();
+        let c = Tensor2::from_matrix(&SamplesTensor2::TENSOR_S.matrix, Mandel::Symmetric).unwrap();
+        let d = Tensor2Sym::from_tensor2(&c).unwrap();
+        let e = Tensor2::from_matrix(&SamplesTensor2::TENSOR_X.matrix, Mandel::Symmetric2D).unwrap();
+        let f = Tensor2Sym2D::from_tensor2(&e).unwrap();
+        for i in 0..3 {
+            for j in 0..3 {
+                approx_eq(b.get(i, j), a.get(i, j), 1e-15);
+                approx_eq(d.get(i, j), c.get(i, j), 1e-15);
+                approx_eq(f.get(i, j), e.get(i, j), 1e-15);
+            }
+        }
+        array_approx_eq(b.to_tensor2().vec.as_data(), a.vec.as_data(), 1e-15);
+        array_approx_eq(d.to_tensor2().vec.as_data(), c.vec.as_data(), 1e-15);
+        array_approx_eq(f.to_tensor2().vec.as_data(), e.vec.as_data(), 1e-15);
+    }
+
+    #[test]
+    fn sym_set_clear_and_add_work() {
+        let mut a = Tensor2Sym::new();
+        a.sym_set(0, 0, 1.0);
+        a.sym_set(1, 1, 2.0);
+        a.sym_set(2, 2, 3.0);
+        a.sym_set(0, 1, 4.0);
+        a.sym_set(1, 2, 5.0);
+        a.sym_set(0, 2, 6.0);
+        approx_eq(a.get(1, 0), 4.0, 1e-15);
+        approx_eq(a.get(2, 1), 5.0, 1e-15);
+        approx_eq(a.get(2, 0), 6.0, 1e-15);
+        let mut b = Tensor2Sym::identity();
+        b.add(2.0, &a);
+        let correct = [3.0, 5.0, 7.0, 8.0 * SQRT_2, 10.0 * SQRT_2, 12.0 * SQRT_2];
+        array_approx_eq(&b.vec, &correct, 1e-14);
+        b.clear();
+        assert_eq!(b.vec, [0.0; 6]);
+    }
+
+    #[test]
+    fn trace_norm_and_deviator_work() {
+        let a = Tensor2::from_matrix(&SamplesTensor2::TENSOR_T.matrix, Mandel::General).unwrap();
+        let b = Tensor2Gen::from_tensor2(&a).unwrap();
+        approx_eq(b.trace(), a.trace(), 1e-15);
+        approx_eq(b.norm(), a.norm(), 1e-15);
+        approx_eq(b.deviator_norm(), a.deviator_norm(), 1e-15);
+        let mut dev = Tensor2::new(Mandel::General);
+        a.deviator(&mut dev).unwrap();
+        array_approx_eq(&b.deviator().vec, dev.vec.as_data(), 1e-15);
+    }
+}
@@ -0,0 +1,171 @@
+use crate::{Mandel, StrError, Tensor4};
+
+/// Implements a stack-allocated fourth-order tensor with the Mandel dimension known at compile time
+///
+/// The components are stored in the Mandel basis exactly as in [Tensor4]; however, they are held
+/// by a fixed-size (row-major) nested array instead of a heap-allocated matrix. Thus, the creation
+/// of temporaries does not allocate memory and the loops in the operations (e.g., [crate::t4_ddot_t2_fixed()])
+/// have compile-time bounds.
+///
+/// The const parameter `M` is the dimension of the Mandel matrix (M×M):
+///
+/// * `M = 9` -- General (see [Tensor4Gen])
+/// * `M = 6` -- Minor-symmetric in 3D (see [Tensor4Sym])
+/// * `M = 4` -- Minor-symmetric in 2D (see [Tensor4Sym2D])
+///
+/// Any other value of `M` results in a compile-time error.
+///
+/// # Notes
+///
+/// * You may perform operations on `mat` directly because it is isomorphic with the tensor itself
+/// * Use [Tensor4Fixed::from_tensor4()] and [Tensor4Fixed::to_tensor4()] to convert from/to [Tensor4]
+///
+/// # Examples
+///
+/// ```
+/// use russell_tensor::{Mandel, Tensor4, Tensor4Sym};
+///
+/// fn main() {
+///     let pp = Tensor4::constant_pp_symdev(true);
+///     let dd = Tensor4Sym::from_tensor4(&pp).unwrap();
+///     assert_eq!(dd.mandel(), Mandel::Symmetric);
+///     assert_eq!(dd.mat[0][0], 2.0 / 3.0);
+///     assert_eq!(dd.to_tensor4().mat.as_data(), pp.mat.as_data());
+/// }
+/// ```
+#[derive(Clone, Copy, Debug, PartialEq)]
+pub struct Tensor4Fixed<const M: usize> {
+    /// Holds the components in Mandel basis as a row-major (M,M) nested array
+    pub mat: [[f64; M]; M],
+}
+
+/// Defines a stack-allocated General Tensor4 (9×9 Mandel matrix)
+pub type Tensor4Gen = Tensor4Fixed<9>;
+
+/// Defines a stack-allocated minor-symmetric Tensor4 in 3D (6×6 Mandel matrix)
+pub type Tensor4Sym = Tensor4Fixed<6>;
+
+/// Defines a stack-allocated minor-symmetric Tensor4 in 2D (4×4 Mandel matrix)
+pub type Tensor4Sym2D = Tensor4Fixed<4>;
+
+impl<const M: usize> Tensor4Fixed<M> {
+    /// Checks (at compile time) the dimension of the Mandel matrix
+    const VALID_DIM: () = assert!(M == 4 || M == 6 || M == 9, "the Mandel dimension must be 4, 6, or 9");
+
+    /// Creates a new (zeroed) tensor
+    #[inline]
+    pub fn new() -> Self {
+        let () = Self::VALID_DIM;
+        Tensor4Fixed { mat: [[0.0; M]; M] }
+    }
+
+    /// Creates a new tensor from a (heap-allocated) Tensor4
+    ///
+    /// Returns an error if the Mandel representation of `other` does not correspond to `M`
+    pub fn from_tensor4(other: &Tensor4) -> Result<Self, StrError> {
+        if other.mat.nrow() != M {
+            return Err("the Mandel dimension of the Tensor4 is incompatible");
+        }
+        let mut res = Self::new();
+        for m in 0..M {
+            for n in 0..M {
+                res.mat[m][n] = other.mat.get(m, n);
+            }
+        }
+        Ok(res)
+    }
+
+    /// Returns a new (heap-allocated) Tensor4 with the same components
+    pub fn to_tensor4(&self) -> Tensor4 {
+        let mut res = Tensor4::new(self.mandel());
+        for m in 0..M {
+            for n in 0..M {
+                res.mat.set(m, n, self.mat[m][n]);
+            }
+        }
+        res
+    }
+
+    /// Returns the Mandel representation associated with this tensor
+    #[inline]
+    pub fn mandel(&self) -> Mandel {
+        Mandel::new(M)
+    }
+
+    /// Set all values to zero
+    #[inline]
+    pub fn clear(&mut self) {
+        self.mat = [[0.0; M]; M];
+    }
+
+    /// Adds another tensor to this one
+    ///
+    /// ```text
+    /// self += α other
+    /// ```
+    #[inline]
+    pub fn add(&mut self, alpha: f64, other: &Self) {
+        for m in 0..M {
+            for n in 0..M {
+                self.mat[m][n] += alpha * other.mat[m][n];
+            }
+        }
+    }
+}
+
+impl<const M: usize> Default for Tensor4Fixed<M> {
+    fn default() -> Self {
+        Self::new()
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#[cfg(test)]
+mod tests {
+    use super::{Tensor4Gen, Tensor4Sym, Tensor4Sym2D};
+    use crate::{Mandel, SamplesTensor4, Tensor4};
+
+    #[test]
+    fn new_works() {
+        let a = Tensor4Gen::new();
+        assert_eq!(a.mat, [[0.0; 9]; 9]);
+        assert_eq!(a.mandel(), Mandel::General);
+        let b = Tensor4Sym::default();
+        assert_eq!(b.mat, [[0.0; 6]; 6]);
+        assert_eq!(b.mandel(), Mandel::Symmetric);
+        let c = Tensor4Sym2D::new();
+        assert_eq!(c.mat, [[0.0; 4]; 4]);
+        assert_eq!(c.mandel(), Mandel::Symmetric2D);
+    }
+
+    #[test]
+    fn from_tensor4_captures_errors() {
+        let a = Tensor4::new(Mandel::Symmetric);
+        assert_eq!(
+            Tensor4Gen::from_tensor4(&a).err(),
+            Some("the Mandel dimension of the Tensor4 is incompatible")
+        );
+    }
+
+    #[test]
+    fn conversion_clear_and_add_work() {
+        let a = Tensor4::from_matrix(&SamplesTensor4::SAMPLE1_STD_MATRIX, Mandel::General).unwrap();
+        let mut b = Tensor4Gen::from_tensor4(&a).unwrap();
+        for m in 0..9 {
+            for n in 0..9 {
+                assert_eq!(b.mat[m][n], SamplesTensor4::SAMPLE1_MANDEL_MATRIX[m][n]);
+            }
+        }
+        assert_eq!(b.to_tensor4().mat.as_data(), a.mat.as_data());
+        let c = b;
+        b.add(-1.0, &c);
+        assert_eq!(b.mat, [[0.0; 9]; 9]);
+
+        let a = Tensor4::from_matrix(&SamplesTensor4::SYM_2D_SAMPLE1_STD_MATRIX, Mandel::Symmetric2D).unwrap();
+        let mut b = Tensor4Sym2D::from_tensor4(&a).unwrap();
+        assert_eq!(b.mat, SamplesTensor4::SYM_2D_SAMPLE1_MANDEL_MATRIX);
+        b.clear();
+        assert_eq!(b.mat, [[0.0; 4]; 4]);
+    }
+}
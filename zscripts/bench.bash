@@ -1,8 +1,58 @@
 #!/bin/bash
 
-echo "Install:"
-echo
-echo "cargo install cargo-criterion"
-echo
+set -e
 
-cargo criterion
+# Runs the criterion benchmarks and, optionally, saves or compares against a baseline
+#
+# Usage:
+#
+#     bash zscripts/bench.bash [save|compare|run] [BASELINE] [PACKAGE] [FEATURES]
+#
+# Examples:
+#
+#     bash zscripts/bench.bash save main                         # all packages; saves the "main" baseline
+#     bash zscripts/bench.bash compare main russell_sparse       # compares russell_sparse against "main"
+#     bash zscripts/bench.bash run "" russell_sparse with_mumps  # includes the MUMPS solver
+#
+# Additional Matrix Market files may be given to the russell_sparse benchmarks as follows:
+#
+#     RUSSELL_SPARSE_BENCH_MM=bfwb62.mtx:pre2.mtx bash zscripts/bench.bash run "" russell_sparse
+#
+# The results (and baselines) are saved in target/criterion (see target/criterion/report/index.html)
+
+MODE=${1:-"run"}
+BASELINE=${2:-"main"}
+PACKAGE=${3:-""}
+FEATURES=${4:-""}
+
+PACKAGES="russell_lab russell_sparse russell_ode"
+if [ "$PACKAGE" != "" ]; then
+    PACKAGES="$PACKAGE"
+fi
+
+case "$MODE" in
+    save)
+        CRITERION_ARGS="--save-baseline $BASELINE"
+        ;;
+    compare)
+        CRITERION_ARGS="--baseline $BASELINE"
+        ;;
+    run)
+        CRITERION_ARGS=""
+        ;;
+    *)
+        echo "unknown mode: $MODE (options: save, compare, run)"
+        exit 1
+        ;;
+esac
+
+for pkg in $PACKAGES; do
+    echo
+    echo "### benchmarking $pkg ###"
+    echo
+    if [ "$FEATURES" != "" ] && [ "$pkg" != "russell_lab" ]; then
+        cargo bench -p $pkg --features "$FEATURES" -- $CRITERION_ARGS
+    else
+        cargo bench -p $pkg -- $CRITERION_ARGS
+    fi
+done
@@ -8,14 +8,25 @@ sudo () {
   "$@"
 }
 
-# the first argument is the "mkl" option
+# the first argument is the "mkl" or "mpi" option
 BLAS_LIB=${1:-""}
 
+# the "mpi" option compiles the distributed-memory (MPI) version with OpenBLAS
+WITH_MPI=""
+if [ "${BLAS_LIB}" = "mpi" ]; then
+    WITH_MPI="mpi"
+    BLAS_LIB=""
+fi
+
 # options
 VERSION="5.6.2"
 PREFIX="/usr/local"
 INCDIR=$PREFIX/include/mumps
 LIBDIR=$PREFIX/lib/mumps
+if [ "${WITH_MPI}" = "mpi" ]; then
+    INCDIR=$PREFIX/include/mumps_mpi
+    LIBDIR=$PREFIX/lib/mumps_mpi
+fi
 PDIR=`pwd`/zscripts/makefiles-mumps
 
 # install dependencies
@@ -34,6 +45,13 @@ else
         liblapacke-dev \
         libopenblas-dev
 fi
+if [ "${WITH_MPI}" = "mpi" ]; then
+    sudo apt-get install -y --no-install-recommends \
+        libopenmpi-dev \
+        libparmetis-dev \
+        libptscotch-dev \
+        libscalapack-openmpi-dev
+fi
 
 # source Intel oneAPI vars (ifort)
 if [ "${BLAS_LIB}" = "mkl" ]; then
@@ -61,6 +79,8 @@ cd $MUMPS_DIR
 # copy inc file
 if [ "${BLAS_LIB}" = "mkl" ]; then
     cp $PDIR/MakefileMKL.inc Makefile.inc
+elif [ "${WITH_MPI}" = "mpi" ]; then
+    cp $PDIR/MakefileMPI.inc Makefile.inc
 else
     cp $PDIR/Makefile.inc Makefile.inc
 fi
@@ -92,5 +112,9 @@ sudo mkdir -p $INCDIR/
 sudo cp -av include/*.h $INCDIR/
 
 # update ldconfig
-echo "${LIBDIR}" | sudo tee /etc/ld.so.conf.d/mumps.conf >/dev/null
+if [ "${WITH_MPI}" = "mpi" ]; then
+    echo "${LIBDIR}" | sudo tee /etc/ld.so.conf.d/mumps_mpi.conf >/dev/null
+else
+    echo "${LIBDIR}" | sudo tee /etc/ld.so.conf.d/mumps.conf >/dev/null
+fi
 sudo ldconfig
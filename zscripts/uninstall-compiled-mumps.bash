@@ -13,6 +13,15 @@ then
     echo "sudo rm -f /etc/ld.so.conf.d/mumps.conf"
     sudo rm -f /etc/ld.so.conf.d/mumps.conf
 
+    echo "sudo rm -rf /usr/local/include/mumps_mpi"
+    sudo rm -rf /usr/local/include/mumps_mpi
+
+    echo "sudo rm -rf /usr/local/lib/mumps_mpi"
+    sudo rm -rf /usr/local/lib/mumps_mpi
+
+    echo "sudo rm -f /etc/ld.so.conf.d/mumps_mpi.conf"
+    sudo rm -f /etc/ld.so.conf.d/mumps_mpi.conf
+
     echo "sudo ldconfig"
     sudo ldconfig
 